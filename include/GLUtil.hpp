@@ -31,7 +31,8 @@ public:
     /// Create an unitialized OpenGL shader
     GLShader()
         : mVertexShader(0), mFragmentShader(0), mGeometryShader(0),
-          mProgramShader(0), mVertexArrayObject(0) { }
+          mProgramShader(0), mVertexArrayObject(0), mFeatures(0), mVariantFeatures(0),
+          mGeometryFeatures(~0u), mVariant(nullptr), mSerial(0) { }
 
     /// Initialize the shader using the specified source strings
     bool init(const std::string &name, const std::string &vertex_str,
@@ -50,9 +51,50 @@ public:
     /// Set a preprocessor definition
     void define(const std::string &key, const std::string &value) { mDefinitions[key] = value; }
 
-    /// Select this shader for subsequent draw calls
+    /**
+     * Declare the preprocessor symbols which make up the variant feature bitmask,
+     * bit i of the mask defines names[i]. Must be called before init()
+     */
+    void declareFeatures(const std::vector<std::string> &names);
+
+    /// Enable or disable feature bits, the matching variant is selected on the next bind()
+    void setFeature(uint32_t feature, bool enabled) {
+        mFeatures = enabled ? (mFeatures | feature) : (mFeatures & ~feature);
+    }
+
+    /// Replace the whole feature bitmask, the matching variant is selected on the next bind()
+    void setFeatures(uint32_t features) { mFeatures = features; }
+
+    /// Only variants with one of these features use the geometry shader, all do by default. Must be called before init()
+    void setGeometryFeatures(uint32_t features) { mGeometryFeatures = features; }
+
+    /// Currently requested feature bitmask
+    uint32_t features() const { return mFeatures; }
+
+    /// Number of variants compiled so far
+    size_t variantCount() const { return mVariants.size(); }
+
+    /// Use a fixed location for an attribute in all variants. Must be called before init()
+    void bindAttribLocation(const std::string &name, GLint location) { mAttribBindings[name] = location; }
+
+    /// Select this shader (compiling the requested variant on first use) for subsequent draw calls, free if it is in use already
     void bind();
 
+    /// Unbind any program, e.g. before third party code changes the GL state
+    static void unbind();
+
+    /// Number and duration (in ms) of programs linked from source or loaded from the binary cache
+    struct CompileStats {
+        uint32_t compiled = 0, cached = 0;
+        double compileTime = 0.0, cacheTime = 0.0;
+
+        /// One line summary, e.g. for the viewer info
+        std::string toString() const;
+    };
+
+    /// Statistics of all shaders created so far
+    static const CompileStats &compileStats() { return sStats; }
+
     /// Release underlying OpenGL objects
     void free();
 
@@ -132,37 +174,42 @@ public:
 
     /// Initialize a uniform parameter with a 4x4 matrix
     void setUniform(const std::string &name, const Matrix4f &mat, bool warn = true) {
-        glUniformMatrix4fv(uniform(name, warn), 1, GL_FALSE, mat.data());
+        setUniformValue(name, GL_FLOAT_MAT4, mat.data(), sizeof(float) * 16, 1, warn);
     }
 
     /// Initialize a uniform parameter with a 3x3 matrix
     void setUniform(const std::string &name, const Matrix3f &mat, bool warn = true) {
-        glUniformMatrix3fv(uniform(name, warn), 1, GL_FALSE, mat.data());
+        setUniformValue(name, GL_FLOAT_MAT3, mat.data(), sizeof(float) * 9, 1, warn);
     }
 
     /// Initialize a uniform parameter with an integer value
     void setUniform(const std::string &name, int value, bool warn = true) {
-        glUniform1i(uniform(name, warn), value);
+        setUniformValue(name, GL_INT, &value, sizeof(int), 1, warn);
     }
 
     /// Initialize a uniform parameter with a float value
     void setUniform(const std::string &name, float value, bool warn = true) {
-        glUniform1f(uniform(name, warn), value);
+        setUniformValue(name, GL_FLOAT, &value, sizeof(float), 1, warn);
     }
 
     /// Initialize a uniform parameter with a 2D vector
     void setUniform(const std::string &name, const Vector2f &v, bool warn = true) {
-        glUniform2f(uniform(name, warn), v.x(), v.y());
+        setUniformValue(name, GL_FLOAT_VEC2, v.data(), sizeof(float) * 2, 1, warn);
     }
 
     /// Initialize a uniform parameter with a 3D vector
     void setUniform(const std::string &name, const Vector3f &v, bool warn = true) {
-        glUniform3f(uniform(name, warn), v.x(), v.y(), v.z());
+        setUniformValue(name, GL_FLOAT_VEC3, v.data(), sizeof(float) * 3, 1, warn);
+    }
+
+    /// Initialize a uniform array of 3D vectors
+    void setUniform(const std::string &name, const Vector3f *v, int count, bool warn = true) {
+        setUniformValue(name, GL_FLOAT_VEC3, v, sizeof(float) * 3 * count, count, warn);
     }
 
     /// Initialize a uniform parameter with a 4D vector
     void setUniform(const std::string &name, const Vector4f &v, bool warn = true) {
-        glUniform4f(uniform(name, warn), v.x(), v.y(), v.z(), v.w());
+        setUniformValue(name, GL_FLOAT_VEC4, v.data(), sizeof(float) * 4, 1, warn);
     }
 
     /// Return the size of all registered buffers in bytes
@@ -177,6 +224,39 @@ public:
 	GLuint getId() { return mProgramShader; }
 
 protected:
+    struct Variant;
+
+    /// Make the variant for the given features current, compiles it on first use
+    bool selectVariant(uint32_t features);
+
+    /// Compile and link the program for a feature bitmask
+    bool compileVariant(uint32_t features, Variant &variant);
+
+    /// Whether a name appears as a whole word in one of the sources, i.e. in at least one variant
+    bool inSources(const std::string &name) const;
+
+    /// Load a program from the binary cache, false if missing, stale or rejected by the driver
+    bool loadProgramBinary(uint64_t key, Variant &variant);
+
+    /// Write the binary of a freshly linked program to the cache
+    void storeProgramBinary(uint64_t key, const Variant &variant);
+
+    /// Driver vendor, renderer and version, binaries are only valid for the exact same driver
+    static std::string driverString();
+
+    /// Whether the context can retrieve program binaries and a cache directory is set
+    static bool binaryCacheSupported();
+
+    /// Cache file name for a given key
+    static std::string binaryCacheFile(uint64_t key);
+
+    /// Record a uniform value and upload it if this program is in use
+    void setUniformValue(const std::string &name, GLenum type, const void *data,
+                         size_t size, GLsizei count, bool warn);
+
+    /// Upload a recorded uniform value to the current variant
+    void uploadUniform(size_t index, bool warn);
+
     void uploadAttrib(const std::string &name, uint32_t size, int dim,
                        uint32_t compSize, GLuint glType, bool integral,
                        const uint8_t *data, int version = -1);
@@ -191,6 +271,21 @@ protected:
         GLuint size;
         int version;
     };
+    struct UniformValue {
+        std::string name;
+        GLenum type;
+        GLsizei count;
+        uint32_t serial;
+        std::vector<uint8_t> data;
+        bool checked; ///< Missing location already looked into, warnings are given once
+    };
+    struct Variant {
+        GLuint program = 0, vertexShader = 0, fragmentShader = 0, geometryShader = 0;
+        std::vector<GLint> locations; ///< Cached uniform locations, indexed like mUniforms
+        std::vector<uint32_t> synced; ///< Serial of the last uploaded value per uniform
+    };
+    enum { UNKNOWN_LOCATION = -2 };
+
     std::string mName;
     GLuint mVertexShader;
     GLuint mFragmentShader;
@@ -199,6 +294,18 @@ protected:
     GLuint mVertexArrayObject;
     std::map<std::string, Buffer> mBufferObjects;
     std::map<std::string, std::string> mDefinitions;
+    std::string mVertexSource, mFragmentSource, mGeometrySource;
+    std::vector<std::string> mFeatureNames;
+    std::map<std::string, GLint> mAttribBindings;
+    uint32_t mFeatures, mVariantFeatures;
+    uint32_t mGeometryFeatures;
+    std::map<uint32_t, Variant> mVariants;
+    Variant *mVariant;
+    std::vector<UniformValue> mUniforms;
+    std::map<std::string, size_t> mUniformIndices;
+    uint32_t mSerial;
+    static GLuint sCurrentProgram;
+    static CompileStats sStats;
 };
 
 /// Helper class for creating framebuffer objects
@@ -298,6 +405,77 @@ protected:
     bool useTexture;
 };
 
+/**
+ * @brief Streaming vertex buffer for all per-frame dynamic geometry
+ *
+ * One buffer object split into three frame segments. Each segment is protected
+ * by a fence, such that the CPU never writes into memory the GPU still reads from.
+ * If GL_ARB_buffer_storage is available the buffer is persistently mapped, otherwise
+ * every write maps the range unsynchronized and the buffer is orphaned on overflow.
+ */
+class GLStreamBuffer {
+public:
+
+	/**
+	 * @brief Singleton, shared by all meshes using the current context
+	 */
+	static GLStreamBuffer &getInstance() {
+		static GLStreamBuffer instance;
+		return instance;
+	}
+
+	/// Allocate the ring with the given size in bytes per frame segment
+	void init(GLsizeiptr segmentSize);
+
+	/// Release underlying OpenGL objects
+	void free();
+
+	/// Start a new frame, waits until the GPU released the next segment
+	void beginFrame();
+
+	/// Fence the segment written during the current frame
+	void endFrame();
+
+	/// Copy data into the current segment and return its byte offset inside the buffer object
+	GLintptr write(const void *data, GLsizeiptr size, GLsizeiptr alignment = 16);
+
+	/// OpenGL buffer id
+	GLuint getId() const { return mBuffer; }
+
+	/// Whether the buffer is persistently mapped
+	bool isPersistent() const { return mMapped != nullptr; }
+
+	/// Number of bytes streamed during the last completed frame
+	size_t bytesStreamed() const { return mLastFrameBytes; }
+
+protected:
+
+	GLStreamBuffer()
+		: mBuffer(0), mSegmentSize(0), mSegment(0), mHead(0), mMapped(nullptr)
+		, mFrameBytes(0), mLastFrameBytes(0) {
+		for (int i = 0; i < Segments; i++)
+			mFences[i] = 0;
+	}
+
+	GLStreamBuffer(GLStreamBuffer const&) = delete;
+	void operator=(GLStreamBuffer const&) = delete;
+
+	/// (Re-)create the buffer object
+	void allocate(GLsizeiptr segmentSize);
+
+protected:
+
+	static const int Segments = 3; ///< Frames in flight
+	GLuint mBuffer; ///< Buffer object
+	GLsizeiptr mSegmentSize; ///< Size of one frame segment in bytes
+	int mSegment; ///< Segment written during the current frame
+	GLsizeiptr mHead; ///< Write position inside the current segment
+	uint8_t *mMapped; ///< Persistent mapping or nullptr
+	GLsync mFences[Segments]; ///< One fence per segment
+	size_t mFrameBytes; ///< Bytes written during the current frame
+	size_t mLastFrameBytes; ///< Bytes written during the last frame
+};
+
 /// Arcball helper class to interactively rotate objects on-screen
 struct Arcball {
     Arcball(float speedFactor = 2.0f)
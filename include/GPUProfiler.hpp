@@ -0,0 +1,177 @@
+#pragma once
+
+#include "common.hpp"
+#include <map>
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief GPU frame profiler based on timer queries
+ *
+ * Each render pass is wrapped in a GL_TIME_ELAPSED query, the whole
+ * frame in a pair of GL_TIMESTAMP queries. Results are read back
+ * Latency frames later, such that the CPU never waits for the GPU.
+ * Passes executed several times per frame (e.g. once per eye) are summed.
+ * Besides timings, CPU side counters can be recorded as percentages and
+ * latencies measured on the CPU in milliseconds.
+ */
+class GPUProfiler {
+public:
+
+	/**
+	 * @brief Rolling statistics of one pass in milliseconds
+	 */
+	struct Stats {
+		std::string name;
+		float last = 0.f, min = 0.f, avg = 0.f, p99 = 0.f;
+		size_t samples = 0;
+	};
+
+	/**
+	 * @brief Times the GPU work issued during the lifetime of this object
+	 */
+	class Scope {
+	public:
+		Scope(const std::string &pass) { GPUProfiler::getInstance().begin(pass); }
+		~Scope() { GPUProfiler::getInstance().end(); }
+	};
+
+	/**
+	 * @brief Singleton, shared by all renderers using the current context
+	 */
+	static GPUProfiler &getInstance() {
+		static GPUProfiler instance;
+		return instance;
+	}
+
+	/// Allocate query objects
+	void init();
+
+	/// Release query objects
+	void free();
+
+	/// Start a new frame, collects the results of the frame issued Latency frames ago
+	void beginFrame();
+
+	/// Close the current frame
+	void endFrame();
+
+	/// Read back all frames still in flight, call after glFinish()
+	void flush();
+
+	/// Drop all samples, e.g. after warm-up frames
+	void reset();
+
+	/// Start timing a named pass. Passes can not be nested
+	void begin(const std::string &pass);
+
+	/// Stop timing the current pass
+	void end();
+
+	/// Statistics of the whole frame followed by all passes, in order of first appearance
+	std::vector<Stats> stats() const;
+
+	/**
+	 * @brief Adds part of total to a counter of the current frame, e.g. culled of all triangles
+	 *
+	 * All calls of a frame are summed, the frame sample is the percentage of
+	 * the sums.
+	 */
+	void count(const std::string &counter, double part, double total);
+
+	/// Statistics of all counters in percent, in order of first appearance
+	std::vector<Stats> counters() const;
+
+	/**
+	 * @brief Adds a latency sample in ms measured on the CPU, e.g. from sampling the input to presenting the frame
+	 *
+	 * Unlike counters, latencies can also be recorded outside of a frame.
+	 */
+	void latency(const std::string &name, float ms);
+
+	/// Statistics of all latencies in ms, in order of first appearance
+	std::vector<Stats> latencies() const;
+
+	/// Statistics of the whole frame
+	Stats frameStats() const { return stats().front(); }
+
+	/**
+	 * @brief Sum of all pass times of the newest measured frame in ms
+	 *
+	 * Unlike the frame time this leaves out gaps between the passes, e.g. the
+	 * wait for vsync in the distortion pass of the SDK.
+	 *
+	 * @return Number of frames measured so far, grows with each new sample
+	 */
+	uint64_t latestPasses(float &ms) const {
+		ms = mLatestPasses;
+		return mMeasured;
+	}
+
+	/// Draw one bar per pass (average) into the lower left corner of the bound framebuffer, passes beyond its height are left out
+	void drawOverlay(int width, int height) const;
+
+	/// Write the statistics to <prefix>.csv and <prefix>.json
+	void dump(const std::string &prefix) const;
+
+	/// Human readable summary
+	std::string info() const;
+
+protected:
+
+	GPUProfiler() : mFrame(0), mMeasured(0), mLatestPasses(0.f), mActive(-1), mInFrame(false), mReady(false) { }
+
+	GPUProfiler(GPUProfiler const&) = delete;
+	void operator=(GPUProfiler const&) = delete;
+
+	/// Index of a pass, registers it on first use
+	size_t passIndex(const std::string &pass);
+
+	/// Read back the queries of a frame slot, if the GPU finished it
+	void collect(int slot);
+
+	/// Compute rolling statistics of a series
+	static Stats computeStats(const std::string &name, const std::vector<float> &samples, size_t head);
+
+protected:
+
+	static const int Latency = 4; ///< Frames between issuing and reading a query
+	static const size_t Window = 300; ///< Number of samples in the rolling statistics
+
+	/**
+	 * @brief Queries issued during one frame
+	 */
+	struct FrameSlot {
+		GLuint timestamps[2]; ///< Frame begin and end
+		std::vector<GLuint> queries; ///< Pool of GL_TIME_ELAPSED queries
+		std::vector<size_t> passes; ///< Pass index of each used query
+		bool pending = false; ///< Whether queries were issued and not yet read
+	};
+
+	/**
+	 * @brief Samples of one pass or counter
+	 */
+	struct Series {
+		std::string name;
+		std::vector<float> samples; ///< Ring buffer of Window samples in ms or percent
+		size_t head = 0; ///< Total number of samples written
+	};
+
+	/// Append a sample to the ring buffer of a series
+	static void push(Series &series, float sample);
+
+	FrameSlot mSlots[Latency]; ///< Query slots
+	std::vector<Series> mSeries; ///< Frame series (index 0) followed by passes
+	std::map<std::string, size_t> mPassIndices; ///< Pass name -> series index
+	std::vector<Series> mCounters; ///< Counter series in percent
+	std::vector<Series> mLatencies; ///< Latency series in ms
+	std::vector<std::pair<double, double>> mCounterSums; ///< Part and total of each counter in the current frame
+	uint64_t mFrame; ///< Current frame number
+	uint64_t mMeasured; ///< Number of frames read back
+	float mLatestPasses; ///< Sum of the pass times of the newest frame read back
+	int mActive; ///< Series index of the running pass or -1
+	bool mInFrame; ///< Between beginFrame() and endFrame()
+	bool mReady; ///< Whether init() was called
+};
+
+VR_NAMESPACE_END
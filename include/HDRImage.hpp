@@ -0,0 +1,58 @@
+#pragma once
+
+#include "common.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Radiance RGBE (.hdr) image decoded to float RGB triplets
+ *
+ * The file is memory mapped. A first pass only walks the run length
+ * codes to find where each scanline starts, then the scanlines are
+ * decoded in parallel and converted to float with SSE2 where available.
+ */
+class HDRImage {
+public:
+
+	/**
+	 * @brief Decodes the given file, throws a std::runtime_error on failure
+	 */
+	HDRImage(const std::string &file);
+
+	/**
+	 * @brief Decoded image of a file, shared with earlier loads as long as the file is unmodified
+	 */
+	static std::shared_ptr<const HDRImage> load(const std::string &file);
+
+	/**
+	 * @brief Drops all cached images
+	 */
+	static void clearCache();
+
+	/// Width in pixels
+	int width() const { return mWidth; }
+
+	/// Height in pixels
+	int height() const { return mHeight; }
+
+	/// RGB float triplets, first scanline of the file first
+	const float *data() const { return mPixels.data(); }
+
+protected:
+
+	/// Decodes one run length encoded scanline of the new format into RGBE quadruples
+	static bool decodeScanline(const uint8_t *src, const uint8_t *end, int width, uint8_t *rgbe);
+
+	/// Decodes all scanlines sequentially, supports flat and old-style run length encoded files
+	bool decodeSequential(const uint8_t *src, const uint8_t *end);
+
+	/// Converts RGBE quadruples to float RGB
+	static void convert(const uint8_t *rgbe, int count, float *rgb);
+
+protected:
+
+	int mWidth, mHeight; ///< Image size
+	std::vector<float> mPixels; ///< RGB triplets
+};
+
+VR_NAMESPACE_END
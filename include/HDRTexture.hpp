@@ -0,0 +1,84 @@
+#pragma once
+
+#include "common.hpp"
+#include "SphericalHarmonics.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Environment cubemap packed as GL_RGB9_E5 with a roughness prefiltered mip chain
+ *
+ * Level 0 is the latitude-longitude HDR image resampled to GI_CUBEMAP_SIZE,
+ * level i holds the environment convolved with a GGX lobe of roughness
+ * i / (levels - 1), such that the shader picks the blur with textureLod.
+ * Shared exponent texels take 4 bytes instead of 12 for GL_RGB32F. The
+ * packed levels and the diffuse irradiance are stored in the texture cache
+ * directory, such that later launches neither decode nor filter the HDR file.
+ */
+class HDRTexture {
+public:
+
+	/**
+	 * @brief Loads the packed levels from the cache or filters the HDR file, throws a std::runtime_error on failure
+	 */
+	HDRTexture(const std::string &file);
+
+	/**
+	 * @brief Creates a mipmapped cubemap texture of all levels
+	 */
+	GLuint upload() const;
+
+	/// Face size of level 0 in pixels
+	int size() const { return mLevels.front().size; }
+
+	/// Number of mip levels
+	int levels() const { return int(mLevels.size()); }
+
+	/// Size of all levels in bytes
+	size_t bytes() const;
+
+	/// Diffuse irradiance of the full resolution image
+	const SphericalHarmonics &irradiance() const { return mIrradiance; }
+
+	/// Whether the levels came from the cache file
+	bool cached() const { return mCached; }
+
+	/// Packs a linear RGB color, values outside of the representable range are clamped
+	static uint32_t packRGB9E5(float r, float g, float b);
+
+	/// Inverse of packRGB9E5
+	static Vector3f unpackRGB9E5(uint32_t texel);
+
+	/// Direction of a point (s, t) in [-1, 1]^2 on a face, in the order of GL_TEXTURE_CUBE_MAP_POSITIVE_X + face
+	static Vector3f faceDirection(int face, float s, float t);
+
+protected:
+
+	/**
+	 * @brief One mip level of packed texels, the six faces one after another
+	 */
+	struct Level {
+		int size;
+		std::vector<uint32_t> texels;
+	};
+
+	/// Resamples the image to a cube, prefilters every level and projects the irradiance
+	void convert(const HDRImage &image, int size);
+
+	/// Cache file of the given source file
+	static std::string cacheFile(const std::string &file);
+
+	/// Reads the levels if the cache file matches the source size, modification time and cube size
+	bool loadCache(const std::string &file, long long size, long long modified, int cubeSize);
+
+	/// Writes the levels to the cache, failures are ignored
+	void storeCache(const std::string &file, long long sourceSize, long long modified) const;
+
+protected:
+
+	std::vector<Level> mLevels; ///< Level 0 first
+	SphericalHarmonics mIrradiance; ///< Diffuse irradiance
+	bool mCached; ///< Loaded from the cache file
+};
+
+VR_NAMESPACE_END
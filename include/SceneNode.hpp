@@ -0,0 +1,92 @@
+#pragma once
+
+#include "common.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Node of the transform hierarchy
+ *
+ * The local transform is translation * rotation * scale, the world matrix
+ * is the one of the parent times the local one. World and normal matrices
+ * are cached and only recomputed after a transform of the node or of one
+ * of its ancestors changed, setting an unchanged transform does not
+ * invalidate anything. Copies do not inherit the parent or the children.
+ */
+class SceneNode {
+public:
+
+	SceneNode();
+
+	/// Copies the local transform, the copy is not attached to the hierarchy
+	SceneNode(const SceneNode &other);
+
+	/// Copies the local transform, parent and children stay as they are
+	SceneNode &operator=(const SceneNode &other);
+
+	/// Detaches from the parent, children become roots
+	virtual ~SceneNode();
+
+	/// Attaches to a new parent, nullptr makes this node a root
+	void setParent(SceneNode *p);
+
+	/// Return the parent or nullptr
+	SceneNode *getParent() const { return parent; }
+
+	/// Return the attached children
+	const std::vector<SceneNode *> &getChildren() const { return children; }
+
+	/// Sets the local translation matrix
+	void setTranslateMatrix(const Matrix4f &t);
+
+	/// Sets the local scale matrix
+	void setScaleMatrix(const Matrix4f &s);
+
+	/// Sets the local rotation matrix
+	void setRotationMatrix(const Matrix4f &r);
+
+	/// Return the world matrix, recomputed if invalid
+	const Matrix4f &getWorldMatrix() {
+		if (dirty)
+			evaluate();
+		return worldMatrix;
+	}
+
+	/// Return the transpose inverse of the upper 3x3 world matrix, recomputed if invalid
+	const Matrix3f &getWorldNormalMatrix() {
+		if (dirty)
+			evaluate();
+		return normalMatrix;
+	}
+
+	/// Recomputes all invalid nodes of the subtree, called once per frame after the transforms were set
+	void update();
+
+	/// Marks the world matrices of this node and of all descendants as invalid
+	void invalidate();
+
+protected:
+
+	/// Local transform, overridden by nodes with additional local matrices
+	virtual Matrix4f getLocalMatrix() const { return transMat * rotateMat * scaleMat; }
+
+	/// Called after the world matrix was recomputed, e.g. to update world bounds
+	virtual void worldChanged() { }
+
+	/// Recompute the world and normal matrices
+	void evaluate();
+
+protected:
+	Matrix4f transMat; ///< Local translation
+	Matrix4f scaleMat; ///< Local scale
+	Matrix4f rotateMat; ///< Local rotation
+
+private:
+	Matrix4f worldMatrix; ///< Cached world matrix
+	Matrix3f normalMatrix; ///< Cached normal matrix
+	bool dirty; ///< Whether the cached matrices are invalid
+	SceneNode *parent; ///< Parent or nullptr
+	std::vector<SceneNode *> children; ///< Attached children
+};
+
+VR_NAMESPACE_END
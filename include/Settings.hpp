@@ -2,6 +2,7 @@
 
 #include "Eigen/Core"
 #include "Leap.h"
+#include <atomic>
 
 /// To avoid cycling includes
 #if !defined(VR_NAMESPACE_BEGIN)
@@ -40,7 +41,10 @@ private:
 public:
 
 	/**
-	 * Global settings as members
+	 * Configuration, set before the threads start. Afterwards only the key
+	 * callbacks on the render thread toggle some of the drawing options,
+	 * which are read by the render thread only. State which changes while
+	 * running lives in the snapshots of the simulation or below.
 	 */
 	std::string MODEL;
 	std::string ANNOTATIONS;
@@ -57,7 +61,6 @@ public:
 
 	Eigen::Vector3f MATERIAL_COLOR;
 	Eigen::Vector3f MATERIAL_COLOR_ROTATION;
-	bool ROTATION_ACTIVE;
 	Eigen::Vector3f LIGHT_INTENSITY;
 	float LIGHT_AMBIENT;
 
@@ -65,20 +68,21 @@ public:
 	float MESH_DIAGONAL;
 	bool MESH_DRAW_WIREFRAME;
 	bool MESH_DRAW_BBOX;
-	bool MESH_DISPLAY_BBOX;
-	float BBOX_ALPHA_BLEND;
+	bool MESH_OPTIMIZE;
+	bool MESH_QUANTIZE;
+	bool MESH_CULL;
+	int MESH_LOD_LEVELS;
+	float MESH_LOD_PIXEL_ERROR;
+	float MESH_LOD_HYSTERESIS;
 	bool SHOW_HANDS;
-	bool SHOW_SPHERE;
 	bool ENABLE_SPHERE;
 	bool SHOW_SOCKEL;
-	float SOCKEL_ALPHA_BLEND;
 
 	bool USE_LEAP;
 	bool LEAP_USE_PASSTHROUGH;
 	float LEAP_ALPHA_SCALE;
 	float LEAP_CAMERA_SHIFT_X;
 	float LEAP_CAMERA_SHIFT_Z;
-	bool LEAP_USE_LISTENER;
 	Eigen::Vector3f LEAP_NO_HMD_OFFSET;
 
 	double GESTURES_SCALE_TIME;
@@ -89,13 +93,11 @@ public:
 	float ANNOTATION_SEACH_RADIUS;
 
 	bool NETWORK_ENABLED;
-	bool NETWORK_LISTEN;
 	short NETWORK_PORT;
 	int NETWORK_MODE;
 	std::string NETWORK_IP;
 	long NETWORK_SEND_RATE;
 	int NETWORK_BUFFER_SIZE;
-	bool NETWORK_NEW_DATA;
 
 	bool SHOW_DEBUG_SPHERES;
 	float SPHERE_VISUAL_SCALE;
@@ -103,17 +105,39 @@ public:
 	float SPHERE_SPINCH_SCALE;
 	float SPHERE_MEDIUM_SCALE;
 	float SPHERE_LARGE_SCALE;
-	bool SPHERE_DISPLAY;
-	float SPHERE_ALPHA_BLEND;
-	bool SPHERE_ALPHA_BLEND_INTRO;
-	bool SPHERE_VISUAL_HINT;
 	Eigen::Vector3f SPHERE_VISUAL_HINT_COLOR;
 
 	bool GI_ENABLED;
 	std::string GI_FILE;
-	std::string GI_DIFFUSE_FILE;
+	int GI_CUBEMAP_SIZE;
+	float GI_SPECULAR_ROUGHNESS;
 
-	double FRAME_TIME;
+	int STREAM_BUFFER_SIZE;
+
+	float SIMULATION_RATE;
+
+	bool DYNAMIC_RESOLUTION;
+	float DYNAMIC_RESOLUTION_MIN;
+	float DYNAMIC_RESOLUTION_MAX;
+
+	std::string SHADER_CACHE_DIR;
+	std::string TEXTURE_CACHE_DIR;
+	std::string MESH_CACHE_DIR;
+
+	bool PROFILER_OVERLAY;
+	std::string PROFILER_DUMP;
+	std::string TRACE_FILE;
+
+	bool HEADLESS;
+	int BENCH_FRAMES;
+	std::string BENCH_OUTPUT;
+	int BENCH_PINS;
+	bool BENCH_HANDS;
+
+	/**
+	 * Runtime state shared between the render, simulation and network threads
+	 */
+	std::atomic<bool> NETWORK_NEW_DATA; ///< The model or the annotations changed since the last packet was sent
 };
 
 VR_NAMESPACE_END
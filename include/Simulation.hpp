@@ -0,0 +1,117 @@
+#pragma once
+
+#include "common.hpp"
+#include "SceneNode.hpp"
+#include "mesh/Mesh.hpp"
+#include "leap/SkeletonHand.hpp"
+#include "Leap.h"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Stand-in for the mesh on the simulation thread
+ *
+ * Gestures and annotation hit tests need the model matrix and the world
+ * bounds of the mesh, which the render thread updates while drawing. The
+ * simulation thread transforms its own node instead and attaches its pins
+ * to it. The kd-tree is shared, it is never modified after loading.
+ */
+class ModelNode : public SceneNode {
+public:
+
+	ModelNode() : kdtree(nullptr) { }
+
+	/// Takes over the local bounds and the kd-tree of a loaded and placed mesh
+	void attach(Mesh &m) {
+		bbox = m.getBoundingBox();
+		kdtree = &m.getKDTree();
+		invalidate();
+	}
+
+	/// Return the model matrix
+	const Matrix4f &getModelMatrix() { return getWorldMatrix(); }
+
+	/// Return the normal matrix
+	const Matrix3f &getNormalMatrix() { return getWorldNormalMatrix(); }
+
+	/// Return an axis-aligned bounding box of the mesh in world space
+	BoundingBox3f &getBoundingBox() {
+		getWorldMatrix();
+		return bbox;
+	}
+
+	/// Return the kd-tree of the mesh in local coordinates
+	const KDTree &getKDTree() const { return *kdtree; }
+
+protected:
+
+	/// World bounds follow the model matrix
+	virtual void worldChanged() { bbox.transformAxisAligned(getWorldMatrix()); }
+
+protected:
+	BoundingBox3f bbox; ///< World bounds, transformed from the local ones
+	KDTree *kdtree; ///< Kd-tree of the mesh
+};
+
+/**
+ * @brief Visual feedback of the gestures, set on the simulation thread and drawn by the renderer
+ */
+struct GestureFeedback {
+	bool rotating = false; ///< A hand rotates the model, the rotation sphere is shown
+	bool sphereIntro = false; ///< The rotation sphere fades in after the rotation started
+	float sphereAlpha = 0.f; ///< Alpha of the rotation sphere
+	bool sphereHint = false; ///< The rotation sphere blinks to show where to grab
+	Vector3f fingerColor = Settings::getInstance().MATERIAL_COLOR_ROTATION; ///< Finger color, shows the distance to the sphere while rotating
+	bool scaling = false; ///< Both hands scale the model, the bounding box is shown
+
+	/// Fade steps were tuned per rendered frame at the 75 Hz of the DK2, returns the step for one simulation step
+	static float fadeStep(float perFrame) {
+		return perFrame * 75.f / std::max(1.f, Settings::getInstance().SIMULATION_RATE);
+	}
+};
+
+/**
+ * @brief Annotation as published to the render thread
+ */
+struct Annotation {
+	Vector3f position; ///< Position on the mesh in local coordinates
+	Vector3f normal; ///< Surface normal at the position
+	Vector3f color; ///< Pin color
+};
+
+/**
+ * @brief Input sampled on the render thread, read by the simulation thread
+ *
+ * Events are counted since start-up, the simulation thread applies the
+ * difference to the last state it read. Events are not lost if it skips
+ * a state, only picks in between collapse to the last one.
+ */
+struct InputState {
+	Matrix4f viewMatrix = Matrix4f::Identity(); ///< View matrix of the last frame, sent to clients
+	bool arcball = false; ///< Whether arcballRotation replaces the rotation of the model
+	Matrix4f arcballRotation = Matrix4f::Identity(); ///< Rotation set with the mouse
+	unsigned int scrollUp = 0, scrollDown = 0; ///< Mouse wheel steps
+	unsigned int resets = 0; ///< Requests to place the object at its default transform
+	unsigned int picks = 0; ///< Annotations added or deleted with the mouse
+	Vector3f pickPosition = Vector3f::Zero(); ///< Last picked point on the mesh in local coordinates
+	Vector3f pickWorldPosition = Vector3f::Zero(); ///< Last picked point in world coordinates
+};
+
+/**
+ * @brief Immutable state of one simulation step, everything the render thread needs to draw a frame
+ */
+struct FrameSnapshot {
+	uint64_t step = 0; ///< Simulation step, 0 before the first one
+	double inputTime = 0.0; ///< glfwGetTime() when the Leap frame was polled
+	Matrix4f scaleMatrix = Matrix4f::Identity(); ///< Model scale
+	Matrix4f rotationMatrix = Matrix4f::Identity(); ///< Model rotation
+	Matrix4f translateMatrix = Matrix4f::Identity(); ///< Model translation
+	HandState hands[2] = { HandState(true), HandState(false) }; ///< Right and left hand
+	Matrix4f handsTransform = Matrix4f::Identity(); ///< Leap to world transformation the hands were placed with
+	Leap::Frame frame; ///< Leap frame of the step, its images are drawn as passthrough
+	GestureFeedback gestures; ///< Rotation sphere, bounding box and finger colors
+	uint64_t annotationsVersion = 0; ///< Changes with every added or deleted annotation
+	std::shared_ptr<const std::vector<Annotation>> annotations; ///< All annotations, shared until they change
+};
+
+VR_NAMESPACE_END
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "common.hpp"
+#include "HDRImage.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Diffuse irradiance of an environment map as 9 spherical harmonics coefficients (bands 0 to 2)
+ *
+ * The coefficients already contain the cosine lobe convolution, the basis
+ * normalization and the division by pi, such that the outgoing radiance of
+ * a white Lambertian surface with normal n = (x, y, z) is
+ *
+ *   c0 + c1 y + c2 z + c3 x + c4 xy + c5 yz + c6 (3z^2 - 1) + c7 xz + c8 (x^2 - y^2)
+ *
+ * Directions are in the frame of the environment sphere, which maps
+ * u = atan2(-z, x) / 2pi and v = acos(y) / pi.
+ */
+class SphericalHarmonics {
+public:
+
+	/// Number of coefficients
+	static const int Count = 9;
+
+	/// All coefficients zero
+	SphericalHarmonics();
+
+	/**
+	 * @brief Projects a latitude-longitude environment map, rows are reduced in parallel
+	 */
+	static SphericalHarmonics irradiance(const HDRImage &image);
+
+	/// Diffuse radiance for a unit normal
+	Vector3f evaluate(const Vector3f &n) const;
+
+	/// Coefficients in the order of the polynomial above
+	const Vector3f *data() const { return mCoefficients; }
+	Vector3f *data() { return mCoefficients; }
+
+protected:
+
+	Vector3f mCoefficients[Count]; ///< RGB coefficients
+};
+
+VR_NAMESPACE_END
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "common.hpp"
+#include <atomic>
+#include <mutex>
+
+/// MSVC 2013 lacks thread_local, __declspec(thread) is fine for plain pointers
+#if defined(_MSC_VER) && _MSC_VER < 1900
+	#define VR_THREAD_LOCAL __declspec(thread)
+#else
+	#define VR_THREAD_LOCAL thread_local
+#endif
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Collects CPU scoped timers for export in the Chrome trace format
+ *
+ * Every thread records into its own ring buffer, so recording never locks.
+ * Only the first event of a thread registers its buffer under a mutex.
+ * When a ring is full the oldest events are overwritten.
+ */
+class Tracer {
+public:
+
+	/**
+	 * @brief A completed scope, times in nanoseconds since startup
+	 */
+	struct Event {
+		const char *name;
+		uint64_t begin, end;
+	};
+
+	/**
+	 * @brief Singleton
+	 */
+	static Tracer &getInstance() {
+		static Tracer instance;
+		return instance;
+	}
+
+	/// Monotonic time in nanoseconds
+	static uint64_t now();
+
+	/// Append an event to the ring of the calling thread. The name must be a string literal
+	void record(const char *name, uint64_t begin, uint64_t end);
+
+	/// Name the calling thread in the exported trace
+	void setThreadName(const std::string &name);
+
+	/// Write all recorded events as Chrome trace JSON (chrome://tracing), false on failure
+	bool write(const std::string &file) const;
+
+protected:
+
+	Tracer() : mStart(now()) { }
+
+	Tracer(Tracer const&) = delete;
+	void operator=(Tracer const&) = delete;
+
+	static const size_t Capacity = 1 << 16; ///< Events per thread
+
+	/**
+	 * @brief Ring entry, relaxed atomics since write() copies slots the owner may be overwriting
+	 */
+	struct Slot {
+		std::atomic<const char *> name;
+		std::atomic<uint64_t> begin, end;
+	};
+
+	/**
+	 * @brief Ring buffer owned by a single writing thread
+	 */
+	struct ThreadBuffer {
+		std::string name;
+		uint32_t id;
+		std::unique_ptr<Slot[]> events;
+		std::atomic<uint64_t> head; ///< Total number of events written, published after each write
+	};
+
+	/// Ring of the calling thread, created on first use
+	ThreadBuffer &threadBuffer();
+
+	mutable std::mutex mMutex; ///< Guards the thread list and names
+	std::vector<std::unique_ptr<ThreadBuffer>> mThreads; ///< All rings
+	uint64_t mStart; ///< Time stamp of the trace origin
+};
+
+/**
+ * @brief Records the lifetime of this object, use through VR_TRACE_SCOPE
+ */
+class TraceScope {
+public:
+	TraceScope(const char *name) : name(name), begin(Tracer::now()) { }
+	~TraceScope() { Tracer::getInstance().record(name, begin, Tracer::now()); }
+
+private:
+	const char *name;
+	uint64_t begin;
+};
+
+VR_NAMESPACE_END
+
+/**
+ * Instrumentation macros, compiled out unless VR_ENABLE_TRACE is defined
+ * (CMake option VR_ENABLE_TRACE)
+ */
+#if defined(VR_ENABLE_TRACE)
+	#define VR_TRACE_CONCAT_(a, b) a##b
+	#define VR_TRACE_CONCAT(a, b) VR_TRACE_CONCAT_(a, b)
+	#define VR_TRACE_SCOPE(name) VR_NS::TraceScope VR_TRACE_CONCAT(vrTraceScope, __LINE__)(name)
+	#define VR_TRACE_THREAD(name) VR_NS::Tracer::getInstance().setThreadName(name)
+	#define VR_TRACE_WRITE(file) VR_NS::Tracer::getInstance().write(file)
+#else
+	#define VR_TRACE_SCOPE(name) ((void) 0)
+	#define VR_TRACE_THREAD(name) ((void) 0)
+	#define VR_TRACE_WRITE(file) ((void) 0)
+#endif
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "common.hpp"
+#include <atomic>
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Lock-free triple buffer between one writer and one reader thread
+ *
+ * The writer fills its back slot and publishes it, the reader picks up the
+ * newest published slot. Both sides only swap their slot with the shared
+ * middle one, so neither ever waits for the other. A published value the
+ * reader did not pick up in time is overwritten by the next one, the reader
+ * always sees the newest complete value. Slots are reused, the writer has
+ * to overwrite every field of its back slot before publishing it.
+ */
+template <typename T> class TripleBuffer {
+public:
+
+	TripleBuffer() : back(0), front(2), middle(1) { }
+
+	TripleBuffer(const TripleBuffer &) = delete;
+	TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+	/// Slot the writer fills, owned by the writer until publish()
+	T &write() { return slots[back]; }
+
+	/// Hand the written slot to the reader, the writer continues with the previous middle slot
+	void publish() {
+		back = middle.exchange(back | Fresh, std::memory_order_acq_rel) & Index;
+	}
+
+	/**
+	 * @brief Pick up the newest published slot
+	 *
+	 * @return Whether a slot was published since the last call, read() is unchanged otherwise
+	 */
+	bool update() {
+		if (!(middle.load(std::memory_order_relaxed) & Fresh))
+			return false;
+		front = middle.exchange(front, std::memory_order_acq_rel) & Index;
+		return true;
+	}
+
+	/// Slot picked up by the last update(), owned by the reader until the next one
+	const T &read() const { return slots[front]; }
+
+private:
+	static const int Index = 3; ///< Slot index bits of middle
+	static const int Fresh = 4; ///< Set in middle if it holds a slot the reader did not pick up yet
+
+	T slots[3]; ///< Back, middle and front slot in any order
+	int back; ///< Slot of the writer
+	int front; ///< Slot of the reader
+	std::atomic<int> middle; ///< Shared slot index and fresh bit
+};
+
+VR_NAMESPACE_END
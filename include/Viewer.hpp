@@ -7,11 +7,18 @@
 #include "renderer/Renderer.hpp"
 #include "renderer/RiftRenderer.hpp"
 #include "GLUtil.hpp"
+#include "GPUProfiler.hpp"
+#include "Trace.hpp"
 #include "leap/LeapListener.hpp"
 #include "leap/SkeletonHand.hpp"
 #include "leap/GestureHandler.hpp"
 #include "Eigen/Geometry"
 #include "network/UDPSocket.hpp"
+#include "Simulation.hpp"
+#include "TripleBuffer.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
 
 VR_NAMESPACE_BEGIN
 
@@ -48,16 +55,32 @@ public:
 	 * Internally it calls the Renderer::update() and Renderer::draw() methods. The purpose of
 	 * Renderer::update() is that the states get updated and Renderer::draw() is responsible
 	 * of drawing the data. Of course a renderer must be set in advance.
+	 *
+	 * Leap input, gestures, networking and annotations run on a simulation thread
+	 * at Settings::SIMULATION_RATE. It exchanges frame snapshots and the window
+	 * input with the render thread through triple buffers, neither thread waits
+	 * for the other.
 	 */
 	virtual void display(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r);
 
 	/**
-	* @brief Add an annotation
+	 * @brief Renders a fixed number of frames offscreen along a deterministic rotation path
+	 *
+	 * Optionally adds synthetic annotations and hands. Frame time statistics of
+	 * the CPU (including glFinish), of every GPU pass and the input latencies
+	 * are written as JSON. Needs no window system interaction, Leap or Rift.
+	 * Frames are started and presented by the renderer, the simulation thread
+	 * and networking run as in display().
+	 */
+	virtual void benchmark(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r, int frames, const std::string &output);
+
+	/**
+	* @brief Add an annotation, simulation thread
 	*/
 	void addAnnotation(Vector3f &pos, Vector3f &n);
 
 	/**
-	* @brief Add an annotation with color
+	* @brief Add an annotation with color, simulation thread
 	*/
 	void addAnnotation(const Vector3f &pos, const Vector3f &n, const Vector3f &c);
 
@@ -114,7 +137,7 @@ public:
 	std::shared_ptr<Mesh> &getMesh ();
 
 	/**
-	* @brief Returns the vector of annotations
+	* @brief Returns the vector of uploaded annotations, render thread
 	*/
 	std::vector<std::shared_ptr<Pin>> &getAnnotations();
 
@@ -129,12 +152,17 @@ public:
 	void attachSocket (UDPSocket &s);
 
 	/**
-	* @brief Delete the pin if we hit it
+	* @brief Delete the pin if we hit it, simulation thread
 	*/
 	bool deletePinIfHit(Vector3f &position);
 
 protected:
 
+	/**
+	 * @brief Attaches mesh and renderer and runs all pre processing before the first frame
+	 */
+	virtual void setUp(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r);
+
 	/**
 	 * @brief Places the object in the world coordindate system and scales it for the immersion effect and builds the kd-tree
 	 */
@@ -185,6 +213,73 @@ protected:
 	 */
 	void processNetworking ();
 
+	/**
+	 * @brief Runs simulation steps at a fixed rate until the render loop ends
+	 *
+	 * An exception ends the thread, it is rethrown on the render thread by checkSimulation().
+	 */
+	void simulate ();
+
+	/**
+	 * @brief Starts the simulation thread
+	 */
+	void startSimulation ();
+
+	/**
+	 * @brief Stops and joins the simulation thread, if it runs
+	 */
+	void stopSimulation ();
+
+	/**
+	 * @brief Rethrows an exception which ended the simulation thread, render thread
+	 */
+	void checkSimulation ();
+
+	/**
+	 * @brief Runs the simulation thread while in scope, it is also stopped and joined if the render loop throws
+	 */
+	struct SimulationScope {
+		SimulationScope (Viewer &v) : viewer(v) { viewer.startSimulation(); }
+		~SimulationScope () { viewer.stopSimulation(); }
+		Viewer &viewer;
+	};
+
+	/**
+	 * @brief One simulation step: window input, Leap frame and gestures, annotations and networking
+	 */
+	void step ();
+
+	/**
+	 * @brief Applies the events of the render thread since the last applied input
+	 */
+	void applyInput (const InputState &in);
+
+	/**
+	 * @brief Deletes the pin at a picked point or adds one at the closest vertex
+	 */
+	void pick (const Vector3f &position, Vector3f worldPosition);
+
+	/**
+	 * @brief Publishes the state of the simulation thread as the newest snapshot
+	 *
+	 * @param inputTime glfwGetTime() when the Leap frame was polled
+	 */
+	void publish (double inputTime);
+
+	/**
+	 * @brief Takes over a snapshot on the render thread: Leap frame, gesture feedback and the pins to upload or release
+	 */
+	void applySnapshot (const FrameSnapshot &snapshot);
+
+	/**
+	 * @brief Places the drawn hands of a snapshot, render thread
+	 *
+	 * With a head pose latched by Renderer::beginFrame() the hands are moved
+	 * from the head pose of the simulation step to the one of the eyes, such
+	 * that hands and eyes are drawn from one consistent head pose.
+	 */
+	void placeHands (const FrameSnapshot &snapshot, const ovrPosef *headPose);
+
 public:
 
 	int FBWidth, FBHeight; ///< Framebuffer size
@@ -207,6 +302,7 @@ protected:
 	unsigned int frameCount = 0; ///< Frame count
 	double fps = 0.0; ///< FPS count
 	bool appFPS = true; ///< If true, then the current FPS count is appended to the window title
+	bool writeTrace = false; ///< Export the CPU trace at the end of the current frame
 	std::shared_ptr<Mesh> mesh; ///< Pointer to mesh
 	Arcball arcball; ///< Arcball
 	Matrix4f scaleMatrix; ///< Scale matrix
@@ -214,16 +310,36 @@ protected:
 	Matrix4f translateMatrix; ///< Translation matrix
 	Vector2i lastPos; ///< Last click position used for the arcball
 	std::unique_ptr<LeapListener> leapListener; ///< Leap listener instance
-	std::shared_ptr<SkeletonHand> hands[2]; ///< Leap hands
+	std::shared_ptr<SkeletonHand> hands[2]; ///< Leap hands tracked on the simulation thread
+	std::shared_ptr<SkeletonHand> renderHands[2]; ///< Leap hands drawn on the render thread
 	std::shared_ptr<GestureHandler> gestureHandler; ///< Gesture handler
 	Leap::Frame frame; ///< Leap Frame
-	std::vector<std::shared_ptr<Pin>> pinList; ///< List of annotations
+	std::vector<std::shared_ptr<Pin>> pinList; ///< List of uploaded annotations, render thread
+	std::vector<std::shared_ptr<Pin>> annotations; ///< List of annotations attached to the model, simulation thread
+	std::shared_ptr<const std::vector<Annotation>> publishedAnnotations; ///< Annotations of the last snapshot
+	uint64_t annotationsVersion; ///< Version of publishedAnnotations
+	bool annotationsChanged; ///< Annotations were added or deleted since the last snapshot
+	uint64_t renderedAnnotations; ///< Version of the annotations in pinList
 	std::vector<Pin> pinListAdd; ///< List of annotations to aff for client
 	std::vector<Pin> pinListDelete; ///< List of annotations to delete for client
 	bool loadAnnotationsFlag; ///< Load annotations on start up
 	std::string annotationsLoadPath; ///< File to load from
 	UDPSocket *netSocket; ///< UDP Socket
 	unsigned long sequenceNr; ///< UDP Packet sequence nr
+	long lastSendTime; ///< Time of the last sent or received packet in milliseconds
+
+	ModelNode model; ///< Stand-in of the mesh on the simulation thread
+	Matrix4f viewMatrix; ///< View matrix of the latest input, sent to clients
+	Matrix4f handsTransform; ///< Leap to world transformation of the last polled frame
+	InputState input; ///< Window input of the render thread
+	InputState lastInput; ///< Input last applied by the simulation thread
+	TripleBuffer<InputState> inputs; ///< Render thread to simulation thread
+	TripleBuffer<FrameSnapshot> snapshots; ///< Simulation thread to render thread
+	uint64_t simulationStep; ///< Number of published snapshots
+	std::atomic<bool> simulating; ///< Keeps the simulation thread running
+	std::atomic<bool> simulationFailed; ///< Set once simulationError holds the exception which ended the thread
+	std::exception_ptr simulationError; ///< Exception thrown on the simulation thread
+	std::thread simulation; ///< Simulation thread
 };
 
 VR_NAMESPACE_END
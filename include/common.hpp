@@ -36,6 +36,7 @@
 #include <string>
 #include <fstream>
 #include <vector>
+#include <functional>
 #define WIN32_LEAN_AND_MEAN
 #define PATH_SEPARATOR '/'
 #if defined(PLATFORM_APPLE)
@@ -140,6 +141,17 @@ enum NETWORK_MODES {
 	CLIENT //!< CLIENT
 };
 
+/// Feature bits of the standard shader variants
+enum SHADER_FEATURES {
+	SIMPLE_COLOR = 1 << 0, //!< Flat material color
+	TEXTURE_ONLY = 1 << 1, //!< Environment texture without shading
+	ENABLE_GI = 1 << 2, //!< Image based lighting
+	SPECULAR = 1 << 3, //!< Sample the specular instead of the diffuse environment
+	USE_SPECULAR = 1 << 4, //!< Reflect the view vector for the environment lookup
+	QUANTIZED = 1 << 5, //!< Packed 16 bit positions, octahedral normals and half float texture coordinates
+	WIREFRAME = 1 << 6 //!< Triangle edges blended over the shading, from barycentric distances of a geometry shader
+};
+
 /// Stores an RGBA color value
 class Color : public Eigen::Vector4f {
 public:
@@ -212,6 +224,15 @@ extern std::string pv(const Vector3f v);
 /// Checks if the file exists
 extern bool fileExists(const std::string &name);
 
+/// 64 bit FNV-1a hash, chain calls by passing the previous hash
+extern uint64_t fnv1a(const std::string &str, uint64_t hash = 14695981039346656037ULL);
+
+/// 64 bit FNV-1a hash of a block of memory
+extern uint64_t fnv1a(const void *data, size_t size, uint64_t hash = 14695981039346656037ULL);
+
+/// Runs body(0) ... body(count - 1) on all cores
+extern void parallelFor(int count, const std::function<void(int)> &body);
+
 /// Matrix4f to string
 extern std::string matrix4fToString(const Matrix4f &m);
 
@@ -3,6 +3,7 @@
 #include "common.hpp"
 #include "Viewer.hpp"
 #include "leap/SkeletonHand.hpp"
+#include "Simulation.hpp"
 
 VR_NAMESPACE_BEGIN
 
@@ -45,9 +46,14 @@ public:
 	void setViewer (Viewer *v);
 
 	/**
-	* @brief Sets the pointer to the mesh
+	* @brief Sets the stand-in of the mesh on the simulation thread
 	*/
-	void setMesh (std::shared_ptr<Mesh> &m);
+	void setModel (ModelNode *m);
+
+	/**
+	* @brief Visual feedback of the running gestures, published with every simulation step
+	*/
+	GestureFeedback &getFeedback () { return feedback; }
 
 	/**
 	* @brief Transform Leap -> Rift coordinates to normalized 2D coordinates [0, 1] x [0, 1]
@@ -65,7 +71,8 @@ public:
 private:
 
 	Viewer *viewer; ///< Viewer
-	std::shared_ptr<Mesh> mesh; ///< Mesh
+	ModelNode *model; ///< Transform and bounds of the mesh
+	GestureFeedback feedback; ///< Rotation sphere, bounding box and finger colors
 };
 
 VR_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include "common.hpp"
 #include "mesh/Mesh.hpp"
+#include "Simulation.hpp"
 #include "Leap.h"
 #include "leap/SkeletonHand.hpp"
 #include "leap/GestureHandler.hpp"
@@ -10,27 +11,22 @@
 VR_NAMESPACE_BEGIN
 
 /**
- * @brief Leap listener
+ * @brief Leap input
  *
- * Implements the leap API
+ * Polls the Leap controller on the simulation thread, it is not registered
+ * as a Leap::Listener. No Leap callbacks run on other threads.
  */
-class LeapListener : public Leap::Listener {
+class LeapListener {
 public:
 	LeapListener(bool useRift);
 	virtual ~LeapListener () = default;
 
 	/**
-	 * Leap listener implementation
+	 * @brief Polls the newest Leap frame, transforms the hands into world space and recognizes gestures
+	 *
+	 * @param worldTransform Leap to world transformation, see getTransformationMatrix()
 	 */
-	virtual void onInit(const Leap::Controller &controller);
-	virtual void onConnect (const Leap::Controller &controller);
-	virtual void onDisconnect (const Leap::Controller &controller);
-	virtual void onExit(const Leap::Controller &controller);
-	virtual void onFrame (const Leap::Controller &controller);
-	virtual Leap::Frame pollFrame (const Leap::Controller &controller);
-	virtual void onServiceConnect (const Leap::Controller &controller);
-	virtual void onServiceDisconnect (const Leap::Controller &controller);
-	virtual void onDeviceChange (const Leap::Controller &controller);
+	virtual Leap::Frame pollFrame (const Leap::Controller &controller, const Matrix4f &worldTransform);
 
 	/**
 	* @brief Recognizes gestures
@@ -48,21 +44,25 @@ public:
 	void setHmd (ovrHmd h);
 
 	/**
-	* @brief Sets mesh pointer
+	* @brief Sets the stand-in of the mesh on the simulation thread
 	*/
-	void setMesh(std::shared_ptr<Mesh> &m);
+	void setModel(ModelNode *m);
 
 	/**
 	 * @brief Sets the gesture handler
 	 */
 	void setGestureHandler (std::shared_ptr<GestureHandler> &s);
 
-protected:
-
 	/**
 	* @brief Returns the transformation matrix from Leap to World coordinates
+	*
+	* The head pose is ignored without the Rift. Called by the simulation thread
+	* for polling and by the render thread to move the hands to the head pose of
+	* the frame.
 	*/
-	Matrix4f getTransformationMatrix();
+	Matrix4f getTransformationMatrix(const ovrPosef &headPose) const;
+
+protected:
 
 	/**
 	 * @brief Leap state to intern state
@@ -83,7 +83,7 @@ protected:
 	std::map<GESTURES, GESTURE_STATES> gestures[2]; ///< Gesture states (for both hands)
 	GESTURE_STATES gestureZoom; ///< Zoom gesture states, not applicapable to one hand
 	ovrHmd hmd; ///< The Rift
-	std::shared_ptr<Mesh> mesh;
+	ModelNode *model; ///< Transform and bounds of the mesh
 	std::shared_ptr<GestureHandler> gestureHandler; ///< Gesture handler
 };
 
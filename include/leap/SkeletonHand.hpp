@@ -9,38 +9,24 @@
 VR_NAMESPACE_BEGIN
 
 /**
- * @brief Leap Skeleton hand
+ * @brief Tracking state of a Leap hand in world coordinates
+ *
+ * Plain data, copied from the simulation to the render thread with each
+ * frame snapshot.
  */
-class SkeletonHand {
-public:
+struct HandState {
 
 	/**
-	* @brief Default
+	* @brief Default, far away and invisible
 	*/
-	SkeletonHand (bool _isRight);
-	virtual ~SkeletonHand () = default;
-
-	/**
-	 * @brief Upload the mesh (positions, normals, indices and uv) to the shader
-	 */
-	virtual void upload (std::shared_ptr<GLShader> &s);
-
-	/**
-	 * @brief Draw to the currently bounded shader
-	 */
-	virtual void draw (const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
-
-	/**
-	 * @brief Translation for all fingers and palm
-	 */
-	void translate (float x, float y, float z);
+	HandState (bool _isRight);
 
 	/**
-	* @brief BBox containing check
+	* @brief Moves all world positions and directions by a rigid transformation, e.g. to another head pose
+	*
+	* Leap space values (velocity and angles) are unchanged.
 	*/
-	bool containsBBox(const BoundingBox3f &b);
-
-public:
+	void transform (const Matrix4f &T);
 
 	int id; ///< Leap hand id
 	bool isRight; ///< Is it the right hand?
@@ -58,6 +44,7 @@ public:
 		Vector3f side; /// Palm side
 		Vector3f normal; ///< Palm normal
 		Vector3f velocity;
+		Matrix4f rotation; ///< Hand basis, orients all spheres of the hand
 		float pitch, yaw, roll;
 	} palm;
 	
@@ -69,6 +56,64 @@ public:
 		bool extended; ///< The finger extended or not?
 	} finger[5];
 	Vector3f handJointPosition; ///< Closing hand
+};
+
+/**
+ * @brief Leap Skeleton hand
+ */
+class SkeletonHand : public HandState {
+public:
+
+	/**
+	* @brief Default
+	*/
+	SkeletonHand (bool _isRight);
+	virtual ~SkeletonHand () = default;
+
+	/**
+	 * @brief Upload the mesh (positions, normals, indices and uv) to the shader
+	 */
+	virtual void upload (std::shared_ptr<GLShader> &s);
+
+	/**
+	 * @brief Draw to the currently bounded shader
+	 */
+	virtual void draw (const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
+
+	/**
+	 * @brief Moves the spheres to the tracked positions, called after the state changed
+	 */
+	void place ();
+
+	/**
+	 * @brief Finger color of the next draw, fingers are unlit while the hand rotates the model
+	 */
+	void highlight (bool rotating, const Vector3f &fingerColor) {
+		this->rotating = rotating;
+		this->fingerColor = fingerColor;
+	}
+
+	/**
+	 * @brief Translation for all fingers and palm
+	 */
+	void translate (float x, float y, float z);
+
+	/**
+	 * @brief Places an open, fully tracked hand at the given palm position without a Leap
+	 *
+	 * Used by the benchmark. The fingers fan out upwards, spread is the angle
+	 * between neighbouring fingers in radians.
+	 */
+	void pose (const Vector3f &palmPosition, float spread);
+
+	/**
+	* @brief BBox containing check
+	*/
+	bool containsBBox(const BoundingBox3f &b);
+
+public:
+
+	SceneNode root; ///< Parent of all spheres, evaluated once per draw
 
 	///< Composite mesh
 	struct mesh_t {
@@ -83,6 +128,8 @@ public:
 	} mesh; ///< Composite mesh
 
 	std::shared_ptr<GLShader> shader; ///< Bounded shader
+	bool rotating; ///< The hand rotates the model
+	Vector3f fingerColor; ///< Color of the finger tips
 };
 
 VR_NAMESPACE_END
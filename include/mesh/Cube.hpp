@@ -1,25 +1,36 @@
 #pragma once
 
 #include "common.hpp"
-#include "mesh/WavefrontObj.hpp"
-#include <sstream>
+#include "mesh/Mesh.hpp"
 
 VR_NAMESPACE_BEGIN
 
 /**
  * \brief Cube
  *
+ * The geometry is always the unit cube [-1, 1]^3. The actual extent is
+ * applied with a box matrix, such that resizing the cube never touches the GPU.
  */
-class Cube : public WavefrontOBJ {
+class Cube : public Mesh {
 public:
 	
 	Cube();
 	Cube(Vector3f min, Vector3f max);
 	virtual ~Cube() = default;
+
+	/**
+	 * @brief Resize the cube to span [min, max]
+	 */
 	void update(const Vector3f &min, const Vector3f &max);
 
-	// Override to use better cache locality
-	void upload(std::shared_ptr<GLShader> &s);
+protected:
+
+	/**
+	 * @brief Local matrix including the box matrix
+	 */
+	virtual Matrix4f getLocalMatrix() const;
+
+	Matrix4f boxMatrix; ///< Maps the unit cube to [min, max]
 };
 
 VR_NAMESPACE_END
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "common.hpp"
-#include "mesh/WavefrontObj.hpp"
+#include "mesh/Mesh.hpp"
 
 VR_NAMESPACE_BEGIN
 
@@ -9,7 +9,7 @@ VR_NAMESPACE_BEGIN
  * \brief Environment sphere
  *
  */
-class Environment : public WavefrontOBJ {
+class Environment : public Mesh {
 public:
 	
 	Environment(bool invertNormals = false);
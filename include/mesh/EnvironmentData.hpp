@@ -0,0 +1,3876 @@
+#pragma once
+
+#include "common.hpp"
+
+/**
+ * Geometry of the environment sphere as compile-time tables.
+ *
+ * Vertices are unique (position, uv, normal) tuples, indices form triangles. The
+ * bounding box spans all positions of the original model.
+ */
+
+VR_NAMESPACE_BEGIN
+
+namespace EnvironmentData {
+
+	constexpr uint32_t VertexCount = 1104;
+	constexpr uint32_t TriangleCount = 528;
+
+	constexpr float BBoxMin[] = { -50.0f, -50.0f, -50.0f };
+	constexpr float BBoxMax[] = { 50.0f, 50.0f, 50.0f };
+
+	constexpr float Positions[] = {
+		12.5f, -48.296299f, -3.34937f,
+		24.1480999f, -43.3013f, -6.47049999f,
+		25.0f, -43.3013f, 0.0f,
+		12.9408998f, -48.296299f, 0.0f,
+		11.2072001f, -48.296299f, -6.47049999f,
+		21.6506004f, -43.3013f, -12.5f,
+		24.1480999f, -43.3013f, -6.47049999f,
+		12.5f, -48.296299f, -3.34937f,
+		9.15065002f, -48.296299f, -9.15065002f,
+		17.6776009f, -43.3013f, -17.6776009f,
+		21.6506004f, -43.3013f, -12.5f,
+		11.2072001f, -48.296299f, -6.47049999f,
+		6.47049999f, -48.296299f, -11.2072001f,
+		12.5f, -43.3013f, -21.6506996f,
+		17.6776009f, -43.3013f, -17.6776009f,
+		9.15065002f, -48.296299f, -9.15065002f,
+		3.34935999f, -48.296299f, -12.5f,
+		6.47049999f, -43.3013f, -24.1481991f,
+		12.5f, -43.3013f, -21.6506996f,
+		6.47049999f, -48.296299f, -11.2072001f,
+		-4.2222e-06f, -48.296299f, -12.941f,
+		-3.78551999e-06f, -43.3012009f, -25.0f,
+		6.47049999f, -43.3013f, -24.1481991f,
+		3.34935999f, -48.296299f, -12.5f,
+		-3.34937f, -48.296299f, -12.5f,
+		-6.47049999f, -43.3012009f, -24.1481991f,
+		-3.78551999e-06f, -43.3012009f, -25.0f,
+		-4.2222e-06f, -48.296299f, -12.941f,
+		-6.47049999f, -48.296299f, -11.2072001f,
+		-12.5f, -43.3012009f, -21.6506996f,
+		-6.47049999f, -43.3012009f, -24.1481991f,
+		-3.34937f, -48.296299f, -12.5f,
+		-9.15065002f, -48.296299f, -9.15065002f,
+		-17.6777f, -43.3012009f, -17.6776009f,
+		-12.5f, -43.3012009f, -21.6506996f,
+		-6.47049999f, -48.296299f, -11.2072001f,
+		-11.2072001f, -48.296299f, -6.47049999f,
+		-21.6506996f, -43.3012009f, -12.5f,
+		-17.6777f, -43.3012009f, -17.6776009f,
+		-9.15065002f, -48.296299f, -9.15065002f,
+		-12.5f, -48.296299f, -3.34937f,
+		-24.1481991f, -43.3012009f, -6.47049999f,
+		-21.6506996f, -43.3012009f, -12.5f,
+		-11.2072001f, -48.296299f, -6.47049999f,
+		-12.941f, -48.296299f, -1.58480997e-15f,
+		-25.0f, -43.3012009f, -3.06160991e-15f,
+		-24.1481991f, -43.3012009f, -6.47049999f,
+		-12.5f, -48.296299f, -3.34937f,
+		-12.5f, -48.296299f, 3.34937f,
+		-24.1481991f, -43.3012009f, 6.47049999f,
+		-25.0f, -43.3012009f, -3.06160991e-15f,
+		-12.941f, -48.296299f, -1.58480997e-15f,
+		-11.2072001f, -48.296299f, 6.47049999f,
+		-21.6506996f, -43.3012009f, 12.5f,
+		-24.1481991f, -43.3012009f, 6.47049999f,
+		-12.5f, -48.296299f, 3.34937f,
+		-9.15065002f, -48.296299f, 9.15065002f,
+		-17.6777f, -43.3012009f, 17.6776009f,
+		-21.6506996f, -43.3012009f, 12.5f,
+		-11.2072001f, -48.296299f, 6.47049999f,
+		-6.47049999f, -48.296299f, 11.2072001f,
+		-12.5f, -43.3012009f, 21.6506996f,
+		-17.6777f, -43.3012009f, 17.6776009f,
+		-9.15065002f, -48.296299f, 9.15065002f,
+		-3.34937f, -48.296299f, 12.5f,
+		-6.47049999f, -43.3012009f, 24.1481991f,
+		-12.5f, -43.3012009f, 21.6506996f,
+		-6.47049999f, -48.296299f, 11.2072001f,
+		-4.2222e-06f, -48.296299f, 12.941f,
+		-3.78551999e-06f, -43.3012009f, 25.0f,
+		-6.47049999f, -43.3012009f, 24.1481991f,
+		-3.34937f, -48.296299f, 12.5f,
+		3.34935999f, -48.296299f, 12.5f,
+		6.47049999f, -43.3013f, 24.1481991f,
+		-3.78551999e-06f, -43.3012009f, 25.0f,
+		-4.2222e-06f, -48.296299f, 12.941f,
+		6.47049999f, -48.296299f, 11.2072001f,
+		12.5f, -43.3013f, 21.6506996f,
+		6.47049999f, -43.3013f, 24.1481991f,
+		3.34935999f, -48.296299f, 12.5f,
+		9.15065002f, -48.296299f, 9.15065002f,
+		17.6776009f, -43.3013f, 17.6776009f,
+		12.5f, -43.3013f, 21.6506996f,
+		6.47049999f, -48.296299f, 11.2072001f,
+		11.2072001f, -48.296299f, 6.47049999f,
+		21.6506004f, -43.3013f, 12.5f,
+		17.6776009f, -43.3013f, 17.6776009f,
+		9.15065002f, -48.296299f, 9.15065002f,
+		12.5f, -48.296299f, 3.34937f,
+		24.1480999f, -43.3013f, 6.47049999f,
+		21.6506004f, -43.3013f, 12.5f,
+		11.2072001f, -48.296299f, 6.47049999f,
+		12.9408998f, -48.296299f, 0.0f,
+		25.0f, -43.3013f, 0.0f,
+		24.1480999f, -43.3013f, 6.47049999f,
+		12.5f, -48.296299f, 3.34937f,
+		24.1480999f, -43.3013f, -6.47049999f,
+		34.1506004f, -35.3554001f, -9.15065002f,
+		35.3553009f, -35.3554001f, 0.0f,
+		25.0f, -43.3013f, 0.0f,
+		21.6506004f, -43.3013f, -12.5f,
+		30.6186008f, -35.3554001f, -17.6776009f,
+		34.1506004f, -35.3554001f, -9.15065002f,
+		24.1480999f, -43.3013f, -6.47049999f,
+		17.6776009f, -43.3013f, -17.6776009f,
+		25.0f, -35.3554001f, -25.0f,
+		30.6186008f, -35.3554001f, -17.6776009f,
+		21.6506004f, -43.3013f, -12.5f,
+		12.5f, -43.3013f, -21.6506996f,
+		17.6776009f, -35.3554001f, -30.6186008f,
+		25.0f, -35.3554001f, -25.0f,
+		17.6776009f, -43.3013f, -17.6776009f,
+		6.47049999f, -43.3013f, -24.1481991f,
+		9.15065002f, -35.3554001f, -34.1506004f,
+		17.6776009f, -35.3554001f, -30.6186008f,
+		12.5f, -43.3013f, -21.6506996f,
+		-3.78551999e-06f, -43.3012009f, -25.0f,
+		-3.09085999e-06f, -35.3553009f, -35.3554001f,
+		9.15065002f, -35.3554001f, -34.1506004f,
+		6.47049999f, -43.3013f, -24.1481991f,
+		-6.47049999f, -43.3012009f, -24.1481991f,
+		-9.15065002f, -35.3553009f, -34.1506004f,
+		-3.09085999e-06f, -35.3553009f, -35.3554001f,
+		-3.78551999e-06f, -43.3012009f, -25.0f,
+		-12.5f, -43.3012009f, -21.6506996f,
+		-17.6777f, -35.3553009f, -30.6186008f,
+		-9.15065002f, -35.3553009f, -34.1506004f,
+		-6.47049999f, -43.3012009f, -24.1481991f,
+		-17.6777f, -43.3012009f, -17.6776009f,
+		-25.0f, -35.3553009f, -25.0f,
+		-17.6777f, -35.3553009f, -30.6186008f,
+		-12.5f, -43.3012009f, -21.6506996f,
+		-21.6506996f, -43.3012009f, -12.5f,
+		-30.6186008f, -35.3553009f, -17.6776009f,
+		-25.0f, -35.3553009f, -25.0f,
+		-17.6777f, -43.3012009f, -17.6776009f,
+		-24.1481991f, -43.3012009f, -6.47049999f,
+		-34.1506996f, -35.3553009f, -9.15065002f,
+		-30.6186008f, -35.3553009f, -17.6776009f,
+		-21.6506996f, -43.3012009f, -12.5f,
+		-25.0f, -43.3012009f, -3.06160991e-15f,
+		-35.3554001f, -35.3553009f, -4.32978001e-15f,
+		-34.1506996f, -35.3553009f, -9.15065002f,
+		-24.1481991f, -43.3012009f, -6.47049999f,
+		-24.1481991f, -43.3012009f, 6.47049999f,
+		-34.1506996f, -35.3553009f, 9.15065002f,
+		-35.3554001f, -35.3553009f, -4.32978001e-15f,
+		-25.0f, -43.3012009f, -3.06160991e-15f,
+		-21.6506996f, -43.3012009f, 12.5f,
+		-30.6186008f, -35.3553009f, 17.6776009f,
+		-34.1506996f, -35.3553009f, 9.15065002f,
+		-24.1481991f, -43.3012009f, 6.47049999f,
+		-17.6777f, -43.3012009f, 17.6776009f,
+		-25.0f, -35.3553009f, 25.0f,
+		-30.6186008f, -35.3553009f, 17.6776009f,
+		-21.6506996f, -43.3012009f, 12.5f,
+		-12.5f, -43.3012009f, 21.6506996f,
+		-17.6777f, -35.3553009f, 30.6186008f,
+		-25.0f, -35.3553009f, 25.0f,
+		-17.6777f, -43.3012009f, 17.6776009f,
+		-6.47049999f, -43.3012009f, 24.1481991f,
+		-9.15065002f, -35.3553009f, 34.1506004f,
+		-17.6777f, -35.3553009f, 30.6186008f,
+		-12.5f, -43.3012009f, 21.6506996f,
+		-3.78551999e-06f, -43.3012009f, 25.0f,
+		-3.09085999e-06f, -35.3553009f, 35.3554001f,
+		-9.15065002f, -35.3553009f, 34.1506004f,
+		-6.47049999f, -43.3012009f, 24.1481991f,
+		6.47049999f, -43.3013f, 24.1481991f,
+		9.15065002f, -35.3554001f, 34.1506004f,
+		-3.09085999e-06f, -35.3553009f, 35.3554001f,
+		-3.78551999e-06f, -43.3012009f, 25.0f,
+		12.5f, -43.3013f, 21.6506996f,
+		17.6776009f, -35.3554001f, 30.6186008f,
+		9.15065002f, -35.3554001f, 34.1506004f,
+		6.47049999f, -43.3013f, 24.1481991f,
+		17.6776009f, -43.3013f, 17.6776009f,
+		25.0f, -35.3554001f, 25.0f,
+		17.6776009f, -35.3554001f, 30.6186008f,
+		12.5f, -43.3013f, 21.6506996f,
+		21.6506004f, -43.3013f, 12.5f,
+		30.6186008f, -35.3554001f, 17.6776009f,
+		25.0f, -35.3554001f, 25.0f,
+		17.6776009f, -43.3013f, 17.6776009f,
+		24.1480999f, -43.3013f, 6.47049999f,
+		34.1506004f, -35.3554001f, 9.15065002f,
+		30.6186008f, -35.3554001f, 17.6776009f,
+		21.6506004f, -43.3013f, 12.5f,
+		25.0f, -43.3013f, 0.0f,
+		35.3553009f, -35.3554001f, 0.0f,
+		34.1506004f, -35.3554001f, 9.15065002f,
+		24.1480999f, -43.3013f, 6.47049999f,
+		34.1506004f, -35.3554001f, -9.15065002f,
+		41.8258018f, -25.0f, -11.2072001f,
+		43.3012009f, -25.0f, 0.0f,
+		35.3553009f, -35.3554001f, 0.0f,
+		30.6186008f, -35.3554001f, -17.6776009f,
+		37.5f, -25.0f, -21.6506996f,
+		41.8258018f, -25.0f, -11.2072001f,
+		34.1506004f, -35.3554001f, -9.15065002f,
+		25.0f, -35.3554001f, -25.0f,
+		30.6186008f, -25.0f, -30.6186008f,
+		37.5f, -25.0f, -21.6506996f,
+		30.6186008f, -35.3554001f, -17.6776009f,
+		17.6776009f, -35.3554001f, -30.6186008f,
+		21.6506004f, -25.0f, -37.5f,
+		30.6186008f, -25.0f, -30.6186008f,
+		25.0f, -35.3554001f, -25.0f,
+		9.15065002f, -35.3554001f, -34.1506004f,
+		11.2072001f, -25.0f, -41.8258018f,
+		21.6506004f, -25.0f, -37.5f,
+		17.6776009f, -35.3554001f, -30.6186008f,
+		-3.09085999e-06f, -35.3553009f, -35.3554001f,
+		-2.18557011e-06f, -25.0f, -43.3013f,
+		11.2072001f, -25.0f, -41.8258018f,
+		9.15065002f, -35.3554001f, -34.1506004f,
+		-9.15065002f, -35.3553009f, -34.1506004f,
+		-11.2072001f, -25.0f, -41.8258018f,
+		-2.18557011e-06f, -25.0f, -43.3013f,
+		-3.09085999e-06f, -35.3553009f, -35.3554001f,
+		-17.6777f, -35.3553009f, -30.6186008f,
+		-21.6506996f, -25.0f, -37.5f,
+		-11.2072001f, -25.0f, -41.8258018f,
+		-9.15065002f, -35.3553009f, -34.1506004f,
+		-25.0f, -35.3553009f, -25.0f,
+		-30.6186008f, -25.0f, -30.6186008f,
+		-21.6506996f, -25.0f, -37.5f,
+		-17.6777f, -35.3553009f, -30.6186008f,
+		-30.6186008f, -35.3553009f, -17.6776009f,
+		-37.5f, -25.0f, -21.6506996f,
+		-30.6186008f, -25.0f, -30.6186008f,
+		-25.0f, -35.3553009f, -25.0f,
+		-34.1506996f, -35.3553009f, -9.15065002f,
+		-41.8258018f, -25.0f, -11.2072001f,
+		-37.5f, -25.0f, -21.6506996f,
+		-30.6186008f, -35.3553009f, -17.6776009f,
+		-35.3554001f, -35.3553009f, -4.32978001e-15f,
+		-43.3013f, -25.0f, -5.30290016e-15f,
+		-41.8258018f, -25.0f, -11.2072001f,
+		-34.1506996f, -35.3553009f, -9.15065002f,
+		-34.1506996f, -35.3553009f, 9.15065002f,
+		-41.8258018f, -25.0f, 11.2072001f,
+		-43.3013f, -25.0f, -5.30290016e-15f,
+		-35.3554001f, -35.3553009f, -4.32978001e-15f,
+		-30.6186008f, -35.3553009f, 17.6776009f,
+		-37.5f, -25.0f, 21.6506996f,
+		-41.8258018f, -25.0f, 11.2072001f,
+		-34.1506996f, -35.3553009f, 9.15065002f,
+		-25.0f, -35.3553009f, 25.0f,
+		-30.6186008f, -25.0f, 30.6186008f,
+		-37.5f, -25.0f, 21.6506996f,
+		-30.6186008f, -35.3553009f, 17.6776009f,
+		-17.6777f, -35.3553009f, 30.6186008f,
+		-21.6506996f, -25.0f, 37.5f,
+		-30.6186008f, -25.0f, 30.6186008f,
+		-25.0f, -35.3553009f, 25.0f,
+		-9.15065002f, -35.3553009f, 34.1506004f,
+		-11.2072001f, -25.0f, 41.8258018f,
+		-21.6506996f, -25.0f, 37.5f,
+		-17.6777f, -35.3553009f, 30.6186008f,
+		-3.09085999e-06f, -35.3553009f, 35.3554001f,
+		-2.18557011e-06f, -25.0f, 43.3013f,
+		-11.2072001f, -25.0f, 41.8258018f,
+		-9.15065002f, -35.3553009f, 34.1506004f,
+		9.15065002f, -35.3554001f, 34.1506004f,
+		11.2072001f, -25.0f, 41.8258018f,
+		-2.18557011e-06f, -25.0f, 43.3013f,
+		-3.09085999e-06f, -35.3553009f, 35.3554001f,
+		17.6776009f, -35.3554001f, 30.6186008f,
+		21.6506004f, -25.0f, 37.5f,
+		11.2072001f, -25.0f, 41.8258018f,
+		9.15065002f, -35.3554001f, 34.1506004f,
+		25.0f, -35.3554001f, 25.0f,
+		30.6186008f, -25.0f, 30.6186008f,
+		21.6506004f, -25.0f, 37.5f,
+		17.6776009f, -35.3554001f, 30.6186008f,
+		30.6186008f, -35.3554001f, 17.6776009f,
+		37.5f, -25.0f, 21.6506996f,
+		30.6186008f, -25.0f, 30.6186008f,
+		25.0f, -35.3554001f, 25.0f,
+		34.1506004f, -35.3554001f, 9.15065002f,
+		41.8258018f, -25.0f, 11.2072001f,
+		37.5f, -25.0f, 21.6506996f,
+		30.6186008f, -35.3554001f, 17.6776009f,
+		35.3553009f, -35.3554001f, 0.0f,
+		43.3012009f, -25.0f, 0.0f,
+		41.8258018f, -25.0f, 11.2072001f,
+		34.1506004f, -35.3554001f, 9.15065002f,
+		41.8258018f, -25.0f, -11.2072001f,
+		46.6506004f, -12.941f, -12.5f,
+		48.296299f, -12.941f, 0.0f,
+		43.3012009f, -25.0f, 0.0f,
+		37.5f, -25.0f, -21.6506996f,
+		41.8258018f, -12.941f, -24.1481991f,
+		46.6506004f, -12.941f, -12.5f,
+		41.8258018f, -25.0f, -11.2072001f,
+		30.6186008f, -25.0f, -30.6186008f,
+		34.1506004f, -12.941f, -34.1506004f,
+		41.8258018f, -12.941f, -24.1481991f,
+		37.5f, -25.0f, -21.6506996f,
+		21.6506004f, -25.0f, -37.5f,
+		24.1480999f, -12.941f, -41.8258018f,
+		34.1506004f, -12.941f, -34.1506004f,
+		30.6186008f, -25.0f, -30.6186008f,
+		11.2072001f, -25.0f, -41.8258018f,
+		12.5f, -12.941f, -46.6506004f,
+		24.1480999f, -12.941f, -41.8258018f,
+		21.6506004f, -25.0f, -37.5f,
+		-2.18557011e-06f, -25.0f, -43.3013f,
+		-1.13133001e-06f, -12.9408998f, -48.296299f,
+		12.5f, -12.941f, -46.6506004f,
+		11.2072001f, -25.0f, -41.8258018f,
+		-11.2072001f, -25.0f, -41.8258018f,
+		-12.5f, -12.9408998f, -46.6506004f,
+		-1.13133001e-06f, -12.9408998f, -48.296299f,
+		-2.18557011e-06f, -25.0f, -43.3013f,
+		-21.6506996f, -25.0f, -37.5f,
+		-24.1481991f, -12.9408998f, -41.8258018f,
+		-12.5f, -12.9408998f, -46.6506004f,
+		-11.2072001f, -25.0f, -41.8258018f,
+		-30.6186008f, -25.0f, -30.6186008f,
+		-34.1506996f, -12.9408998f, -34.1506004f,
+		-24.1481991f, -12.9408998f, -41.8258018f,
+		-21.6506996f, -25.0f, -37.5f,
+		-37.5f, -25.0f, -21.6506996f,
+		-41.8258018f, -12.9408998f, -24.1481991f,
+		-34.1506996f, -12.9408998f, -34.1506004f,
+		-30.6186008f, -25.0f, -30.6186008f,
+		-41.8258018f, -25.0f, -11.2072001f,
+		-46.6506996f, -12.9408998f, -12.5f,
+		-41.8258018f, -12.9408998f, -24.1481991f,
+		-37.5f, -25.0f, -21.6506996f,
+		-43.3013f, -25.0f, -5.30290016e-15f,
+		-48.296299f, -12.9408998f, -5.91459983e-15f,
+		-46.6506996f, -12.9408998f, -12.5f,
+		-41.8258018f, -25.0f, -11.2072001f,
+		-41.8258018f, -25.0f, 11.2072001f,
+		-46.6506996f, -12.9408998f, 12.5f,
+		-48.296299f, -12.9408998f, -5.91459983e-15f,
+		-43.3013f, -25.0f, -5.30290016e-15f,
+		-37.5f, -25.0f, 21.6506996f,
+		-41.8258018f, -12.9408998f, 24.1481991f,
+		-46.6506996f, -12.9408998f, 12.5f,
+		-41.8258018f, -25.0f, 11.2072001f,
+		-30.6186008f, -25.0f, 30.6186008f,
+		-34.1506996f, -12.9408998f, 34.1506004f,
+		-41.8258018f, -12.9408998f, 24.1481991f,
+		-37.5f, -25.0f, 21.6506996f,
+		-21.6506996f, -25.0f, 37.5f,
+		-24.1481991f, -12.9408998f, 41.8258018f,
+		-34.1506996f, -12.9408998f, 34.1506004f,
+		-30.6186008f, -25.0f, 30.6186008f,
+		-11.2072001f, -25.0f, 41.8258018f,
+		-12.5f, -12.9408998f, 46.6506004f,
+		-24.1481991f, -12.9408998f, 41.8258018f,
+		-21.6506996f, -25.0f, 37.5f,
+		-2.18557011e-06f, -25.0f, 43.3013f,
+		-1.13133001e-06f, -12.9408998f, 48.296299f,
+		-12.5f, -12.9408998f, 46.6506004f,
+		-11.2072001f, -25.0f, 41.8258018f,
+		11.2072001f, -25.0f, 41.8258018f,
+		12.5f, -12.941f, 46.6506004f,
+		-1.13133001e-06f, -12.9408998f, 48.296299f,
+		-2.18557011e-06f, -25.0f, 43.3013f,
+		21.6506004f, -25.0f, 37.5f,
+		24.1480999f, -12.941f, 41.8258018f,
+		12.5f, -12.941f, 46.6506004f,
+		11.2072001f, -25.0f, 41.8258018f,
+		30.6186008f, -25.0f, 30.6186008f,
+		34.1506004f, -12.941f, 34.1506004f,
+		24.1480999f, -12.941f, 41.8258018f,
+		21.6506004f, -25.0f, 37.5f,
+		37.5f, -25.0f, 21.6506996f,
+		41.8258018f, -12.941f, 24.1481991f,
+		34.1506004f, -12.941f, 34.1506004f,
+		30.6186008f, -25.0f, 30.6186008f,
+		41.8258018f, -25.0f, 11.2072001f,
+		46.6506004f, -12.941f, 12.5f,
+		41.8258018f, -12.941f, 24.1481991f,
+		37.5f, -25.0f, 21.6506996f,
+		43.3012009f, -25.0f, 0.0f,
+		48.296299f, -12.941f, 0.0f,
+		46.6506004f, -12.941f, 12.5f,
+		41.8258018f, -25.0f, 11.2072001f,
+		46.6506004f, -12.941f, -12.5f,
+		48.296299f, -4.2222e-06f, -12.941f,
+		50.0f, -4.37114022e-06f, 0.0f,
+		48.296299f, -12.941f, 0.0f,
+		41.8258018f, -12.941f, -24.1481991f,
+		43.3012009f, -3.78551999e-06f, -25.0f,
+		48.296299f, -4.2222e-06f, -12.941f,
+		46.6506004f, -12.941f, -12.5f,
+		34.1506004f, -12.941f, -34.1506004f,
+		35.3553009f, -3.09085999e-06f, -35.3554001f,
+		43.3012009f, -3.78551999e-06f, -25.0f,
+		41.8258018f, -12.941f, -24.1481991f,
+		24.1480999f, -12.941f, -41.8258018f,
+		25.0f, -2.18557011e-06f, -43.3013f,
+		35.3553009f, -3.09085999e-06f, -35.3554001f,
+		34.1506004f, -12.941f, -34.1506004f,
+		12.5f, -12.941f, -46.6506004f,
+		12.9408998f, -1.13133001e-06f, -48.296299f,
+		25.0f, -2.18557011e-06f, -43.3013f,
+		24.1480999f, -12.941f, -41.8258018f,
+		-1.13133001e-06f, -12.9408998f, -48.296299f,
+		3.06160991e-15f, -2.67655002e-22f, -50.0f,
+		12.9408998f, -1.13133001e-06f, -48.296299f,
+		12.5f, -12.941f, -46.6506004f,
+		-12.5f, -12.9408998f, -46.6506004f,
+		-12.9408998f, 1.13133001e-06f, -48.296299f,
+		3.06160991e-15f, -2.67655002e-22f, -50.0f,
+		-1.13133001e-06f, -12.9408998f, -48.296299f,
+		-24.1481991f, -12.9408998f, -41.8258018f,
+		-25.0f, 2.18557011e-06f, -43.3013f,
+		-12.9408998f, 1.13133001e-06f, -48.296299f,
+		-12.5f, -12.9408998f, -46.6506004f,
+		-34.1506996f, -12.9408998f, -34.1506004f,
+		-35.3553009f, 3.09085999e-06f, -35.3554001f,
+		-25.0f, 2.18557011e-06f, -43.3013f,
+		-24.1481991f, -12.9408998f, -41.8258018f,
+		-41.8258018f, -12.9408998f, -24.1481991f,
+		-43.3012009f, 3.78551999e-06f, -25.0f,
+		-35.3553009f, 3.09085999e-06f, -35.3554001f,
+		-34.1506996f, -12.9408998f, -34.1506004f,
+		-46.6506996f, -12.9408998f, -12.5f,
+		-48.296299f, 4.2222e-06f, -12.941f,
+		-43.3012009f, 3.78551999e-06f, -25.0f,
+		-41.8258018f, -12.9408998f, -24.1481991f,
+		-48.296299f, -12.9408998f, -5.91459983e-15f,
+		-50.0f, 4.37114022e-06f, -6.12324988e-15f,
+		-48.296299f, 4.2222e-06f, -12.941f,
+		-46.6506996f, -12.9408998f, -12.5f,
+		-46.6506996f, -12.9408998f, 12.5f,
+		-48.296299f, 4.2222e-06f, 12.941f,
+		-50.0f, 4.37114022e-06f, -6.12324988e-15f,
+		-48.296299f, -12.9408998f, -5.91459983e-15f,
+		-41.8258018f, -12.9408998f, 24.1481991f,
+		-43.3012009f, 3.78551999e-06f, 25.0f,
+		-48.296299f, 4.2222e-06f, 12.941f,
+		-46.6506996f, -12.9408998f, 12.5f,
+		-34.1506996f, -12.9408998f, 34.1506004f,
+		-35.3553009f, 3.09085999e-06f, 35.3554001f,
+		-43.3012009f, 3.78551999e-06f, 25.0f,
+		-41.8258018f, -12.9408998f, 24.1481991f,
+		-24.1481991f, -12.9408998f, 41.8258018f,
+		-25.0f, 2.18557011e-06f, 43.3013f,
+		-35.3553009f, 3.09085999e-06f, 35.3554001f,
+		-34.1506996f, -12.9408998f, 34.1506004f,
+		-12.5f, -12.9408998f, 46.6506004f,
+		-12.9408998f, 1.13133001e-06f, 48.296299f,
+		-25.0f, 2.18557011e-06f, 43.3013f,
+		-24.1481991f, -12.9408998f, 41.8258018f,
+		-1.13133001e-06f, -12.9408998f, 48.296299f,
+		-9.18485004e-15f, 8.02964981e-22f, 50.0f,
+		-12.9408998f, 1.13133001e-06f, 48.296299f,
+		-12.5f, -12.9408998f, 46.6506004f,
+		12.5f, -12.941f, 46.6506004f,
+		12.9408998f, -1.13133001e-06f, 48.296299f,
+		-9.18485004e-15f, 8.02964981e-22f, 50.0f,
+		-1.13133001e-06f, -12.9408998f, 48.296299f,
+		24.1480999f, -12.941f, 41.8258018f,
+		25.0f, -2.18557011e-06f, 43.3013f,
+		12.9408998f, -1.13133001e-06f, 48.296299f,
+		12.5f, -12.941f, 46.6506004f,
+		34.1506004f, -12.941f, 34.1506004f,
+		35.3553009f, -3.09085999e-06f, 35.3554001f,
+		25.0f, -2.18557011e-06f, 43.3013f,
+		24.1480999f, -12.941f, 41.8258018f,
+		41.8258018f, -12.941f, 24.1481991f,
+		43.3012009f, -3.78551999e-06f, 25.0f,
+		35.3553009f, -3.09085999e-06f, 35.3554001f,
+		34.1506004f, -12.941f, 34.1506004f,
+		46.6506004f, -12.941f, 12.5f,
+		48.296299f, -4.2222e-06f, 12.941f,
+		43.3012009f, -3.78551999e-06f, 25.0f,
+		41.8258018f, -12.941f, 24.1481991f,
+		48.296299f, -12.941f, 0.0f,
+		50.0f, -4.37114022e-06f, 0.0f,
+		48.296299f, -4.2222e-06f, 12.941f,
+		46.6506004f, -12.941f, 12.5f,
+		48.296299f, -4.2222e-06f, -12.941f,
+		46.6506996f, 12.9408998f, -12.5f,
+		48.296299f, 12.9408998f, 0.0f,
+		50.0f, -4.37114022e-06f, 0.0f,
+		43.3012009f, -3.78551999e-06f, -25.0f,
+		41.8258018f, 12.9408998f, -24.1481991f,
+		46.6506996f, 12.9408998f, -12.5f,
+		48.296299f, -4.2222e-06f, -12.941f,
+		35.3553009f, -3.09085999e-06f, -35.3554001f,
+		34.1506996f, 12.9408998f, -34.1506004f,
+		41.8258018f, 12.9408998f, -24.1481991f,
+		43.3012009f, -3.78551999e-06f, -25.0f,
+		25.0f, -2.18557011e-06f, -43.3013f,
+		24.1481991f, 12.9408998f, -41.8258018f,
+		34.1506996f, 12.9408998f, -34.1506004f,
+		35.3553009f, -3.09085999e-06f, -35.3554001f,
+		12.9408998f, -1.13133001e-06f, -48.296299f,
+		12.5f, 12.9408998f, -46.6506004f,
+		24.1481991f, 12.9408998f, -41.8258018f,
+		25.0f, -2.18557011e-06f, -43.3013f,
+		3.06160991e-15f, -2.67655002e-22f, -50.0f,
+		1.13133001e-06f, 12.9408998f, -48.296299f,
+		12.5f, 12.9408998f, -46.6506004f,
+		12.9408998f, -1.13133001e-06f, -48.296299f,
+		-12.9408998f, 1.13133001e-06f, -48.296299f,
+		-12.5f, 12.941f, -46.6506004f,
+		1.13133001e-06f, 12.9408998f, -48.296299f,
+		3.06160991e-15f, -2.67655002e-22f, -50.0f,
+		-25.0f, 2.18557011e-06f, -43.3013f,
+		-24.1480999f, 12.941f, -41.8258018f,
+		-12.5f, 12.941f, -46.6506004f,
+		-12.9408998f, 1.13133001e-06f, -48.296299f,
+		-35.3553009f, 3.09085999e-06f, -35.3554001f,
+		-34.1506004f, 12.941f, -34.1506004f,
+		-24.1480999f, 12.941f, -41.8258018f,
+		-25.0f, 2.18557011e-06f, -43.3013f,
+		-43.3012009f, 3.78551999e-06f, -25.0f,
+		-41.8258018f, 12.941f, -24.1481991f,
+		-34.1506004f, 12.941f, -34.1506004f,
+		-35.3553009f, 3.09085999e-06f, -35.3554001f,
+		-48.296299f, 4.2222e-06f, -12.941f,
+		-46.6506004f, 12.941f, -12.5f,
+		-41.8258018f, 12.941f, -24.1481991f,
+		-43.3012009f, 3.78551999e-06f, -25.0f,
+		-50.0f, 4.37114022e-06f, -6.12324988e-15f,
+		-48.296299f, 12.941f, -5.91459983e-15f,
+		-46.6506004f, 12.941f, -12.5f,
+		-48.296299f, 4.2222e-06f, -12.941f,
+		-48.296299f, 4.2222e-06f, 12.941f,
+		-46.6506004f, 12.941f, 12.5f,
+		-48.296299f, 12.941f, -5.91459983e-15f,
+		-50.0f, 4.37114022e-06f, -6.12324988e-15f,
+		-43.3012009f, 3.78551999e-06f, 25.0f,
+		-41.8258018f, 12.941f, 24.1481991f,
+		-46.6506004f, 12.941f, 12.5f,
+		-48.296299f, 4.2222e-06f, 12.941f,
+		-35.3553009f, 3.09085999e-06f, 35.3554001f,
+		-34.1506004f, 12.941f, 34.1506004f,
+		-41.8258018f, 12.941f, 24.1481991f,
+		-43.3012009f, 3.78551999e-06f, 25.0f,
+		-25.0f, 2.18557011e-06f, 43.3013f,
+		-24.1480999f, 12.941f, 41.8258018f,
+		-34.1506004f, 12.941f, 34.1506004f,
+		-35.3553009f, 3.09085999e-06f, 35.3554001f,
+		-12.9408998f, 1.13133001e-06f, 48.296299f,
+		-12.5f, 12.941f, 46.6506004f,
+		-24.1480999f, 12.941f, 41.8258018f,
+		-25.0f, 2.18557011e-06f, 43.3013f,
+		-9.18485004e-15f, 8.02964981e-22f, 50.0f,
+		1.13133001e-06f, 12.9408998f, 48.296299f,
+		-12.5f, 12.941f, 46.6506004f,
+		-12.9408998f, 1.13133001e-06f, 48.296299f,
+		12.9408998f, -1.13133001e-06f, 48.296299f,
+		12.5f, 12.9408998f, 46.6506004f,
+		1.13133001e-06f, 12.9408998f, 48.296299f,
+		-9.18485004e-15f, 8.02964981e-22f, 50.0f,
+		25.0f, -2.18557011e-06f, 43.3013f,
+		24.1481991f, 12.9408998f, 41.8258018f,
+		12.5f, 12.9408998f, 46.6506004f,
+		12.9408998f, -1.13133001e-06f, 48.296299f,
+		35.3553009f, -3.09085999e-06f, 35.3554001f,
+		34.1506996f, 12.9408998f, 34.1506004f,
+		24.1481991f, 12.9408998f, 41.8258018f,
+		25.0f, -2.18557011e-06f, 43.3013f,
+		43.3012009f, -3.78551999e-06f, 25.0f,
+		41.8258018f, 12.9408998f, 24.1481991f,
+		34.1506996f, 12.9408998f, 34.1506004f,
+		35.3553009f, -3.09085999e-06f, 35.3554001f,
+		48.296299f, -4.2222e-06f, 12.941f,
+		46.6506996f, 12.9408998f, 12.5f,
+		41.8258018f, 12.9408998f, 24.1481991f,
+		43.3012009f, -3.78551999e-06f, 25.0f,
+		50.0f, -4.37114022e-06f, 0.0f,
+		48.296299f, 12.9408998f, 0.0f,
+		46.6506996f, 12.9408998f, 12.5f,
+		48.296299f, -4.2222e-06f, 12.941f,
+		46.6506996f, 12.9408998f, -12.5f,
+		41.8258018f, 25.0f, -11.2072001f,
+		43.3013f, 25.0f, 0.0f,
+		48.296299f, 12.9408998f, 0.0f,
+		41.8258018f, 12.9408998f, -24.1481991f,
+		37.5f, 25.0f, -21.6506996f,
+		41.8258018f, 25.0f, -11.2072001f,
+		46.6506996f, 12.9408998f, -12.5f,
+		34.1506996f, 12.9408998f, -34.1506004f,
+		30.6186008f, 25.0f, -30.6186008f,
+		37.5f, 25.0f, -21.6506996f,
+		41.8258018f, 12.9408998f, -24.1481991f,
+		24.1481991f, 12.9408998f, -41.8258018f,
+		21.6506996f, 25.0f, -37.5f,
+		30.6186008f, 25.0f, -30.6186008f,
+		34.1506996f, 12.9408998f, -34.1506004f,
+		12.5f, 12.9408998f, -46.6506004f,
+		11.2072001f, 25.0f, -41.8258018f,
+		21.6506996f, 25.0f, -37.5f,
+		24.1481991f, 12.9408998f, -41.8258018f,
+		1.13133001e-06f, 12.9408998f, -48.296299f,
+		2.18557011e-06f, 25.0f, -43.3013f,
+		11.2072001f, 25.0f, -41.8258018f,
+		12.5f, 12.9408998f, -46.6506004f,
+		-12.5f, 12.941f, -46.6506004f,
+		-11.2072001f, 25.0f, -41.8258018f,
+		2.18557011e-06f, 25.0f, -43.3013f,
+		1.13133001e-06f, 12.9408998f, -48.296299f,
+		-24.1480999f, 12.941f, -41.8258018f,
+		-21.6506004f, 25.0f, -37.5f,
+		-11.2072001f, 25.0f, -41.8258018f,
+		-12.5f, 12.941f, -46.6506004f,
+		-34.1506004f, 12.941f, -34.1506004f,
+		-30.6186008f, 25.0f, -30.6186008f,
+		-21.6506004f, 25.0f, -37.5f,
+		-24.1480999f, 12.941f, -41.8258018f,
+		-41.8258018f, 12.941f, -24.1481991f,
+		-37.5f, 25.0f, -21.6506996f,
+		-30.6186008f, 25.0f, -30.6186008f,
+		-34.1506004f, 12.941f, -34.1506004f,
+		-46.6506004f, 12.941f, -12.5f,
+		-41.8258018f, 25.0f, -11.2072001f,
+		-37.5f, 25.0f, -21.6506996f,
+		-41.8258018f, 12.941f, -24.1481991f,
+		-48.296299f, 12.941f, -5.91459983e-15f,
+		-43.3012009f, 25.0f, -5.30290016e-15f,
+		-41.8258018f, 25.0f, -11.2072001f,
+		-46.6506004f, 12.941f, -12.5f,
+		-46.6506004f, 12.941f, 12.5f,
+		-41.8258018f, 25.0f, 11.2072001f,
+		-43.3012009f, 25.0f, -5.30290016e-15f,
+		-48.296299f, 12.941f, -5.91459983e-15f,
+		-41.8258018f, 12.941f, 24.1481991f,
+		-37.5f, 25.0f, 21.6506996f,
+		-41.8258018f, 25.0f, 11.2072001f,
+		-46.6506004f, 12.941f, 12.5f,
+		-34.1506004f, 12.941f, 34.1506004f,
+		-30.6186008f, 25.0f, 30.6186008f,
+		-37.5f, 25.0f, 21.6506996f,
+		-41.8258018f, 12.941f, 24.1481991f,
+		-24.1480999f, 12.941f, 41.8258018f,
+		-21.6506004f, 25.0f, 37.5f,
+		-30.6186008f, 25.0f, 30.6186008f,
+		-34.1506004f, 12.941f, 34.1506004f,
+		-12.5f, 12.941f, 46.6506004f,
+		-11.2072001f, 25.0f, 41.8258018f,
+		-21.6506004f, 25.0f, 37.5f,
+		-24.1480999f, 12.941f, 41.8258018f,
+		1.13133001e-06f, 12.9408998f, 48.296299f,
+		2.18557011e-06f, 25.0f, 43.3013f,
+		-11.2072001f, 25.0f, 41.8258018f,
+		-12.5f, 12.941f, 46.6506004f,
+		12.5f, 12.9408998f, 46.6506004f,
+		11.2072001f, 25.0f, 41.8258018f,
+		2.18557011e-06f, 25.0f, 43.3013f,
+		1.13133001e-06f, 12.9408998f, 48.296299f,
+		24.1481991f, 12.9408998f, 41.8258018f,
+		21.6506996f, 25.0f, 37.5f,
+		11.2072001f, 25.0f, 41.8258018f,
+		12.5f, 12.9408998f, 46.6506004f,
+		34.1506996f, 12.9408998f, 34.1506004f,
+		30.6186008f, 25.0f, 30.6186008f,
+		21.6506996f, 25.0f, 37.5f,
+		24.1481991f, 12.9408998f, 41.8258018f,
+		41.8258018f, 12.9408998f, 24.1481991f,
+		37.5f, 25.0f, 21.6506996f,
+		30.6186008f, 25.0f, 30.6186008f,
+		34.1506996f, 12.9408998f, 34.1506004f,
+		46.6506996f, 12.9408998f, 12.5f,
+		41.8258018f, 25.0f, 11.2072001f,
+		37.5f, 25.0f, 21.6506996f,
+		41.8258018f, 12.9408998f, 24.1481991f,
+		48.296299f, 12.9408998f, 0.0f,
+		43.3013f, 25.0f, 0.0f,
+		41.8258018f, 25.0f, 11.2072001f,
+		46.6506996f, 12.9408998f, 12.5f,
+		41.8258018f, 25.0f, -11.2072001f,
+		34.1506996f, 35.3553009f, -9.15065002f,
+		35.3554001f, 35.3553009f, 0.0f,
+		43.3013f, 25.0f, 0.0f,
+		37.5f, 25.0f, -21.6506996f,
+		30.6186008f, 35.3553009f, -17.6776009f,
+		34.1506996f, 35.3553009f, -9.15065002f,
+		41.8258018f, 25.0f, -11.2072001f,
+		30.6186008f, 25.0f, -30.6186008f,
+		25.0f, 35.3553009f, -25.0f,
+		30.6186008f, 35.3553009f, -17.6776009f,
+		37.5f, 25.0f, -21.6506996f,
+		21.6506996f, 25.0f, -37.5f,
+		17.6777f, 35.3553009f, -30.6186008f,
+		25.0f, 35.3553009f, -25.0f,
+		30.6186008f, 25.0f, -30.6186008f,
+		11.2072001f, 25.0f, -41.8258018f,
+		9.15065002f, 35.3553009f, -34.1506004f,
+		17.6777f, 35.3553009f, -30.6186008f,
+		21.6506996f, 25.0f, -37.5f,
+		2.18557011e-06f, 25.0f, -43.3013f,
+		3.09085999e-06f, 35.3553009f, -35.3554001f,
+		9.15065002f, 35.3553009f, -34.1506004f,
+		11.2072001f, 25.0f, -41.8258018f,
+		-11.2072001f, 25.0f, -41.8258018f,
+		-9.15065002f, 35.3554001f, -34.1506004f,
+		3.09085999e-06f, 35.3553009f, -35.3554001f,
+		2.18557011e-06f, 25.0f, -43.3013f,
+		-21.6506004f, 25.0f, -37.5f,
+		-17.6776009f, 35.3554001f, -30.6186008f,
+		-9.15065002f, 35.3554001f, -34.1506004f,
+		-11.2072001f, 25.0f, -41.8258018f,
+		-30.6186008f, 25.0f, -30.6186008f,
+		-25.0f, 35.3554001f, -25.0f,
+		-17.6776009f, 35.3554001f, -30.6186008f,
+		-21.6506004f, 25.0f, -37.5f,
+		-37.5f, 25.0f, -21.6506996f,
+		-30.6186008f, 35.3554001f, -17.6776009f,
+		-25.0f, 35.3554001f, -25.0f,
+		-30.6186008f, 25.0f, -30.6186008f,
+		-41.8258018f, 25.0f, -11.2072001f,
+		-34.1506004f, 35.3554001f, -9.15065002f,
+		-30.6186008f, 35.3554001f, -17.6776009f,
+		-37.5f, 25.0f, -21.6506996f,
+		-43.3012009f, 25.0f, -5.30290016e-15f,
+		-35.3553009f, 35.3554001f, -4.32978001e-15f,
+		-34.1506004f, 35.3554001f, -9.15065002f,
+		-41.8258018f, 25.0f, -11.2072001f,
+		-41.8258018f, 25.0f, 11.2072001f,
+		-34.1506004f, 35.3554001f, 9.15065002f,
+		-35.3553009f, 35.3554001f, -4.32978001e-15f,
+		-43.3012009f, 25.0f, -5.30290016e-15f,
+		-37.5f, 25.0f, 21.6506996f,
+		-30.6186008f, 35.3554001f, 17.6776009f,
+		-34.1506004f, 35.3554001f, 9.15065002f,
+		-41.8258018f, 25.0f, 11.2072001f,
+		-30.6186008f, 25.0f, 30.6186008f,
+		-25.0f, 35.3554001f, 25.0f,
+		-30.6186008f, 35.3554001f, 17.6776009f,
+		-37.5f, 25.0f, 21.6506996f,
+		-21.6506004f, 25.0f, 37.5f,
+		-17.6776009f, 35.3554001f, 30.6186008f,
+		-25.0f, 35.3554001f, 25.0f,
+		-30.6186008f, 25.0f, 30.6186008f,
+		-11.2072001f, 25.0f, 41.8258018f,
+		-9.15065002f, 35.3554001f, 34.1506004f,
+		-17.6776009f, 35.3554001f, 30.6186008f,
+		-21.6506004f, 25.0f, 37.5f,
+		2.18557011e-06f, 25.0f, 43.3013f,
+		3.09085999e-06f, 35.3553009f, 35.3554001f,
+		-9.15065002f, 35.3554001f, 34.1506004f,
+		-11.2072001f, 25.0f, 41.8258018f,
+		11.2072001f, 25.0f, 41.8258018f,
+		9.15065002f, 35.3553009f, 34.1506004f,
+		3.09085999e-06f, 35.3553009f, 35.3554001f,
+		2.18557011e-06f, 25.0f, 43.3013f,
+		21.6506996f, 25.0f, 37.5f,
+		17.6777f, 35.3553009f, 30.6186008f,
+		9.15065002f, 35.3553009f, 34.1506004f,
+		11.2072001f, 25.0f, 41.8258018f,
+		30.6186008f, 25.0f, 30.6186008f,
+		25.0f, 35.3553009f, 25.0f,
+		17.6777f, 35.3553009f, 30.6186008f,
+		21.6506996f, 25.0f, 37.5f,
+		37.5f, 25.0f, 21.6506996f,
+		30.6186008f, 35.3553009f, 17.6776009f,
+		25.0f, 35.3553009f, 25.0f,
+		30.6186008f, 25.0f, 30.6186008f,
+		41.8258018f, 25.0f, 11.2072001f,
+		34.1506996f, 35.3553009f, 9.15065002f,
+		30.6186008f, 35.3553009f, 17.6776009f,
+		37.5f, 25.0f, 21.6506996f,
+		43.3013f, 25.0f, 0.0f,
+		35.3554001f, 35.3553009f, 0.0f,
+		34.1506996f, 35.3553009f, 9.15065002f,
+		41.8258018f, 25.0f, 11.2072001f,
+		34.1506996f, 35.3553009f, -9.15065002f,
+		24.1481991f, 43.3012009f, -6.47049999f,
+		25.0f, 43.3012009f, 0.0f,
+		35.3554001f, 35.3553009f, 0.0f,
+		30.6186008f, 35.3553009f, -17.6776009f,
+		21.6506996f, 43.3012009f, -12.5f,
+		24.1481991f, 43.3012009f, -6.47049999f,
+		34.1506996f, 35.3553009f, -9.15065002f,
+		25.0f, 35.3553009f, -25.0f,
+		17.6777f, 43.3012009f, -17.6776009f,
+		21.6506996f, 43.3012009f, -12.5f,
+		30.6186008f, 35.3553009f, -17.6776009f,
+		17.6777f, 35.3553009f, -30.6186008f,
+		12.5f, 43.3012009f, -21.6506996f,
+		17.6777f, 43.3012009f, -17.6776009f,
+		25.0f, 35.3553009f, -25.0f,
+		9.15065002f, 35.3553009f, -34.1506004f,
+		6.47049999f, 43.3012009f, -24.1481991f,
+		12.5f, 43.3012009f, -21.6506996f,
+		17.6777f, 35.3553009f, -30.6186008f,
+		3.09085999e-06f, 35.3553009f, -35.3554001f,
+		3.78551999e-06f, 43.3012009f, -25.0f,
+		6.47049999f, 43.3012009f, -24.1481991f,
+		9.15065002f, 35.3553009f, -34.1506004f,
+		-9.15065002f, 35.3554001f, -34.1506004f,
+		-6.47049999f, 43.3013f, -24.1481991f,
+		3.78551999e-06f, 43.3012009f, -25.0f,
+		3.09085999e-06f, 35.3553009f, -35.3554001f,
+		-17.6776009f, 35.3554001f, -30.6186008f,
+		-12.5f, 43.3013f, -21.6506996f,
+		-6.47049999f, 43.3013f, -24.1481991f,
+		-9.15065002f, 35.3554001f, -34.1506004f,
+		-25.0f, 35.3554001f, -25.0f,
+		-17.6776009f, 43.3013f, -17.6776009f,
+		-12.5f, 43.3013f, -21.6506996f,
+		-17.6776009f, 35.3554001f, -30.6186008f,
+		-30.6186008f, 35.3554001f, -17.6776009f,
+		-21.6506004f, 43.3013f, -12.5f,
+		-17.6776009f, 43.3013f, -17.6776009f,
+		-25.0f, 35.3554001f, -25.0f,
+		-34.1506004f, 35.3554001f, -9.15065002f,
+		-24.1480999f, 43.3013f, -6.47049999f,
+		-21.6506004f, 43.3013f, -12.5f,
+		-30.6186008f, 35.3554001f, -17.6776009f,
+		-35.3553009f, 35.3554001f, -4.32978001e-15f,
+		-25.0f, 43.3013f, -3.06160991e-15f,
+		-24.1480999f, 43.3013f, -6.47049999f,
+		-34.1506004f, 35.3554001f, -9.15065002f,
+		-34.1506004f, 35.3554001f, 9.15065002f,
+		-24.1480999f, 43.3013f, 6.47049999f,
+		-25.0f, 43.3013f, -3.06160991e-15f,
+		-35.3553009f, 35.3554001f, -4.32978001e-15f,
+		-30.6186008f, 35.3554001f, 17.6776009f,
+		-21.6506004f, 43.3013f, 12.5f,
+		-24.1480999f, 43.3013f, 6.47049999f,
+		-34.1506004f, 35.3554001f, 9.15065002f,
+		-25.0f, 35.3554001f, 25.0f,
+		-17.6776009f, 43.3013f, 17.6776009f,
+		-21.6506004f, 43.3013f, 12.5f,
+		-30.6186008f, 35.3554001f, 17.6776009f,
+		-17.6776009f, 35.3554001f, 30.6186008f,
+		-12.5f, 43.3013f, 21.6506996f,
+		-17.6776009f, 43.3013f, 17.6776009f,
+		-25.0f, 35.3554001f, 25.0f,
+		-9.15065002f, 35.3554001f, 34.1506004f,
+		-6.47049999f, 43.3013f, 24.1481991f,
+		-12.5f, 43.3013f, 21.6506996f,
+		-17.6776009f, 35.3554001f, 30.6186008f,
+		3.09085999e-06f, 35.3553009f, 35.3554001f,
+		3.78551999e-06f, 43.3012009f, 25.0f,
+		-6.47049999f, 43.3013f, 24.1481991f,
+		-9.15065002f, 35.3554001f, 34.1506004f,
+		9.15065002f, 35.3553009f, 34.1506004f,
+		6.47049999f, 43.3012009f, 24.1481991f,
+		3.78551999e-06f, 43.3012009f, 25.0f,
+		3.09085999e-06f, 35.3553009f, 35.3554001f,
+		17.6777f, 35.3553009f, 30.6186008f,
+		12.5f, 43.3012009f, 21.6506996f,
+		6.47049999f, 43.3012009f, 24.1481991f,
+		9.15065002f, 35.3553009f, 34.1506004f,
+		25.0f, 35.3553009f, 25.0f,
+		17.6777f, 43.3012009f, 17.6776009f,
+		12.5f, 43.3012009f, 21.6506996f,
+		17.6777f, 35.3553009f, 30.6186008f,
+		30.6186008f, 35.3553009f, 17.6776009f,
+		21.6506996f, 43.3012009f, 12.5f,
+		17.6777f, 43.3012009f, 17.6776009f,
+		25.0f, 35.3553009f, 25.0f,
+		34.1506996f, 35.3553009f, 9.15065002f,
+		24.1481991f, 43.3012009f, 6.47049999f,
+		21.6506996f, 43.3012009f, 12.5f,
+		30.6186008f, 35.3553009f, 17.6776009f,
+		35.3554001f, 35.3553009f, 0.0f,
+		25.0f, 43.3012009f, 0.0f,
+		24.1481991f, 43.3012009f, 6.47049999f,
+		34.1506996f, 35.3553009f, 9.15065002f,
+		24.1481991f, 43.3012009f, -6.47049999f,
+		12.5f, 48.296299f, -3.34937f,
+		12.941f, 48.296299f, 0.0f,
+		25.0f, 43.3012009f, 0.0f,
+		21.6506996f, 43.3012009f, -12.5f,
+		11.2072001f, 48.296299f, -6.47049999f,
+		12.5f, 48.296299f, -3.34937f,
+		24.1481991f, 43.3012009f, -6.47049999f,
+		17.6777f, 43.3012009f, -17.6776009f,
+		9.15065002f, 48.296299f, -9.15065002f,
+		11.2072001f, 48.296299f, -6.47049999f,
+		21.6506996f, 43.3012009f, -12.5f,
+		12.5f, 43.3012009f, -21.6506996f,
+		6.47049999f, 48.296299f, -11.2072001f,
+		9.15065002f, 48.296299f, -9.15065002f,
+		17.6777f, 43.3012009f, -17.6776009f,
+		6.47049999f, 43.3012009f, -24.1481991f,
+		3.34937f, 48.296299f, -12.5f,
+		6.47049999f, 48.296299f, -11.2072001f,
+		12.5f, 43.3012009f, -21.6506996f,
+		3.78551999e-06f, 43.3012009f, -25.0f,
+		4.2222e-06f, 48.296299f, -12.941f,
+		3.34937f, 48.296299f, -12.5f,
+		6.47049999f, 43.3012009f, -24.1481991f,
+		-6.47049999f, 43.3013f, -24.1481991f,
+		-3.34935999f, 48.296299f, -12.5f,
+		4.2222e-06f, 48.296299f, -12.941f,
+		3.78551999e-06f, 43.3012009f, -25.0f,
+		-12.5f, 43.3013f, -21.6506996f,
+		-6.47049999f, 48.296299f, -11.2072001f,
+		-3.34935999f, 48.296299f, -12.5f,
+		-6.47049999f, 43.3013f, -24.1481991f,
+		-17.6776009f, 43.3013f, -17.6776009f,
+		-9.15065002f, 48.296299f, -9.15065002f,
+		-6.47049999f, 48.296299f, -11.2072001f,
+		-12.5f, 43.3013f, -21.6506996f,
+		-21.6506004f, 43.3013f, -12.5f,
+		-11.2072001f, 48.296299f, -6.47049999f,
+		-9.15065002f, 48.296299f, -9.15065002f,
+		-17.6776009f, 43.3013f, -17.6776009f,
+		-24.1480999f, 43.3013f, -6.47049999f,
+		-12.5f, 48.296299f, -3.34937f,
+		-11.2072001f, 48.296299f, -6.47049999f,
+		-21.6506004f, 43.3013f, -12.5f,
+		-25.0f, 43.3013f, -3.06160991e-15f,
+		-12.9408998f, 48.296299f, -1.58480997e-15f,
+		-12.5f, 48.296299f, -3.34937f,
+		-24.1480999f, 43.3013f, -6.47049999f,
+		-24.1480999f, 43.3013f, 6.47049999f,
+		-12.5f, 48.296299f, 3.34937f,
+		-12.9408998f, 48.296299f, -1.58480997e-15f,
+		-25.0f, 43.3013f, -3.06160991e-15f,
+		-21.6506004f, 43.3013f, 12.5f,
+		-11.2072001f, 48.296299f, 6.47049999f,
+		-12.5f, 48.296299f, 3.34937f,
+		-24.1480999f, 43.3013f, 6.47049999f,
+		-17.6776009f, 43.3013f, 17.6776009f,
+		-9.15065002f, 48.296299f, 9.15065002f,
+		-11.2072001f, 48.296299f, 6.47049999f,
+		-21.6506004f, 43.3013f, 12.5f,
+		-12.5f, 43.3013f, 21.6506996f,
+		-6.47049999f, 48.296299f, 11.2072001f,
+		-9.15065002f, 48.296299f, 9.15065002f,
+		-17.6776009f, 43.3013f, 17.6776009f,
+		-6.47049999f, 43.3013f, 24.1481991f,
+		-3.34935999f, 48.296299f, 12.5f,
+		-6.47049999f, 48.296299f, 11.2072001f,
+		-12.5f, 43.3013f, 21.6506996f,
+		3.78551999e-06f, 43.3012009f, 25.0f,
+		4.2222e-06f, 48.296299f, 12.941f,
+		-3.34935999f, 48.296299f, 12.5f,
+		-6.47049999f, 43.3013f, 24.1481991f,
+		6.47049999f, 43.3012009f, 24.1481991f,
+		3.34937f, 48.296299f, 12.5f,
+		4.2222e-06f, 48.296299f, 12.941f,
+		3.78551999e-06f, 43.3012009f, 25.0f,
+		12.5f, 43.3012009f, 21.6506996f,
+		6.47049999f, 48.296299f, 11.2072001f,
+		3.34937f, 48.296299f, 12.5f,
+		6.47049999f, 43.3012009f, 24.1481991f,
+		17.6777f, 43.3012009f, 17.6776009f,
+		9.15065002f, 48.296299f, 9.15065002f,
+		6.47049999f, 48.296299f, 11.2072001f,
+		12.5f, 43.3012009f, 21.6506996f,
+		21.6506996f, 43.3012009f, 12.5f,
+		11.2072001f, 48.296299f, 6.47049999f,
+		9.15065002f, 48.296299f, 9.15065002f,
+		17.6777f, 43.3012009f, 17.6776009f,
+		24.1481991f, 43.3012009f, 6.47049999f,
+		12.5f, 48.296299f, 3.34937f,
+		11.2072001f, 48.296299f, 6.47049999f,
+		21.6506996f, 43.3012009f, 12.5f,
+		25.0f, 43.3012009f, 0.0f,
+		12.941f, 48.296299f, 0.0f,
+		12.5f, 48.296299f, 3.34937f,
+		24.1481991f, 43.3012009f, 6.47049999f,
+		12.5f, -48.296299f, -3.34937f,
+		12.9408998f, -48.296299f, 0.0f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		12.941f, 48.296299f, 0.0f,
+		12.5f, 48.296299f, -3.34937f,
+		11.2072001f, -48.296299f, -6.47049999f,
+		12.5f, -48.296299f, -3.34937f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		12.5f, 48.296299f, -3.34937f,
+		11.2072001f, 48.296299f, -6.47049999f,
+		9.15065002f, -48.296299f, -9.15065002f,
+		11.2072001f, -48.296299f, -6.47049999f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		11.2072001f, 48.296299f, -6.47049999f,
+		9.15065002f, 48.296299f, -9.15065002f,
+		6.47049999f, -48.296299f, -11.2072001f,
+		9.15065002f, -48.296299f, -9.15065002f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		9.15065002f, 48.296299f, -9.15065002f,
+		6.47049999f, 48.296299f, -11.2072001f,
+		3.34935999f, -48.296299f, -12.5f,
+		6.47049999f, -48.296299f, -11.2072001f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		6.47049999f, 48.296299f, -11.2072001f,
+		3.34937f, 48.296299f, -12.5f,
+		-4.2222e-06f, -48.296299f, -12.941f,
+		3.34935999f, -48.296299f, -12.5f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		3.34937f, 48.296299f, -12.5f,
+		4.2222e-06f, 48.296299f, -12.941f,
+		-3.34937f, -48.296299f, -12.5f,
+		-4.2222e-06f, -48.296299f, -12.941f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		4.2222e-06f, 48.296299f, -12.941f,
+		-3.34935999f, 48.296299f, -12.5f,
+		-6.47049999f, -48.296299f, -11.2072001f,
+		-3.34937f, -48.296299f, -12.5f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-3.34935999f, 48.296299f, -12.5f,
+		-6.47049999f, 48.296299f, -11.2072001f,
+		-9.15065002f, -48.296299f, -9.15065002f,
+		-6.47049999f, -48.296299f, -11.2072001f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-6.47049999f, 48.296299f, -11.2072001f,
+		-9.15065002f, 48.296299f, -9.15065002f,
+		-11.2072001f, -48.296299f, -6.47049999f,
+		-9.15065002f, -48.296299f, -9.15065002f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-9.15065002f, 48.296299f, -9.15065002f,
+		-11.2072001f, 48.296299f, -6.47049999f,
+		-12.5f, -48.296299f, -3.34937f,
+		-11.2072001f, -48.296299f, -6.47049999f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-11.2072001f, 48.296299f, -6.47049999f,
+		-12.5f, 48.296299f, -3.34937f,
+		-12.941f, -48.296299f, -1.58480997e-15f,
+		-12.5f, -48.296299f, -3.34937f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-12.5f, 48.296299f, -3.34937f,
+		-12.9408998f, 48.296299f, -1.58480997e-15f,
+		-12.5f, -48.296299f, 3.34937f,
+		-12.941f, -48.296299f, -1.58480997e-15f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-12.9408998f, 48.296299f, -1.58480997e-15f,
+		-12.5f, 48.296299f, 3.34937f,
+		-11.2072001f, -48.296299f, 6.47049999f,
+		-12.5f, -48.296299f, 3.34937f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-12.5f, 48.296299f, 3.34937f,
+		-11.2072001f, 48.296299f, 6.47049999f,
+		-9.15065002f, -48.296299f, 9.15065002f,
+		-11.2072001f, -48.296299f, 6.47049999f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-11.2072001f, 48.296299f, 6.47049999f,
+		-9.15065002f, 48.296299f, 9.15065002f,
+		-6.47049999f, -48.296299f, 11.2072001f,
+		-9.15065002f, -48.296299f, 9.15065002f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-9.15065002f, 48.296299f, 9.15065002f,
+		-6.47049999f, 48.296299f, 11.2072001f,
+		-3.34937f, -48.296299f, 12.5f,
+		-6.47049999f, -48.296299f, 11.2072001f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-6.47049999f, 48.296299f, 11.2072001f,
+		-3.34935999f, 48.296299f, 12.5f,
+		-4.2222e-06f, -48.296299f, 12.941f,
+		-3.34937f, -48.296299f, 12.5f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		-3.34935999f, 48.296299f, 12.5f,
+		4.2222e-06f, 48.296299f, 12.941f,
+		3.34935999f, -48.296299f, 12.5f,
+		-4.2222e-06f, -48.296299f, 12.941f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		4.2222e-06f, 48.296299f, 12.941f,
+		3.34937f, 48.296299f, 12.5f,
+		6.47049999f, -48.296299f, 11.2072001f,
+		3.34935999f, -48.296299f, 12.5f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		3.34937f, 48.296299f, 12.5f,
+		6.47049999f, 48.296299f, 11.2072001f,
+		9.15065002f, -48.296299f, 9.15065002f,
+		6.47049999f, -48.296299f, 11.2072001f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		6.47049999f, 48.296299f, 11.2072001f,
+		9.15065002f, 48.296299f, 9.15065002f,
+		11.2072001f, -48.296299f, 6.47049999f,
+		9.15065002f, -48.296299f, 9.15065002f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		9.15065002f, 48.296299f, 9.15065002f,
+		11.2072001f, 48.296299f, 6.47049999f,
+		12.5f, -48.296299f, 3.34937f,
+		11.2072001f, -48.296299f, 6.47049999f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		11.2072001f, 48.296299f, 6.47049999f,
+		12.5f, 48.296299f, 3.34937f,
+		12.9408998f, -48.296299f, 0.0f,
+		12.5f, -48.296299f, 3.34937f,
+		-4.37114022e-06f, -50.0f, 0.0f,
+		4.37114022e-06f, 50.0f, 0.0f,
+		12.5f, 48.296299f, 3.34937f,
+		12.941f, 48.296299f, 0.0f
+	};
+
+	constexpr float Normals[] = {
+		0.249910071f, -0.96595031f, -0.0669696257f,
+		0.482858211f, -0.866088331f, -0.129379064f,
+		0.49989f, -0.866088986f, 0.0f,
+		0.258721977f, -0.96595186f, 0.0f,
+		0.224066094f, -0.965952396f, -0.129346058f,
+		0.432919055f, -0.866088092f, -0.24994503f,
+		0.482858211f, -0.866088331f, -0.129379064f,
+		0.249910071f, -0.96595031f, -0.0669696257f,
+		0.182940066f, -0.96595335f, -0.182940066f,
+		0.353477895f, -0.866086721f, -0.353478879f,
+		0.432919055f, -0.866088092f, -0.24994503f,
+		0.224066094f, -0.965952396f, -0.129346058f,
+		0.129346058f, -0.965952396f, -0.224066094f,
+		0.24994503f, -0.866088092f, -0.432919055f,
+		0.353477895f, -0.866086721f, -0.353478879f,
+		0.182940066f, -0.96595335f, -0.182940066f,
+		0.0669696257f, -0.96595031f, -0.249910071f,
+		0.129379064f, -0.866088331f, -0.482858211f,
+		0.24994503f, -0.866088092f, -0.432919055f,
+		0.129346058f, -0.965952396f, -0.224066094f,
+		-8.44461709e-08f, -0.965951622f, -0.258722901f,
+		-7.57159029e-08f, -0.866088986f, -0.49989f,
+		0.129379064f, -0.866088331f, -0.482858211f,
+		0.0669696257f, -0.96595031f, -0.249910071f,
+		-0.0669697225f, -0.96595031f, -0.249910071f,
+		-0.129379064f, -0.866088331f, -0.482858211f,
+		-7.57159029e-08f, -0.866088986f, -0.49989f,
+		-8.44461709e-08f, -0.965951622f, -0.258722901f,
+		-0.129346058f, -0.965952396f, -0.224066094f,
+		-0.24994503f, -0.866088092f, -0.432919055f,
+		-0.129379064f, -0.866088331f, -0.482858211f,
+		-0.0669697225f, -0.96595031f, -0.249910071f,
+		-0.182941034f, -0.965953171f, -0.182940036f,
+		-0.353479028f, -0.866086125f, -0.353479028f,
+		-0.24994503f, -0.866088092f, -0.432919055f,
+		-0.129346058f, -0.965952396f, -0.224066094f,
+		-0.224066094f, -0.965952396f, -0.129346058f,
+		-0.432919055f, -0.866088092f, -0.24994503f,
+		-0.353479028f, -0.866086125f, -0.353479028f,
+		-0.182941034f, -0.965953171f, -0.182940036f,
+		-0.249910071f, -0.96595031f, -0.0669696257f,
+		-0.482858211f, -0.866088331f, -0.129379064f,
+		-0.432919055f, -0.866088092f, -0.24994503f,
+		-0.224066094f, -0.965952396f, -0.129346058f,
+		-0.258722901f, -0.965951622f, 0.0f,
+		-0.49989f, -0.866088986f, 0.0f,
+		-0.482858211f, -0.866088331f, -0.129379064f,
+		-0.249910071f, -0.96595031f, -0.0669696257f,
+		-0.249910071f, -0.96595031f, 0.0669696257f,
+		-0.482858211f, -0.866088331f, 0.129379064f,
+		-0.49989f, -0.866088986f, 0.0f,
+		-0.258722901f, -0.965951622f, 0.0f,
+		-0.224066094f, -0.965952396f, 0.129346058f,
+		-0.432919055f, -0.866088092f, 0.24994503f,
+		-0.482858211f, -0.866088331f, 0.129379064f,
+		-0.249910071f, -0.96595031f, 0.0669696257f,
+		-0.182941034f, -0.965953171f, 0.182940036f,
+		-0.353479028f, -0.866086125f, 0.353479028f,
+		-0.432919055f, -0.866088092f, 0.24994503f,
+		-0.224066094f, -0.965952396f, 0.129346058f,
+		-0.129346058f, -0.965952396f, 0.224066094f,
+		-0.24994503f, -0.866088092f, 0.432919055f,
+		-0.353479028f, -0.866086125f, 0.353479028f,
+		-0.182941034f, -0.965953171f, 0.182940036f,
+		-0.0669697225f, -0.96595031f, 0.249910071f,
+		-0.129379064f, -0.866088331f, 0.482858211f,
+		-0.24994503f, -0.866088092f, 0.432919055f,
+		-0.129346058f, -0.965952396f, 0.224066094f,
+		-8.44461709e-08f, -0.965951622f, 0.258722901f,
+		-7.57159029e-08f, -0.866088986f, 0.49989f,
+		-0.129379064f, -0.866088331f, 0.482858211f,
+		-0.0669697225f, -0.96595031f, 0.249910071f,
+		0.0669696257f, -0.96595031f, 0.249910071f,
+		0.129379064f, -0.866088331f, 0.482858211f,
+		-7.57159029e-08f, -0.866088986f, 0.49989f,
+		-8.44461709e-08f, -0.965951622f, 0.258722901f,
+		0.129346058f, -0.965952396f, 0.224066094f,
+		0.24994503f, -0.866088092f, 0.432919055f,
+		0.129379064f, -0.866088331f, 0.482858211f,
+		0.0669696257f, -0.96595031f, 0.249910071f,
+		0.182940066f, -0.96595335f, 0.182940066f,
+		0.353477895f, -0.866086721f, 0.353478879f,
+		0.24994503f, -0.866088092f, 0.432919055f,
+		0.129346058f, -0.965952396f, 0.224066094f,
+		0.224066094f, -0.965952396f, 0.129346058f,
+		0.432919055f, -0.866088092f, 0.24994503f,
+		0.353477895f, -0.866086721f, 0.353478879f,
+		0.182940066f, -0.96595335f, 0.182940066f,
+		0.249910071f, -0.96595031f, 0.0669696257f,
+		0.482858211f, -0.866088331f, 0.129379064f,
+		0.432919055f, -0.866088092f, 0.24994503f,
+		0.224066094f, -0.965952396f, 0.129346058f,
+		0.258721977f, -0.96595186f, 0.0f,
+		0.49989f, -0.866088986f, 0.0f,
+		0.482858211f, -0.866088331f, 0.129379064f,
+		0.249910071f, -0.96595031f, 0.0669696257f,
+		0.482858211f, -0.866088331f, -0.129379064f,
+		0.682922304f, -0.707204342f, -0.182973087f,
+		0.707012773f, -0.707200766f, 0.0f,
+		0.49989f, -0.866088986f, 0.0f,
+		0.432919055f, -0.866088092f, -0.24994503f,
+		0.612292051f, -0.70720005f, -0.353506029f,
+		0.682922304f, -0.707204342f, -0.182973087f,
+		0.482858211f, -0.866088331f, -0.129379064f,
+		0.353477895f, -0.866086721f, -0.353478879f,
+		0.499924928f, -0.707212925f, -0.499924928f,
+		0.612292051f, -0.70720005f, -0.353506029f,
+		0.432919055f, -0.866088092f, -0.24994503f,
+		0.24994503f, -0.866088092f, -0.432919055f,
+		0.353506029f, -0.70720005f, -0.612292051f,
+		0.499924928f, -0.707212925f, -0.499924928f,
+		0.353477895f, -0.866086721f, -0.353478879f,
+		0.129379064f, -0.866088331f, -0.482858211f,
+		0.182973087f, -0.707204342f, -0.682922304f,
+		0.353506029f, -0.70720005f, -0.612292051f,
+		0.24994503f, -0.866088092f, -0.432919055f,
+		-7.57159029e-08f, -0.866088986f, -0.49989f,
+		-6.18253821e-08f, -0.707200766f, -0.707012773f,
+		0.182973087f, -0.707204342f, -0.682922304f,
+		0.129379064f, -0.866088331f, -0.482858211f,
+		-0.129379064f, -0.866088331f, -0.482858211f,
+		-0.182973087f, -0.707204342f, -0.682922304f,
+		-6.18253821e-08f, -0.707200766f, -0.707012773f,
+		-7.57159029e-08f, -0.866088986f, -0.49989f,
+		-0.24994503f, -0.866088092f, -0.432919055f,
+		-0.353506029f, -0.70720005f, -0.612292051f,
+		-0.182973087f, -0.707204342f, -0.682922304f,
+		-0.129379064f, -0.866088331f, -0.482858211f,
+		-0.353479028f, -0.866086125f, -0.353479028f,
+		-0.499924928f, -0.707212925f, -0.499924928f,
+		-0.353506029f, -0.70720005f, -0.612292051f,
+		-0.24994503f, -0.866088092f, -0.432919055f,
+		-0.432919055f, -0.866088092f, -0.24994503f,
+		-0.612292051f, -0.70720005f, -0.353506029f,
+		-0.499924928f, -0.707212925f, -0.499924928f,
+		-0.353479028f, -0.866086125f, -0.353479028f,
+		-0.482858211f, -0.866088331f, -0.129379064f,
+		-0.682922304f, -0.707204342f, -0.182973087f,
+		-0.612292051f, -0.70720005f, -0.353506029f,
+		-0.432919055f, -0.866088092f, -0.24994503f,
+		-0.49989f, -0.866088986f, 0.0f,
+		-0.707013249f, -0.707200229f, 0.0f,
+		-0.682922304f, -0.707204342f, -0.182973087f,
+		-0.482858211f, -0.866088331f, -0.129379064f,
+		-0.482858211f, -0.866088331f, 0.129379064f,
+		-0.682922304f, -0.707204342f, 0.182973087f,
+		-0.707013249f, -0.707200229f, 0.0f,
+		-0.49989f, -0.866088986f, 0.0f,
+		-0.432919055f, -0.866088092f, 0.24994503f,
+		-0.612292051f, -0.70720005f, 0.353506029f,
+		-0.682922304f, -0.707204342f, 0.182973087f,
+		-0.482858211f, -0.866088331f, 0.129379064f,
+		-0.353479028f, -0.866086125f, 0.353479028f,
+		-0.499924928f, -0.707212925f, 0.499924928f,
+		-0.612292051f, -0.70720005f, 0.353506029f,
+		-0.432919055f, -0.866088092f, 0.24994503f,
+		-0.24994503f, -0.866088092f, 0.432919055f,
+		-0.353506029f, -0.70720005f, 0.612292051f,
+		-0.499924928f, -0.707212925f, 0.499924928f,
+		-0.353479028f, -0.866086125f, 0.353479028f,
+		-0.129379064f, -0.866088331f, 0.482858211f,
+		-0.182973087f, -0.707204342f, 0.682922304f,
+		-0.353506029f, -0.70720005f, 0.612292051f,
+		-0.24994503f, -0.866088092f, 0.432919055f,
+		-7.57159029e-08f, -0.866088986f, 0.49989f,
+		-6.18253821e-08f, -0.707200766f, 0.707012773f,
+		-0.182973087f, -0.707204342f, 0.682922304f,
+		-0.129379064f, -0.866088331f, 0.482858211f,
+		0.129379064f, -0.866088331f, 0.482858211f,
+		0.182973087f, -0.707204342f, 0.682922304f,
+		-6.18253821e-08f, -0.707200766f, 0.707012773f,
+		-7.57159029e-08f, -0.866088986f, 0.49989f,
+		0.24994503f, -0.866088092f, 0.432919055f,
+		0.353506029f, -0.70720005f, 0.612292051f,
+		0.182973087f, -0.707204342f, 0.682922304f,
+		0.129379064f, -0.866088331f, 0.482858211f,
+		0.353477895f, -0.866086721f, 0.353478879f,
+		0.499924928f, -0.707212925f, 0.499924928f,
+		0.353506029f, -0.70720005f, 0.612292051f,
+		0.24994503f, -0.866088092f, 0.432919055f,
+		0.432919055f, -0.866088092f, 0.24994503f,
+		0.612292051f, -0.70720005f, 0.353506029f,
+		0.499924928f, -0.707212925f, 0.499924928f,
+		0.353477895f, -0.866086721f, 0.353478879f,
+		0.482858211f, -0.866088331f, 0.129379064f,
+		0.682922304f, -0.707204342f, 0.182973087f,
+		0.612292051f, -0.70720005f, 0.353506029f,
+		0.432919055f, -0.866088092f, 0.24994503f,
+		0.49989f, -0.866088986f, 0.0f,
+		0.707012773f, -0.707200766f, 0.0f,
+		0.682922304f, -0.707204342f, 0.182973087f,
+		0.482858211f, -0.866088331f, 0.129379064f,
+		0.682922304f, -0.707204342f, -0.182973087f,
+		0.836457193f, -0.500105143f, -0.224130049f,
+		0.865963042f, -0.500108063f, 0.0f,
+		0.707012773f, -0.707200766f, 0.0f,
+		0.612292051f, -0.70720005f, -0.353506029f,
+		0.749952018f, -0.500102997f, -0.432976991f,
+		0.836457193f, -0.500105143f, -0.224130049f,
+		0.682922304f, -0.707204342f, -0.182973087f,
+		0.499924928f, -0.707212925f, -0.499924928f,
+		0.612328887f, -0.500106871f, -0.612328887f,
+		0.749952018f, -0.500102997f, -0.432976991f,
+		0.612292051f, -0.70720005f, -0.353506029f,
+		0.353506029f, -0.70720005f, -0.612292051f,
+		0.432976991f, -0.500102997f, -0.749952018f,
+		0.612328887f, -0.500106871f, -0.612328887f,
+		0.499924928f, -0.707212925f, -0.499924928f,
+		0.182973087f, -0.707204342f, -0.682922304f,
+		0.224130049f, -0.500105143f, -0.836457193f,
+		0.432976991f, -0.500102997f, -0.749952018f,
+		0.353506029f, -0.70720005f, -0.612292051f,
+		-6.18253821e-08f, -0.707200766f, -0.707012773f,
+		-4.37209025e-08f, -0.500108063f, -0.865963042f,
+		0.224130049f, -0.500105143f, -0.836457193f,
+		0.182973087f, -0.707204342f, -0.682922304f,
+		-0.182973087f, -0.707204342f, -0.682922304f,
+		-0.224130049f, -0.500105143f, -0.836457193f,
+		-4.37209025e-08f, -0.500108063f, -0.865963042f,
+		-6.18253821e-08f, -0.707200766f, -0.707012773f,
+		-0.353506029f, -0.70720005f, -0.612292051f,
+		-0.432976991f, -0.500102997f, -0.749952018f,
+		-0.224130049f, -0.500105143f, -0.836457193f,
+		-0.182973087f, -0.707204342f, -0.682922304f,
+		-0.499924928f, -0.707212925f, -0.499924928f,
+		-0.612328887f, -0.500106871f, -0.612328887f,
+		-0.432976991f, -0.500102997f, -0.749952018f,
+		-0.353506029f, -0.70720005f, -0.612292051f,
+		-0.612292051f, -0.70720005f, -0.353506029f,
+		-0.749952018f, -0.500102997f, -0.432976991f,
+		-0.612328887f, -0.500106871f, -0.612328887f,
+		-0.499924928f, -0.707212925f, -0.499924928f,
+		-0.682922304f, -0.707204342f, -0.182973087f,
+		-0.836457193f, -0.500105143f, -0.224130049f,
+		-0.749952018f, -0.500102997f, -0.432976991f,
+		-0.612292051f, -0.70720005f, -0.353506029f,
+		-0.707013249f, -0.707200229f, 0.0f,
+		-0.865963042f, -0.500108063f, 0.0f,
+		-0.836457193f, -0.500105143f, -0.224130049f,
+		-0.682922304f, -0.707204342f, -0.182973087f,
+		-0.682922304f, -0.707204342f, 0.182973087f,
+		-0.836457193f, -0.500105143f, 0.224130049f,
+		-0.865963042f, -0.500108063f, 0.0f,
+		-0.707013249f, -0.707200229f, 0.0f,
+		-0.612292051f, -0.70720005f, 0.353506029f,
+		-0.749952018f, -0.500102997f, 0.432976991f,
+		-0.836457193f, -0.500105143f, 0.224130049f,
+		-0.682922304f, -0.707204342f, 0.182973087f,
+		-0.499924928f, -0.707212925f, 0.499924928f,
+		-0.612328887f, -0.500106871f, 0.612328887f,
+		-0.749952018f, -0.500102997f, 0.432976991f,
+		-0.612292051f, -0.70720005f, 0.353506029f,
+		-0.353506029f, -0.70720005f, 0.612292051f,
+		-0.432976991f, -0.500102997f, 0.749952018f,
+		-0.612328887f, -0.500106871f, 0.612328887f,
+		-0.499924928f, -0.707212925f, 0.499924928f,
+		-0.182973087f, -0.707204342f, 0.682922304f,
+		-0.224130049f, -0.500105143f, 0.836457193f,
+		-0.432976991f, -0.500102997f, 0.749952018f,
+		-0.353506029f, -0.70720005f, 0.612292051f,
+		-6.18253821e-08f, -0.707200766f, 0.707012773f,
+		-4.37209025e-08f, -0.500108063f, 0.865963042f,
+		-0.224130049f, -0.500105143f, 0.836457193f,
+		-0.182973087f, -0.707204342f, 0.682922304f,
+		0.182973087f, -0.707204342f, 0.682922304f,
+		0.224130049f, -0.500105143f, 0.836457193f,
+		-4.37209025e-08f, -0.500108063f, 0.865963042f,
+		-6.18253821e-08f, -0.707200766f, 0.707012773f,
+		0.353506029f, -0.70720005f, 0.612292051f,
+		0.432976991f, -0.500102997f, 0.749952018f,
+		0.224130049f, -0.500105143f, 0.836457193f,
+		0.182973087f, -0.707204342f, 0.682922304f,
+		0.499924928f, -0.707212925f, 0.499924928f,
+		0.612328887f, -0.500106871f, 0.612328887f,
+		0.432976991f, -0.500102997f, 0.749952018f,
+		0.353506029f, -0.70720005f, 0.612292051f,
+		0.612292051f, -0.70720005f, 0.353506029f,
+		0.749952018f, -0.500102997f, 0.432976991f,
+		0.612328887f, -0.500106871f, 0.612328887f,
+		0.499924928f, -0.707212925f, 0.499924928f,
+		0.682922304f, -0.707204342f, 0.182973087f,
+		0.836457193f, -0.500105143f, 0.224130049f,
+		0.749952018f, -0.500102997f, 0.432976991f,
+		0.612292051f, -0.70720005f, 0.353506029f,
+		0.707012773f, -0.707200766f, 0.0f,
+		0.865963042f, -0.500108063f, 0.0f,
+		0.836457193f, -0.500105143f, 0.224130049f,
+		0.682922304f, -0.707204342f, 0.182973087f,
+		0.836457193f, -0.500105143f, -0.224130049f,
+		0.933000863f, -0.258883983f, -0.249976963f,
+		0.965910614f, -0.258875906f, 0.0f,
+		0.865963042f, -0.500108063f, 0.0f,
+		0.749952018f, -0.500102997f, -0.432976991f,
+		0.83649987f, -0.258884966f, -0.482955933f,
+		0.933000863f, -0.258883983f, -0.249976963f,
+		0.836457193f, -0.500105143f, -0.224130049f,
+		0.612328887f, -0.500106871f, -0.612328887f,
+		0.682999849f, -0.258886933f, -0.682999849f,
+		0.83649987f, -0.258884966f, -0.482955933f,
+		0.749952018f, -0.500102997f, -0.432976991f,
+		0.432976991f, -0.500102997f, -0.749952018f,
+		0.482955992f, -0.258884996f, -0.836499989f,
+		0.682999849f, -0.258886933f, -0.682999849f,
+		0.612328887f, -0.500106871f, -0.612328887f,
+		0.224130049f, -0.500105143f, -0.836457193f,
+		0.249976963f, -0.258883983f, -0.933000863f,
+		0.482955992f, -0.258884996f, -0.836499989f,
+		0.432976991f, -0.500102997f, -0.749952018f,
+		-4.37209025e-08f, -0.500108063f, -0.865963042f,
+		-2.26316903e-08f, -0.258875906f, -0.965910614f,
+		0.249976963f, -0.258883983f, -0.933000863f,
+		0.224130049f, -0.500105143f, -0.836457193f,
+		-0.224130049f, -0.500105143f, -0.836457193f,
+		-0.249976963f, -0.258883983f, -0.933000863f,
+		-2.26316903e-08f, -0.258875906f, -0.965910614f,
+		-4.37209025e-08f, -0.500108063f, -0.865963042f,
+		-0.432976991f, -0.500102997f, -0.749952018f,
+		-0.482955992f, -0.258884996f, -0.836499989f,
+		-0.249976963f, -0.258883983f, -0.933000863f,
+		-0.224130049f, -0.500105143f, -0.836457193f,
+		-0.612328887f, -0.500106871f, -0.612328887f,
+		-0.682999849f, -0.258886933f, -0.682999849f,
+		-0.482955992f, -0.258884996f, -0.836499989f,
+		-0.432976991f, -0.500102997f, -0.749952018f,
+		-0.749952018f, -0.500102997f, -0.432976991f,
+		-0.83649987f, -0.258884966f, -0.482955933f,
+		-0.682999849f, -0.258886933f, -0.682999849f,
+		-0.612328887f, -0.500106871f, -0.612328887f,
+		-0.836457193f, -0.500105143f, -0.224130049f,
+		-0.933000863f, -0.258883983f, -0.249976963f,
+		-0.83649987f, -0.258884966f, -0.482955933f,
+		-0.749952018f, -0.500102997f, -0.432976991f,
+		-0.865963042f, -0.500108063f, 0.0f,
+		-0.965910614f, -0.258875906f, 0.0f,
+		-0.933000863f, -0.258883983f, -0.249976963f,
+		-0.836457193f, -0.500105143f, -0.224130049f,
+		-0.836457193f, -0.500105143f, 0.224130049f,
+		-0.933000863f, -0.258883983f, 0.249976963f,
+		-0.965910614f, -0.258875906f, 0.0f,
+		-0.865963042f, -0.500108063f, 0.0f,
+		-0.749952018f, -0.500102997f, 0.432976991f,
+		-0.83649987f, -0.258884966f, 0.482955933f,
+		-0.933000863f, -0.258883983f, 0.249976963f,
+		-0.836457193f, -0.500105143f, 0.224130049f,
+		-0.612328887f, -0.500106871f, 0.612328887f,
+		-0.682999849f, -0.258886933f, 0.682999849f,
+		-0.83649987f, -0.258884966f, 0.482955933f,
+		-0.749952018f, -0.500102997f, 0.432976991f,
+		-0.432976991f, -0.500102997f, 0.749952018f,
+		-0.482955992f, -0.258884996f, 0.836499989f,
+		-0.682999849f, -0.258886933f, 0.682999849f,
+		-0.612328887f, -0.500106871f, 0.612328887f,
+		-0.224130049f, -0.500105143f, 0.836457193f,
+		-0.249976963f, -0.258883983f, 0.933000863f,
+		-0.482955992f, -0.258884996f, 0.836499989f,
+		-0.432976991f, -0.500102997f, 0.749952018f,
+		-4.37209025e-08f, -0.500108063f, 0.865963042f,
+		-2.26316903e-08f, -0.258875906f, 0.965910614f,
+		-0.249976963f, -0.258883983f, 0.933000863f,
+		-0.224130049f, -0.500105143f, 0.836457193f,
+		0.224130049f, -0.500105143f, 0.836457193f,
+		0.249976963f, -0.258883983f, 0.933000863f,
+		-2.26316903e-08f, -0.258875906f, 0.965910614f,
+		-4.37209025e-08f, -0.500108063f, 0.865963042f,
+		0.432976991f, -0.500102997f, 0.749952018f,
+		0.482955992f, -0.258884996f, 0.836499989f,
+		0.249976963f, -0.258883983f, 0.933000863f,
+		0.224130049f, -0.500105143f, 0.836457193f,
+		0.612328887f, -0.500106871f, 0.612328887f,
+		0.682999849f, -0.258886933f, 0.682999849f,
+		0.482955992f, -0.258884996f, 0.836499989f,
+		0.432976991f, -0.500102997f, 0.749952018f,
+		0.749952018f, -0.500102997f, 0.432976991f,
+		0.83649987f, -0.258884966f, 0.482955933f,
+		0.682999849f, -0.258886933f, 0.682999849f,
+		0.612328887f, -0.500106871f, 0.612328887f,
+		0.836457193f, -0.500105143f, 0.224130049f,
+		0.933000863f, -0.258883983f, 0.249976963f,
+		0.83649987f, -0.258884966f, 0.482955933f,
+		0.749952018f, -0.500102997f, 0.432976991f,
+		0.865963042f, -0.500108063f, 0.0f,
+		0.965910614f, -0.258875906f, 0.0f,
+		0.933000863f, -0.258883983f, 0.249976963f,
+		0.836457193f, -0.500105143f, 0.224130049f,
+		0.933000863f, -0.258883983f, -0.249976963f,
+		0.965926111f, -8.44439043e-08f, -0.25881803f,
+		1.0f, -8.74227979e-08f, 0.0f,
+		0.965910614f, -0.258875906f, 0.0f,
+		0.83649987f, -0.258884966f, -0.482955933f,
+		0.86601907f, -7.57098064e-08f, -0.500011086f,
+		0.965926111f, -8.44439043e-08f, -0.25881803f,
+		0.933000863f, -0.258883983f, -0.249976963f,
+		0.682999849f, -0.258886933f, -0.682999849f,
+		0.707106829f, -6.18171825e-08f, -0.707106829f,
+		0.86601907f, -7.57098064e-08f, -0.500011086f,
+		0.83649987f, -0.258884966f, -0.482955933f,
+		0.482955992f, -0.258884996f, -0.836499989f,
+		0.500011086f, -4.37123049e-08f, -0.86601907f,
+		0.707106829f, -6.18171825e-08f, -0.707106829f,
+		0.682999849f, -0.258886933f, -0.682999849f,
+		0.249976963f, -0.258883983f, -0.933000863f,
+		0.25881803f, -2.26266028e-08f, -0.965926111f,
+		0.500011086f, -4.37123049e-08f, -0.86601907f,
+		0.482955992f, -0.258884996f, -0.836499989f,
+		-2.26316903e-08f, -0.258875906f, -0.965910614f,
+		0.0f, 0.0f, -1.0f,
+		0.25881803f, -2.26266028e-08f, -0.965926111f,
+		0.249976963f, -0.258883983f, -0.933000863f,
+		-0.249976963f, -0.258883983f, -0.933000863f,
+		-0.25881803f, 2.26266028e-08f, -0.965926111f,
+		0.0f, 0.0f, -1.0f,
+		-2.26316903e-08f, -0.258875906f, -0.965910614f,
+		-0.482955992f, -0.258884996f, -0.836499989f,
+		-0.500011086f, 4.37123049e-08f, -0.86601907f,
+		-0.25881803f, 2.26266028e-08f, -0.965926111f,
+		-0.249976963f, -0.258883983f, -0.933000863f,
+		-0.682999849f, -0.258886933f, -0.682999849f,
+		-0.707106829f, 6.18171825e-08f, -0.707106829f,
+		-0.500011086f, 4.37123049e-08f, -0.86601907f,
+		-0.482955992f, -0.258884996f, -0.836499989f,
+		-0.83649987f, -0.258884966f, -0.482955933f,
+		-0.86601907f, 7.57098064e-08f, -0.500011086f,
+		-0.707106829f, 6.18171825e-08f, -0.707106829f,
+		-0.682999849f, -0.258886933f, -0.682999849f,
+		-0.933000863f, -0.258883983f, -0.249976963f,
+		-0.965926111f, 8.44439043e-08f, -0.25881803f,
+		-0.86601907f, 7.57098064e-08f, -0.500011086f,
+		-0.83649987f, -0.258884966f, -0.482955933f,
+		-0.965910614f, -0.258875906f, 0.0f,
+		-1.0f, 8.74227979e-08f, 0.0f,
+		-0.965926111f, 8.44439043e-08f, -0.25881803f,
+		-0.933000863f, -0.258883983f, -0.249976963f,
+		-0.933000863f, -0.258883983f, 0.249976963f,
+		-0.965926111f, 8.44439043e-08f, 0.25881803f,
+		-1.0f, 8.74227979e-08f, 0.0f,
+		-0.965910614f, -0.258875906f, 0.0f,
+		-0.83649987f, -0.258884966f, 0.482955933f,
+		-0.86601907f, 7.57098064e-08f, 0.500011086f,
+		-0.965926111f, 8.44439043e-08f, 0.25881803f,
+		-0.933000863f, -0.258883983f, 0.249976963f,
+		-0.682999849f, -0.258886933f, 0.682999849f,
+		-0.707106829f, 6.18171825e-08f, 0.707106829f,
+		-0.86601907f, 7.57098064e-08f, 0.500011086f,
+		-0.83649987f, -0.258884966f, 0.482955933f,
+		-0.482955992f, -0.258884996f, 0.836499989f,
+		-0.500011086f, 4.37123049e-08f, 0.86601907f,
+		-0.707106829f, 6.18171825e-08f, 0.707106829f,
+		-0.682999849f, -0.258886933f, 0.682999849f,
+		-0.249976963f, -0.258883983f, 0.933000863f,
+		-0.25881803f, 2.26266028e-08f, 0.965926111f,
+		-0.500011086f, 4.37123049e-08f, 0.86601907f,
+		-0.482955992f, -0.258884996f, 0.836499989f,
+		-2.26316903e-08f, -0.258875906f, 0.965910614f,
+		0.0f, 0.0f, 1.0f,
+		-0.25881803f, 2.26266028e-08f, 0.965926111f,
+		-0.249976963f, -0.258883983f, 0.933000863f,
+		0.249976963f, -0.258883983f, 0.933000863f,
+		0.25881803f, -2.26266028e-08f, 0.965926111f,
+		0.0f, 0.0f, 1.0f,
+		-2.26316903e-08f, -0.258875906f, 0.965910614f,
+		0.482955992f, -0.258884996f, 0.836499989f,
+		0.500011086f, -4.37123049e-08f, 0.86601907f,
+		0.25881803f, -2.26266028e-08f, 0.965926111f,
+		0.249976963f, -0.258883983f, 0.933000863f,
+		0.682999849f, -0.258886933f, 0.682999849f,
+		0.707106829f, -6.18171825e-08f, 0.707106829f,
+		0.500011086f, -4.37123049e-08f, 0.86601907f,
+		0.482955992f, -0.258884996f, 0.836499989f,
+		0.83649987f, -0.258884966f, 0.482955933f,
+		0.86601907f, -7.57098064e-08f, 0.500011086f,
+		0.707106829f, -6.18171825e-08f, 0.707106829f,
+		0.682999849f, -0.258886933f, 0.682999849f,
+		0.933000863f, -0.258883983f, 0.249976963f,
+		0.965926111f, -8.44439043e-08f, 0.25881803f,
+		0.86601907f, -7.57098064e-08f, 0.500011086f,
+		0.83649987f, -0.258884966f, 0.482955933f,
+		0.965910614f, -0.258875906f, 0.0f,
+		1.0f, -8.74227979e-08f, 0.0f,
+		0.965926111f, -8.44439043e-08f, 0.25881803f,
+		0.933000863f, -0.258883983f, 0.249976963f,
+		0.965926111f, -8.44439043e-08f, -0.25881803f,
+		0.933000863f, 0.258883983f, -0.249976963f,
+		0.965910614f, 0.258875906f, 0.0f,
+		1.0f, -8.74227979e-08f, 0.0f,
+		0.86601907f, -7.57098064e-08f, -0.500011086f,
+		0.83649987f, 0.258884966f, -0.482955933f,
+		0.933000863f, 0.258883983f, -0.249976963f,
+		0.965926111f, -8.44439043e-08f, -0.25881803f,
+		0.707106829f, -6.18171825e-08f, -0.707106829f,
+		0.682999849f, 0.258886933f, -0.682999849f,
+		0.83649987f, 0.258884966f, -0.482955933f,
+		0.86601907f, -7.57098064e-08f, -0.500011086f,
+		0.500011086f, -4.37123049e-08f, -0.86601907f,
+		0.48294282f, 0.258877903f, -0.836509705f,
+		0.682999849f, 0.258886933f, -0.682999849f,
+		0.707106829f, -6.18171825e-08f, -0.707106829f,
+		0.25881803f, -2.26266028e-08f, -0.965926111f,
+		0.249976963f, 0.258883983f, -0.933000863f,
+		0.48294282f, 0.258877903f, -0.836509705f,
+		0.500011086f, -4.37123049e-08f, -0.86601907f,
+		0.0f, 0.0f, -1.0f,
+		2.26316903e-08f, 0.258875906f, -0.965910614f,
+		0.249976963f, 0.258883983f, -0.933000863f,
+		0.25881803f, -2.26266028e-08f, -0.965926111f,
+		-0.25881803f, 2.26266028e-08f, -0.965926111f,
+		-0.249976963f, 0.258883983f, -0.933000863f,
+		2.26316903e-08f, 0.258875906f, -0.965910614f,
+		0.0f, 0.0f, -1.0f,
+		-0.500011086f, 4.37123049e-08f, -0.86601907f,
+		-0.482955992f, 0.258884996f, -0.836499989f,
+		-0.249976963f, 0.258883983f, -0.933000863f,
+		-0.25881803f, 2.26266028e-08f, -0.965926111f,
+		-0.707106829f, 6.18171825e-08f, -0.707106829f,
+		-0.682999849f, 0.258886933f, -0.682999849f,
+		-0.482955992f, 0.258884996f, -0.836499989f,
+		-0.500011086f, 4.37123049e-08f, -0.86601907f,
+		-0.86601907f, 7.57098064e-08f, -0.500011086f,
+		-0.83649987f, 0.258884966f, -0.482955933f,
+		-0.682999849f, 0.258886933f, -0.682999849f,
+		-0.707106829f, 6.18171825e-08f, -0.707106829f,
+		-0.965926111f, 8.44439043e-08f, -0.25881803f,
+		-0.933000863f, 0.258883983f, -0.249976963f,
+		-0.83649987f, 0.258884966f, -0.482955933f,
+		-0.86601907f, 7.57098064e-08f, -0.500011086f,
+		-1.0f, 8.74227979e-08f, 0.0f,
+		-0.965910614f, 0.258875906f, 0.0f,
+		-0.933000863f, 0.258883983f, -0.249976963f,
+		-0.965926111f, 8.44439043e-08f, -0.25881803f,
+		-0.965926111f, 8.44439043e-08f, 0.25881803f,
+		-0.933000863f, 0.258883983f, 0.249976963f,
+		-0.965910614f, 0.258875906f, 0.0f,
+		-1.0f, 8.74227979e-08f, 0.0f,
+		-0.86601907f, 7.57098064e-08f, 0.500011086f,
+		-0.83649987f, 0.258884966f, 0.482955933f,
+		-0.933000863f, 0.258883983f, 0.249976963f,
+		-0.965926111f, 8.44439043e-08f, 0.25881803f,
+		-0.707106829f, 6.18171825e-08f, 0.707106829f,
+		-0.682999849f, 0.258886933f, 0.682999849f,
+		-0.83649987f, 0.258884966f, 0.482955933f,
+		-0.86601907f, 7.57098064e-08f, 0.500011086f,
+		-0.500011086f, 4.37123049e-08f, 0.86601907f,
+		-0.48294282f, 0.258877903f, 0.836509705f,
+		-0.682999849f, 0.258886933f, 0.682999849f,
+		-0.707106829f, 6.18171825e-08f, 0.707106829f,
+		-0.25881803f, 2.26266028e-08f, 0.965926111f,
+		-0.249976963f, 0.258883983f, 0.933000863f,
+		-0.48294282f, 0.258877903f, 0.836509705f,
+		-0.500011086f, 4.37123049e-08f, 0.86601907f,
+		0.0f, 0.0f, 1.0f,
+		2.26316903e-08f, 0.258875906f, 0.965910614f,
+		-0.249976963f, 0.258883983f, 0.933000863f,
+		-0.25881803f, 2.26266028e-08f, 0.965926111f,
+		0.25881803f, -2.26266028e-08f, 0.965926111f,
+		0.249976963f, 0.258883983f, 0.933000863f,
+		2.26316903e-08f, 0.258875906f, 0.965910614f,
+		0.0f, 0.0f, 1.0f,
+		0.500011086f, -4.37123049e-08f, 0.86601907f,
+		0.482955992f, 0.258884996f, 0.836499989f,
+		0.249976963f, 0.258883983f, 0.933000863f,
+		0.25881803f, -2.26266028e-08f, 0.965926111f,
+		0.707106829f, -6.18171825e-08f, 0.707106829f,
+		0.682999849f, 0.258886933f, 0.682999849f,
+		0.482955992f, 0.258884996f, 0.836499989f,
+		0.500011086f, -4.37123049e-08f, 0.86601907f,
+		0.86601907f, -7.57098064e-08f, 0.500011086f,
+		0.83649987f, 0.258884966f, 0.482955933f,
+		0.682999849f, 0.258886933f, 0.682999849f,
+		0.707106829f, -6.18171825e-08f, 0.707106829f,
+		0.965926111f, -8.44439043e-08f, 0.25881803f,
+		0.933000863f, 0.258883983f, 0.249976963f,
+		0.83649987f, 0.258884966f, 0.482955933f,
+		0.86601907f, -7.57098064e-08f, 0.500011086f,
+		1.0f, -8.74227979e-08f, 0.0f,
+		0.965910614f, 0.258875906f, 0.0f,
+		0.933000863f, 0.258883983f, 0.249976963f,
+		0.965926111f, -8.44439043e-08f, 0.25881803f,
+		0.933000863f, 0.258883983f, -0.249976963f,
+		0.836457193f, 0.500105143f, -0.224130049f,
+		0.865963042f, 0.500108063f, 0.0f,
+		0.965910614f, 0.258875906f, 0.0f,
+		0.83649987f, 0.258884966f, -0.482955933f,
+		0.749952018f, 0.500102997f, -0.432976991f,
+		0.836457193f, 0.500105143f, -0.224130049f,
+		0.933000863f, 0.258883983f, -0.249976963f,
+		0.682999849f, 0.258886933f, -0.682999849f,
+		0.612328887f, 0.500106871f, -0.612328887f,
+		0.749952018f, 0.500102997f, -0.432976991f,
+		0.83649987f, 0.258884966f, -0.482955933f,
+		0.48294282f, 0.258877903f, -0.836509705f,
+		0.432976991f, 0.500102997f, -0.749952018f,
+		0.612328887f, 0.500106871f, -0.612328887f,
+		0.682999849f, 0.258886933f, -0.682999849f,
+		0.249976963f, 0.258883983f, -0.933000863f,
+		0.224130049f, 0.500105143f, -0.836457193f,
+		0.432976991f, 0.500102997f, -0.749952018f,
+		0.48294282f, 0.258877903f, -0.836509705f,
+		2.26316903e-08f, 0.258875906f, -0.965910614f,
+		4.37209025e-08f, 0.500108063f, -0.865963042f,
+		0.224130049f, 0.500105143f, -0.836457193f,
+		0.249976963f, 0.258883983f, -0.933000863f,
+		-0.249976963f, 0.258883983f, -0.933000863f,
+		-0.224130049f, 0.500105143f, -0.836457193f,
+		4.37209025e-08f, 0.500108063f, -0.865963042f,
+		2.26316903e-08f, 0.258875906f, -0.965910614f,
+		-0.482955992f, 0.258884996f, -0.836499989f,
+		-0.432976991f, 0.500102997f, -0.749952018f,
+		-0.224130049f, 0.500105143f, -0.836457193f,
+		-0.249976963f, 0.258883983f, -0.933000863f,
+		-0.682999849f, 0.258886933f, -0.682999849f,
+		-0.612328887f, 0.500106871f, -0.612328887f,
+		-0.432976991f, 0.500102997f, -0.749952018f,
+		-0.482955992f, 0.258884996f, -0.836499989f,
+		-0.83649987f, 0.258884966f, -0.482955933f,
+		-0.749952018f, 0.500102997f, -0.432976991f,
+		-0.612328887f, 0.500106871f, -0.612328887f,
+		-0.682999849f, 0.258886933f, -0.682999849f,
+		-0.933000863f, 0.258883983f, -0.249976963f,
+		-0.836457193f, 0.500105143f, -0.224130049f,
+		-0.749952018f, 0.500102997f, -0.432976991f,
+		-0.83649987f, 0.258884966f, -0.482955933f,
+		-0.965910614f, 0.258875906f, 0.0f,
+		-0.865963042f, 0.500108063f, 0.0f,
+		-0.836457193f, 0.500105143f, -0.224130049f,
+		-0.933000863f, 0.258883983f, -0.249976963f,
+		-0.933000863f, 0.258883983f, 0.249976963f,
+		-0.836457193f, 0.500105143f, 0.224130049f,
+		-0.865963042f, 0.500108063f, 0.0f,
+		-0.965910614f, 0.258875906f, 0.0f,
+		-0.83649987f, 0.258884966f, 0.482955933f,
+		-0.749952018f, 0.500102997f, 0.432976991f,
+		-0.836457193f, 0.500105143f, 0.224130049f,
+		-0.933000863f, 0.258883983f, 0.249976963f,
+		-0.682999849f, 0.258886933f, 0.682999849f,
+		-0.612328887f, 0.500106871f, 0.612328887f,
+		-0.749952018f, 0.500102997f, 0.432976991f,
+		-0.83649987f, 0.258884966f, 0.482955933f,
+		-0.48294282f, 0.258877903f, 0.836509705f,
+		-0.432976991f, 0.500102997f, 0.749952018f,
+		-0.612328887f, 0.500106871f, 0.612328887f,
+		-0.682999849f, 0.258886933f, 0.682999849f,
+		-0.249976963f, 0.258883983f, 0.933000863f,
+		-0.224130049f, 0.500105143f, 0.836457193f,
+		-0.432976991f, 0.500102997f, 0.749952018f,
+		-0.48294282f, 0.258877903f, 0.836509705f,
+		2.26316903e-08f, 0.258875906f, 0.965910614f,
+		4.37209025e-08f, 0.500108063f, 0.865963042f,
+		-0.224130049f, 0.500105143f, 0.836457193f,
+		-0.249976963f, 0.258883983f, 0.933000863f,
+		0.249976963f, 0.258883983f, 0.933000863f,
+		0.224130049f, 0.500105143f, 0.836457193f,
+		4.37209025e-08f, 0.500108063f, 0.865963042f,
+		2.26316903e-08f, 0.258875906f, 0.965910614f,
+		0.482955992f, 0.258884996f, 0.836499989f,
+		0.432976991f, 0.500102997f, 0.749952018f,
+		0.224130049f, 0.500105143f, 0.836457193f,
+		0.249976963f, 0.258883983f, 0.933000863f,
+		0.682999849f, 0.258886933f, 0.682999849f,
+		0.612328887f, 0.500106871f, 0.612328887f,
+		0.432976991f, 0.500102997f, 0.749952018f,
+		0.482955992f, 0.258884996f, 0.836499989f,
+		0.83649987f, 0.258884966f, 0.482955933f,
+		0.749952018f, 0.500102997f, 0.432976991f,
+		0.612328887f, 0.500106871f, 0.612328887f,
+		0.682999849f, 0.258886933f, 0.682999849f,
+		0.933000863f, 0.258883983f, 0.249976963f,
+		0.836457193f, 0.500105143f, 0.224130049f,
+		0.749952018f, 0.500102997f, 0.432976991f,
+		0.83649987f, 0.258884966f, 0.482955933f,
+		0.965910614f, 0.258875906f, 0.0f,
+		0.865963042f, 0.500108063f, 0.0f,
+		0.836457193f, 0.500105143f, 0.224130049f,
+		0.933000863f, 0.258883983f, 0.249976963f,
+		0.836457193f, 0.500105143f, -0.224130049f,
+		0.682922304f, 0.707204342f, -0.182973087f,
+		0.707013249f, 0.707200229f, 0.0f,
+		0.865963042f, 0.500108063f, 0.0f,
+		0.749952018f, 0.500102997f, -0.432976991f,
+		0.612292051f, 0.70720005f, -0.353506029f,
+		0.682922304f, 0.707204342f, -0.182973087f,
+		0.836457193f, 0.500105143f, -0.224130049f,
+		0.612328887f, 0.500106871f, -0.612328887f,
+		0.499924928f, 0.707212925f, -0.499924928f,
+		0.612292051f, 0.70720005f, -0.353506029f,
+		0.749952018f, 0.500102997f, -0.432976991f,
+		0.432976991f, 0.500102997f, -0.749952018f,
+		0.353506029f, 0.70720005f, -0.612292051f,
+		0.499924928f, 0.707212925f, -0.499924928f,
+		0.612328887f, 0.500106871f, -0.612328887f,
+		0.224130049f, 0.500105143f, -0.836457193f,
+		0.182973087f, 0.707204342f, -0.682922304f,
+		0.353506029f, 0.70720005f, -0.612292051f,
+		0.432976991f, 0.500102997f, -0.749952018f,
+		4.37209025e-08f, 0.500108063f, -0.865963042f,
+		6.18253821e-08f, 0.707200766f, -0.707012773f,
+		0.182973087f, 0.707204342f, -0.682922304f,
+		0.224130049f, 0.500105143f, -0.836457193f,
+		-0.224130049f, 0.500105143f, -0.836457193f,
+		-0.182973087f, 0.707204342f, -0.682922304f,
+		6.18253821e-08f, 0.707200766f, -0.707012773f,
+		4.37209025e-08f, 0.500108063f, -0.865963042f,
+		-0.432976991f, 0.500102997f, -0.749952018f,
+		-0.353506029f, 0.70720005f, -0.612292051f,
+		-0.182973087f, 0.707204342f, -0.682922304f,
+		-0.224130049f, 0.500105143f, -0.836457193f,
+		-0.612328887f, 0.500106871f, -0.612328887f,
+		-0.499924928f, 0.707212925f, -0.499924928f,
+		-0.353506029f, 0.70720005f, -0.612292051f,
+		-0.432976991f, 0.500102997f, -0.749952018f,
+		-0.749952018f, 0.500102997f, -0.432976991f,
+		-0.612292051f, 0.70720005f, -0.353506029f,
+		-0.499924928f, 0.707212925f, -0.499924928f,
+		-0.612328887f, 0.500106871f, -0.612328887f,
+		-0.836457193f, 0.500105143f, -0.224130049f,
+		-0.682922304f, 0.707204342f, -0.182973087f,
+		-0.612292051f, 0.70720005f, -0.353506029f,
+		-0.749952018f, 0.500102997f, -0.432976991f,
+		-0.865963042f, 0.500108063f, 0.0f,
+		-0.707012773f, 0.707200766f, 0.0f,
+		-0.682922304f, 0.707204342f, -0.182973087f,
+		-0.836457193f, 0.500105143f, -0.224130049f,
+		-0.836457193f, 0.500105143f, 0.224130049f,
+		-0.682922304f, 0.707204342f, 0.182973087f,
+		-0.707012773f, 0.707200766f, 0.0f,
+		-0.865963042f, 0.500108063f, 0.0f,
+		-0.749952018f, 0.500102997f, 0.432976991f,
+		-0.612292051f, 0.70720005f, 0.353506029f,
+		-0.682922304f, 0.707204342f, 0.182973087f,
+		-0.836457193f, 0.500105143f, 0.224130049f,
+		-0.612328887f, 0.500106871f, 0.612328887f,
+		-0.499924928f, 0.707212925f, 0.499924928f,
+		-0.612292051f, 0.70720005f, 0.353506029f,
+		-0.749952018f, 0.500102997f, 0.432976991f,
+		-0.432976991f, 0.500102997f, 0.749952018f,
+		-0.353506029f, 0.70720005f, 0.612292051f,
+		-0.499924928f, 0.707212925f, 0.499924928f,
+		-0.612328887f, 0.500106871f, 0.612328887f,
+		-0.224130049f, 0.500105143f, 0.836457193f,
+		-0.182973087f, 0.707204342f, 0.682922304f,
+		-0.353506029f, 0.70720005f, 0.612292051f,
+		-0.432976991f, 0.500102997f, 0.749952018f,
+		4.37209025e-08f, 0.500108063f, 0.865963042f,
+		6.18253821e-08f, 0.707200766f, 0.707012773f,
+		-0.182973087f, 0.707204342f, 0.682922304f,
+		-0.224130049f, 0.500105143f, 0.836457193f,
+		0.224130049f, 0.500105143f, 0.836457193f,
+		0.182973087f, 0.707204342f, 0.682922304f,
+		6.18253821e-08f, 0.707200766f, 0.707012773f,
+		4.37209025e-08f, 0.500108063f, 0.865963042f,
+		0.432976991f, 0.500102997f, 0.749952018f,
+		0.353506029f, 0.70720005f, 0.612292051f,
+		0.182973087f, 0.707204342f, 0.682922304f,
+		0.224130049f, 0.500105143f, 0.836457193f,
+		0.612328887f, 0.500106871f, 0.612328887f,
+		0.499924928f, 0.707212925f, 0.499924928f,
+		0.353506029f, 0.70720005f, 0.612292051f,
+		0.432976991f, 0.500102997f, 0.749952018f,
+		0.749952018f, 0.500102997f, 0.432976991f,
+		0.612292051f, 0.70720005f, 0.353506029f,
+		0.499924928f, 0.707212925f, 0.499924928f,
+		0.612328887f, 0.500106871f, 0.612328887f,
+		0.836457193f, 0.500105143f, 0.224130049f,
+		0.682922304f, 0.707204342f, 0.182973087f,
+		0.612292051f, 0.70720005f, 0.353506029f,
+		0.749952018f, 0.500102997f, 0.432976991f,
+		0.865963042f, 0.500108063f, 0.0f,
+		0.707013249f, 0.707200229f, 0.0f,
+		0.682922304f, 0.707204342f, 0.182973087f,
+		0.836457193f, 0.500105143f, 0.224130049f,
+		0.682922304f, 0.707204342f, -0.182973087f,
+		0.482858211f, 0.866088331f, -0.129379064f,
+		0.49989f, 0.866088986f, 0.0f,
+		0.707013249f, 0.707200229f, 0.0f,
+		0.612292051f, 0.70720005f, -0.353506029f,
+		0.432919055f, 0.866088092f, -0.24994503f,
+		0.482858211f, 0.866088331f, -0.129379064f,
+		0.682922304f, 0.707204342f, -0.182973087f,
+		0.499924928f, 0.707212925f, -0.499924928f,
+		0.353479028f, 0.866086125f, -0.353479028f,
+		0.432919055f, 0.866088092f, -0.24994503f,
+		0.612292051f, 0.70720005f, -0.353506029f,
+		0.353506029f, 0.70720005f, -0.612292051f,
+		0.24994503f, 0.866088092f, -0.432919055f,
+		0.353479028f, 0.866086125f, -0.353479028f,
+		0.499924928f, 0.707212925f, -0.499924928f,
+		0.182973087f, 0.707204342f, -0.682922304f,
+		0.129379064f, 0.866088331f, -0.482858211f,
+		0.24994503f, 0.866088092f, -0.432919055f,
+		0.353506029f, 0.70720005f, -0.612292051f,
+		6.18253821e-08f, 0.707200766f, -0.707012773f,
+		7.57159029e-08f, 0.866088986f, -0.49989f,
+		0.129379064f, 0.866088331f, -0.482858211f,
+		0.182973087f, 0.707204342f, -0.682922304f,
+		-0.182973087f, 0.707204342f, -0.682922304f,
+		-0.129379064f, 0.866088331f, -0.482858211f,
+		7.57159029e-08f, 0.866088986f, -0.49989f,
+		6.18253821e-08f, 0.707200766f, -0.707012773f,
+		-0.353506029f, 0.70720005f, -0.612292051f,
+		-0.24994503f, 0.866088092f, -0.432919055f,
+		-0.129379064f, 0.866088331f, -0.482858211f,
+		-0.182973087f, 0.707204342f, -0.682922304f,
+		-0.499924928f, 0.707212925f, -0.499924928f,
+		-0.353477895f, 0.866086721f, -0.353478879f,
+		-0.24994503f, 0.866088092f, -0.432919055f,
+		-0.353506029f, 0.70720005f, -0.612292051f,
+		-0.612292051f, 0.70720005f, -0.353506029f,
+		-0.432919055f, 0.866088092f, -0.24994503f,
+		-0.353477895f, 0.866086721f, -0.353478879f,
+		-0.499924928f, 0.707212925f, -0.499924928f,
+		-0.682922304f, 0.707204342f, -0.182973087f,
+		-0.482858211f, 0.866088331f, -0.129379064f,
+		-0.432919055f, 0.866088092f, -0.24994503f,
+		-0.612292051f, 0.70720005f, -0.353506029f,
+		-0.707012773f, 0.707200766f, 0.0f,
+		-0.49989f, 0.866088986f, 0.0f,
+		-0.482858211f, 0.866088331f, -0.129379064f,
+		-0.682922304f, 0.707204342f, -0.182973087f,
+		-0.682922304f, 0.707204342f, 0.182973087f,
+		-0.482858211f, 0.866088331f, 0.129379064f,
+		-0.49989f, 0.866088986f, 0.0f,
+		-0.707012773f, 0.707200766f, 0.0f,
+		-0.612292051f, 0.70720005f, 0.353506029f,
+		-0.432919055f, 0.866088092f, 0.24994503f,
+		-0.482858211f, 0.866088331f, 0.129379064f,
+		-0.682922304f, 0.707204342f, 0.182973087f,
+		-0.499924928f, 0.707212925f, 0.499924928f,
+		-0.353477895f, 0.866086721f, 0.353478879f,
+		-0.432919055f, 0.866088092f, 0.24994503f,
+		-0.612292051f, 0.70720005f, 0.353506029f,
+		-0.353506029f, 0.70720005f, 0.612292051f,
+		-0.24994503f, 0.866088092f, 0.432919055f,
+		-0.353477895f, 0.866086721f, 0.353478879f,
+		-0.499924928f, 0.707212925f, 0.499924928f,
+		-0.182973087f, 0.707204342f, 0.682922304f,
+		-0.129379064f, 0.866088331f, 0.482858211f,
+		-0.24994503f, 0.866088092f, 0.432919055f,
+		-0.353506029f, 0.70720005f, 0.612292051f,
+		6.18253821e-08f, 0.707200766f, 0.707012773f,
+		7.57159029e-08f, 0.866088986f, 0.49989f,
+		-0.129379064f, 0.866088331f, 0.482858211f,
+		-0.182973087f, 0.707204342f, 0.682922304f,
+		0.182973087f, 0.707204342f, 0.682922304f,
+		0.129379064f, 0.866088331f, 0.482858211f,
+		7.57159029e-08f, 0.866088986f, 0.49989f,
+		6.18253821e-08f, 0.707200766f, 0.707012773f,
+		0.353506029f, 0.70720005f, 0.612292051f,
+		0.24994503f, 0.866088092f, 0.432919055f,
+		0.129379064f, 0.866088331f, 0.482858211f,
+		0.182973087f, 0.707204342f, 0.682922304f,
+		0.499924928f, 0.707212925f, 0.499924928f,
+		0.353479028f, 0.866086125f, 0.353479028f,
+		0.24994503f, 0.866088092f, 0.432919055f,
+		0.353506029f, 0.70720005f, 0.612292051f,
+		0.612292051f, 0.70720005f, 0.353506029f,
+		0.432919055f, 0.866088092f, 0.24994503f,
+		0.353479028f, 0.866086125f, 0.353479028f,
+		0.499924928f, 0.707212925f, 0.499924928f,
+		0.682922304f, 0.707204342f, 0.182973087f,
+		0.482858211f, 0.866088331f, 0.129379064f,
+		0.432919055f, 0.866088092f, 0.24994503f,
+		0.612292051f, 0.70720005f, 0.353506029f,
+		0.707013249f, 0.707200229f, 0.0f,
+		0.49989f, 0.866088986f, 0.0f,
+		0.482858211f, 0.866088331f, 0.129379064f,
+		0.682922304f, 0.707204342f, 0.182973087f,
+		0.482858211f, 0.866088331f, -0.129379064f,
+		0.249910071f, 0.96595031f, -0.0669696257f,
+		0.258722901f, 0.965951622f, 0.0f,
+		0.49989f, 0.866088986f, 0.0f,
+		0.432919055f, 0.866088092f, -0.24994503f,
+		0.224066094f, 0.965952396f, -0.129346058f,
+		0.249910071f, 0.96595031f, -0.0669696257f,
+		0.482858211f, 0.866088331f, -0.129379064f,
+		0.353479028f, 0.866086125f, -0.353479028f,
+		0.182941034f, 0.965953171f, -0.182940036f,
+		0.224066094f, 0.965952396f, -0.129346058f,
+		0.432919055f, 0.866088092f, -0.24994503f,
+		0.24994503f, 0.866088092f, -0.432919055f,
+		0.129346058f, 0.965952396f, -0.224066094f,
+		0.182941034f, 0.965953171f, -0.182940036f,
+		0.353479028f, 0.866086125f, -0.353479028f,
+		0.129379064f, 0.866088331f, -0.482858211f,
+		0.0669697225f, 0.96595031f, -0.249910071f,
+		0.129346058f, 0.965952396f, -0.224066094f,
+		0.24994503f, 0.866088092f, -0.432919055f,
+		7.57159029e-08f, 0.866088986f, -0.49989f,
+		8.44461709e-08f, 0.965951622f, -0.258722901f,
+		0.0669697225f, 0.96595031f, -0.249910071f,
+		0.129379064f, 0.866088331f, -0.482858211f,
+		-0.129379064f, 0.866088331f, -0.482858211f,
+		-0.0669696257f, 0.96595031f, -0.249910071f,
+		8.44461709e-08f, 0.965951622f, -0.258722901f,
+		7.57159029e-08f, 0.866088986f, -0.49989f,
+		-0.24994503f, 0.866088092f, -0.432919055f,
+		-0.129346058f, 0.965952396f, -0.224066094f,
+		-0.0669696257f, 0.96595031f, -0.249910071f,
+		-0.129379064f, 0.866088331f, -0.482858211f,
+		-0.353477895f, 0.866086721f, -0.353478879f,
+		-0.182940066f, 0.96595335f, -0.182940066f,
+		-0.129346058f, 0.965952396f, -0.224066094f,
+		-0.24994503f, 0.866088092f, -0.432919055f,
+		-0.432919055f, 0.866088092f, -0.24994503f,
+		-0.224066094f, 0.965952396f, -0.129346058f,
+		-0.182940066f, 0.96595335f, -0.182940066f,
+		-0.353477895f, 0.866086721f, -0.353478879f,
+		-0.482858211f, 0.866088331f, -0.129379064f,
+		-0.249910071f, 0.96595031f, -0.0669696257f,
+		-0.224066094f, 0.965952396f, -0.129346058f,
+		-0.432919055f, 0.866088092f, -0.24994503f,
+		-0.49989f, 0.866088986f, 0.0f,
+		-0.258721977f, 0.96595186f, 0.0f,
+		-0.249910071f, 0.96595031f, -0.0669696257f,
+		-0.482858211f, 0.866088331f, -0.129379064f,
+		-0.482858211f, 0.866088331f, 0.129379064f,
+		-0.249910071f, 0.96595031f, 0.0669696257f,
+		-0.258721977f, 0.96595186f, 0.0f,
+		-0.49989f, 0.866088986f, 0.0f,
+		-0.432919055f, 0.866088092f, 0.24994503f,
+		-0.224066094f, 0.965952396f, 0.129346058f,
+		-0.249910071f, 0.96595031f, 0.0669696257f,
+		-0.482858211f, 0.866088331f, 0.129379064f,
+		-0.353477895f, 0.866086721f, 0.353478879f,
+		-0.182940066f, 0.96595335f, 0.182940066f,
+		-0.224066094f, 0.965952396f, 0.129346058f,
+		-0.432919055f, 0.866088092f, 0.24994503f,
+		-0.24994503f, 0.866088092f, 0.432919055f,
+		-0.129346058f, 0.965952396f, 0.224066094f,
+		-0.182940066f, 0.96595335f, 0.182940066f,
+		-0.353477895f, 0.866086721f, 0.353478879f,
+		-0.129379064f, 0.866088331f, 0.482858211f,
+		-0.0669696257f, 0.96595031f, 0.249910071f,
+		-0.129346058f, 0.965952396f, 0.224066094f,
+		-0.24994503f, 0.866088092f, 0.432919055f,
+		7.57159029e-08f, 0.866088986f, 0.49989f,
+		8.44461709e-08f, 0.965951622f, 0.258722901f,
+		-0.0669696257f, 0.96595031f, 0.249910071f,
+		-0.129379064f, 0.866088331f, 0.482858211f,
+		0.129379064f, 0.866088331f, 0.482858211f,
+		0.0669697225f, 0.96595031f, 0.249910071f,
+		8.44461709e-08f, 0.965951622f, 0.258722901f,
+		7.57159029e-08f, 0.866088986f, 0.49989f,
+		0.24994503f, 0.866088092f, 0.432919055f,
+		0.129346058f, 0.965952396f, 0.224066094f,
+		0.0669697225f, 0.96595031f, 0.249910071f,
+		0.129379064f, 0.866088331f, 0.482858211f,
+		0.353479028f, 0.866086125f, 0.353479028f,
+		0.182941034f, 0.965953171f, 0.182940036f,
+		0.129346058f, 0.965952396f, 0.224066094f,
+		0.24994503f, 0.866088092f, 0.432919055f,
+		0.432919055f, 0.866088092f, 0.24994503f,
+		0.224066094f, 0.965952396f, 0.129346058f,
+		0.182941034f, 0.965953171f, 0.182940036f,
+		0.353479028f, 0.866086125f, 0.353479028f,
+		0.482858211f, 0.866088331f, 0.129379064f,
+		0.249910071f, 0.96595031f, 0.0669696257f,
+		0.224066094f, 0.965952396f, 0.129346058f,
+		0.432919055f, 0.866088092f, 0.24994503f,
+		0.49989f, 0.866088986f, 0.0f,
+		0.258722901f, 0.965951622f, 0.0f,
+		0.249910071f, 0.96595031f, 0.0669696257f,
+		0.482858211f, 0.866088331f, 0.129379064f,
+		0.249910071f, -0.96595031f, -0.0669696257f,
+		0.258721977f, -0.96595186f, 0.0f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.258722901f, 0.965951622f, 0.0f,
+		0.249910071f, 0.96595031f, -0.0669696257f,
+		0.224066094f, -0.965952396f, -0.129346058f,
+		0.249910071f, -0.96595031f, -0.0669696257f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.249910071f, 0.96595031f, -0.0669696257f,
+		0.224066094f, 0.965952396f, -0.129346058f,
+		0.182940066f, -0.96595335f, -0.182940066f,
+		0.224066094f, -0.965952396f, -0.129346058f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.224066094f, 0.965952396f, -0.129346058f,
+		0.182941034f, 0.965953171f, -0.182940036f,
+		0.129346058f, -0.965952396f, -0.224066094f,
+		0.182940066f, -0.96595335f, -0.182940066f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.182941034f, 0.965953171f, -0.182940036f,
+		0.129346058f, 0.965952396f, -0.224066094f,
+		0.0669696257f, -0.96595031f, -0.249910071f,
+		0.129346058f, -0.965952396f, -0.224066094f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.129346058f, 0.965952396f, -0.224066094f,
+		0.0669697225f, 0.96595031f, -0.249910071f,
+		-8.44461709e-08f, -0.965951622f, -0.258722901f,
+		0.0669696257f, -0.96595031f, -0.249910071f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.0669697225f, 0.96595031f, -0.249910071f,
+		8.44461709e-08f, 0.965951622f, -0.258722901f,
+		-0.0669697225f, -0.96595031f, -0.249910071f,
+		-8.44461709e-08f, -0.965951622f, -0.258722901f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		8.44461709e-08f, 0.965951622f, -0.258722901f,
+		-0.0669696257f, 0.96595031f, -0.249910071f,
+		-0.129346058f, -0.965952396f, -0.224066094f,
+		-0.0669697225f, -0.96595031f, -0.249910071f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.0669696257f, 0.96595031f, -0.249910071f,
+		-0.129346058f, 0.965952396f, -0.224066094f,
+		-0.182941034f, -0.965953171f, -0.182940036f,
+		-0.129346058f, -0.965952396f, -0.224066094f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.129346058f, 0.965952396f, -0.224066094f,
+		-0.182940066f, 0.96595335f, -0.182940066f,
+		-0.224066094f, -0.965952396f, -0.129346058f,
+		-0.182941034f, -0.965953171f, -0.182940036f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.182940066f, 0.96595335f, -0.182940066f,
+		-0.224066094f, 0.965952396f, -0.129346058f,
+		-0.249910071f, -0.96595031f, -0.0669696257f,
+		-0.224066094f, -0.965952396f, -0.129346058f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.224066094f, 0.965952396f, -0.129346058f,
+		-0.249910071f, 0.96595031f, -0.0669696257f,
+		-0.258722901f, -0.965951622f, 0.0f,
+		-0.249910071f, -0.96595031f, -0.0669696257f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.249910071f, 0.96595031f, -0.0669696257f,
+		-0.258721977f, 0.96595186f, 0.0f,
+		-0.249910071f, -0.96595031f, 0.0669696257f,
+		-0.258722901f, -0.965951622f, 0.0f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.258721977f, 0.96595186f, 0.0f,
+		-0.249910071f, 0.96595031f, 0.0669696257f,
+		-0.224066094f, -0.965952396f, 0.129346058f,
+		-0.249910071f, -0.96595031f, 0.0669696257f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.249910071f, 0.96595031f, 0.0669696257f,
+		-0.224066094f, 0.965952396f, 0.129346058f,
+		-0.182941034f, -0.965953171f, 0.182940036f,
+		-0.224066094f, -0.965952396f, 0.129346058f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.224066094f, 0.965952396f, 0.129346058f,
+		-0.182940066f, 0.96595335f, 0.182940066f,
+		-0.129346058f, -0.965952396f, 0.224066094f,
+		-0.182941034f, -0.965953171f, 0.182940036f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.182940066f, 0.96595335f, 0.182940066f,
+		-0.129346058f, 0.965952396f, 0.224066094f,
+		-0.0669697225f, -0.96595031f, 0.249910071f,
+		-0.129346058f, -0.965952396f, 0.224066094f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.129346058f, 0.965952396f, 0.224066094f,
+		-0.0669696257f, 0.96595031f, 0.249910071f,
+		-8.44461709e-08f, -0.965951622f, 0.258722901f,
+		-0.0669697225f, -0.96595031f, 0.249910071f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		-0.0669696257f, 0.96595031f, 0.249910071f,
+		8.44461709e-08f, 0.965951622f, 0.258722901f,
+		0.0669696257f, -0.96595031f, 0.249910071f,
+		-8.44461709e-08f, -0.965951622f, 0.258722901f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		8.44461709e-08f, 0.965951622f, 0.258722901f,
+		0.0669697225f, 0.96595031f, 0.249910071f,
+		0.129346058f, -0.965952396f, 0.224066094f,
+		0.0669696257f, -0.96595031f, 0.249910071f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.0669697225f, 0.96595031f, 0.249910071f,
+		0.129346058f, 0.965952396f, 0.224066094f,
+		0.182940066f, -0.96595335f, 0.182940066f,
+		0.129346058f, -0.965952396f, 0.224066094f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.129346058f, 0.965952396f, 0.224066094f,
+		0.182941034f, 0.965953171f, 0.182940036f,
+		0.224066094f, -0.965952396f, 0.129346058f,
+		0.182940066f, -0.96595335f, 0.182940066f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.182941034f, 0.965953171f, 0.182940036f,
+		0.224066094f, 0.965952396f, 0.129346058f,
+		0.249910071f, -0.96595031f, 0.0669696257f,
+		0.224066094f, -0.965952396f, 0.129346058f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.224066094f, 0.965952396f, 0.129346058f,
+		0.249910071f, 0.96595031f, 0.0669696257f,
+		0.258721977f, -0.96595186f, 0.0f,
+		0.249910071f, -0.96595031f, 0.0669696257f,
+		-8.74227979e-08f, -1.0f, 0.0f,
+		8.74227979e-08f, 1.0f, 0.0f,
+		0.249910071f, 0.96595031f, 0.0669696257f,
+		0.258722901f, 0.965951622f, 0.0f
+	};
+
+	constexpr float TexCoords[] = {
+		0.0416699983f, 0.916670024f,
+		0.0416699983f, 0.833329976f,
+		0.0f, 0.833329976f,
+		0.0f, 0.916670024f,
+		0.083329998f, 0.916670024f,
+		0.083329998f, 0.833329976f,
+		0.0416699983f, 0.833329976f,
+		0.0416699983f, 0.916670024f,
+		0.125f, 0.916670024f,
+		0.125f, 0.833329976f,
+		0.083329998f, 0.833329976f,
+		0.083329998f, 0.916670024f,
+		0.166669995f, 0.916670024f,
+		0.166669995f, 0.833329976f,
+		0.125f, 0.833329976f,
+		0.125f, 0.916670024f,
+		0.208330005f, 0.916670024f,
+		0.208330005f, 0.833329976f,
+		0.166669995f, 0.833329976f,
+		0.166669995f, 0.916670024f,
+		0.25f, 0.916670024f,
+		0.25f, 0.833329976f,
+		0.208330005f, 0.833329976f,
+		0.208330005f, 0.916670024f,
+		0.291669995f, 0.916670024f,
+		0.291669995f, 0.833329976f,
+		0.25f, 0.833329976f,
+		0.25f, 0.916670024f,
+		0.333330005f, 0.916670024f,
+		0.333330005f, 0.833329976f,
+		0.291669995f, 0.833329976f,
+		0.291669995f, 0.916670024f,
+		0.375f, 0.916670024f,
+		0.375f, 0.833329976f,
+		0.333330005f, 0.833329976f,
+		0.333330005f, 0.916670024f,
+		0.416669995f, 0.916670024f,
+		0.416669995f, 0.833329976f,
+		0.375f, 0.833329976f,
+		0.375f, 0.916670024f,
+		0.458330005f, 0.916670024f,
+		0.458330005f, 0.833329976f,
+		0.416669995f, 0.833329976f,
+		0.416669995f, 0.916670024f,
+		0.5f, 0.916670024f,
+		0.5f, 0.833329976f,
+		0.458330005f, 0.833329976f,
+		0.458330005f, 0.916670024f,
+		0.541670024f, 0.916670024f,
+		0.541670024f, 0.833329976f,
+		0.5f, 0.833329976f,
+		0.5f, 0.916670024f,
+		0.583329976f, 0.916670024f,
+		0.583329976f, 0.833329976f,
+		0.541670024f, 0.833329976f,
+		0.541670024f, 0.916670024f,
+		0.625f, 0.916670024f,
+		0.625f, 0.833329976f,
+		0.583329976f, 0.833329976f,
+		0.583329976f, 0.916670024f,
+		0.666670024f, 0.916670024f,
+		0.666670024f, 0.833329976f,
+		0.625f, 0.833329976f,
+		0.625f, 0.916670024f,
+		0.708329976f, 0.916670024f,
+		0.708329976f, 0.833329976f,
+		0.666670024f, 0.833329976f,
+		0.666670024f, 0.916670024f,
+		0.75f, 0.916670024f,
+		0.75f, 0.833329976f,
+		0.708329976f, 0.833329976f,
+		0.708329976f, 0.916670024f,
+		0.791670024f, 0.916670024f,
+		0.791670024f, 0.833329976f,
+		0.75f, 0.833329976f,
+		0.75f, 0.916670024f,
+		0.833329976f, 0.916670024f,
+		0.833329976f, 0.833329976f,
+		0.791670024f, 0.833329976f,
+		0.791670024f, 0.916670024f,
+		0.875f, 0.916670024f,
+		0.875f, 0.833329976f,
+		0.833329976f, 0.833329976f,
+		0.833329976f, 0.916670024f,
+		0.916670024f, 0.916670024f,
+		0.916670024f, 0.833329976f,
+		0.875f, 0.833329976f,
+		0.875f, 0.916670024f,
+		0.958329976f, 0.916670024f,
+		0.958329976f, 0.833329976f,
+		0.916670024f, 0.833329976f,
+		0.916670024f, 0.916670024f,
+		1.0f, 0.916670024f,
+		1.0f, 0.833329976f,
+		0.958329976f, 0.833329976f,
+		0.958329976f, 0.916670024f,
+		0.0416699983f, 0.833329976f,
+		0.0416699983f, 0.75f,
+		0.0f, 0.75f,
+		0.0f, 0.833329976f,
+		0.083329998f, 0.833329976f,
+		0.083329998f, 0.75f,
+		0.0416699983f, 0.75f,
+		0.0416699983f, 0.833329976f,
+		0.125f, 0.833329976f,
+		0.125f, 0.75f,
+		0.083329998f, 0.75f,
+		0.083329998f, 0.833329976f,
+		0.166669995f, 0.833329976f,
+		0.166669995f, 0.75f,
+		0.125f, 0.75f,
+		0.125f, 0.833329976f,
+		0.208330005f, 0.833329976f,
+		0.208330005f, 0.75f,
+		0.166669995f, 0.75f,
+		0.166669995f, 0.833329976f,
+		0.25f, 0.833329976f,
+		0.25f, 0.75f,
+		0.208330005f, 0.75f,
+		0.208330005f, 0.833329976f,
+		0.291669995f, 0.833329976f,
+		0.291669995f, 0.75f,
+		0.25f, 0.75f,
+		0.25f, 0.833329976f,
+		0.333330005f, 0.833329976f,
+		0.333330005f, 0.75f,
+		0.291669995f, 0.75f,
+		0.291669995f, 0.833329976f,
+		0.375f, 0.833329976f,
+		0.375f, 0.75f,
+		0.333330005f, 0.75f,
+		0.333330005f, 0.833329976f,
+		0.416669995f, 0.833329976f,
+		0.416669995f, 0.75f,
+		0.375f, 0.75f,
+		0.375f, 0.833329976f,
+		0.458330005f, 0.833329976f,
+		0.458330005f, 0.75f,
+		0.416669995f, 0.75f,
+		0.416669995f, 0.833329976f,
+		0.5f, 0.833329976f,
+		0.5f, 0.75f,
+		0.458330005f, 0.75f,
+		0.458330005f, 0.833329976f,
+		0.541670024f, 0.833329976f,
+		0.541670024f, 0.75f,
+		0.5f, 0.75f,
+		0.5f, 0.833329976f,
+		0.583329976f, 0.833329976f,
+		0.583329976f, 0.75f,
+		0.541670024f, 0.75f,
+		0.541670024f, 0.833329976f,
+		0.625f, 0.833329976f,
+		0.625f, 0.75f,
+		0.583329976f, 0.75f,
+		0.583329976f, 0.833329976f,
+		0.666670024f, 0.833329976f,
+		0.666670024f, 0.75f,
+		0.625f, 0.75f,
+		0.625f, 0.833329976f,
+		0.708329976f, 0.833329976f,
+		0.708329976f, 0.75f,
+		0.666670024f, 0.75f,
+		0.666670024f, 0.833329976f,
+		0.75f, 0.833329976f,
+		0.75f, 0.75f,
+		0.708329976f, 0.75f,
+		0.708329976f, 0.833329976f,
+		0.791670024f, 0.833329976f,
+		0.791670024f, 0.75f,
+		0.75f, 0.75f,
+		0.75f, 0.833329976f,
+		0.833329976f, 0.833329976f,
+		0.833329976f, 0.75f,
+		0.791670024f, 0.75f,
+		0.791670024f, 0.833329976f,
+		0.875f, 0.833329976f,
+		0.875f, 0.75f,
+		0.833329976f, 0.75f,
+		0.833329976f, 0.833329976f,
+		0.916670024f, 0.833329976f,
+		0.916670024f, 0.75f,
+		0.875f, 0.75f,
+		0.875f, 0.833329976f,
+		0.958329976f, 0.833329976f,
+		0.958329976f, 0.75f,
+		0.916670024f, 0.75f,
+		0.916670024f, 0.833329976f,
+		1.0f, 0.833329976f,
+		1.0f, 0.75f,
+		0.958329976f, 0.75f,
+		0.958329976f, 0.833329976f,
+		0.0416699983f, 0.75f,
+		0.0416699983f, 0.666670024f,
+		0.0f, 0.666670024f,
+		0.0f, 0.75f,
+		0.083329998f, 0.75f,
+		0.083329998f, 0.666670024f,
+		0.0416699983f, 0.666670024f,
+		0.0416699983f, 0.75f,
+		0.125f, 0.75f,
+		0.125f, 0.666670024f,
+		0.083329998f, 0.666670024f,
+		0.083329998f, 0.75f,
+		0.166669995f, 0.75f,
+		0.166669995f, 0.666670024f,
+		0.125f, 0.666670024f,
+		0.125f, 0.75f,
+		0.208330005f, 0.75f,
+		0.208330005f, 0.666670024f,
+		0.166669995f, 0.666670024f,
+		0.166669995f, 0.75f,
+		0.25f, 0.75f,
+		0.25f, 0.666670024f,
+		0.208330005f, 0.666670024f,
+		0.208330005f, 0.75f,
+		0.291669995f, 0.75f,
+		0.291669995f, 0.666670024f,
+		0.25f, 0.666670024f,
+		0.25f, 0.75f,
+		0.333330005f, 0.75f,
+		0.333330005f, 0.666670024f,
+		0.291669995f, 0.666670024f,
+		0.291669995f, 0.75f,
+		0.375f, 0.75f,
+		0.375f, 0.666670024f,
+		0.333330005f, 0.666670024f,
+		0.333330005f, 0.75f,
+		0.416669995f, 0.75f,
+		0.416669995f, 0.666670024f,
+		0.375f, 0.666670024f,
+		0.375f, 0.75f,
+		0.458330005f, 0.75f,
+		0.458330005f, 0.666670024f,
+		0.416669995f, 0.666670024f,
+		0.416669995f, 0.75f,
+		0.5f, 0.75f,
+		0.5f, 0.666670024f,
+		0.458330005f, 0.666670024f,
+		0.458330005f, 0.75f,
+		0.541670024f, 0.75f,
+		0.541670024f, 0.666670024f,
+		0.5f, 0.666670024f,
+		0.5f, 0.75f,
+		0.583329976f, 0.75f,
+		0.583329976f, 0.666670024f,
+		0.541670024f, 0.666670024f,
+		0.541670024f, 0.75f,
+		0.625f, 0.75f,
+		0.625f, 0.666670024f,
+		0.583329976f, 0.666670024f,
+		0.583329976f, 0.75f,
+		0.666670024f, 0.75f,
+		0.666670024f, 0.666670024f,
+		0.625f, 0.666670024f,
+		0.625f, 0.75f,
+		0.708329976f, 0.75f,
+		0.708329976f, 0.666670024f,
+		0.666670024f, 0.666670024f,
+		0.666670024f, 0.75f,
+		0.75f, 0.75f,
+		0.75f, 0.666670024f,
+		0.708329976f, 0.666670024f,
+		0.708329976f, 0.75f,
+		0.791670024f, 0.75f,
+		0.791670024f, 0.666670024f,
+		0.75f, 0.666670024f,
+		0.75f, 0.75f,
+		0.833329976f, 0.75f,
+		0.833329976f, 0.666670024f,
+		0.791670024f, 0.666670024f,
+		0.791670024f, 0.75f,
+		0.875f, 0.75f,
+		0.875f, 0.666670024f,
+		0.833329976f, 0.666670024f,
+		0.833329976f, 0.75f,
+		0.916670024f, 0.75f,
+		0.916670024f, 0.666670024f,
+		0.875f, 0.666670024f,
+		0.875f, 0.75f,
+		0.958329976f, 0.75f,
+		0.958329976f, 0.666670024f,
+		0.916670024f, 0.666670024f,
+		0.916670024f, 0.75f,
+		1.0f, 0.75f,
+		1.0f, 0.666670024f,
+		0.958329976f, 0.666670024f,
+		0.958329976f, 0.75f,
+		0.0416699983f, 0.666670024f,
+		0.0416699983f, 0.583329976f,
+		0.0f, 0.583329976f,
+		0.0f, 0.666670024f,
+		0.083329998f, 0.666670024f,
+		0.083329998f, 0.583329976f,
+		0.0416699983f, 0.583329976f,
+		0.0416699983f, 0.666670024f,
+		0.125f, 0.666670024f,
+		0.125f, 0.583329976f,
+		0.083329998f, 0.583329976f,
+		0.083329998f, 0.666670024f,
+		0.166669995f, 0.666670024f,
+		0.166669995f, 0.583329976f,
+		0.125f, 0.583329976f,
+		0.125f, 0.666670024f,
+		0.208330005f, 0.666670024f,
+		0.208330005f, 0.583329976f,
+		0.166669995f, 0.583329976f,
+		0.166669995f, 0.666670024f,
+		0.25f, 0.666670024f,
+		0.25f, 0.583329976f,
+		0.208330005f, 0.583329976f,
+		0.208330005f, 0.666670024f,
+		0.291669995f, 0.666670024f,
+		0.291669995f, 0.583329976f,
+		0.25f, 0.583329976f,
+		0.25f, 0.666670024f,
+		0.333330005f, 0.666670024f,
+		0.333330005f, 0.583329976f,
+		0.291669995f, 0.583329976f,
+		0.291669995f, 0.666670024f,
+		0.375f, 0.666670024f,
+		0.375f, 0.583329976f,
+		0.333330005f, 0.583329976f,
+		0.333330005f, 0.666670024f,
+		0.416669995f, 0.666670024f,
+		0.416669995f, 0.583329976f,
+		0.375f, 0.583329976f,
+		0.375f, 0.666670024f,
+		0.458330005f, 0.666670024f,
+		0.458330005f, 0.583329976f,
+		0.416669995f, 0.583329976f,
+		0.416669995f, 0.666670024f,
+		0.5f, 0.666670024f,
+		0.5f, 0.583329976f,
+		0.458330005f, 0.583329976f,
+		0.458330005f, 0.666670024f,
+		0.541670024f, 0.666670024f,
+		0.541670024f, 0.583329976f,
+		0.5f, 0.583329976f,
+		0.5f, 0.666670024f,
+		0.583329976f, 0.666670024f,
+		0.583329976f, 0.583329976f,
+		0.541670024f, 0.583329976f,
+		0.541670024f, 0.666670024f,
+		0.625f, 0.666670024f,
+		0.625f, 0.583329976f,
+		0.583329976f, 0.583329976f,
+		0.583329976f, 0.666670024f,
+		0.666670024f, 0.666670024f,
+		0.666670024f, 0.583329976f,
+		0.625f, 0.583329976f,
+		0.625f, 0.666670024f,
+		0.708329976f, 0.666670024f,
+		0.708329976f, 0.583329976f,
+		0.666670024f, 0.583329976f,
+		0.666670024f, 0.666670024f,
+		0.75f, 0.666670024f,
+		0.75f, 0.583329976f,
+		0.708329976f, 0.583329976f,
+		0.708329976f, 0.666670024f,
+		0.791670024f, 0.666670024f,
+		0.791670024f, 0.583329976f,
+		0.75f, 0.583329976f,
+		0.75f, 0.666670024f,
+		0.833329976f, 0.666670024f,
+		0.833329976f, 0.583329976f,
+		0.791670024f, 0.583329976f,
+		0.791670024f, 0.666670024f,
+		0.875f, 0.666670024f,
+		0.875f, 0.583329976f,
+		0.833329976f, 0.583329976f,
+		0.833329976f, 0.666670024f,
+		0.916670024f, 0.666670024f,
+		0.916670024f, 0.583329976f,
+		0.875f, 0.583329976f,
+		0.875f, 0.666670024f,
+		0.958329976f, 0.666670024f,
+		0.958329976f, 0.583329976f,
+		0.916670024f, 0.583329976f,
+		0.916670024f, 0.666670024f,
+		1.0f, 0.666670024f,
+		1.0f, 0.583329976f,
+		0.958329976f, 0.583329976f,
+		0.958329976f, 0.666670024f,
+		0.0416699983f, 0.583329976f,
+		0.0416699983f, 0.5f,
+		0.0f, 0.5f,
+		0.0f, 0.583329976f,
+		0.083329998f, 0.583329976f,
+		0.083329998f, 0.5f,
+		0.0416699983f, 0.5f,
+		0.0416699983f, 0.583329976f,
+		0.125f, 0.583329976f,
+		0.125f, 0.5f,
+		0.083329998f, 0.5f,
+		0.083329998f, 0.583329976f,
+		0.166669995f, 0.583329976f,
+		0.166669995f, 0.5f,
+		0.125f, 0.5f,
+		0.125f, 0.583329976f,
+		0.208330005f, 0.583329976f,
+		0.208330005f, 0.5f,
+		0.166669995f, 0.5f,
+		0.166669995f, 0.583329976f,
+		0.25f, 0.583329976f,
+		0.25f, 0.5f,
+		0.208330005f, 0.5f,
+		0.208330005f, 0.583329976f,
+		0.291669995f, 0.583329976f,
+		0.291669995f, 0.5f,
+		0.25f, 0.5f,
+		0.25f, 0.583329976f,
+		0.333330005f, 0.583329976f,
+		0.333330005f, 0.5f,
+		0.291669995f, 0.5f,
+		0.291669995f, 0.583329976f,
+		0.375f, 0.583329976f,
+		0.375f, 0.5f,
+		0.333330005f, 0.5f,
+		0.333330005f, 0.583329976f,
+		0.416669995f, 0.583329976f,
+		0.416669995f, 0.5f,
+		0.375f, 0.5f,
+		0.375f, 0.583329976f,
+		0.458330005f, 0.583329976f,
+		0.458330005f, 0.5f,
+		0.416669995f, 0.5f,
+		0.416669995f, 0.583329976f,
+		0.5f, 0.583329976f,
+		0.5f, 0.5f,
+		0.458330005f, 0.5f,
+		0.458330005f, 0.583329976f,
+		0.541670024f, 0.583329976f,
+		0.541670024f, 0.5f,
+		0.5f, 0.5f,
+		0.5f, 0.583329976f,
+		0.583329976f, 0.583329976f,
+		0.583329976f, 0.5f,
+		0.541670024f, 0.5f,
+		0.541670024f, 0.583329976f,
+		0.625f, 0.583329976f,
+		0.625f, 0.5f,
+		0.583329976f, 0.5f,
+		0.583329976f, 0.583329976f,
+		0.666670024f, 0.583329976f,
+		0.666670024f, 0.5f,
+		0.625f, 0.5f,
+		0.625f, 0.583329976f,
+		0.708329976f, 0.583329976f,
+		0.708329976f, 0.5f,
+		0.666670024f, 0.5f,
+		0.666670024f, 0.583329976f,
+		0.75f, 0.583329976f,
+		0.75f, 0.5f,
+		0.708329976f, 0.5f,
+		0.708329976f, 0.583329976f,
+		0.791670024f, 0.583329976f,
+		0.791670024f, 0.5f,
+		0.75f, 0.5f,
+		0.75f, 0.583329976f,
+		0.833329976f, 0.583329976f,
+		0.833329976f, 0.5f,
+		0.791670024f, 0.5f,
+		0.791670024f, 0.583329976f,
+		0.875f, 0.583329976f,
+		0.875f, 0.5f,
+		0.833329976f, 0.5f,
+		0.833329976f, 0.583329976f,
+		0.916670024f, 0.583329976f,
+		0.916670024f, 0.5f,
+		0.875f, 0.5f,
+		0.875f, 0.583329976f,
+		0.958329976f, 0.583329976f,
+		0.958329976f, 0.5f,
+		0.916670024f, 0.5f,
+		0.916670024f, 0.583329976f,
+		1.0f, 0.583329976f,
+		1.0f, 0.5f,
+		0.958329976f, 0.5f,
+		0.958329976f, 0.583329976f,
+		0.0416699983f, 0.5f,
+		0.0416699983f, 0.416669995f,
+		0.0f, 0.416669995f,
+		0.0f, 0.5f,
+		0.083329998f, 0.5f,
+		0.083329998f, 0.416669995f,
+		0.0416699983f, 0.416669995f,
+		0.0416699983f, 0.5f,
+		0.125f, 0.5f,
+		0.125f, 0.416669995f,
+		0.083329998f, 0.416669995f,
+		0.083329998f, 0.5f,
+		0.166669995f, 0.5f,
+		0.166669995f, 0.416669995f,
+		0.125f, 0.416669995f,
+		0.125f, 0.5f,
+		0.208330005f, 0.5f,
+		0.208330005f, 0.416669995f,
+		0.166669995f, 0.416669995f,
+		0.166669995f, 0.5f,
+		0.25f, 0.5f,
+		0.25f, 0.416669995f,
+		0.208330005f, 0.416669995f,
+		0.208330005f, 0.5f,
+		0.291669995f, 0.5f,
+		0.291669995f, 0.416669995f,
+		0.25f, 0.416669995f,
+		0.25f, 0.5f,
+		0.333330005f, 0.5f,
+		0.333330005f, 0.416669995f,
+		0.291669995f, 0.416669995f,
+		0.291669995f, 0.5f,
+		0.375f, 0.5f,
+		0.375f, 0.416669995f,
+		0.333330005f, 0.416669995f,
+		0.333330005f, 0.5f,
+		0.416669995f, 0.5f,
+		0.416669995f, 0.416669995f,
+		0.375f, 0.416669995f,
+		0.375f, 0.5f,
+		0.458330005f, 0.5f,
+		0.458330005f, 0.416669995f,
+		0.416669995f, 0.416669995f,
+		0.416669995f, 0.5f,
+		0.5f, 0.5f,
+		0.5f, 0.416669995f,
+		0.458330005f, 0.416669995f,
+		0.458330005f, 0.5f,
+		0.541670024f, 0.5f,
+		0.541670024f, 0.416669995f,
+		0.5f, 0.416669995f,
+		0.5f, 0.5f,
+		0.583329976f, 0.5f,
+		0.583329976f, 0.416669995f,
+		0.541670024f, 0.416669995f,
+		0.541670024f, 0.5f,
+		0.625f, 0.5f,
+		0.625f, 0.416669995f,
+		0.583329976f, 0.416669995f,
+		0.583329976f, 0.5f,
+		0.666670024f, 0.5f,
+		0.666670024f, 0.416669995f,
+		0.625f, 0.416669995f,
+		0.625f, 0.5f,
+		0.708329976f, 0.5f,
+		0.708329976f, 0.416669995f,
+		0.666670024f, 0.416669995f,
+		0.666670024f, 0.5f,
+		0.75f, 0.5f,
+		0.75f, 0.416669995f,
+		0.708329976f, 0.416669995f,
+		0.708329976f, 0.5f,
+		0.791670024f, 0.5f,
+		0.791670024f, 0.416669995f,
+		0.75f, 0.416669995f,
+		0.75f, 0.5f,
+		0.833329976f, 0.5f,
+		0.833329976f, 0.416669995f,
+		0.791670024f, 0.416669995f,
+		0.791670024f, 0.5f,
+		0.875f, 0.5f,
+		0.875f, 0.416669995f,
+		0.833329976f, 0.416669995f,
+		0.833329976f, 0.5f,
+		0.916670024f, 0.5f,
+		0.916670024f, 0.416669995f,
+		0.875f, 0.416669995f,
+		0.875f, 0.5f,
+		0.958329976f, 0.5f,
+		0.958329976f, 0.416669995f,
+		0.916670024f, 0.416669995f,
+		0.916670024f, 0.5f,
+		1.0f, 0.5f,
+		1.0f, 0.416669995f,
+		0.958329976f, 0.416669995f,
+		0.958329976f, 0.5f,
+		0.0416699983f, 0.416669995f,
+		0.0416699983f, 0.333330005f,
+		0.0f, 0.333330005f,
+		0.0f, 0.416669995f,
+		0.083329998f, 0.416669995f,
+		0.083329998f, 0.333330005f,
+		0.0416699983f, 0.333330005f,
+		0.0416699983f, 0.416669995f,
+		0.125f, 0.416669995f,
+		0.125f, 0.333330005f,
+		0.083329998f, 0.333330005f,
+		0.083329998f, 0.416669995f,
+		0.166669995f, 0.416669995f,
+		0.166669995f, 0.333330005f,
+		0.125f, 0.333330005f,
+		0.125f, 0.416669995f,
+		0.208330005f, 0.416669995f,
+		0.208330005f, 0.333330005f,
+		0.166669995f, 0.333330005f,
+		0.166669995f, 0.416669995f,
+		0.25f, 0.416669995f,
+		0.25f, 0.333330005f,
+		0.208330005f, 0.333330005f,
+		0.208330005f, 0.416669995f,
+		0.291669995f, 0.416669995f,
+		0.291669995f, 0.333330005f,
+		0.25f, 0.333330005f,
+		0.25f, 0.416669995f,
+		0.333330005f, 0.416669995f,
+		0.333330005f, 0.333330005f,
+		0.291669995f, 0.333330005f,
+		0.291669995f, 0.416669995f,
+		0.375f, 0.416669995f,
+		0.375f, 0.333330005f,
+		0.333330005f, 0.333330005f,
+		0.333330005f, 0.416669995f,
+		0.416669995f, 0.416669995f,
+		0.416669995f, 0.333330005f,
+		0.375f, 0.333330005f,
+		0.375f, 0.416669995f,
+		0.458330005f, 0.416669995f,
+		0.458330005f, 0.333330005f,
+		0.416669995f, 0.333330005f,
+		0.416669995f, 0.416669995f,
+		0.5f, 0.416669995f,
+		0.5f, 0.333330005f,
+		0.458330005f, 0.333330005f,
+		0.458330005f, 0.416669995f,
+		0.541670024f, 0.416669995f,
+		0.541670024f, 0.333330005f,
+		0.5f, 0.333330005f,
+		0.5f, 0.416669995f,
+		0.583329976f, 0.416669995f,
+		0.583329976f, 0.333330005f,
+		0.541670024f, 0.333330005f,
+		0.541670024f, 0.416669995f,
+		0.625f, 0.416669995f,
+		0.625f, 0.333330005f,
+		0.583329976f, 0.333330005f,
+		0.583329976f, 0.416669995f,
+		0.666670024f, 0.416669995f,
+		0.666670024f, 0.333330005f,
+		0.625f, 0.333330005f,
+		0.625f, 0.416669995f,
+		0.708329976f, 0.416669995f,
+		0.708329976f, 0.333330005f,
+		0.666670024f, 0.333330005f,
+		0.666670024f, 0.416669995f,
+		0.75f, 0.416669995f,
+		0.75f, 0.333330005f,
+		0.708329976f, 0.333330005f,
+		0.708329976f, 0.416669995f,
+		0.791670024f, 0.416669995f,
+		0.791670024f, 0.333330005f,
+		0.75f, 0.333330005f,
+		0.75f, 0.416669995f,
+		0.833329976f, 0.416669995f,
+		0.833329976f, 0.333330005f,
+		0.791670024f, 0.333330005f,
+		0.791670024f, 0.416669995f,
+		0.875f, 0.416669995f,
+		0.875f, 0.333330005f,
+		0.833329976f, 0.333330005f,
+		0.833329976f, 0.416669995f,
+		0.916670024f, 0.416669995f,
+		0.916670024f, 0.333330005f,
+		0.875f, 0.333330005f,
+		0.875f, 0.416669995f,
+		0.958329976f, 0.416669995f,
+		0.958329976f, 0.333330005f,
+		0.916670024f, 0.333330005f,
+		0.916670024f, 0.416669995f,
+		1.0f, 0.416669995f,
+		1.0f, 0.333330005f,
+		0.958329976f, 0.333330005f,
+		0.958329976f, 0.416669995f,
+		0.0416699983f, 0.333330005f,
+		0.0416699983f, 0.25f,
+		0.0f, 0.25f,
+		0.0f, 0.333330005f,
+		0.083329998f, 0.333330005f,
+		0.083329998f, 0.25f,
+		0.0416699983f, 0.25f,
+		0.0416699983f, 0.333330005f,
+		0.125f, 0.333330005f,
+		0.125f, 0.25f,
+		0.083329998f, 0.25f,
+		0.083329998f, 0.333330005f,
+		0.166669995f, 0.333330005f,
+		0.166669995f, 0.25f,
+		0.125f, 0.25f,
+		0.125f, 0.333330005f,
+		0.208330005f, 0.333330005f,
+		0.208330005f, 0.25f,
+		0.166669995f, 0.25f,
+		0.166669995f, 0.333330005f,
+		0.25f, 0.333330005f,
+		0.25f, 0.25f,
+		0.208330005f, 0.25f,
+		0.208330005f, 0.333330005f,
+		0.291669995f, 0.333330005f,
+		0.291669995f, 0.25f,
+		0.25f, 0.25f,
+		0.25f, 0.333330005f,
+		0.333330005f, 0.333330005f,
+		0.333330005f, 0.25f,
+		0.291669995f, 0.25f,
+		0.291669995f, 0.333330005f,
+		0.375f, 0.333330005f,
+		0.375f, 0.25f,
+		0.333330005f, 0.25f,
+		0.333330005f, 0.333330005f,
+		0.416669995f, 0.333330005f,
+		0.416669995f, 0.25f,
+		0.375f, 0.25f,
+		0.375f, 0.333330005f,
+		0.458330005f, 0.333330005f,
+		0.458330005f, 0.25f,
+		0.416669995f, 0.25f,
+		0.416669995f, 0.333330005f,
+		0.5f, 0.333330005f,
+		0.5f, 0.25f,
+		0.458330005f, 0.25f,
+		0.458330005f, 0.333330005f,
+		0.541670024f, 0.333330005f,
+		0.541670024f, 0.25f,
+		0.5f, 0.25f,
+		0.5f, 0.333330005f,
+		0.583329976f, 0.333330005f,
+		0.583329976f, 0.25f,
+		0.541670024f, 0.25f,
+		0.541670024f, 0.333330005f,
+		0.625f, 0.333330005f,
+		0.625f, 0.25f,
+		0.583329976f, 0.25f,
+		0.583329976f, 0.333330005f,
+		0.666670024f, 0.333330005f,
+		0.666670024f, 0.25f,
+		0.625f, 0.25f,
+		0.625f, 0.333330005f,
+		0.708329976f, 0.333330005f,
+		0.708329976f, 0.25f,
+		0.666670024f, 0.25f,
+		0.666670024f, 0.333330005f,
+		0.75f, 0.333330005f,
+		0.75f, 0.25f,
+		0.708329976f, 0.25f,
+		0.708329976f, 0.333330005f,
+		0.791670024f, 0.333330005f,
+		0.791670024f, 0.25f,
+		0.75f, 0.25f,
+		0.75f, 0.333330005f,
+		0.833329976f, 0.333330005f,
+		0.833329976f, 0.25f,
+		0.791670024f, 0.25f,
+		0.791670024f, 0.333330005f,
+		0.875f, 0.333330005f,
+		0.875f, 0.25f,
+		0.833329976f, 0.25f,
+		0.833329976f, 0.333330005f,
+		0.916670024f, 0.333330005f,
+		0.916670024f, 0.25f,
+		0.875f, 0.25f,
+		0.875f, 0.333330005f,
+		0.958329976f, 0.333330005f,
+		0.958329976f, 0.25f,
+		0.916670024f, 0.25f,
+		0.916670024f, 0.333330005f,
+		1.0f, 0.333330005f,
+		1.0f, 0.25f,
+		0.958329976f, 0.25f,
+		0.958329976f, 0.333330005f,
+		0.0416699983f, 0.25f,
+		0.0416699983f, 0.166669995f,
+		0.0f, 0.166669995f,
+		0.0f, 0.25f,
+		0.083329998f, 0.25f,
+		0.083329998f, 0.166669995f,
+		0.0416699983f, 0.166669995f,
+		0.0416699983f, 0.25f,
+		0.125f, 0.25f,
+		0.125f, 0.166669995f,
+		0.083329998f, 0.166669995f,
+		0.083329998f, 0.25f,
+		0.166669995f, 0.25f,
+		0.166669995f, 0.166669995f,
+		0.125f, 0.166669995f,
+		0.125f, 0.25f,
+		0.208330005f, 0.25f,
+		0.208330005f, 0.166669995f,
+		0.166669995f, 0.166669995f,
+		0.166669995f, 0.25f,
+		0.25f, 0.25f,
+		0.25f, 0.166669995f,
+		0.208330005f, 0.166669995f,
+		0.208330005f, 0.25f,
+		0.291669995f, 0.25f,
+		0.291669995f, 0.166669995f,
+		0.25f, 0.166669995f,
+		0.25f, 0.25f,
+		0.333330005f, 0.25f,
+		0.333330005f, 0.166669995f,
+		0.291669995f, 0.166669995f,
+		0.291669995f, 0.25f,
+		0.375f, 0.25f,
+		0.375f, 0.166669995f,
+		0.333330005f, 0.166669995f,
+		0.333330005f, 0.25f,
+		0.416669995f, 0.25f,
+		0.416669995f, 0.166669995f,
+		0.375f, 0.166669995f,
+		0.375f, 0.25f,
+		0.458330005f, 0.25f,
+		0.458330005f, 0.166669995f,
+		0.416669995f, 0.166669995f,
+		0.416669995f, 0.25f,
+		0.5f, 0.25f,
+		0.5f, 0.166669995f,
+		0.458330005f, 0.166669995f,
+		0.458330005f, 0.25f,
+		0.541670024f, 0.25f,
+		0.541670024f, 0.166669995f,
+		0.5f, 0.166669995f,
+		0.5f, 0.25f,
+		0.583329976f, 0.25f,
+		0.583329976f, 0.166669995f,
+		0.541670024f, 0.166669995f,
+		0.541670024f, 0.25f,
+		0.625f, 0.25f,
+		0.625f, 0.166669995f,
+		0.583329976f, 0.166669995f,
+		0.583329976f, 0.25f,
+		0.666670024f, 0.25f,
+		0.666670024f, 0.166669995f,
+		0.625f, 0.166669995f,
+		0.625f, 0.25f,
+		0.708329976f, 0.25f,
+		0.708329976f, 0.166669995f,
+		0.666670024f, 0.166669995f,
+		0.666670024f, 0.25f,
+		0.75f, 0.25f,
+		0.75f, 0.166669995f,
+		0.708329976f, 0.166669995f,
+		0.708329976f, 0.25f,
+		0.791670024f, 0.25f,
+		0.791670024f, 0.166669995f,
+		0.75f, 0.166669995f,
+		0.75f, 0.25f,
+		0.833329976f, 0.25f,
+		0.833329976f, 0.166669995f,
+		0.791670024f, 0.166669995f,
+		0.791670024f, 0.25f,
+		0.875f, 0.25f,
+		0.875f, 0.166669995f,
+		0.833329976f, 0.166669995f,
+		0.833329976f, 0.25f,
+		0.916670024f, 0.25f,
+		0.916670024f, 0.166669995f,
+		0.875f, 0.166669995f,
+		0.875f, 0.25f,
+		0.958329976f, 0.25f,
+		0.958329976f, 0.166669995f,
+		0.916670024f, 0.166669995f,
+		0.916670024f, 0.25f,
+		1.0f, 0.25f,
+		1.0f, 0.166669995f,
+		0.958329976f, 0.166669995f,
+		0.958329976f, 0.25f,
+		0.0416699983f, 0.166669995f,
+		0.0416699983f, 0.083329998f,
+		0.0f, 0.083329998f,
+		0.0f, 0.166669995f,
+		0.083329998f, 0.166669995f,
+		0.083329998f, 0.083329998f,
+		0.0416699983f, 0.083329998f,
+		0.0416699983f, 0.166669995f,
+		0.125f, 0.166669995f,
+		0.125f, 0.083329998f,
+		0.083329998f, 0.083329998f,
+		0.083329998f, 0.166669995f,
+		0.166669995f, 0.166669995f,
+		0.166669995f, 0.083329998f,
+		0.125f, 0.083329998f,
+		0.125f, 0.166669995f,
+		0.208330005f, 0.166669995f,
+		0.208330005f, 0.083329998f,
+		0.166669995f, 0.083329998f,
+		0.166669995f, 0.166669995f,
+		0.25f, 0.166669995f,
+		0.25f, 0.083329998f,
+		0.208330005f, 0.083329998f,
+		0.208330005f, 0.166669995f,
+		0.291669995f, 0.166669995f,
+		0.291669995f, 0.083329998f,
+		0.25f, 0.083329998f,
+		0.25f, 0.166669995f,
+		0.333330005f, 0.166669995f,
+		0.333330005f, 0.083329998f,
+		0.291669995f, 0.083329998f,
+		0.291669995f, 0.166669995f,
+		0.375f, 0.166669995f,
+		0.375f, 0.083329998f,
+		0.333330005f, 0.083329998f,
+		0.333330005f, 0.166669995f,
+		0.416669995f, 0.166669995f,
+		0.416669995f, 0.083329998f,
+		0.375f, 0.083329998f,
+		0.375f, 0.166669995f,
+		0.458330005f, 0.166669995f,
+		0.458330005f, 0.083329998f,
+		0.416669995f, 0.083329998f,
+		0.416669995f, 0.166669995f,
+		0.5f, 0.166669995f,
+		0.5f, 0.083329998f,
+		0.458330005f, 0.083329998f,
+		0.458330005f, 0.166669995f,
+		0.541670024f, 0.166669995f,
+		0.541670024f, 0.083329998f,
+		0.5f, 0.083329998f,
+		0.5f, 0.166669995f,
+		0.583329976f, 0.166669995f,
+		0.583329976f, 0.083329998f,
+		0.541670024f, 0.083329998f,
+		0.541670024f, 0.166669995f,
+		0.625f, 0.166669995f,
+		0.625f, 0.083329998f,
+		0.583329976f, 0.083329998f,
+		0.583329976f, 0.166669995f,
+		0.666670024f, 0.166669995f,
+		0.666670024f, 0.083329998f,
+		0.625f, 0.083329998f,
+		0.625f, 0.166669995f,
+		0.708329976f, 0.166669995f,
+		0.708329976f, 0.083329998f,
+		0.666670024f, 0.083329998f,
+		0.666670024f, 0.166669995f,
+		0.75f, 0.166669995f,
+		0.75f, 0.083329998f,
+		0.708329976f, 0.083329998f,
+		0.708329976f, 0.166669995f,
+		0.791670024f, 0.166669995f,
+		0.791670024f, 0.083329998f,
+		0.75f, 0.083329998f,
+		0.75f, 0.166669995f,
+		0.833329976f, 0.166669995f,
+		0.833329976f, 0.083329998f,
+		0.791670024f, 0.083329998f,
+		0.791670024f, 0.166669995f,
+		0.875f, 0.166669995f,
+		0.875f, 0.083329998f,
+		0.833329976f, 0.083329998f,
+		0.833329976f, 0.166669995f,
+		0.916670024f, 0.166669995f,
+		0.916670024f, 0.083329998f,
+		0.875f, 0.083329998f,
+		0.875f, 0.166669995f,
+		0.958329976f, 0.166669995f,
+		0.958329976f, 0.083329998f,
+		0.916670024f, 0.083329998f,
+		0.916670024f, 0.166669995f,
+		1.0f, 0.166669995f,
+		1.0f, 0.083329998f,
+		0.958329976f, 0.083329998f,
+		0.958329976f, 0.166669995f,
+		0.0416699983f, 0.916670024f,
+		0.0f, 0.916670024f,
+		0.0f, 1.0f,
+		0.0f, 0.0f,
+		0.0f, 0.083329998f,
+		0.0416699983f, 0.083329998f,
+		0.083329998f, 0.916670024f,
+		0.0416699983f, 0.916670024f,
+		0.0416699983f, 1.0f,
+		0.0416699983f, 0.0f,
+		0.0416699983f, 0.083329998f,
+		0.083329998f, 0.083329998f,
+		0.125f, 0.916670024f,
+		0.083329998f, 0.916670024f,
+		0.083329998f, 1.0f,
+		0.083329998f, 0.0f,
+		0.083329998f, 0.083329998f,
+		0.125f, 0.083329998f,
+		0.166669995f, 0.916670024f,
+		0.125f, 0.916670024f,
+		0.125f, 1.0f,
+		0.125f, 0.0f,
+		0.125f, 0.083329998f,
+		0.166669995f, 0.083329998f,
+		0.208330005f, 0.916670024f,
+		0.166669995f, 0.916670024f,
+		0.166669995f, 1.0f,
+		0.166669995f, 0.0f,
+		0.166669995f, 0.083329998f,
+		0.208330005f, 0.083329998f,
+		0.25f, 0.916670024f,
+		0.208330005f, 0.916670024f,
+		0.208330005f, 1.0f,
+		0.208330005f, 0.0f,
+		0.208330005f, 0.083329998f,
+		0.25f, 0.083329998f,
+		0.291669995f, 0.916670024f,
+		0.25f, 0.916670024f,
+		0.25f, 1.0f,
+		0.25f, 0.0f,
+		0.25f, 0.083329998f,
+		0.291669995f, 0.083329998f,
+		0.333330005f, 0.916670024f,
+		0.291669995f, 0.916670024f,
+		0.291669995f, 1.0f,
+		0.291669995f, 0.0f,
+		0.291669995f, 0.083329998f,
+		0.333330005f, 0.083329998f,
+		0.375f, 0.916670024f,
+		0.333330005f, 0.916670024f,
+		0.333330005f, 1.0f,
+		0.333330005f, 0.0f,
+		0.333330005f, 0.083329998f,
+		0.375f, 0.083329998f,
+		0.416669995f, 0.916670024f,
+		0.375f, 0.916670024f,
+		0.375f, 1.0f,
+		0.375f, 0.0f,
+		0.375f, 0.083329998f,
+		0.416669995f, 0.083329998f,
+		0.458330005f, 0.916670024f,
+		0.416669995f, 0.916670024f,
+		0.416669995f, 1.0f,
+		0.416669995f, 0.0f,
+		0.416669995f, 0.083329998f,
+		0.458330005f, 0.083329998f,
+		0.5f, 0.916670024f,
+		0.458330005f, 0.916670024f,
+		0.458330005f, 1.0f,
+		0.458330005f, 0.0f,
+		0.458330005f, 0.083329998f,
+		0.5f, 0.083329998f,
+		0.541670024f, 0.916670024f,
+		0.5f, 0.916670024f,
+		0.5f, 1.0f,
+		0.5f, 0.0f,
+		0.5f, 0.083329998f,
+		0.541670024f, 0.083329998f,
+		0.583329976f, 0.916670024f,
+		0.541670024f, 0.916670024f,
+		0.541670024f, 1.0f,
+		0.541670024f, 0.0f,
+		0.541670024f, 0.083329998f,
+		0.583329976f, 0.083329998f,
+		0.625f, 0.916670024f,
+		0.583329976f, 0.916670024f,
+		0.583329976f, 1.0f,
+		0.583329976f, 0.0f,
+		0.583329976f, 0.083329998f,
+		0.625f, 0.083329998f,
+		0.666670024f, 0.916670024f,
+		0.625f, 0.916670024f,
+		0.625f, 1.0f,
+		0.625f, 0.0f,
+		0.625f, 0.083329998f,
+		0.666670024f, 0.083329998f,
+		0.708329976f, 0.916670024f,
+		0.666670024f, 0.916670024f,
+		0.666670024f, 1.0f,
+		0.666670024f, 0.0f,
+		0.666670024f, 0.083329998f,
+		0.708329976f, 0.083329998f,
+		0.75f, 0.916670024f,
+		0.708329976f, 0.916670024f,
+		0.708329976f, 1.0f,
+		0.708329976f, 0.0f,
+		0.708329976f, 0.083329998f,
+		0.75f, 0.083329998f,
+		0.791670024f, 0.916670024f,
+		0.75f, 0.916670024f,
+		0.75f, 1.0f,
+		0.75f, 0.0f,
+		0.75f, 0.083329998f,
+		0.791670024f, 0.083329998f,
+		0.833329976f, 0.916670024f,
+		0.791670024f, 0.916670024f,
+		0.791670024f, 1.0f,
+		0.791670024f, 0.0f,
+		0.791670024f, 0.083329998f,
+		0.833329976f, 0.083329998f,
+		0.875f, 0.916670024f,
+		0.833329976f, 0.916670024f,
+		0.833329976f, 1.0f,
+		0.833329976f, 0.0f,
+		0.833329976f, 0.083329998f,
+		0.875f, 0.083329998f,
+		0.916670024f, 0.916670024f,
+		0.875f, 0.916670024f,
+		0.875f, 1.0f,
+		0.875f, 0.0f,
+		0.875f, 0.083329998f,
+		0.916670024f, 0.083329998f,
+		0.958329976f, 0.916670024f,
+		0.916670024f, 0.916670024f,
+		0.916670024f, 1.0f,
+		0.916670024f, 0.0f,
+		0.916670024f, 0.083329998f,
+		0.958329976f, 0.083329998f,
+		1.0f, 0.916670024f,
+		0.958329976f, 0.916670024f,
+		0.958329976f, 1.0f,
+		0.958329976f, 0.0f,
+		0.958329976f, 0.083329998f,
+		1.0f, 0.083329998f
+	};
+
+	constexpr uint32_t Indices[] = {
+		0, 1, 2,
+		3, 0, 2,
+		4, 5, 6,
+		7, 4, 6,
+		8, 9, 10,
+		11, 8, 10,
+		12, 13, 14,
+		15, 12, 14,
+		16, 17, 18,
+		19, 16, 18,
+		20, 21, 22,
+		23, 20, 22,
+		24, 25, 26,
+		27, 24, 26,
+		28, 29, 30,
+		31, 28, 30,
+		32, 33, 34,
+		35, 32, 34,
+		36, 37, 38,
+		39, 36, 38,
+		40, 41, 42,
+		43, 40, 42,
+		44, 45, 46,
+		47, 44, 46,
+		48, 49, 50,
+		51, 48, 50,
+		52, 53, 54,
+		55, 52, 54,
+		56, 57, 58,
+		59, 56, 58,
+		60, 61, 62,
+		63, 60, 62,
+		64, 65, 66,
+		67, 64, 66,
+		68, 69, 70,
+		71, 68, 70,
+		72, 73, 74,
+		75, 72, 74,
+		76, 77, 78,
+		79, 76, 78,
+		80, 81, 82,
+		83, 80, 82,
+		84, 85, 86,
+		87, 84, 86,
+		88, 89, 90,
+		91, 88, 90,
+		92, 93, 94,
+		95, 92, 94,
+		96, 97, 98,
+		99, 96, 98,
+		100, 101, 102,
+		103, 100, 102,
+		104, 105, 106,
+		107, 104, 106,
+		108, 109, 110,
+		111, 108, 110,
+		112, 113, 114,
+		115, 112, 114,
+		116, 117, 118,
+		119, 116, 118,
+		120, 121, 122,
+		123, 120, 122,
+		124, 125, 126,
+		127, 124, 126,
+		128, 129, 130,
+		131, 128, 130,
+		132, 133, 134,
+		135, 132, 134,
+		136, 137, 138,
+		139, 136, 138,
+		140, 141, 142,
+		143, 140, 142,
+		144, 145, 146,
+		147, 144, 146,
+		148, 149, 150,
+		151, 148, 150,
+		152, 153, 154,
+		155, 152, 154,
+		156, 157, 158,
+		159, 156, 158,
+		160, 161, 162,
+		163, 160, 162,
+		164, 165, 166,
+		167, 164, 166,
+		168, 169, 170,
+		171, 168, 170,
+		172, 173, 174,
+		175, 172, 174,
+		176, 177, 178,
+		179, 176, 178,
+		180, 181, 182,
+		183, 180, 182,
+		184, 185, 186,
+		187, 184, 186,
+		188, 189, 190,
+		191, 188, 190,
+		192, 193, 194,
+		195, 192, 194,
+		196, 197, 198,
+		199, 196, 198,
+		200, 201, 202,
+		203, 200, 202,
+		204, 205, 206,
+		207, 204, 206,
+		208, 209, 210,
+		211, 208, 210,
+		212, 213, 214,
+		215, 212, 214,
+		216, 217, 218,
+		219, 216, 218,
+		220, 221, 222,
+		223, 220, 222,
+		224, 225, 226,
+		227, 224, 226,
+		228, 229, 230,
+		231, 228, 230,
+		232, 233, 234,
+		235, 232, 234,
+		236, 237, 238,
+		239, 236, 238,
+		240, 241, 242,
+		243, 240, 242,
+		244, 245, 246,
+		247, 244, 246,
+		248, 249, 250,
+		251, 248, 250,
+		252, 253, 254,
+		255, 252, 254,
+		256, 257, 258,
+		259, 256, 258,
+		260, 261, 262,
+		263, 260, 262,
+		264, 265, 266,
+		267, 264, 266,
+		268, 269, 270,
+		271, 268, 270,
+		272, 273, 274,
+		275, 272, 274,
+		276, 277, 278,
+		279, 276, 278,
+		280, 281, 282,
+		283, 280, 282,
+		284, 285, 286,
+		287, 284, 286,
+		288, 289, 290,
+		291, 288, 290,
+		292, 293, 294,
+		295, 292, 294,
+		296, 297, 298,
+		299, 296, 298,
+		300, 301, 302,
+		303, 300, 302,
+		304, 305, 306,
+		307, 304, 306,
+		308, 309, 310,
+		311, 308, 310,
+		312, 313, 314,
+		315, 312, 314,
+		316, 317, 318,
+		319, 316, 318,
+		320, 321, 322,
+		323, 320, 322,
+		324, 325, 326,
+		327, 324, 326,
+		328, 329, 330,
+		331, 328, 330,
+		332, 333, 334,
+		335, 332, 334,
+		336, 337, 338,
+		339, 336, 338,
+		340, 341, 342,
+		343, 340, 342,
+		344, 345, 346,
+		347, 344, 346,
+		348, 349, 350,
+		351, 348, 350,
+		352, 353, 354,
+		355, 352, 354,
+		356, 357, 358,
+		359, 356, 358,
+		360, 361, 362,
+		363, 360, 362,
+		364, 365, 366,
+		367, 364, 366,
+		368, 369, 370,
+		371, 368, 370,
+		372, 373, 374,
+		375, 372, 374,
+		376, 377, 378,
+		379, 376, 378,
+		380, 381, 382,
+		383, 380, 382,
+		384, 385, 386,
+		387, 384, 386,
+		388, 389, 390,
+		391, 388, 390,
+		392, 393, 394,
+		395, 392, 394,
+		396, 397, 398,
+		399, 396, 398,
+		400, 401, 402,
+		403, 400, 402,
+		404, 405, 406,
+		407, 404, 406,
+		408, 409, 410,
+		411, 408, 410,
+		412, 413, 414,
+		415, 412, 414,
+		416, 417, 418,
+		419, 416, 418,
+		420, 421, 422,
+		423, 420, 422,
+		424, 425, 426,
+		427, 424, 426,
+		428, 429, 430,
+		431, 428, 430,
+		432, 433, 434,
+		435, 432, 434,
+		436, 437, 438,
+		439, 436, 438,
+		440, 441, 442,
+		443, 440, 442,
+		444, 445, 446,
+		447, 444, 446,
+		448, 449, 450,
+		451, 448, 450,
+		452, 453, 454,
+		455, 452, 454,
+		456, 457, 458,
+		459, 456, 458,
+		460, 461, 462,
+		463, 460, 462,
+		464, 465, 466,
+		467, 464, 466,
+		468, 469, 470,
+		471, 468, 470,
+		472, 473, 474,
+		475, 472, 474,
+		476, 477, 478,
+		479, 476, 478,
+		480, 481, 482,
+		483, 480, 482,
+		484, 485, 486,
+		487, 484, 486,
+		488, 489, 490,
+		491, 488, 490,
+		492, 493, 494,
+		495, 492, 494,
+		496, 497, 498,
+		499, 496, 498,
+		500, 501, 502,
+		503, 500, 502,
+		504, 505, 506,
+		507, 504, 506,
+		508, 509, 510,
+		511, 508, 510,
+		512, 513, 514,
+		515, 512, 514,
+		516, 517, 518,
+		519, 516, 518,
+		520, 521, 522,
+		523, 520, 522,
+		524, 525, 526,
+		527, 524, 526,
+		528, 529, 530,
+		531, 528, 530,
+		532, 533, 534,
+		535, 532, 534,
+		536, 537, 538,
+		539, 536, 538,
+		540, 541, 542,
+		543, 540, 542,
+		544, 545, 546,
+		547, 544, 546,
+		548, 549, 550,
+		551, 548, 550,
+		552, 553, 554,
+		555, 552, 554,
+		556, 557, 558,
+		559, 556, 558,
+		560, 561, 562,
+		563, 560, 562,
+		564, 565, 566,
+		567, 564, 566,
+		568, 569, 570,
+		571, 568, 570,
+		572, 573, 574,
+		575, 572, 574,
+		576, 577, 578,
+		579, 576, 578,
+		580, 581, 582,
+		583, 580, 582,
+		584, 585, 586,
+		587, 584, 586,
+		588, 589, 590,
+		591, 588, 590,
+		592, 593, 594,
+		595, 592, 594,
+		596, 597, 598,
+		599, 596, 598,
+		600, 601, 602,
+		603, 600, 602,
+		604, 605, 606,
+		607, 604, 606,
+		608, 609, 610,
+		611, 608, 610,
+		612, 613, 614,
+		615, 612, 614,
+		616, 617, 618,
+		619, 616, 618,
+		620, 621, 622,
+		623, 620, 622,
+		624, 625, 626,
+		627, 624, 626,
+		628, 629, 630,
+		631, 628, 630,
+		632, 633, 634,
+		635, 632, 634,
+		636, 637, 638,
+		639, 636, 638,
+		640, 641, 642,
+		643, 640, 642,
+		644, 645, 646,
+		647, 644, 646,
+		648, 649, 650,
+		651, 648, 650,
+		652, 653, 654,
+		655, 652, 654,
+		656, 657, 658,
+		659, 656, 658,
+		660, 661, 662,
+		663, 660, 662,
+		664, 665, 666,
+		667, 664, 666,
+		668, 669, 670,
+		671, 668, 670,
+		672, 673, 674,
+		675, 672, 674,
+		676, 677, 678,
+		679, 676, 678,
+		680, 681, 682,
+		683, 680, 682,
+		684, 685, 686,
+		687, 684, 686,
+		688, 689, 690,
+		691, 688, 690,
+		692, 693, 694,
+		695, 692, 694,
+		696, 697, 698,
+		699, 696, 698,
+		700, 701, 702,
+		703, 700, 702,
+		704, 705, 706,
+		707, 704, 706,
+		708, 709, 710,
+		711, 708, 710,
+		712, 713, 714,
+		715, 712, 714,
+		716, 717, 718,
+		719, 716, 718,
+		720, 721, 722,
+		723, 720, 722,
+		724, 725, 726,
+		727, 724, 726,
+		728, 729, 730,
+		731, 728, 730,
+		732, 733, 734,
+		735, 732, 734,
+		736, 737, 738,
+		739, 736, 738,
+		740, 741, 742,
+		743, 740, 742,
+		744, 745, 746,
+		747, 744, 746,
+		748, 749, 750,
+		751, 748, 750,
+		752, 753, 754,
+		755, 752, 754,
+		756, 757, 758,
+		759, 756, 758,
+		760, 761, 762,
+		763, 760, 762,
+		764, 765, 766,
+		767, 764, 766,
+		768, 769, 770,
+		771, 768, 770,
+		772, 773, 774,
+		775, 772, 774,
+		776, 777, 778,
+		779, 776, 778,
+		780, 781, 782,
+		783, 780, 782,
+		784, 785, 786,
+		787, 784, 786,
+		788, 789, 790,
+		791, 788, 790,
+		792, 793, 794,
+		795, 792, 794,
+		796, 797, 798,
+		799, 796, 798,
+		800, 801, 802,
+		803, 800, 802,
+		804, 805, 806,
+		807, 804, 806,
+		808, 809, 810,
+		811, 808, 810,
+		812, 813, 814,
+		815, 812, 814,
+		816, 817, 818,
+		819, 816, 818,
+		820, 821, 822,
+		823, 820, 822,
+		824, 825, 826,
+		827, 824, 826,
+		828, 829, 830,
+		831, 828, 830,
+		832, 833, 834,
+		835, 832, 834,
+		836, 837, 838,
+		839, 836, 838,
+		840, 841, 842,
+		843, 840, 842,
+		844, 845, 846,
+		847, 844, 846,
+		848, 849, 850,
+		851, 848, 850,
+		852, 853, 854,
+		855, 852, 854,
+		856, 857, 858,
+		859, 856, 858,
+		860, 861, 862,
+		863, 860, 862,
+		864, 865, 866,
+		867, 864, 866,
+		868, 869, 870,
+		871, 868, 870,
+		872, 873, 874,
+		875, 872, 874,
+		876, 877, 878,
+		879, 876, 878,
+		880, 881, 882,
+		883, 880, 882,
+		884, 885, 886,
+		887, 884, 886,
+		888, 889, 890,
+		891, 888, 890,
+		892, 893, 894,
+		895, 892, 894,
+		896, 897, 898,
+		899, 896, 898,
+		900, 901, 902,
+		903, 900, 902,
+		904, 905, 906,
+		907, 904, 906,
+		908, 909, 910,
+		911, 908, 910,
+		912, 913, 914,
+		915, 912, 914,
+		916, 917, 918,
+		919, 916, 918,
+		920, 921, 922,
+		923, 920, 922,
+		924, 925, 926,
+		927, 924, 926,
+		928, 929, 930,
+		931, 928, 930,
+		932, 933, 934,
+		935, 932, 934,
+		936, 937, 938,
+		939, 936, 938,
+		940, 941, 942,
+		943, 940, 942,
+		944, 945, 946,
+		947, 944, 946,
+		948, 949, 950,
+		951, 948, 950,
+		952, 953, 954,
+		955, 952, 954,
+		956, 957, 958,
+		959, 956, 958,
+		960, 961, 962,
+		963, 964, 965,
+		966, 967, 968,
+		969, 970, 971,
+		972, 973, 974,
+		975, 976, 977,
+		978, 979, 980,
+		981, 982, 983,
+		984, 985, 986,
+		987, 988, 989,
+		990, 991, 992,
+		993, 994, 995,
+		996, 997, 998,
+		999, 1000, 1001,
+		1002, 1003, 1004,
+		1005, 1006, 1007,
+		1008, 1009, 1010,
+		1011, 1012, 1013,
+		1014, 1015, 1016,
+		1017, 1018, 1019,
+		1020, 1021, 1022,
+		1023, 1024, 1025,
+		1026, 1027, 1028,
+		1029, 1030, 1031,
+		1032, 1033, 1034,
+		1035, 1036, 1037,
+		1038, 1039, 1040,
+		1041, 1042, 1043,
+		1044, 1045, 1046,
+		1047, 1048, 1049,
+		1050, 1051, 1052,
+		1053, 1054, 1055,
+		1056, 1057, 1058,
+		1059, 1060, 1061,
+		1062, 1063, 1064,
+		1065, 1066, 1067,
+		1068, 1069, 1070,
+		1071, 1072, 1073,
+		1074, 1075, 1076,
+		1077, 1078, 1079,
+		1080, 1081, 1082,
+		1083, 1084, 1085,
+		1086, 1087, 1088,
+		1089, 1090, 1091,
+		1092, 1093, 1094,
+		1095, 1096, 1097,
+		1098, 1099, 1100,
+		1101, 1102, 1103
+	};
+
+}
+
+VR_NAMESPACE_END
@@ -21,7 +21,8 @@ public:
 	virtual void draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
 
 protected:
-	bool buffersAllocated;
+	bool buffersAllocated; ///< VAO created
+	GLuint positionLocation; ///< Position attribute location
 };
 
 VR_NAMESPACE_END
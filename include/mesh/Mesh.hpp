@@ -5,6 +5,7 @@
 #include "mesh/kdtree.hpp"
 #include "Eigen/Geometry"
 #include "GLUtil.hpp"
+#include "SceneNode.hpp"
 
 VR_NAMESPACE_BEGIN
 
@@ -17,9 +18,18 @@ VR_NAMESPACE_BEGIN
  * external file)
  */
 
-class Mesh {
+class Mesh : public SceneNode {
 
 public:
+
+	/**
+	 * @brief Simplified level of detail, a range of the shared index buffer
+	 */
+	struct LOD {
+		uint32_t offset; ///< First index
+		uint32_t count; ///< Number of triangles
+		float error; ///< Geometric error relative to the bounding sphere radius
+	};
 	
 	/// Default constructor
 	Mesh();
@@ -36,8 +46,11 @@ public:
     /// Return the total number of vertices in this hsape
     uint32_t getVertexCount() const { return (uint32_t) m_V.cols(); }
 
-    /// Return an axis-aligned bounding box of the entire mesh
-    BoundingBox3f &getBoundingBox() { return m_bbox; }
+    /// Return an axis-aligned bounding box of the entire mesh in world space
+    BoundingBox3f &getBoundingBox() {
+        getWorldMatrix();
+        return m_bbox;
+    }
 
     /// Return a pointer to the vertex positions
     const MatrixXf &getVertexPositions() const { return m_V; }
@@ -65,25 +78,82 @@ public:
     /// Return the kd-tree
     KDTree &getKDTree () { return kdtree; }
 
+    /// Return the levels of detail, level 0 is the full mesh
+    const std::vector<LOD> &getLODs() const { return m_lods; }
+
+    /// Return the level of detail last drawn for a view
+    int getLOD(int view = 0) const { return lodLevel[view]; }
+
+    /// Selects the view (0 = left eye or mono, 1 = right eye) whose level of detail the next draw calls update
+    void setLODView(int view) { lodView = view; }
+
+    /// Upload the packed vertex format with the QUANTIZED shader feature instead of float attributes
+    void setQuantized(bool q) { quantized = q; }
+
+    /// Whether the packed vertex format is drawn
+    bool isQuantized() const { return quantized; }
+
+    /// Split the mesh into meshlets at upload and cull them against the view frustum and by their normal cones
+    void setMeshletCulling(bool c) { meshletCulling = c; }
+
+    /// Return the size of the uploaded vertex and index buffers in bytes
+    size_t getGPUBytes() const { return gpuBytes; }
+
     /// Return a human-readable summary of this instance
 	std::string toString() const {
+		std::string lods;
+		for (size_t i = 1; i < m_lods.size(); i++)
+			lods += (i > 1 ? ", " : "") + std::to_string(m_lods[i].count);
+
 		return
 			"Mesh[\n"
 			"  name = \""+m_name+"\",\n"
 			"  vertexCount = "+std::to_string(m_V.cols())+",\n"
-			"  triangleCount = "+std::to_string(m_F.cols())+"\n"
+			"  triangleCount = "+std::to_string(m_F.cols())+",\n"
+			"  acmr = "+std::to_string(acmrBefore)+" -> "+std::to_string(acmrAfter)+",\n"
+			"  gpuMemory = "+std::to_string(gpuBytes / 1024)+" KB"+(quantized ? " (quantized)" : "")+",\n"
+			"  lodTriangleCounts = ["+lods+"]\n"
 			"]";
 	}
 
+	/**
+	 * @brief Reorders the triangles for the post-transform cache and against overdraw, then the vertices by first use
+	 *
+	 * The new order is loaded from MESH_CACHE_DIR if the source file did not
+	 * change. Has to be called before buildLODs and upload.
+	 */
+	void optimize();
+
+	/// Average vertex shader invocations per triangle before and after optimize
+	float getACMR(bool optimized = true) const { return optimized ? acmrAfter : acmrBefore; }
+
+	/**
+	 * @brief Builds MESH_LOD_LEVELS - 1 simplified levels, each with a quarter of the triangles of the previous one
+	 *
+	 * The levels only reference the existing vertices and are loaded from
+	 * MESH_CACHE_DIR if the source file did not change. Has to be called
+	 * once the vertices are in place and before upload.
+	 */
+	void buildLODs();
+
+	/**
+	 * @brief Picks the coarsest level whose error stays below MESH_LOD_PIXEL_ERROR pixels in the current viewport
+	 *
+	 * A level is only given up for a coarser one once its projected error
+	 * dropped below the threshold by MESH_LOD_HYSTERESIS, such that small
+	 * head movements do not make the mesh pop back and forth.
+	 */
+	int selectLOD(const Matrix4f &modelMatrix, const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
+
 	/**
 	 * @return Model Matrix
 	 */
-	virtual Matrix4f getModelMatrix();
+	const Matrix4f &getModelMatrix() { return getWorldMatrix(); }
 
 	/**
 	 * @return Transpose inverse model matrix
 	 */
-	virtual Matrix3f getNormalMatrix();
+	const Matrix3f &getNormalMatrix() { return getWorldNormalMatrix(); }
 
 	/// Upload the mesh (positions, normals, indices and uv) to the shader
 	virtual void upload(std::shared_ptr<GLShader> &s);
@@ -91,15 +161,6 @@ public:
 	/// Draw to the currently bounded shader
 	virtual void draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
 
-	/// Sets translation matrix
-	virtual void setTranslateMatrix (Matrix4f &t);
-
-	/// Sets scale matrix
-	virtual void setScaleMatrix(Matrix4f &t);
-
-	/// Sets rotation matrix
-	virtual void setRotationMatrix(Matrix4f &t);
-
 	/// Translate x, y, z
 	virtual void translate(float x, float y, float z);
 
@@ -121,6 +182,104 @@ public:
 	/// Rotation round axis of angle radians
 	virtual void rotate(float angle, Vector3f axis);
 
+protected:
+
+	/**
+	 * @brief Draw call of a range of the index buffer, relative to a base vertex
+	 */
+	struct Chunk {
+		size_t offset; ///< Offset into the index buffer in bytes
+		GLsizei count; ///< Number of indices
+		GLint baseVertex; ///< First vertex of the chunk
+	};
+
+	/**
+	 * @brief Bounds of four meshlets, one lane each
+	 */
+	struct MeshletBlock {
+		float center[3][4]; ///< Bounding sphere center in object space
+		float radius[4]; ///< Bounding sphere radius
+		float axis[3][4]; ///< Normal cone axis
+		float cutoff[4]; ///< Sine of the normal cone angle
+	};
+
+	/**
+	 * @brief Meshlets which passed the culling, as arguments of glMultiDrawElementsBaseVertex
+	 */
+	struct DrawList {
+		Matrix4f mvp; ///< Matrix the list was culled with
+		int level = -1; ///< Level the list was culled for, -1 if invalid
+		bool backfaces = false; ///< Whether the cones were tested
+		std::vector<uint8_t> visible; ///< Result per meshlet of the level
+		std::vector<GLsizei> counts;
+		std::vector<const GLvoid *> offsets;
+		std::vector<GLint> baseVertices;
+		uint32_t triangles = 0; ///< Triangles drawn
+	};
+
+	/// Moves the bounding box along with the world matrix
+	virtual void worldChanged() { m_bbox.transformAxisAligned(getWorldMatrix()); }
+
+	/// Fill vertex and index data from flat tables, texture coordinates are optional
+	void loadFromTables(uint32_t vertexCount, uint32_t triangleCount, const float *positions,
+		const float *normals, const float *texCoords, const uint32_t *indices);
+
+	/**
+	 * @brief Uploads 16 byte interleaved vertices and 16 bit indices
+	 *
+	 * Positions are 16 bit fixed point in the bounding box, normals are
+	 * octahedral encoded into two 16 bit values and texture coordinates are
+	 * half floats. Every level is split into chunks of at most 65535
+	 * vertices with their own copy of the vertices, each chunk is drawn with
+	 * glDrawElementsBaseVertex. Vertices on the chunk borders are the only
+	 * ones stored twice, which optimize keeps to a few percent.
+	 */
+	void uploadQuantized();
+
+	/// Uploads positions, normals and texture coordinates as separate float arrays and 32 bit indices
+	void uploadFloat();
+
+	/**
+	 * @brief Splits the chunks of every level into meshlets of up to 128 triangles
+	 *
+	 * Each meshlet gets a bounding sphere and a cone containing its face
+	 * normals. The bounds are stored in blocks of four, such that four
+	 * meshlets are tested at once.
+	 */
+	void buildMeshlets();
+
+	/**
+	 * @brief Draw ranges of the meshlets of a level which intersect the view frustum and face the camera
+	 *
+	 * The result is kept per view and reused as long as the level and the
+	 * matrix do not change, e.g. for the wireframe overlay.
+	 */
+	const DrawList &cullMeshlets(int level, const Matrix4f &modelView, const Matrix4f &mvp, bool backfaces);
+
+	/// Number of levels including the full mesh
+	size_t levelCount() const { return std::max<size_t>(m_lods.size(), 1); }
+
+	/// Triangles of a level
+	uint32_t levelTriangles(size_t level) const { return level == 0 ? getTriangleCount() : m_lods[level].count; }
+
+	/// First index of a level
+	const uint32_t *levelIndices(size_t level) const { return level == 0 ? m_F.data() : m_lodIndices.data() + (m_lods[level].offset - m_F.size()); }
+
+	/// Cache file with the given extension, named after the source file
+	std::string cacheFile(const std::string &extension) const;
+
+	/// Reads the optimized triangle order and vertex permutation if the cache matches the source file and the mesh
+	bool loadOptimized(long long sourceSize, long long modified, std::vector<uint32_t> &indices, std::vector<uint32_t> &order) const;
+
+	/// Writes the optimized triangle order and vertex permutation to the cache, failures are ignored
+	void storeOptimized(long long sourceSize, long long modified, const std::vector<uint32_t> &indices, const std::vector<uint32_t> &order) const;
+
+	/// Reads the levels of detail if the cache matches the source file and the mesh
+	bool loadLODs(long long sourceSize, long long modified);
+
+	/// Writes the levels of detail to the cache, failures are ignored
+	void storeLODs(long long sourceSize, long long modified) const;
+
 protected:
     std::string m_name;                  ///< Identifying name
     MatrixXf      m_V;                   ///< Vertex positions
@@ -128,11 +287,8 @@ protected:
     MatrixXf      m_UV;                  ///< Vertex texture coordinates
     MatrixXu      m_F;                   ///< Faces
     BoundingBox3f m_bbox;                ///< Bounding box of the mesh
-	Matrix4f transMat;
-	Matrix4f scaleMat;
-	Matrix4f rotateMat;
-	Matrix4f mmCache;
-	bool mmChanged;
+    std::vector<LOD> m_lods;             ///< Levels of detail, finest first
+    std::vector<uint32_t> m_lodIndices;  ///< Triangles of all simplified levels, uploaded after m_F
 
 	enum BUFFERS {
 		VERTEX_BUFFER,  //!< VERTEX_BUFFER
@@ -147,6 +303,25 @@ protected:
 	std::string glTexName;
 	std::shared_ptr<GLShader> shader;
 	KDTree kdtree;
+	Vector3f lodCenter; ///< Bounding sphere center in object space
+	float lodRadius; ///< Bounding sphere radius in object space
+	int lodView; ///< View the next draw call selects the level for
+	int lodLevel[2]; ///< Current level of each view
+	float acmrBefore; ///< ACMR of the loaded index order
+	float acmrAfter; ///< ACMR after optimize
+
+	bool quantized; ///< Packed vertex format
+	std::vector<Chunk> chunks; ///< Chunks of all levels
+	std::vector<uint32_t> lodChunks; ///< First chunk of each level, followed by the total number of chunks
+	Vector3f quantizationScale; ///< Size of one position step
+	Vector3f quantizationOffset; ///< Position of the zero step
+	size_t gpuBytes; ///< Size of all buffers
+
+	bool meshletCulling; ///< Draw meshlets which survive the culling instead of whole chunks
+	std::vector<Chunk> meshlets; ///< Meshlets of all levels, within the chunks
+	std::vector<uint32_t> lodMeshlets; ///< First meshlet of each level, followed by the total number of meshlets
+	std::vector<MeshletBlock> meshletBounds; ///< Bounds, meshlet i is in lane i % 4 of block i / 4
+	DrawList drawLists[2]; ///< Last culling result of each view
 };
 
 VR_NAMESPACE_END
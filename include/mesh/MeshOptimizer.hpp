@@ -0,0 +1,51 @@
+#pragma once
+
+#include "common.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Reorders triangle lists and vertices for the GPU caches
+ *
+ * Triangles are sorted along a Morton curve and cut into chunks, each
+ * chunk is reordered on its own thread for the post-transform vertex cache
+ * [Forsyth 2006]. The chunks are then split into clusters which are sorted
+ * such that outward facing parts are drawn first [Sander et al. 2007], the
+ * clusters of a chunk stay together and the chunks are sorted as well. At
+ * last the vertices are renumbered in the order of their first use, which
+ * makes the vertex fetches mostly sequential.
+ */
+class MeshOptimizer {
+public:
+
+	/// Size of the simulated post-transform cache
+	static const int CacheSize = 16;
+
+	/**
+	 * @brief Average number of vertex shader invocations per triangle with a FIFO cache of CacheSize entries
+	 */
+	static float acmr(const std::vector<uint32_t> &indices, size_t vertexCount);
+
+	/**
+	 * @brief Reorders the triangles for the vertex cache and against overdraw, the vertices are not changed
+	 *
+	 * @param positions Vertex positions, 3 x n
+	 * @param indices Triangle list into positions
+	 * @param overdraw Whether to sort the clusters by their facing, otherwise they stay in Morton order
+	 */
+	static void optimizeTriangles(const MatrixXf &positions, std::vector<uint32_t> &indices, bool overdraw = true);
+
+	/**
+	 * @brief Renumbers the vertices in the order of their first use, unused vertices are moved to the end
+	 *
+	 * @return Old index of each new vertex
+	 */
+	static std::vector<uint32_t> optimizeVertexFetch(std::vector<uint32_t> &indices, size_t vertexCount);
+
+protected:
+
+	/// Forsyth's greedy reordering of one chunk in place
+	static void optimizeVertexCache(std::vector<uint32_t> &indices);
+};
+
+VR_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "common.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Quadric error metric simplification [Garland and Heckbert 1997] by half-edge collapses
+ *
+ * Vertices are only ever moved onto one of their neighbours, such that
+ * every simplified level indexes the vertex buffer of the full mesh. Large
+ * meshes are cut into slabs along their longest axis which are simplified
+ * in parallel, vertices shared by two slabs stay in place.
+ */
+class MeshSimplifier {
+public:
+
+	/**
+	 * @brief Simplifies a triangle list to about targetCount triangles
+	 *
+	 * @param positions Vertex positions, 3 x n
+	 * @param indices Triangle list into positions
+	 * @param targetCount Number of triangles to stop at
+	 * @param pass Shifts the slab boundaries on odd passes, such that chained passes do not keep the same vertices locked
+	 * @param error Largest RMS distance of a collapsed vertex to the planes of its faces
+	 * @return Triangle list of the remaining triangles
+	 */
+	static std::vector<uint32_t> simplify(const MatrixXf &positions, const std::vector<uint32_t> &indices,
+		size_t targetCount, int pass, float &error);
+
+protected:
+
+	/// Simplifies one slab in place, vertices with a locked flag are not moved, returns the error
+	static float simplifySlab(const MatrixXf &positions, const std::vector<uint8_t> &locked,
+		std::vector<uint32_t> &indices, size_t targetCount);
+};
+
+VR_NAMESPACE_END
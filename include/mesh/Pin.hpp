@@ -1,7 +1,7 @@
 #pragma once
 
 #include "common.hpp"
-#include "mesh/WavefrontObj.hpp"
+#include "mesh/Mesh.hpp"
 
 VR_NAMESPACE_BEGIN
 
@@ -10,7 +10,7 @@ VR_NAMESPACE_BEGIN
  *
  * Object to annotate meshes.
  */
-class Pin : public WavefrontOBJ {
+class Pin : public Mesh {
 public:
 	
 	/**
@@ -40,15 +40,10 @@ public:
 	void setColor(const Vector3f &c);
 
 	/**
-	* @brief Overloaded draw
+	* @brief Overloaded draw, the caller sets the pin color as material color
 	*/
 	virtual void draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
 
-	/**
-	* @brief Overloaded model matrix
-	*/
-	virtual Matrix4f getModelMatrix();
-
 	/**
 	* @brief Serialize pin state
 	*/
@@ -70,6 +65,11 @@ public:
 
 protected:
 
+	/**
+	* @brief Position on the parent mesh, pin scale and rotation
+	*/
+	virtual Matrix4f getLocalMatrix() const;
+
 	/**
 	* @brief Calculate local pin rotation
 	*/
@@ -0,0 +1,1721 @@
+#pragma once
+
+#include "common.hpp"
+
+/**
+ * Geometry of the annotation pin as compile-time tables.
+ *
+ * Vertices are unique (position, uv, normal) tuples, indices form triangles. The
+ * bounding box spans all positions of the original model.
+ */
+
+VR_NAMESPACE_BEGIN
+
+namespace PinData {
+
+	constexpr uint32_t VertexCount = 514;
+	constexpr uint32_t TriangleCount = 660;
+
+	constexpr float BBoxMin[] = { -3.03999996f, -0.5f, -3.03999996f };
+	constexpr float BBoxMax[] = { 3.03999996f, 20.0002995f, 3.03999996f };
+
+	constexpr float Positions[] = {
+		0.103307001f, -0.5f, 0.28383401f,
+		0.0f, -0.5f, 0.0f,
+		0.151024997f, -0.5f, 0.261583f,
+		0.302049011f, -0.5f, 0.0f,
+		0.297461003f, -0.5f, 0.0524502993f,
+		0.302049011f, 10.4098997f, 0.0f,
+		0.0f, 10.4098997f, 0.0f,
+		0.297461003f, 10.4098997f, 0.0524502993f,
+		-0.28383401f, -0.5f, 0.103307001f,
+		-0.261583f, -0.5f, 0.151024997f,
+		0.28383401f, -0.5f, 0.103307001f,
+		0.28383401f, 10.4098997f, 0.103307001f,
+		-0.28383401f, -0.5f, -0.103307001f,
+		-0.297461003f, -0.5f, -0.0524502993f,
+		0.261583f, -0.5f, 0.151024997f,
+		0.261583f, 10.4098997f, 0.151024997f,
+		-0.261583f, -0.5f, -0.151024997f,
+		0.261583f, 1.73116004f, 0.151024997f,
+		0.261583f, 10.4098997f, 0.151024997f,
+		0.231382996f, 10.4098997f, 0.194153994f,
+		0.231382996f, 1.73116004f, 0.194153994f,
+		0.231382996f, 10.4098997f, 0.194153994f,
+		0.0524502993f, -0.5f, -0.297461003f,
+		-5.54856013e-17f, -0.5f, -0.302049011f,
+		0.231382996f, -0.5f, 0.194153994f,
+		0.194153994f, -0.5f, 0.231382996f,
+		0.194153994f, 10.4098997f, 0.231382996f,
+		0.103307001f, -0.5f, -0.28383401f,
+		0.194153994f, 1.73116004f, 0.231382996f,
+		0.194153994f, 10.4098997f, 0.231382996f,
+		0.151024997f, 10.4098997f, 0.261583f,
+		0.151024997f, 1.73116004f, 0.261583f,
+		0.151024997f, 10.4098997f, 0.261583f,
+		0.194153994f, -0.5f, -0.231382996f,
+		0.151024997f, -0.5f, -0.261583f,
+		0.151024997f, -0.5f, 0.261583f,
+		0.103307001f, 1.73116004f, 0.28383401f,
+		0.103307001f, -0.5f, 0.28383401f,
+		0.103307001f, 10.4098997f, 0.28383401f,
+		0.261583f, -0.5f, -0.151024997f,
+		0.231382996f, -0.5f, -0.194153994f,
+		0.0524502993f, -0.5f, 0.297461003f,
+		0.0524502993f, 10.4098997f, 0.297461003f,
+		-0.103307001f, -0.5f, 0.28383401f,
+		-0.0524502993f, -0.5f, 0.297461003f,
+		0.0524502993f, 1.73116004f, 0.297461003f,
+		0.0524502993f, 10.4098997f, 0.297461003f,
+		1.84951993e-17f, 10.4098997f, 0.302049011f,
+		1.84951993e-17f, 1.73116004f, 0.302049011f,
+		1.84951993e-17f, 10.4098997f, 0.302049011f,
+		-0.194153994f, -0.5f, 0.231382996f,
+		-0.151024997f, -0.5f, 0.261583f,
+		1.84951993e-17f, -0.5f, 0.302049011f,
+		-0.0524502993f, 10.4098997f, 0.297461003f,
+		-0.302049011f, -0.5f, 4.44088985e-17f,
+		-0.0524502993f, 1.73116004f, 0.297461003f,
+		-0.0524502993f, 10.4098997f, 0.297461003f,
+		-0.103307001f, 10.4098997f, 0.28383401f,
+		-0.103307001f, 1.73116004f, 0.28383401f,
+		-0.103307001f, 10.4098997f, 0.28383401f,
+		-0.231382996f, -0.5f, -0.194153994f,
+		-0.151024997f, 10.4098997f, 0.261583f,
+		-0.151024997f, -0.5f, -0.261583f,
+		-0.194153994f, -0.5f, -0.231382996f,
+		-0.151024997f, 1.73116004f, 0.261583f,
+		-0.151024997f, 10.4098997f, 0.261583f,
+		-0.194153994f, 10.4098997f, 0.231382996f,
+		-0.194153994f, 1.73116004f, 0.231382996f,
+		-0.194153994f, 10.4098997f, 0.231382996f,
+		-0.231382996f, -0.5f, 0.194153994f,
+		-0.231382996f, 10.4098997f, 0.194153994f,
+		-0.261583f, 10.4098997f, 0.151024997f,
+		0.297461003f, -0.5f, -0.0524502993f,
+		0.28383401f, -0.5f, -0.103307001f,
+		-0.261583f, -0.5f, 0.151024997f,
+		-0.261583f, 1.73116004f, 0.151024997f,
+		-0.28383401f, 1.73116004f, 0.103307001f,
+		-0.28383401f, -0.5f, 0.103307001f,
+		-0.28383401f, 10.4098997f, 0.103307001f,
+		-0.28383401f, 10.4098997f, 0.103307001f,
+		-0.297461003f, 10.4098997f, 0.0524502993f,
+		-0.297461003f, 1.73116004f, 0.0524502993f,
+		-0.297461003f, 10.4098997f, 0.0524502993f,
+		0.302049011f, -0.5f, 0.0f,
+		0.302049011f, 1.73116004f, 0.0f,
+		0.297461003f, 1.73116004f, 0.0524502993f,
+		0.297461003f, -0.5f, 0.0524502993f,
+		-0.297461003f, -0.5f, 0.0524502993f,
+		-0.302049011f, 10.4098997f, 4.44088985e-17f,
+		0.28383401f, 1.73116004f, 0.103307001f,
+		0.28383401f, -0.5f, 0.103307001f,
+		-0.302049011f, 1.73116004f, 4.44088985e-17f,
+		-0.302049011f, 10.4098997f, 4.44088985e-17f,
+		-0.297461003f, 10.4098997f, -0.0524502993f,
+		-0.297461003f, 1.73116004f, -0.0524502993f,
+		-0.297461003f, 10.4098997f, -0.0524502993f,
+		0.261583f, -0.5f, 0.151024997f,
+		-0.297461003f, -0.5f, -0.0524502993f,
+		-0.28383401f, 1.73116004f, -0.103307001f,
+		-0.28383401f, -0.5f, -0.103307001f,
+		-0.28383401f, 10.4098997f, -0.103307001f,
+		0.231382996f, -0.5f, 0.194153994f,
+		0.194153994f, -0.5f, 0.231382996f,
+		-0.261583f, 1.73116004f, -0.151024997f,
+		-0.261583f, -0.5f, -0.151024997f,
+		-0.261583f, 10.4098997f, -0.151024997f,
+		0.0524502993f, -0.5f, 0.297461003f,
+		-0.261583f, 10.4098997f, -0.151024997f,
+		-0.231382996f, 10.4098997f, -0.194153994f,
+		-0.231382996f, 1.73116004f, -0.194153994f,
+		-0.231382996f, 10.4098997f, -0.194153994f,
+		1.84951993e-17f, -0.5f, 0.302049011f,
+		-0.0524502993f, -0.5f, 0.297461003f,
+		-0.194153994f, 10.4098997f, -0.231382996f,
+		-0.103307001f, -0.5f, 0.28383401f,
+		-0.151024997f, -0.5f, 0.261583f,
+		-0.194153994f, 1.73116004f, -0.231382996f,
+		-0.194153994f, 10.4098997f, -0.231382996f,
+		-0.151024997f, 10.4098997f, -0.261583f,
+		-0.151024997f, 1.73116004f, -0.261583f,
+		-0.151024997f, 10.4098997f, -0.261583f,
+		-0.194153994f, -0.5f, 0.231382996f,
+		-0.231382996f, 1.73116004f, 0.194153994f,
+		-0.231382996f, -0.5f, 0.194153994f,
+		-0.103307001f, -0.5f, -0.28383401f,
+		-0.103307001f, 10.4098997f, -0.28383401f,
+		-0.103307001f, 1.73116004f, -0.28383401f,
+		-0.103307001f, 10.4098997f, -0.28383401f,
+		-0.0524502993f, 10.4098997f, -0.297461003f,
+		-0.0524502993f, 1.73116004f, -0.297461003f,
+		-0.0524502993f, 10.4098997f, -0.297461003f,
+		-0.297461003f, -0.5f, 0.0524502993f,
+		-0.302049011f, -0.5f, 4.44088985e-17f,
+		-0.0524502993f, -0.5f, -0.297461003f,
+		-5.54856013e-17f, 10.4098997f, -0.302049011f,
+		-0.231382996f, -0.5f, -0.194153994f,
+		-0.194153994f, -0.5f, -0.231382996f,
+		-5.54856013e-17f, -0.5f, -0.302049011f,
+		-5.54856013e-17f, 1.73116004f, -0.302049011f,
+		0.0524502993f, 1.73116004f, -0.297461003f,
+		0.0524502993f, -0.5f, -0.297461003f,
+		0.0524502993f, 10.4098997f, -0.297461003f,
+		-0.151024997f, -0.5f, -0.261583f,
+		-0.103307001f, -0.5f, -0.28383401f,
+		0.103307001f, 1.73116004f, -0.28383401f,
+		0.103307001f, -0.5f, -0.28383401f,
+		0.103307001f, 10.4098997f, -0.28383401f,
+		-0.0524502993f, -0.5f, -0.297461003f,
+		0.103307001f, 10.4098997f, -0.28383401f,
+		0.151024997f, 10.4098997f, -0.261583f,
+		0.151024997f, 1.73116004f, -0.261583f,
+		0.151024997f, 10.4098997f, -0.261583f,
+		0.261583f, -0.5f, -0.151024997f,
+		0.261583f, 1.73116004f, -0.151024997f,
+		0.28383401f, 1.73116004f, -0.103307001f,
+		0.28383401f, -0.5f, -0.103307001f,
+		0.151024997f, -0.5f, -0.261583f,
+		0.194153994f, 1.73116004f, -0.231382996f,
+		0.194153994f, -0.5f, -0.231382996f,
+		0.194153994f, 10.4098997f, -0.231382996f,
+		0.194153994f, 10.4098997f, -0.231382996f,
+		0.231382996f, 10.4098997f, -0.194153994f,
+		0.231382996f, 1.73116004f, -0.194153994f,
+		0.231382996f, 10.4098997f, -0.194153994f,
+		0.231382996f, -0.5f, -0.194153994f,
+		0.261583f, 10.4098997f, -0.151024997f,
+		0.28383401f, 10.4098997f, -0.103307001f,
+		0.28383401f, 10.4098997f, -0.103307001f,
+		0.297461003f, 10.4098997f, -0.0524502993f,
+		0.297461003f, 1.73116004f, -0.0524502993f,
+		0.297461003f, 10.4098997f, -0.0524502993f,
+		0.302049011f, 10.4098997f, 0.0f,
+		0.297461003f, 10.4098997f, 0.0524502993f,
+		0.28383401f, 10.4098997f, 0.103307001f,
+		0.103307001f, 10.4098997f, 0.28383401f,
+		-0.231382996f, 10.4098997f, 0.194153994f,
+		-0.261583f, 10.4098997f, 0.151024997f,
+		-0.28383401f, 10.4098997f, -0.103307001f,
+		-5.54856013e-17f, 10.4098997f, -0.302049011f,
+		0.0524502993f, 10.4098997f, -0.297461003f,
+		0.261583f, 10.4098997f, -0.151024997f,
+		0.297461003f, -0.5f, -0.0524502993f,
+		0.0f, 10.0003004f, 0.0f,
+		3.03999996f, 10.0003004f, 0.0f,
+		2.99381995f, 10.0003004f, 0.527890027f,
+		3.03999996f, 10.0003004f, 0.0f,
+		3.03999996f, 11.0443001f, 0.0f,
+		2.99381995f, 11.0443001f, 0.527890027f,
+		2.99381995f, 10.0003004f, 0.527890027f,
+		3.03999996f, 20.0002995f, 0.0f,
+		0.0f, 20.0002995f, 0.0f,
+		2.99381995f, 20.0002995f, 0.527890027f,
+		2.8566699f, 10.0003004f, 1.03973997f,
+		2.99381995f, 18.9563007f, 0.527890027f,
+		2.99381995f, 20.0002995f, 0.527890027f,
+		2.8566699f, 20.0002995f, 1.03973997f,
+		2.8566699f, 18.9563007f, 1.03973997f,
+		2.8566699f, 20.0002995f, 1.03973997f,
+		2.63271999f, 10.0003004f, 1.51999998f,
+		2.8566699f, 10.0003004f, 1.03973997f,
+		2.8566699f, 11.0443001f, 1.03973997f,
+		2.63271999f, 11.0443001f, 1.51999998f,
+		2.63271999f, 10.0003004f, 1.51999998f,
+		2.63271999f, 20.0002995f, 1.51999998f,
+		2.32877994f, 10.0003004f, 1.95406997f,
+		2.63271999f, 18.9563007f, 1.51999998f,
+		2.63271999f, 20.0002995f, 1.51999998f,
+		2.32877994f, 20.0002995f, 1.95406997f,
+		2.32877994f, 18.9563007f, 1.95406997f,
+		2.32877994f, 20.0002995f, 1.95406997f,
+		1.95406997f, 10.0003004f, 2.32877994f,
+		2.32877994f, 10.0003004f, 1.95406997f,
+		2.32877994f, 11.0443001f, 1.95406997f,
+		1.95406997f, 11.0443001f, 2.32877994f,
+		1.95406997f, 10.0003004f, 2.32877994f,
+		1.95406997f, 20.0002995f, 2.32877994f,
+		1.51999998f, 10.0003004f, 2.63271999f,
+		1.95406997f, 18.9563007f, 2.32877994f,
+		1.95406997f, 20.0002995f, 2.32877994f,
+		1.51999998f, 20.0002995f, 2.63271999f,
+		1.51999998f, 18.9563007f, 2.63271999f,
+		1.51999998f, 20.0002995f, 2.63271999f,
+		1.03973997f, 10.0003004f, 2.8566699f,
+		1.51999998f, 10.0003004f, 2.63271999f,
+		1.51999998f, 11.0443001f, 2.63271999f,
+		1.03973997f, 11.0443001f, 2.8566699f,
+		1.03973997f, 10.0003004f, 2.8566699f,
+		1.03973997f, 20.0002995f, 2.8566699f,
+		0.527890027f, 10.0003004f, 2.99381995f,
+		0.477472007f, 11.5667f, 1.31184006f,
+		0.247264996f, 18.4337997f, 0.679355979f,
+		0.125540003f, 18.4337997f, 0.711971998f,
+		0.242419004f, 11.5667f, 1.37483001f,
+		0.527890027f, 20.0002995f, 2.99381995f,
+		1.86145999e-16f, 10.0003004f, 3.03999996f,
+		0.527890027f, 18.9563007f, 2.99381995f,
+		0.527890027f, 20.0002995f, 2.99381995f,
+		1.86145999e-16f, 20.0002995f, 3.03999996f,
+		1.86145999e-16f, 18.9563007f, 3.03999996f,
+		1.86145999e-16f, 20.0002995f, 3.03999996f,
+		-0.527890027f, 10.0003004f, 2.99381995f,
+		1.86145999e-16f, 10.0003004f, 3.03999996f,
+		1.86145999e-16f, 11.0443001f, 3.03999996f,
+		-0.527890027f, 11.0443001f, 2.99381995f,
+		-0.527890027f, 10.0003004f, 2.99381995f,
+		-0.527890027f, 20.0002995f, 2.99381995f,
+		-1.03973997f, 10.0003004f, 2.8566699f,
+		-0.527890027f, 18.9563007f, 2.99381995f,
+		-0.527890027f, 20.0002995f, 2.99381995f,
+		-1.03973997f, 20.0002995f, 2.8566699f,
+		-1.03973997f, 18.9563007f, 2.8566699f,
+		-1.03973997f, 20.0002995f, 2.8566699f,
+		-1.51999998f, 10.0003004f, 2.63271999f,
+		-0.477472007f, 11.5667f, 1.31184006f,
+		-0.247264996f, 18.4337997f, 0.679355979f,
+		-0.361478001f, 18.4337997f, 0.626097977f,
+		-0.698018014f, 11.5667f, 1.20899999f,
+		-1.51999998f, 20.0002995f, 2.63271999f,
+		-1.95406997f, 10.0003004f, 2.32877994f,
+		-1.51999998f, 18.9563007f, 2.63271999f,
+		-1.51999998f, 20.0002995f, 2.63271999f,
+		-1.95406997f, 20.0002995f, 2.32877994f,
+		-1.95406997f, 18.9563007f, 2.32877994f,
+		-1.95406997f, 20.0002995f, 2.32877994f,
+		-2.32877994f, 10.0003004f, 1.95406997f,
+		-0.464706987f, 18.4337997f, 0.55381602f,
+		-2.32877994f, 18.9563007f, 1.95406997f,
+		-0.55381602f, 18.4337997f, 0.464706987f,
+		-2.32877994f, 20.0002995f, 1.95406997f,
+		-2.63271999f, 10.0003004f, 1.51999998f,
+		-2.32877994f, 20.0002995f, 1.95406997f,
+		-2.63271999f, 20.0002995f, 1.51999998f,
+		-2.63271999f, 18.9563007f, 1.51999998f,
+		-2.63271999f, 20.0002995f, 1.51999998f,
+		-2.8566699f, 10.0003004f, 1.03973997f,
+		-1.20899999f, 11.5667f, 0.698018014f,
+		-0.626097977f, 18.4337997f, 0.361478001f,
+		-0.679355979f, 18.4337997f, 0.247264996f,
+		-1.31184006f, 11.5667f, 0.477472007f,
+		-2.8566699f, 20.0002995f, 1.03973997f,
+		-2.99381995f, 10.0003004f, 0.527890027f,
+		-2.8566699f, 18.9563007f, 1.03973997f,
+		-2.8566699f, 20.0002995f, 1.03973997f,
+		-2.99381995f, 20.0002995f, 0.527890027f,
+		-2.99381995f, 18.9563007f, 0.527890027f,
+		-2.99381995f, 20.0002995f, 0.527890027f,
+		-3.03999996f, 10.0003004f, 3.55271003e-16f,
+		-2.99381995f, 11.0443001f, 0.527890027f,
+		-1.37483001f, 11.5667f, 0.242419004f,
+		-1.39603996f, 11.5667f, 1.77636004e-16f,
+		-3.03999996f, 11.0443001f, 3.55271003e-16f,
+		-3.03999996f, 20.0002995f, 3.55271003e-16f,
+		-2.99381995f, 10.0003004f, -0.527890027f,
+		-3.03999996f, 18.9563007f, 3.55271003e-16f,
+		-3.03999996f, 20.0002995f, 3.55271003e-16f,
+		-2.99381995f, 20.0002995f, -0.527890027f,
+		-2.99381995f, 18.9563007f, -0.527890027f,
+		-2.99381995f, 20.0002995f, -0.527890027f,
+		-2.8566699f, 10.0003004f, -1.03973997f,
+		-2.99381995f, 11.0443001f, -0.527890027f,
+		-1.37483001f, 11.5667f, -0.242419004f,
+		-1.31184006f, 11.5667f, -0.477472007f,
+		-2.8566699f, 11.0443001f, -1.03973997f,
+		-2.8566699f, 20.0002995f, -1.03973997f,
+		-2.63271999f, 10.0003004f, -1.51999998f,
+		-2.8566699f, 10.0003004f, -1.03973997f,
+		-2.63271999f, 11.0443001f, -1.51999998f,
+		-2.63271999f, 10.0003004f, -1.51999998f,
+		-2.63271999f, 20.0002995f, -1.51999998f,
+		-2.32877994f, 10.0003004f, -1.95406997f,
+		-2.63271999f, 18.9563007f, -1.51999998f,
+		-2.63271999f, 20.0002995f, -1.51999998f,
+		-2.32877994f, 20.0002995f, -1.95406997f,
+		-2.32877994f, 18.9563007f, -1.95406997f,
+		-2.32877994f, 20.0002995f, -1.95406997f,
+		-1.95406997f, 10.0003004f, -2.32877994f,
+		-2.32877994f, 11.0443001f, -1.95406997f,
+		-1.06942999f, 11.5667f, -0.89735502f,
+		-0.89735502f, 11.5667f, -1.06942999f,
+		-1.95406997f, 11.0443001f, -2.32877994f,
+		-1.95406997f, 20.0002995f, -2.32877994f,
+		-1.51999998f, 10.0003004f, -2.63271999f,
+		-1.95406997f, 18.9563007f, -2.32877994f,
+		-1.95406997f, 20.0002995f, -2.32877994f,
+		-1.51999998f, 20.0002995f, -2.63271999f,
+		-1.51999998f, 18.9563007f, -2.63271999f,
+		-1.51999998f, 20.0002995f, -2.63271999f,
+		-1.03973997f, 10.0003004f, -2.8566699f,
+		-0.698018014f, 11.5667f, -1.20899999f,
+		-0.361478001f, 18.4337997f, -0.626097977f,
+		-0.247264996f, 18.4337997f, -0.679355979f,
+		-0.477472007f, 11.5667f, -1.31184006f,
+		-1.03973997f, 20.0002995f, -2.8566699f,
+		-0.527890027f, 10.0003004f, -2.99381995f,
+		-1.03973997f, 20.0002995f, -2.8566699f,
+		-0.527890027f, 20.0002995f, -2.99381995f,
+		-0.527890027f, 19.8395996f, -2.99381995f,
+		-0.503706992f, 20.0002995f, -2.8566699f,
+		-0.527890027f, 20.0002995f, -2.99381995f,
+		-5.58438975e-16f, 10.0003004f, -3.03999996f,
+		-0.527890027f, 10.0003004f, -2.99381995f,
+		-0.527890027f, 11.0443001f, -2.99381995f,
+		-5.58438975e-16f, 11.0443001f, -3.03999996f,
+		-5.58438975e-16f, 10.0003004f, -3.03999996f,
+		-5.24760998e-16f, 20.0002995f, -2.8566699f,
+		0.527890027f, 10.0003004f, -2.99381995f,
+		0.527890027f, 11.0443001f, -2.99381995f,
+		0.527890027f, 10.0003004f, -2.99381995f,
+		0.503706992f, 20.0002995f, -2.8566699f,
+		1.03973997f, 10.0003004f, -2.8566699f,
+		0.527890027f, 19.8395996f, -2.99381995f,
+		0.527890027f, 20.0002995f, -2.99381995f,
+		1.03973997f, 20.0002995f, -2.8566699f,
+		0.527890027f, 20.0002995f, -2.99381995f,
+		1.03973997f, 20.0002995f, -2.8566699f,
+		1.51999998f, 10.0003004f, -2.63271999f,
+		1.03973997f, 10.0003004f, -2.8566699f,
+		1.03973997f, 11.0443001f, -2.8566699f,
+		1.51999998f, 11.0443001f, -2.63271999f,
+		1.51999998f, 10.0003004f, -2.63271999f,
+		1.51999998f, 20.0002995f, -2.63271999f,
+		1.95406997f, 10.0003004f, -2.32877994f,
+		1.95406997f, 11.0443001f, -2.32877994f,
+		1.95406997f, 10.0003004f, -2.32877994f,
+		1.95406997f, 20.0002995f, -2.32877994f,
+		2.32877994f, 10.0003004f, -1.95406997f,
+		0.464706987f, 18.4337997f, -0.55381602f,
+		1.95406997f, 18.9563007f, -2.32877994f,
+		2.32877994f, 18.9563007f, -1.95406997f,
+		0.55381602f, 18.4337997f, -0.464706987f,
+		2.32877994f, 20.0002995f, -1.95406997f,
+		2.63271999f, 10.0003004f, -1.51999998f,
+		2.32877994f, 20.0002995f, -1.95406997f,
+		2.63271999f, 20.0002995f, -1.51999998f,
+		2.63271999f, 18.9563007f, -1.51999998f,
+		2.63271999f, 20.0002995f, -1.51999998f,
+		2.8566699f, 10.0003004f, -1.03973997f,
+		2.8566699f, 20.0002995f, -1.03973997f,
+		2.8566699f, 18.9563007f, -1.03973997f,
+		2.8566699f, 20.0002995f, -1.03973997f,
+		2.99381995f, 10.0003004f, -0.527890027f,
+		2.8566699f, 10.0003004f, -1.03973997f,
+		2.8566699f, 11.0443001f, -1.03973997f,
+		2.99381995f, 11.0443001f, -0.527890027f,
+		2.99381995f, 10.0003004f, -0.527890027f,
+		2.99381995f, 20.0002995f, -0.527890027f,
+		-1.03973997f, 10.0003004f, -2.8566699f,
+		-1.03973997f, 11.0443001f, -2.8566699f,
+		-5.58438975e-16f, 20.0002995f, -3.03999996f,
+		-5.58438975e-16f, 19.8075008f, -3.03999996f,
+		-5.58438975e-16f, 20.0002995f, -3.03999996f,
+		0.247264996f, 18.4337997f, -0.679355979f,
+		0.477472007f, 11.5667f, -1.31184006f,
+		0.242419004f, 11.5667f, -1.37483001f,
+		0.125540003f, 18.4337997f, -0.711971998f,
+		3.03999996f, 18.9563007f, 0.0f,
+		3.03999996f, 20.0002995f, 0.0f,
+		0.55381602f, 18.4337997f, 0.464706987f,
+		0.626097977f, 18.4337997f, 0.361478001f,
+		1.03973997f, 20.0002995f, 2.8566699f,
+		1.03973997f, 18.9563007f, 2.8566699f,
+		0.527890027f, 10.0003004f, 2.99381995f,
+		0.527890027f, 11.0443001f, 2.99381995f,
+		-1.03973997f, 11.0443001f, 2.8566699f,
+		-1.03973997f, 10.0003004f, 2.8566699f,
+		-1.95406997f, 11.0443001f, 2.32877994f,
+		-1.95406997f, 10.0003004f, 2.32877994f,
+		-1.51999998f, 10.0003004f, 2.63271999f,
+		-1.51999998f, 11.0443001f, 2.63271999f,
+		-2.63271999f, 11.0443001f, 1.51999998f,
+		-2.63271999f, 10.0003004f, 1.51999998f,
+		-2.32877994f, 10.0003004f, 1.95406997f,
+		-2.32877994f, 11.0443001f, 1.95406997f,
+		-0.711971998f, 18.4337997f, 0.125540003f,
+		-0.679355979f, 18.4337997f, 0.247264996f,
+		-0.711971998f, 18.4337997f, -0.125540003f,
+		-0.722954988f, 18.4337997f, 0.0f,
+		-2.8566699f, 20.0002995f, -1.03973997f,
+		-2.8566699f, 18.9563007f, -1.03973997f,
+		-1.20899999f, 11.5667f, -0.698018014f,
+		-1.51999998f, 11.0443001f, -2.63271999f,
+		-1.51999998f, 10.0003004f, -2.63271999f,
+		-1.95406997f, 10.0003004f, -2.32877994f,
+		-1.03973997f, 18.9563007f, -2.8566699f,
+		-0.527890027f, 18.9563007f, -2.99381995f,
+		-5.58438975e-16f, 18.9563007f, -3.03999996f,
+		0.527890027f, 18.9563007f, -2.99381995f,
+		1.03973997f, 18.9563007f, -2.8566699f,
+		1.51999998f, 20.0002995f, -2.63271999f,
+		1.51999998f, 18.9563007f, -2.63271999f,
+		1.95406997f, 20.0002995f, -2.32877994f,
+		2.63271999f, 11.0443001f, -1.51999998f,
+		2.63271999f, 10.0003004f, -1.51999998f,
+		2.32877994f, 10.0003004f, -1.95406997f,
+		2.32877994f, 11.0443001f, -1.95406997f,
+		0.679355979f, 18.4337997f, -0.247264996f,
+		0.626097977f, 18.4337997f, -0.361478001f,
+		2.99381995f, 20.0002995f, -0.527890027f,
+		2.99381995f, 18.9563007f, -0.527890027f,
+		1.39603996f, 11.5667f, 0.0f,
+		0.722954988f, 18.4337997f, 0.0f,
+		0.711971998f, 18.4337997f, 0.125540003f,
+		1.37483001f, 11.5667f, 0.242419004f,
+		0.679355979f, 18.4337997f, 0.247264996f,
+		0.464706987f, 18.4337997f, 0.55381602f,
+		0.361478001f, 18.4337997f, 0.626097977f,
+		0.247264996f, 18.4337997f, 0.679355979f,
+		4.42681984e-17f, 18.4337997f, 0.722954988f,
+		-0.125540003f, 18.4337997f, 0.711971998f,
+		-2.8566699f, 11.0443001f, 1.03973997f,
+		-2.8566699f, 10.0003004f, 1.03973997f,
+		-3.03999996f, 10.0003004f, 3.55271003e-16f,
+		-2.99381995f, 10.0003004f, 0.527890027f,
+		-2.99381995f, 10.0003004f, -0.527890027f,
+		-2.32877994f, 10.0003004f, -1.95406997f,
+		-0.242419004f, 11.5667f, -1.37483001f,
+		-2.56448013e-16f, 11.5667f, -1.39603996f,
+		-1.32804999e-16f, 18.4337997f, -0.722954988f,
+		0.125540003f, 18.4337997f, -0.711971998f,
+		0.247264996f, 18.4337997f, -0.679355979f,
+		0.361478001f, 18.4337997f, -0.626097977f,
+		1.31184006f, 11.5667f, -0.477472007f,
+		1.37483001f, 11.5667f, -0.242419004f,
+		0.711971998f, 18.4337997f, -0.125540003f,
+		-0.247264996f, 18.4337997f, -0.679355979f,
+		-0.125540003f, 18.4337997f, -0.711971998f,
+		0.711971998f, 18.4337997f, 0.125540003f,
+		0.89735502f, 11.5667f, 1.06942999f,
+		0.464706987f, 18.4337997f, 0.55381602f,
+		0.361478001f, 18.4337997f, 0.626097977f,
+		0.698018014f, 11.5667f, 1.20899999f,
+		8.54825981e-17f, 11.5667f, 1.39603996f,
+		-0.242419004f, 11.5667f, 1.37483001f,
+		-0.125540003f, 18.4337997f, 0.711971998f,
+		-0.361478001f, 18.4337997f, 0.626097977f,
+		-0.626097977f, 18.4337997f, 0.361478001f,
+		-0.464706987f, 18.4337997f, -0.55381602f,
+		-0.361478001f, 18.4337997f, -0.626097977f,
+		1.06942999f, 11.5667f, -0.89735502f,
+		1.20899999f, 11.5667f, -0.698018014f,
+		0.125540003f, 18.4337997f, 0.711971998f,
+		-0.247264996f, 18.4337997f, 0.679355979f,
+		-1.06942999f, 11.5667f, 0.89735502f,
+		-0.89735502f, 11.5667f, 1.06942999f,
+		-0.679355979f, 18.4337997f, -0.247264996f,
+		-0.55381602f, 18.4337997f, -0.464706987f,
+		0.55381602f, 18.4337997f, -0.464706987f,
+		0.89735502f, 11.5667f, -1.06942999f,
+		0.464706987f, 18.4337997f, -0.55381602f,
+		0.55381602f, 18.4337997f, 0.464706987f,
+		1.06942999f, 11.5667f, 0.89735502f,
+		1.20899999f, 11.5667f, 0.698018014f,
+		0.626097977f, 18.4337997f, 0.361478001f,
+		-0.626097977f, 18.4337997f, -0.361478001f,
+		0.679355979f, 18.4337997f, -0.247264996f,
+		0.626097977f, 18.4337997f, -0.361478001f,
+		0.722954988f, 18.4337997f, 0.0f,
+		1.31184006f, 11.5667f, 0.477472007f,
+		4.42681984e-17f, 18.4337997f, 0.722954988f,
+		0.698018014f, 11.5667f, -1.20899999f,
+		0.361478001f, 18.4337997f, -0.626097977f,
+		0.711971998f, 18.4337997f, -0.125540003f,
+		-0.464706987f, 18.4337997f, 0.55381602f,
+		-0.55381602f, 18.4337997f, 0.464706987f,
+		-0.464706987f, 18.4337997f, -0.55381602f,
+		-0.711971998f, 18.4337997f, 0.125540003f,
+		-0.722954988f, 18.4337997f, 0.0f,
+		-0.711971998f, 18.4337997f, -0.125540003f,
+		-0.679355979f, 18.4337997f, -0.247264996f,
+		-0.55381602f, 18.4337997f, -0.464706987f,
+		-0.626097977f, 18.4337997f, -0.361478001f,
+		-0.125540003f, 18.4337997f, -0.711971998f,
+		-1.32804999e-16f, 18.4337997f, -0.722954988f,
+		0.679355979f, 18.4337997f, 0.247264996f
+	};
+
+	constexpr float Normals[] = {
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.866025329f, 0.0f, 0.500000238f,
+		0.866025329f, 0.0f, 0.500000238f,
+		0.76604408f, 0.0f, 0.642788053f,
+		0.76604408f, 0.0f, 0.642788053f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.642788053f, 0.0f, 0.76604408f,
+		0.642788053f, 0.0f, 0.76604408f,
+		0.500000238f, 0.0f, 0.866025329f,
+		0.500000238f, 0.0f, 0.866025329f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.500000238f, 0.0f, 0.866025329f,
+		0.342019916f, 0.0f, 0.939692736f,
+		0.342019916f, 0.0f, 0.939692736f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.173647955f, 0.0f, 0.984807789f,
+		0.173647955f, 0.0f, 0.984807789f,
+		0.0f, 0.0f, 1.0f,
+		0.0f, 0.0f, 1.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.173647955f, 0.0f, 0.984807789f,
+		-0.173647955f, 0.0f, 0.984807789f,
+		-0.342019916f, 0.0f, 0.939692736f,
+		-0.342019916f, 0.0f, 0.939692736f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.500000238f, 0.0f, 0.866025329f,
+		-0.500000238f, 0.0f, 0.866025329f,
+		-0.642788053f, 0.0f, 0.76604408f,
+		-0.642788053f, 0.0f, 0.76604408f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.866025329f, 0.0f, 0.500000238f,
+		-0.866025329f, 0.0f, 0.500000238f,
+		-0.939692736f, 0.0f, 0.342019916f,
+		-0.939692736f, 0.0f, 0.342019916f,
+		0.0f, 1.0f, 0.0f,
+		-0.939692736f, 0.0f, 0.342019916f,
+		-0.984807789f, 0.0f, 0.173647955f,
+		-0.984807789f, 0.0f, 0.173647955f,
+		0.0f, 1.0f, 0.0f,
+		1.0f, 0.0f, 0.0f,
+		1.0f, 0.0f, 0.0f,
+		0.984807789f, 0.0f, 0.173647955f,
+		0.984807789f, 0.0f, 0.173647955f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.939692736f, 0.0f, 0.342019916f,
+		0.939692736f, 0.0f, 0.342019916f,
+		-1.0f, 0.0f, 0.0f,
+		-1.0f, 0.0f, 0.0f,
+		-0.984807789f, 0.0f, -0.173647955f,
+		-0.984807789f, 0.0f, -0.173647955f,
+		0.0f, 1.0f, 0.0f,
+		0.866025329f, 0.0f, 0.500000238f,
+		-0.984807789f, 0.0f, -0.173647955f,
+		-0.939692736f, 0.0f, -0.342019916f,
+		-0.939692736f, 0.0f, -0.342019916f,
+		0.0f, 1.0f, 0.0f,
+		0.76604408f, 0.0f, 0.642788053f,
+		0.642788053f, 0.0f, 0.76604408f,
+		-0.866025329f, 0.0f, -0.500000238f,
+		-0.866025329f, 0.0f, -0.500000238f,
+		0.0f, 1.0f, 0.0f,
+		0.173647955f, 0.0f, 0.984807789f,
+		-0.866025329f, 0.0f, -0.500000238f,
+		-0.76604408f, 0.0f, -0.642788053f,
+		-0.76604408f, 0.0f, -0.642788053f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 1.0f,
+		-0.173647955f, 0.0f, 0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		-0.342019916f, 0.0f, 0.939692736f,
+		-0.500000238f, 0.0f, 0.866025329f,
+		-0.642788053f, 0.0f, -0.76604408f,
+		-0.642788053f, 0.0f, -0.76604408f,
+		-0.500000238f, 0.0f, -0.866025329f,
+		-0.500000238f, 0.0f, -0.866025329f,
+		0.0f, 1.0f, 0.0f,
+		-0.642788053f, 0.0f, 0.76604408f,
+		-0.76604408f, 0.0f, 0.642788053f,
+		-0.76604408f, 0.0f, 0.642788053f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		-0.342019916f, 0.0f, -0.939692736f,
+		-0.342019916f, 0.0f, -0.939692736f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		-0.984807789f, 0.0f, 0.173647955f,
+		-1.0f, 0.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		-0.76604408f, 0.0f, -0.642788053f,
+		-0.642788053f, 0.0f, -0.76604408f,
+		0.0f, 0.0f, -1.0f,
+		0.0f, 0.0f, -1.0f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		-0.500000238f, 0.0f, -0.866025329f,
+		-0.342019916f, 0.0f, -0.939692736f,
+		0.342019916f, 0.0f, -0.939692736f,
+		0.342019916f, 0.0f, -0.939692736f,
+		0.0f, 1.0f, 0.0f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		0.342019916f, 0.0f, -0.939692736f,
+		0.500000238f, 0.0f, -0.866025329f,
+		0.500000238f, 0.0f, -0.866025329f,
+		0.0f, 1.0f, 0.0f,
+		0.866025329f, 0.0f, -0.500000238f,
+		0.866025329f, 0.0f, -0.500000238f,
+		0.939692736f, 0.0f, -0.342019916f,
+		0.939692736f, 0.0f, -0.342019916f,
+		0.500000238f, 0.0f, -0.866025329f,
+		0.642788053f, 0.0f, -0.76604408f,
+		0.642788053f, 0.0f, -0.76604408f,
+		0.0f, 1.0f, 0.0f,
+		0.642788053f, 0.0f, -0.76604408f,
+		0.76604408f, 0.0f, -0.642788053f,
+		0.76604408f, 0.0f, -0.642788053f,
+		0.0f, 1.0f, 0.0f,
+		0.76604408f, 0.0f, -0.642788053f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.939692736f, 0.0f, -0.342019916f,
+		0.984807789f, 0.0f, -0.173647955f,
+		0.984807789f, 0.0f, -0.173647955f,
+		0.0f, 1.0f, 0.0f,
+		1.0f, 0.0f, 0.0f,
+		0.984807789f, 0.0f, 0.173647955f,
+		0.939692736f, 0.0f, 0.342019916f,
+		0.342019916f, 0.0f, 0.939692736f,
+		-0.76604408f, 0.0f, 0.642788053f,
+		-0.866025329f, 0.0f, 0.500000238f,
+		-0.939692736f, 0.0f, -0.342019916f,
+		0.0f, 0.0f, -1.0f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.866025329f, 0.0f, -0.500000238f,
+		0.984807789f, 0.0f, -0.173647955f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		1.0f, 0.0f, 0.0f,
+		0.806366801f, 0.591415882f, 0.0f,
+		0.79411608f, 0.591416061f, 0.140024021f,
+		0.984807789f, 0.0f, 0.173647955f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.768253148f, -0.625649035f, 0.135464013f,
+		0.984807789f, 0.0f, 0.173647955f,
+		0.939692736f, 0.0f, 0.342019916f,
+		0.733058214f, -0.625649214f, 0.266812086f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.939692736f, 0.0f, 0.342019916f,
+		0.757736802f, 0.591415882f, 0.27579394f,
+		0.6983338f, 0.591415882f, 0.403183907f,
+		0.866025329f, 0.0f, 0.500000238f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.675590277f, -0.625649273f, 0.39005217f,
+		0.866025329f, 0.0f, 0.500000238f,
+		0.76604408f, 0.0f, 0.642788053f,
+		0.597594857f, -0.625648797f, 0.501441896f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.76604408f, 0.0f, 0.642788053f,
+		0.617712677f, 0.591415703f, 0.518322766f,
+		0.518322766f, 0.591415703f, 0.617712677f,
+		0.642788053f, 0.0f, 0.76604408f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.501441896f, -0.625648797f, 0.597594857f,
+		0.642788053f, 0.0f, 0.76604408f,
+		0.500000238f, 0.0f, 0.866025329f,
+		0.390052199f, -0.625649333f, 0.675590336f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.500000238f, 0.0f, 0.866025329f,
+		0.403183907f, 0.591415882f, 0.6983338f,
+		0.27579394f, 0.591415882f, 0.757736802f,
+		0.342019916f, 0.0f, 0.939692736f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.265616983f, 0.629979968f, 0.729775965f,
+		0.340389043f, 0.0975477099f, 0.935211062f,
+		0.172820017f, 0.0975477099f, 0.980111063f,
+		0.134856984f, 0.629979968f, 0.764812887f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.135464013f, -0.625649035f, 0.768253148f,
+		0.173647955f, 0.0f, 0.984807789f,
+		0.0f, 0.0f, 1.0f,
+		0.0f, -0.625648797f, 0.780104816f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.0f, 0.0f, 1.0f,
+		-1.67661973e-08f, 0.591415882f, 0.806366801f,
+		-0.140024021f, 0.591416061f, 0.79411608f,
+		-0.173647955f, 0.0f, 0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.135464013f, -0.625649035f, 0.768253148f,
+		-0.173647955f, 0.0f, 0.984807789f,
+		-0.342019916f, 0.0f, 0.939692736f,
+		-0.266812086f, -0.625649214f, 0.733058214f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.265616983f, 0.629979968f, 0.729775965f,
+		-0.340389043f, 0.0975477099f, 0.935211062f,
+		-0.497615188f, 0.0975477397f, 0.861895323f,
+		-0.388305992f, 0.629980028f, 0.672564983f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.390052199f, -0.625649333f, 0.675590336f,
+		-0.500000238f, 0.0f, 0.866025329f,
+		-0.642788053f, 0.0f, 0.76604408f,
+		-0.501441896f, -0.625648797f, 0.597594857f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.141384959f, -0.975509644f, 0.168496937f,
+		-0.597594857f, -0.625648797f, 0.501441896f,
+		-0.168496937f, -0.975509644f, 0.141384959f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.76604408f, 0.0f, 0.642788053f,
+		-0.866025329f, 0.0f, 0.500000238f,
+		-0.675590277f, -0.625649273f, 0.39005217f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.672564983f, 0.629980028f, 0.388305992f,
+		-0.861895323f, 0.0975477397f, 0.497615188f,
+		-0.935211122f, 0.0975477174f, 0.340389043f,
+		-0.729775965f, 0.629979968f, 0.265616983f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.733058214f, -0.625649214f, 0.266812086f,
+		-0.939692736f, 0.0f, 0.342019916f,
+		-0.984807789f, 0.0f, 0.173647955f,
+		-0.768253148f, -0.625649035f, 0.135464013f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.79411608f, 0.591416061f, 0.140024021f,
+		-0.764812887f, 0.629979968f, 0.134856984f,
+		-0.776611209f, 0.629980206f, -1.34122047e-08f,
+		-0.806366801f, 0.591415882f, -1.4453696e-08f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.780104816f, -0.625648797f, -1.19483967e-09f,
+		-1.0f, 0.0f, 0.0f,
+		-0.984807789f, 0.0f, -0.173647955f,
+		-0.768253148f, -0.625649035f, -0.135464013f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.79411608f, 0.591416061f, -0.140024021f,
+		-0.764812887f, 0.629979968f, -0.134856984f,
+		-0.729775965f, 0.629979968f, -0.265616983f,
+		-0.757736802f, 0.591415882f, -0.27579394f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.939692736f, 0.0f, -0.342019916f,
+		-0.6983338f, 0.591415882f, -0.403183907f,
+		-0.866025329f, 0.0f, -0.500000238f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.675590277f, -0.625649273f, -0.39005217f,
+		-0.866025329f, 0.0f, -0.500000238f,
+		-0.76604408f, 0.0f, -0.642788053f,
+		-0.597594857f, -0.625648797f, -0.501441896f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.617712677f, 0.591415703f, -0.518322766f,
+		-0.594919026f, 0.629980028f, -0.499195993f,
+		-0.499195993f, 0.629980028f, -0.594919026f,
+		-0.518322766f, 0.591415703f, -0.617712677f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.501441896f, -0.625648797f, -0.597594857f,
+		-0.642788053f, 0.0f, -0.76604408f,
+		-0.500000238f, 0.0f, -0.866025329f,
+		-0.390052199f, -0.625649333f, -0.675590336f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.388305992f, 0.629980028f, -0.672564983f,
+		-0.497615188f, 0.0975477397f, -0.861895323f,
+		-0.340389043f, 0.0975477099f, -0.935211062f,
+		-0.265616983f, 0.629979968f, -0.729775965f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.314482123f, 0.0f, -0.949263394f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		-0.173647955f, 0.0f, -0.984807789f,
+		-0.140024021f, 0.591416061f, -0.79411608f,
+		1.67661973e-08f, 0.591415882f, -0.806366801f,
+		0.0f, 0.0f, -1.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.140024021f, 0.591416061f, -0.79411608f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.173647955f, 0.0f, -0.984807789f,
+		0.314482123f, 0.0f, -0.949263394f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.342019916f, 0.0f, -0.939692736f,
+		0.27579394f, 0.591415882f, -0.757736802f,
+		0.403183907f, 0.591415882f, -0.6983338f,
+		0.500000238f, 0.0f, -0.866025329f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.518322766f, 0.591415703f, -0.617712677f,
+		0.642788053f, 0.0f, -0.76604408f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.141384959f, -0.975509644f, -0.168496937f,
+		0.501441896f, -0.625648797f, -0.597594857f,
+		0.597594857f, -0.625648797f, -0.501441896f,
+		0.168496937f, -0.975509644f, -0.141384959f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.76604408f, 0.0f, -0.642788053f,
+		0.866025329f, 0.0f, -0.500000238f,
+		0.675590277f, -0.625649273f, -0.39005217f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.939692736f, 0.0f, -0.342019916f,
+		0.733058393f, -0.625649333f, -0.266811162f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, -1.0f, 0.0f,
+		0.939692736f, 0.0f, -0.342019916f,
+		0.757736802f, 0.591415882f, -0.27579394f,
+		0.79411608f, 0.591416061f, -0.140024021f,
+		0.984807789f, 0.0f, -0.173647955f,
+		0.0f, 1.0f, 0.0f,
+		-0.342019916f, 0.0f, -0.939692736f,
+		-0.27579394f, 0.591415882f, -0.757736802f,
+		0.0f, 0.0f, -1.0f,
+		0.0f, 0.0f, -1.0f,
+		0.0f, 1.0f, 0.0f,
+		0.340389043f, 0.0975477099f, -0.935211062f,
+		0.265616983f, 0.629979968f, -0.729775965f,
+		0.134856984f, 0.629979968f, -0.764812887f,
+		0.172820017f, 0.0975477099f, -0.980111063f,
+		0.780104816f, -0.625648797f, 5.97419836e-10f,
+		1.0f, 0.0f, 0.0f,
+		0.168496937f, -0.975509644f, 0.141384959f,
+		0.190487951f, -0.975509763f, 0.109977968f,
+		0.342019916f, 0.0f, 0.939692736f,
+		0.266812086f, -0.625649214f, 0.733058214f,
+		0.173647955f, 0.0f, 0.984807789f,
+		0.140024021f, 0.591416061f, 0.79411608f,
+		-0.27579394f, 0.591415882f, 0.757736802f,
+		-0.342019916f, 0.0f, 0.939692736f,
+		-0.518322766f, 0.591415703f, 0.617712677f,
+		-0.642788053f, 0.0f, 0.76604408f,
+		-0.500000238f, 0.0f, 0.866025329f,
+		-0.403183907f, 0.591415882f, 0.6983338f,
+		-0.6983338f, 0.591415882f, 0.403183907f,
+		-0.866025329f, 0.0f, 0.500000238f,
+		-0.76604408f, 0.0f, 0.642788053f,
+		-0.617712677f, 0.591415703f, 0.518322766f,
+		-0.216614932f, -0.975509644f, 0.0381950848f,
+		-0.206691921f, -0.975509644f, 0.0752295703f,
+		-0.216614932f, -0.975509644f, -0.0381949842f,
+		-0.21995692f, -0.975509644f, -9.31494659e-10f,
+		-0.939692736f, 0.0f, -0.342019916f,
+		-0.733058214f, -0.625649214f, -0.266812086f,
+		-0.672564983f, 0.629980028f, -0.388305992f,
+		-0.403183907f, 0.591415882f, -0.6983338f,
+		-0.500000238f, 0.0f, -0.866025329f,
+		-0.642788053f, 0.0f, -0.76604408f,
+		-0.266812086f, -0.625649214f, -0.733058214f,
+		-0.135464013f, -0.625649035f, -0.768253148f,
+		0.0f, -0.625648797f, -0.780104816f,
+		0.135464013f, -0.625649035f, -0.768253148f,
+		0.266812086f, -0.625649214f, -0.733058214f,
+		0.500000238f, 0.0f, -0.866025329f,
+		0.390052199f, -0.625649333f, -0.675590336f,
+		0.642788053f, 0.0f, -0.76604408f,
+		0.6983338f, 0.591415882f, -0.403183907f,
+		0.866025329f, 0.0f, -0.500000238f,
+		0.76604408f, 0.0f, -0.642788053f,
+		0.617712677f, 0.591415703f, -0.518322766f,
+		0.206691921f, -0.975509644f, -0.0752294734f,
+		0.190487951f, -0.975509763f, -0.109977968f,
+		0.984807789f, 0.0f, -0.173647955f,
+		0.768253148f, -0.625649035f, -0.135464013f,
+		0.776611209f, 0.629980206f, 1.11768028e-09f,
+		0.995230854f, 0.0975476876f, 0.0f,
+		0.980111063f, 0.0975477099f, 0.172820017f,
+		0.764812887f, 0.629979968f, 0.134856984f,
+		0.206691921f, -0.975509644f, 0.0752295703f,
+		0.141384959f, -0.975509644f, 0.168496937f,
+		0.109977968f, -0.975509763f, 0.190487951f,
+		0.0752295703f, -0.975509644f, 0.206691921f,
+		0.0f, -0.975509644f, 0.21995692f,
+		-0.0381949842f, -0.975509644f, 0.216614932f,
+		-0.757736802f, 0.591415882f, 0.27579394f,
+		-0.939692736f, 0.0f, 0.342019916f,
+		-1.0f, 0.0f, 0.0f,
+		-0.984807789f, 0.0f, 0.173647955f,
+		-0.984807789f, 0.0f, -0.173647955f,
+		-0.76604408f, 0.0f, -0.642788053f,
+		-0.134856984f, 0.629979968f, -0.764812887f,
+		1.56475046e-08f, 0.629980206f, -0.776611209f,
+		0.0f, -0.975509644f, -0.21995692f,
+		0.0381949842f, -0.975509644f, -0.216614932f,
+		0.0752295703f, -0.975509644f, -0.206691921f,
+		0.109977968f, -0.975509763f, -0.190487951f,
+		0.729775965f, 0.629979968f, -0.265616983f,
+		0.764812887f, 0.629979968f, -0.134856984f,
+		0.980111063f, 0.0975477099f, -0.172820017f,
+		-0.0752295703f, -0.975509644f, -0.206691921f,
+		-0.0381949842f, -0.975509644f, -0.216614932f,
+		0.216614932f, -0.975509644f, 0.0381949842f,
+		0.499195993f, 0.629980028f, 0.594919026f,
+		0.639722049f, 0.0975477174f, 0.76239109f,
+		0.497615188f, 0.0975477397f, 0.861895323f,
+		0.388305992f, 0.629980028f, 0.672564983f,
+		-3.12951123e-08f, 0.629980206f, 0.776611209f,
+		-0.134856984f, 0.629979968f, 0.764812887f,
+		-0.172820017f, 0.0975477099f, 0.980111063f,
+		-0.109977968f, -0.975509763f, 0.190487951f,
+		-0.190487951f, -0.975509763f, 0.109977968f,
+		-0.141384959f, -0.975509644f, -0.168496937f,
+		-0.109977968f, -0.975509763f, -0.190487951f,
+		0.594919026f, 0.629980028f, -0.499195993f,
+		0.672564983f, 0.629980028f, -0.388305992f,
+		0.0381949842f, -0.975509644f, 0.216614932f,
+		-0.0752295703f, -0.975509644f, 0.206691921f,
+		-0.594919026f, 0.629980028f, 0.499195993f,
+		-0.499195993f, 0.629980028f, 0.594919026f,
+		-0.206691921f, -0.975509644f, -0.0752295703f,
+		-0.168496937f, -0.975509644f, -0.141384959f,
+		0.76239109f, 0.0975477174f, -0.639722049f,
+		0.499195993f, 0.629980028f, -0.594919026f,
+		0.639722049f, 0.0975477174f, -0.76239109f,
+		0.76239109f, 0.0975477174f, 0.639722049f,
+		0.594919026f, 0.629980028f, 0.499195993f,
+		0.672564983f, 0.629980028f, 0.388305992f,
+		0.861895323f, 0.0975477397f, 0.497615188f,
+		-0.190487951f, -0.975509763f, -0.109977968f,
+		0.935211122f, 0.0975477174f, -0.340389043f,
+		0.861895323f, 0.0975477397f, -0.497615188f,
+		0.21995692f, -0.975509644f, 0.0f,
+		0.729775965f, 0.629979968f, 0.265616983f,
+		-2.61756963e-08f, 0.0975476876f, 0.995230854f,
+		0.388305992f, 0.629980028f, -0.672564983f,
+		0.497615188f, 0.0975477397f, -0.861895323f,
+		0.216614932f, -0.975509644f, -0.0381949842f,
+		-0.639722049f, 0.0975477174f, 0.76239109f,
+		-0.76239109f, 0.0975477174f, 0.639722049f,
+		-0.639722049f, 0.0975477174f, -0.76239109f,
+		-0.980111063f, 0.0975477099f, 0.172820017f,
+		-0.995230854f, 0.0975476876f, 0.0f,
+		-0.980111063f, 0.0975477099f, -0.172820017f,
+		-0.935211122f, 0.0975477174f, -0.340389043f,
+		-0.76239109f, 0.0975477174f, -0.639722049f,
+		-0.861895323f, 0.0975477397f, -0.497615188f,
+		-0.172820017f, 0.0975477099f, -0.980111063f,
+		0.0f, 0.0975476876f, -0.995230854f,
+		0.935211122f, 0.0975477174f, 0.340389043f
+	};
+
+	constexpr uint32_t Indices[] = {
+		0, 1, 2,
+		3, 4, 1,
+		5, 6, 7,
+		8, 1, 9,
+		4, 10, 1,
+		7, 6, 11,
+		12, 1, 13,
+		10, 14, 1,
+		11, 6, 15,
+		16, 1, 12,
+		17, 18, 19,
+		20, 17, 19,
+		15, 6, 21,
+		22, 1, 23,
+		24, 25, 1,
+		21, 6, 26,
+		27, 1, 22,
+		28, 29, 30,
+		31, 28, 30,
+		26, 6, 32,
+		33, 1, 34,
+		35, 31, 36,
+		37, 35, 36,
+		32, 6, 38,
+		39, 1, 40,
+		0, 41, 1,
+		38, 6, 42,
+		43, 1, 44,
+		45, 46, 47,
+		48, 45, 47,
+		42, 6, 49,
+		50, 1, 51,
+		52, 44, 1,
+		49, 6, 53,
+		13, 1, 54,
+		55, 56, 57,
+		58, 55, 57,
+		53, 6, 59,
+		60, 1, 16,
+		43, 51, 1,
+		59, 6, 61,
+		62, 1, 63,
+		64, 65, 66,
+		67, 64, 66,
+		61, 6, 68,
+		34, 1, 27,
+		50, 69, 1,
+		68, 6, 70,
+		40, 1, 33,
+		69, 9, 1,
+		70, 6, 71,
+		72, 1, 73,
+		74, 75, 76,
+		77, 74, 76,
+		71, 6, 78,
+		3, 1, 72,
+		76, 79, 80,
+		81, 76, 80,
+		78, 6, 82,
+		83, 84, 85,
+		86, 83, 85,
+		87, 54, 1,
+		82, 6, 88,
+		86, 85, 89,
+		90, 86, 89,
+		91, 92, 93,
+		94, 91, 93,
+		88, 6, 95,
+		90, 89, 17,
+		96, 90, 17,
+		97, 94, 98,
+		99, 97, 98,
+		95, 6, 100,
+		101, 20, 28,
+		102, 101, 28,
+		99, 98, 103,
+		104, 99, 103,
+		100, 6, 105,
+		37, 36, 45,
+		106, 37, 45,
+		103, 107, 108,
+		109, 103, 108,
+		105, 6, 110,
+		111, 48, 55,
+		112, 111, 55,
+		60, 63, 1,
+		110, 6, 113,
+		114, 58, 64,
+		115, 114, 64,
+		116, 117, 118,
+		119, 116, 118,
+		113, 6, 120,
+		121, 67, 122,
+		123, 121, 122,
+		62, 124, 1,
+		120, 6, 125,
+		123, 122, 75,
+		74, 123, 75,
+		126, 127, 128,
+		129, 126, 128,
+		125, 6, 130,
+		131, 81, 91,
+		132, 131, 91,
+		133, 23, 1,
+		130, 6, 134,
+		135, 109, 116,
+		136, 135, 116,
+		137, 138, 139,
+		140, 137, 139,
+		134, 6, 141,
+		142, 119, 126,
+		143, 142, 126,
+		140, 139, 144,
+		145, 140, 144,
+		141, 6, 146,
+		147, 129, 138,
+		137, 147, 138,
+		144, 148, 149,
+		150, 144, 149,
+		146, 6, 151,
+		152, 153, 154,
+		155, 152, 154,
+		156, 150, 157,
+		158, 156, 157,
+		151, 6, 159,
+		96, 17, 20,
+		101, 96, 20,
+		157, 160, 161,
+		162, 157, 161,
+		159, 6, 163,
+		102, 28, 31,
+		35, 102, 31,
+		164, 162, 153,
+		152, 164, 153,
+		163, 6, 165,
+		106, 45, 48,
+		111, 106, 48,
+		39, 73, 1,
+		165, 6, 166,
+		77, 76, 81,
+		131, 77, 81,
+		154, 167, 168,
+		169, 154, 168,
+		166, 6, 170,
+		143, 126, 129,
+		147, 143, 129,
+		169, 168, 171,
+		84, 169, 171,
+		170, 6, 5,
+		84, 171, 172,
+		85, 84, 172,
+		85, 172, 173,
+		89, 85, 173,
+		89, 173, 18,
+		17, 89, 18,
+		24, 1, 14,
+		20, 19, 29,
+		28, 20, 29,
+		2, 1, 25,
+		31, 30, 174,
+		36, 31, 174,
+		36, 174, 46,
+		45, 36, 46,
+		52, 1, 41,
+		48, 47, 56,
+		55, 48, 56,
+		58, 114, 112,
+		55, 58, 112,
+		58, 57, 65,
+		64, 58, 65,
+		67, 121, 115,
+		64, 67, 115,
+		67, 66, 175,
+		122, 67, 175,
+		122, 175, 176,
+		75, 122, 176,
+		75, 176, 79,
+		76, 75, 79,
+		87, 1, 8,
+		81, 80, 92,
+		91, 81, 92,
+		94, 97, 132,
+		91, 94, 132,
+		94, 93, 177,
+		98, 94, 177,
+		98, 177, 107,
+		103, 98, 107,
+		109, 135, 104,
+		103, 109, 104,
+		109, 108, 117,
+		116, 109, 117,
+		119, 142, 136,
+		116, 119, 136,
+		119, 118, 127,
+		126, 119, 127,
+		133, 1, 124,
+		129, 128, 178,
+		138, 129, 178,
+		138, 178, 179,
+		139, 138, 179,
+		139, 179, 148,
+		144, 139, 148,
+		150, 156, 145,
+		144, 150, 145,
+		150, 149, 160,
+		157, 150, 160,
+		162, 164, 158,
+		157, 162, 158,
+		162, 161, 180,
+		153, 162, 180,
+		153, 180, 167,
+		154, 153, 167,
+		169, 181, 155,
+		154, 169, 155,
+		84, 83, 181,
+		169, 84, 181,
+		182, 183, 184,
+		185, 186, 187,
+		188, 185, 187,
+		189, 190, 191,
+		182, 184, 192,
+		193, 194, 195,
+		196, 193, 195,
+		191, 190, 197,
+		182, 192, 198,
+		199, 200, 201,
+		202, 199, 201,
+		197, 190, 203,
+		182, 198, 204,
+		205, 206, 207,
+		208, 205, 207,
+		203, 190, 209,
+		182, 204, 210,
+		211, 212, 213,
+		214, 211, 213,
+		209, 190, 215,
+		182, 210, 216,
+		217, 218, 219,
+		220, 217, 219,
+		215, 190, 221,
+		182, 216, 222,
+		223, 224, 225,
+		226, 223, 225,
+		221, 190, 227,
+		182, 222, 228,
+		229, 230, 231,
+		232, 229, 231,
+		227, 190, 233,
+		182, 228, 234,
+		235, 236, 237,
+		238, 235, 237,
+		233, 190, 239,
+		182, 234, 240,
+		241, 242, 243,
+		244, 241, 243,
+		239, 190, 245,
+		182, 240, 246,
+		247, 248, 249,
+		250, 247, 249,
+		245, 190, 251,
+		182, 246, 252,
+		253, 254, 255,
+		256, 253, 255,
+		251, 190, 257,
+		182, 252, 258,
+		259, 260, 261,
+		262, 259, 261,
+		257, 190, 263,
+		182, 258, 264,
+		265, 262, 266,
+		267, 265, 266,
+		263, 190, 268,
+		182, 264, 269,
+		266, 270, 271,
+		272, 266, 271,
+		268, 190, 273,
+		182, 269, 274,
+		275, 276, 277,
+		278, 275, 277,
+		273, 190, 279,
+		182, 274, 280,
+		281, 282, 283,
+		284, 281, 283,
+		279, 190, 285,
+		182, 280, 286,
+		287, 288, 289,
+		290, 287, 289,
+		285, 190, 291,
+		182, 286, 292,
+		293, 294, 295,
+		296, 293, 295,
+		291, 190, 297,
+		182, 292, 298,
+		299, 300, 301,
+		302, 299, 301,
+		297, 190, 303,
+		182, 298, 304,
+		305, 302, 306,
+		307, 305, 306,
+		303, 190, 308,
+		182, 304, 309,
+		310, 311, 312,
+		313, 310, 312,
+		308, 190, 314,
+		182, 309, 315,
+		316, 317, 318,
+		319, 316, 318,
+		314, 190, 320,
+		182, 315, 321,
+		322, 323, 324,
+		325, 322, 324,
+		320, 190, 326,
+		182, 321, 327,
+		328, 329, 330,
+		331, 328, 330,
+		326, 190, 332,
+		182, 327, 333,
+		334, 335, 336,
+		332, 337, 338,
+		182, 333, 339,
+		340, 341, 342,
+		343, 340, 342,
+		337, 190, 344,
+		182, 339, 345,
+		343, 342, 346,
+		347, 343, 346,
+		344, 190, 348,
+		182, 345, 349,
+		350, 351, 352,
+		353, 348, 354,
+		182, 349, 355,
+		356, 357, 358,
+		359, 356, 358,
+		354, 190, 360,
+		182, 355, 361,
+		359, 358, 362,
+		363, 359, 362,
+		360, 190, 364,
+		182, 361, 365,
+		366, 367, 368,
+		369, 366, 368,
+		364, 190, 370,
+		182, 365, 371,
+		368, 372, 373,
+		374, 368, 373,
+		370, 190, 375,
+		182, 371, 376,
+		374, 373, 377,
+		378, 374, 377,
+		375, 190, 379,
+		182, 376, 380,
+		381, 382, 383,
+		384, 381, 383,
+		379, 190, 385,
+		182, 380, 183,
+		384, 383, 186,
+		185, 384, 186,
+		385, 190, 189,
+		341, 340, 386,
+		387, 341, 386,
+		332, 190, 337,
+		336, 335, 388,
+		389, 336, 388,
+		344, 390, 338,
+		337, 344, 338,
+		389, 388, 351,
+		350, 389, 351,
+		348, 353, 390,
+		344, 348, 390,
+		391, 392, 393,
+		394, 391, 393,
+		348, 190, 354,
+		395, 396, 194,
+		193, 395, 194,
+		200, 199, 188,
+		187, 200, 188,
+		196, 195, 206,
+		205, 196, 206,
+		208, 397, 398,
+		205, 208, 398,
+		208, 207, 218,
+		217, 208, 218,
+		224, 223, 214,
+		213, 224, 214,
+		220, 219, 399,
+		400, 220, 399,
+		400, 399, 236,
+		235, 400, 236,
+		242, 241, 401,
+		402, 242, 401,
+		238, 237, 248,
+		247, 238, 248,
+		403, 404, 244,
+		243, 403, 244,
+		250, 249, 260,
+		259, 250, 260,
+		405, 406, 407,
+		408, 405, 407,
+		262, 261, 270,
+		266, 262, 270,
+		409, 410, 411,
+		412, 409, 411,
+		272, 271, 282,
+		281, 272, 282,
+		284, 413, 414,
+		281, 284, 414,
+		284, 283, 294,
+		293, 284, 294,
+		296, 415, 416,
+		293, 296, 416,
+		296, 295, 417,
+		418, 296, 417,
+		418, 417, 311,
+		310, 418, 311,
+		317, 316, 306,
+		419, 317, 306,
+		313, 312, 323,
+		322, 313, 323,
+		420, 421, 422,
+		319, 420, 422,
+		325, 324, 334,
+		423, 325, 334,
+		424, 336, 389,
+		425, 424, 389,
+		425, 389, 350,
+		426, 425, 350,
+		427, 352, 428,
+		429, 427, 428,
+		429, 428, 430,
+		367, 429, 430,
+		367, 430, 372,
+		368, 367, 372,
+		431, 432, 433,
+		434, 431, 433,
+		378, 435, 436,
+		374, 378, 436,
+		378, 377, 437,
+		438, 378, 437,
+		438, 437, 396,
+		395, 438, 396,
+		423, 334, 336,
+		424, 423, 336,
+		426, 350, 352,
+		427, 426, 352,
+		439, 440, 441,
+		442, 439, 441,
+		443, 196, 205,
+		398, 443, 205,
+		397, 208, 217,
+		444, 397, 217,
+		445, 220, 400,
+		446, 445, 400,
+		402, 401, 226,
+		225, 402, 226,
+		447, 238, 247,
+		448, 447, 247,
+		408, 407, 404,
+		403, 408, 404,
+		412, 411, 406,
+		405, 412, 406,
+		449, 450, 410,
+		409, 449, 410,
+		290, 451, 452,
+		287, 290, 452,
+		302, 305, 453,
+		299, 302, 453,
+		302, 301, 419,
+		306, 302, 419,
+		319, 422, 454,
+		316, 319, 454,
+		387, 386, 421,
+		420, 387, 421,
+		341, 455, 456,
+		342, 341, 456,
+		457, 425, 426,
+		458, 457, 426,
+		459, 427, 429,
+		460, 459, 429,
+		460, 429, 367,
+		366, 460, 367,
+		434, 433, 363,
+		362, 434, 363,
+		382, 461, 462,
+		383, 382, 462,
+		462, 463, 440,
+		439, 462, 440,
+		464, 423, 424,
+		465, 464, 424,
+		357, 356, 347,
+		346, 357, 347,
+		466, 193, 196,
+		443, 466, 196,
+		212, 211, 202,
+		201, 212, 202,
+		467, 468, 469,
+		470, 467, 469,
+		402, 232, 471,
+		242, 402, 471,
+		472, 473, 254,
+		253, 472, 254,
+		474, 259, 262,
+		265, 474, 262,
+		267, 266, 272,
+		475, 267, 272,
+		287, 452, 450,
+		449, 287, 450,
+		299, 453, 451,
+		290, 299, 451,
+		316, 454, 307,
+		306, 316, 307,
+		476, 322, 325,
+		477, 476, 325,
+		434, 478, 479,
+		431, 434, 479,
+		382, 381, 432,
+		431, 382, 432,
+		446, 400, 235,
+		480, 446, 235,
+		481, 250, 259,
+		474, 481, 259,
+		482, 412, 405,
+		483, 482, 405,
+		475, 272, 281,
+		414, 475, 281,
+		413, 284, 293,
+		416, 413, 293,
+		415, 296, 418,
+		484, 415, 418,
+		485, 313, 322,
+		476, 485, 322,
+		477, 325, 423,
+		464, 477, 423,
+		486, 478, 487,
+		488, 486, 487,
+		458, 426, 427,
+		459, 458, 427,
+		489, 490, 491,
+		492, 489, 491,
+		288, 287, 449,
+		278, 288, 449,
+		300, 299, 290,
+		289, 300, 290,
+		493, 310, 313,
+		485, 493, 313,
+		494, 461, 479,
+		495, 494, 479,
+		496, 395, 193,
+		466, 496, 193,
+		491, 201, 200,
+		497, 491, 200,
+		468, 467, 490,
+		489, 468, 490,
+		229, 225, 224,
+		470, 229, 224,
+		473, 472, 471,
+		498, 473, 471,
+		484, 418, 310,
+		493, 484, 310,
+		465, 424, 425,
+		457, 465, 425,
+		393, 346, 342,
+		456, 393, 342,
+		499, 358, 357,
+		392, 499, 357,
+		488, 487, 499,
+		500, 488, 499,
+		435, 378, 438,
+		501, 435, 438,
+		501, 438, 395,
+		496, 501, 395,
+		455, 341, 387,
+		331, 455, 387,
+		497, 200, 187,
+		442, 497, 187,
+		444, 217, 220,
+		445, 444, 220,
+		480, 235, 238,
+		447, 480, 238,
+		448, 247, 250,
+		481, 448, 250,
+		502, 483, 256,
+		255, 502, 256,
+		276, 275, 482,
+		503, 276, 482,
+		329, 328, 318,
+		504, 329, 318,
+		369, 368, 374,
+		436, 369, 374,
+		232, 402, 225,
+		229, 232, 225,
+		256, 408, 403,
+		253, 256, 403,
+		278, 449, 409,
+		275, 278, 409,
+		288, 505, 506,
+		289, 288, 506,
+		300, 507, 508,
+		301, 300, 508,
+		317, 509, 504,
+		318, 317, 504,
+		331, 387, 420,
+		328, 331, 420,
+		392, 357, 346,
+		393, 392, 346,
+		419, 510, 509,
+		317, 419, 509,
+		442, 187, 186,
+		439, 442, 186,
+		301, 508, 510,
+		419, 301, 510,
+		455, 511, 512,
+		456, 455, 512,
+		461, 494, 463,
+		462, 461, 463,
+		439, 186, 383,
+		462, 439, 383,
+		470, 224, 213,
+		467, 470, 213,
+		232, 231, 498,
+		471, 232, 498,
+		253, 403, 243,
+		472, 253, 243,
+		478, 486, 495,
+		479, 478, 495,
+		483, 502, 503,
+		482, 483, 503,
+		478, 434, 362,
+		487, 478, 362,
+		490, 212, 201,
+		491, 490, 201,
+		278, 277, 505,
+		288, 278, 505,
+		289, 506, 507,
+		300, 289, 507,
+		461, 382, 431,
+		479, 461, 431,
+		497, 513, 492,
+		491, 497, 492,
+		467, 213, 212,
+		490, 467, 212,
+		470, 469, 230,
+		229, 470, 230,
+		472, 243, 242,
+		471, 472, 242,
+		456, 512, 394,
+		393, 456, 394,
+		392, 391, 500,
+		499, 392, 500,
+		487, 362, 358,
+		499, 487, 358,
+		331, 330, 511,
+		455, 331, 511,
+		442, 441, 513,
+		497, 442, 513,
+		483, 405, 408,
+		256, 483, 408,
+		275, 409, 412,
+		482, 275, 412,
+		328, 420, 319,
+		318, 328, 319
+	};
+
+}
+
+VR_NAMESPACE_END
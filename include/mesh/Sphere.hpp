@@ -8,22 +8,37 @@ VR_NAMESPACE_BEGIN
 /**
  * \brief Sphere
  *
+ * Spheres of the same radius and tessellation share their vertex data and
+ * one set of buffers, they only differ by their model matrix. The shared
+ * geometry lives as long as one of its spheres.
  */
 class Sphere : public Mesh {
 public:
-	
+
 	Sphere();
 	Sphere(float radius, unsigned int rings, unsigned int sectors, bool invertNormals = false);
-	virtual ~Sphere() = default;
+	virtual ~Sphere();
 	float radius;
 
 	GLuint getVAO() {
 		return vao;
 	}
 
+	/// Reuses the buffers of the first uploaded sphere with the same geometry, shader and vertex format
+	virtual void upload(std::shared_ptr<GLShader> &s);
+
 protected:
 
-	Vector2f getUV(const Vector3f &v);
+	struct Geometry;
+
+	/// Shared geometry of the given sphere, built on first use
+	static std::shared_ptr<Geometry> getGeometry(float radius, unsigned int rings, unsigned int sectors, bool invertNormals);
+
+	static Vector2f getUV(const Vector3f &v);
+
+protected:
+	std::shared_ptr<Geometry> geometry; ///< Vertex data and buffers shared with the other spheres of the same geometry
+	bool sharedBuffers; ///< Whether vao and vbo belong to the geometry
 };
 
 VR_NAMESPACE_END
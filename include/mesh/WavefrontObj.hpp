@@ -2,6 +2,7 @@
 
 #include "common.hpp"
 #include "mesh/Mesh.hpp"
+#include "Trace.hpp"
 #include <unordered_map>
 #include <fstream>
 
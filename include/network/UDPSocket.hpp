@@ -1,11 +1,18 @@
 #pragma once
 
 #include "common.hpp"
+#include <atomic>
+#include <mutex>
 
 VR_NAMESPACE_BEGIN
 
 /**
  * @brief Async UDP operations
+ *
+ * Operations are started from the simulation thread and complete on the
+ * thread running the io_service. A received packet is copied out of the
+ * receive buffer under a mutex, every sent packet owns its buffer until
+ * the send completed.
  */
 class UDPSocket {
 
@@ -37,26 +44,20 @@ public:
 	*/
 	bool hasNewData();
 
-protected:
-
-	/**
-	 * @brief Copies the first 'length' bytes of the string 'content' into the buffer
-	 */
-	void copyToBuffer (const std::string &content, std::size_t length);
-
 	/**
-	 * @brief Copies the string 'content' into the buffer
-	 */
-	std::size_t copyToBuffer (const std::string &content);
+	* @brief Whether no receive is pending, receive() may be called again
+	*/
+	bool isListening() const { return listening; }
 
 private:
 
 	asio::ip::udp::socket socket; ///< UDP socket
-	asio::ip::udp::endpoint endpoint; ///< UDP endpoint
-	int max_length; ///< Max buffer length
-	std::size_t current_length; ///< Length of the data the buffer currently holding
-	char *data; ///< Buffer
+	asio::ip::udp::endpoint sender; ///< Sender of the packet being received
+	std::vector<char> data; ///< Receive buffer, owned by the pending receive
+	std::string received; ///< Last received packet
 	bool bufferChanged; ///< Flag if the buffer holds new data
+	std::mutex mutex; ///< Guards received and bufferChanged
+	std::atomic<bool> listening; ///< No receive is pending
 };
 
 VR_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "common.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Chooses the render resolution from the measured GPU frame times
+ *
+ * The scale applies to both axes of the render targets, which are allocated
+ * at the maximum scale. Frame times are smoothed, the scale drops as soon
+ * as they exceed the budget and only grows again after they stayed well
+ * below it for a while. Each step is bounded and followed by a cool-down
+ * during which samples of frames rendered at the old scale are ignored.
+ * The controller does not touch OpenGL, it can be fed synthetic frame times.
+ */
+class DynamicResolution {
+public:
+
+	/**
+	 * @param budget Frame time to stay below in ms, e.g. 1000 / 75 for the DK2
+	 * @param minScale Lowest scale
+	 * @param maxScale Highest scale
+	 * @param latency Samples which are still in flight after a change, see GPUProfiler
+	 */
+	DynamicResolution(float budget, float minScale = 0.5f, float maxScale = 1.f, int latency = 4);
+
+	/**
+	 * @brief Feed the GPU time of one frame in ms
+	 *
+	 * @return Scale for the next frame
+	 */
+	float update(float frameTime);
+
+	/// Back to the maximum scale, e.g. after loading another model
+	void reset();
+
+	/// Current scale within [minScale, maxScale]
+	float getScale() const { return scale; }
+
+	/// Smoothed frame time in ms
+	float getFrameTime() const { return filtered; }
+
+	/// Number of scale changes so far
+	int getChanges() const { return changes; }
+
+	/// Scale a full size in pixels, at least one pixel per axis
+	Vector2i viewport(const Vector2i &size) const {
+		return Vector2i(std::max(1, int(size.x() * scale + 0.5f)), std::max(1, int(size.y() * scale + 0.5f)));
+	}
+
+	/// Brief info about the controller
+	std::string info() const {
+		return
+			"DynamicResolution[\n"
+			"  budget = " + std::to_string(budget) + " ms,\n"
+			"  scale = " + std::to_string(scale) + " in [" + std::to_string(minScale) + ", " + std::to_string(maxScale) + "],\n"
+			"  frameTime = " + std::to_string(filtered) + " ms,\n"
+			"  changes = " + std::to_string(changes) + "\n"
+			"]";
+	}
+
+protected:
+	float budget; ///< Frame time budget in ms
+	float minScale, maxScale; ///< Bounds of the scale
+	int latency; ///< Samples ignored after a change
+	float scale; ///< Current scale
+	float filtered; ///< Smoothed frame time in ms, 0 without samples
+	int cooldown; ///< Samples left to ignore
+	int settled; ///< Consecutive samples below the headroom
+	int changes; ///< Number of scale changes
+};
+
+VR_NAMESPACE_END
@@ -1,8 +1,9 @@
 #pragma once
 
 #include "common.hpp"
-#include "hdrloader.h"
+#include "HDRTexture.hpp"
 #include "renderer/Renderer.hpp"
+#include "renderer/RenderQueue.hpp"
 #include "mesh/Sphere.hpp"
 #include "mesh/Environment.hpp"
 #include "GLUtil.hpp"
@@ -98,11 +99,12 @@ protected:
 	Vector3f &headsUp; ///< Camera heads up
 	Vector3f &lightIntensity; ///< Light intensity
 	Environment GISphere; /// Fake Global Illumination sphere
-	std::shared_ptr<float> environment; /// Map
-	std::shared_ptr<float> environmentDiffuse; /// Diffuse map
 	GLuint envTexture; /// OpenGL Texture handles
-	GLuint envDiffuseTexture; /// OpenGL Texture handles
 	Cube pedestal; /// Anchor point for model
+	RenderQueue queue; ///< Draw commands of the current pass
+	bool bboxDisplay; ///< The bounding box is drawn while it fades in or out
+	float bboxAlpha; ///< Alpha of the bounding box
+	float pedestalAlpha; ///< Alpha of the pedestal, fades out when the model or a hand gets close
 };
 
 VR_NAMESPACE_END
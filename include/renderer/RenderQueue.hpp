@@ -0,0 +1,112 @@
+#pragma once
+
+#include "common.hpp"
+#include "GLUtil.hpp"
+#include "mesh/Mesh.hpp"
+#include <functional>
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Per pass list of draw commands
+ *
+ * Passes submit commands with the pipeline state and the material they
+ * need instead of changing the GL state themselves. The queue sorts the
+ * commands and issues them, only state which differs from the previous
+ * command is set. Opaque commands are sorted by shader variant, raster
+ * state, texture and material, translucent ones keep their submission
+ * order because they are blended.
+ */
+class RenderQueue {
+public:
+
+	/// Buckets drawn one after the other, the order within a bucket depends on the bucket
+	enum Layer {
+		EOpaque = 0, ///< Sorted by state
+		EBackground, ///< Sorted by state, drawn behind the opaque geometry such that the depth test rejects most of it
+		ETranslucent ///< Blended, submission order
+	};
+
+	/**
+	 * @brief Pipeline state of a command
+	 */
+	struct State {
+		uint32_t features; ///< Shader feature bitmask
+		GLenum cullFace; ///< Culled faces, GL_NONE disables face culling
+		GLenum polygonMode; ///< GL_FILL or GL_LINE
+		GLuint cubeMap; ///< Cube map on texture unit 0, 0 keeps the bound one
+
+		State(uint32_t f = 0, GLenum c = GL_BACK, GLenum p = GL_FILL, GLuint t = 0)
+			: features(f), cullFace(c), polygonMode(p), cubeMap(t) { }
+	};
+
+	/**
+	 * @brief Uniforms of a command
+	 */
+	struct Material {
+		Vector3f color; ///< materialColor
+		float alpha; ///< alpha
+		float ambient; ///< light.ambientCoefficient
+
+		Material(const Vector3f &c = Vector3f(0.8f, 0.8f, 0.8f), float a = 1.f, float am = 0.03f)
+			: color(c), alpha(a), ambient(am) { }
+
+		bool operator==(const Material &m) const { return color == m.color && alpha == m.alpha && ambient == m.ambient; }
+	};
+
+	/**
+	 * @brief Draw a mesh, the mesh only sets its matrices and must not change the material
+	 *
+	 * @param pass Profiler pass the draw is timed in, a string literal
+	 */
+	void submit(Layer layer, const char *pass, const State &state, const Material &material, Mesh &mesh, const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix);
+
+	/**
+	 * @brief Draw with a callback which may change the features and uniforms of the shader
+	 */
+	void submit(Layer layer, const char *pass, const State &state, const Material &material, const std::function<void()> &draw);
+
+	/**
+	 * @brief Sort and issue all commands, then clear the queue
+	 *
+	 * Face culling, filled polygons and the feature bitmask of the shader are
+	 * back at their defaults afterwards.
+	 */
+	void execute(GLShader &shader);
+
+	/// Number of queued commands
+	size_t size() const { return commands.size(); }
+
+protected:
+
+	/**
+	 * @brief Queued command
+	 */
+	struct Command {
+		uint64_t key; ///< Layer, state and material, then submission order
+		const char *pass; ///< Profiler pass
+		State state; ///< Pipeline state
+		size_t material; ///< Index into materials
+		Mesh *mesh; ///< Mesh to draw or nullptr
+		const Matrix4f *viewMatrix, *projectionMatrix; ///< Matrices of the mesh, owned by the renderer
+		std::function<void()> draw; ///< Callback if there is no mesh
+	};
+
+	/// Append a command and compute its sort key
+	Command &push(Layer layer, const char *pass, const State &state, const Material &material);
+
+	/// Index of a value in a table of distinct values, appended if missing
+	template <typename T> static size_t indexOf(std::vector<T> &table, const T &value) {
+		size_t i = std::find(table.begin(), table.end(), value) - table.begin();
+		if (i == table.size())
+			table.push_back(value);
+		return i;
+	}
+
+protected:
+	std::vector<Command> commands; ///< Commands of the current pass
+	std::vector<Material> materials; ///< Distinct materials of the current pass
+	std::vector<GLuint> textures; ///< Distinct cube maps of the current pass
+};
+
+VR_NAMESPACE_END
@@ -2,10 +2,13 @@
 
 #include "common.hpp"
 #include "GLUtil.hpp"
+#include "GPUProfiler.hpp"
+#include "Trace.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Pin.hpp"
 #include "Leap.h"
 #include "leap/SkeletonHand.hpp"
+#include "Simulation.hpp"
 
 VR_NAMESPACE_BEGIN
 
@@ -60,6 +63,38 @@ public:
 	 */
 	virtual void preProcess () {}
 
+	/**
+	 * @brief Starts a frame, called after all waits of the frame right before the input is sampled
+	 *
+	 * Renderers driving a HMD latch the head pose of the frame here.
+	 *
+	 * @return Time the input of the frame is sampled at in seconds, see Renderer::now()
+	 */
+	virtual double beginFrame () {
+		return now();
+	}
+
+	/**
+	 * @brief Shows the drawn frame, called after Renderer::draw()
+	 */
+	virtual void present () {
+		glfwSwapBuffers(window);
+	}
+
+	/**
+	 * @return Current time in seconds on the clock of the input timestamps
+	 */
+	virtual double now () const {
+		return glfwGetTime();
+	}
+
+	/**
+	 * @return Head pose latched by Renderer::beginFrame() or nullptr without HMD
+	 */
+	virtual const ovrPosef *getHeadPose () const {
+		return nullptr;
+	}
+
 	/**
 	 * @brief Updates the state
 	 *
@@ -204,6 +239,13 @@ public:
 		frame = f;
 	}
 
+	/**
+	* @brief Sets the visual feedback of the gestures of the drawn simulation step
+	*/
+	void setGestures(const GestureFeedback &g) {
+		gestures = g;
+	}
+
 	/*
 	* @brief Upload a pin to the graphics card
 	*/
@@ -227,6 +269,7 @@ protected:
 	Vector3f sphereCenter; ///< Sphere center
 	float sphereRadius, sphereRadius_large, sphereRadius_small; ///< Sphere radius
 	Leap::Frame frame; ///< Leap motion frame
+	GestureFeedback gestures; ///< Rotation sphere, bounding box and finger colors
 	std::vector<std::shared_ptr<Pin>> *pinList = nullptr; ///< List of pins
 
 private:
@@ -2,6 +2,7 @@
 
 #include "common.hpp"
 #include "renderer/PerspectiveRenderer.hpp"
+#include "renderer/DynamicResolution.hpp"
 #include "OVR_Math.h"
 #include "OVR_CAPI_GL.h"
 #include "GLUtil.hpp"
@@ -40,6 +41,30 @@ public:
 	 */
 	virtual void clear (Vector3f background);
 
+	/**
+	 * @brief Begins the distortion frame and latches the eye and head poses
+	 */
+	virtual double beginFrame ();
+
+	/**
+	 * @brief Ends the distortion frame, the SDK distorts the eye textures and swaps
+	 */
+	virtual void present ();
+
+	/**
+	 * @return Current time in seconds on the clock of the SDK
+	 */
+	virtual double now () const {
+		return ovr_GetTimeInSeconds();
+	}
+
+	/**
+	 * @return Predicted head pose at the scanout of the frame
+	 */
+	virtual const ovrPosef *getHeadPose () const {
+		return &trackingState.HeadPose.ThePose;
+	}
+
 	/**
 	 * @brief Updates the state
 	 *
@@ -76,6 +101,7 @@ public:
 			"  zFar = "+std::to_string(zFar)+",\n"
 			"  Frustum Width = "+std::to_string(fH)+",\n"
 			"  Frustum Height = "+std::to_string(fW)+",\n"
+			"  Resolution scale = "+std::to_string(resolution.getScale())+",\n"
 			"  OVR[\n"
 			"    Type = "+hmd->ProductName+"\n"
 			"  ]\n"
@@ -101,6 +127,12 @@ protected:
 	*/
 	virtual void drawOnCube(ovrEyeType eye);
 
+	/**
+	* @brief Streams a camera image through the ping-pong PBOs of the camera and uploads
+	* its distortion map if the calibration changed
+	*/
+	virtual void uploadLeapImage(int camera, const Leap::Image &image);
+
 protected:
 
 	GLFramebuffer frameBuffer[2]; ///< The framebuffer which we draw to with the rift for the left and right eye
@@ -109,12 +141,22 @@ protected:
 	ovrGLTexture eyeTexture[2]; ///< OVR textures for distortion rendering
 	OVR::Matrix4f rollPitchYaw; /// HEad pose
 	OVR::Vector3f camPosition; /// OVR cam pos
+	ovrPosef eyeRenderPose[2]; ///< Eye poses latched for the current frame
+	ovrTrackingState trackingState; ///< Tracking state the eye poses were derived from
+	DynamicResolution resolution; ///< Pixel density of the eye viewports, 1 is the native density
+	Vector2i eyeSize[2]; ///< Eye viewports at pixel density 1
+	uint64_t resolutionSamples; ///< GPU frame samples fed into the resolution controller
 	
 	/**
 	* Leap passthrough
 	*/
 	GLuint leapVAO, leapV_VBO, leapUV_VBO, leapF_VBO; ///< Background cube
-	GLuint leap_PBO[2][2][2]; ///< Pixel buffer objects
+	GLuint leapPBO[2][2]; ///< Ping-pong pixel buffer objects per camera
+	int leapPBOIndex; ///< PBO written during this frame, the other one is copied into the texture
+	bool leapPBOFilled[2]; ///< Whether the PBO written during the last frame holds an image
+	Vector2i leapImageSize[2]; ///< Size of the raw textures and PBOs per camera
+	int64_t leapFrameId; ///< Id of the last uploaded Leap frame
+	std::vector<float> leapDistortion[2]; ///< Last uploaded calibration map per camera
 	std::shared_ptr<GLShader> leapShader; ///< Leap passthrough shader
 	GLuint leapRawTexture[2]; ///< Distorted passthrough textures
 	GLuint leapDistortionTexture[2];///< Passthrough textures
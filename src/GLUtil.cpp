@@ -1,9 +1,48 @@
 #include "GLUtil.hpp"
 #include <iostream>
 #include <fstream>
+#include <cstring>
+#include <cctype>
+#include <chrono>
+#include <iomanip>
 
 VR_NAMESPACE_BEGIN
 
+GLuint GLShader::sCurrentProgram = 0;
+GLShader::CompileStats GLShader::sStats;
+
+static bool hasExtension(const char *name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const char *ext = (const char *) glGetStringi(GL_EXTENSIONS, i);
+        if (ext && strcmp(ext, name) == 0)
+            return true;
+    }
+    return false;
+}
+
+std::string GLShader::CompileStats::toString() const {
+    return VR_NS::toString(compiled) + " compiled (" + VR_NS::toString(compileTime) + " ms), " +
+        VR_NS::toString(cached) + " from cache (" + VR_NS::toString(cacheTime) + " ms)";
+}
+
+static double millisecondsSince(const std::chrono::high_resolution_clock::time_point &start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/// File header of a cached program binary
+struct ProgramBinaryHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;
+    uint32_t length;
+};
+
+static const char ProgramBinaryMagic[4] = { 'V', 'R', 'P', 'B' };
+static const uint32_t ProgramBinaryVersion = 1;
+
 static GLuint createShader_helper(GLint type, const std::string &defines, std::string shader_string) {
     if (shader_string.empty())
         return (GLuint) 0;
@@ -70,53 +109,320 @@ bool GLShader::init(const std::string &name,
                     const std::string &vertex_str,
                     const std::string &fragment_str,
                     const std::string &geometry_str) {
+    glGenVertexArrays(1, &mVertexArrayObject);
+
+    mName = name;
+    mVertexSource = vertex_str;
+    mFragmentSource = fragment_str;
+    mGeometrySource = geometry_str;
+
+    return selectVariant(mFeatures);
+}
+
+bool GLShader::selectVariant(uint32_t features) {
+    auto it = mVariants.find(features);
+    if (it == mVariants.end()) {
+        Variant variant;
+        if (!compileVariant(features, variant))
+            return false;
+        variant.locations.resize(mUniforms.size(), UNKNOWN_LOCATION);
+        variant.synced.resize(mUniforms.size(), 0);
+        it = mVariants.insert(std::make_pair(features, variant)).first;
+    }
+
+    Variant &variant = it->second;
+    mVariant = &variant;
+    mVariantFeatures = features;
+    mProgramShader = variant.program;
+    mVertexShader = variant.vertexShader;
+    mFragmentShader = variant.fragmentShader;
+    mGeometryShader = variant.geometryShader;
+    return true;
+}
+
+bool GLShader::compileVariant(uint32_t features, Variant &variant) {
     std::string defines;
     for (auto def : mDefinitions)
         defines += std::string("#define ") + def.first + std::string(" ") + def.second + "\n";
+    for (size_t i = 0; i < mFeatureNames.size(); ++i)
+        if (features & (1u << i))
+            defines += std::string("#define ") + mFeatureNames[i] + " 1\n";
+
+    // Key: everything which influences the binary, including the driver
+    bool geometry = (features & mGeometryFeatures) != 0 || mGeometryFeatures == ~0u;
+    uint64_t key = fnv1a(defines);
+    key = fnv1a(mVertexSource, key);
+    key = fnv1a(geometry ? mGeometrySource : std::string(), key);
+    key = fnv1a(mFragmentSource, key);
+    for (auto &binding : mAttribBindings)
+        key = fnv1a(binding.first + "=" + std::to_string(binding.second) + ";", key);
+    key = fnv1a(driverString(), key);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    if (loadProgramBinary(key, variant)) {
+        sStats.cached++;
+        sStats.cacheTime += millisecondsSince(start);
+        return true;
+    }
 
-    glGenVertexArrays(1, &mVertexArrayObject);
+    variant.vertexShader =
+        createShader_helper(GL_VERTEX_SHADER, defines, mVertexSource);
+    variant.geometryShader =
+        geometry ? createShader_helper(GL_GEOMETRY_SHADER, defines, mGeometrySource) : 0;
+    variant.fragmentShader =
+        createShader_helper(GL_FRAGMENT_SHADER, defines, mFragmentSource);
 
-    mName = name;
-    mVertexShader =
-        createShader_helper(GL_VERTEX_SHADER, defines, vertex_str);
-    mGeometryShader =
-        createShader_helper(GL_GEOMETRY_SHADER, defines, geometry_str);
-    mFragmentShader =
-        createShader_helper(GL_FRAGMENT_SHADER, defines, fragment_str);
-
-    if (!mVertexShader || !mFragmentShader)
+    if (!variant.vertexShader || !variant.fragmentShader)
         return false;
 
-    mProgramShader = glCreateProgram();
+    variant.program = glCreateProgram();
+
+    glAttachShader(variant.program, variant.vertexShader);
+    glAttachShader(variant.program, variant.fragmentShader);
 
-    glAttachShader(mProgramShader, mVertexShader);
-    glAttachShader(mProgramShader, mFragmentShader);
+    if (variant.geometryShader)
+        glAttachShader(variant.program, variant.geometryShader);
 
-    if (mGeometryShader)
-        glAttachShader(mProgramShader, mGeometryShader);
+    // Identical attribute locations in all variants, such that they can share vertex arrays
+    for (auto &binding : mAttribBindings)
+        glBindAttribLocation(variant.program, binding.second, binding.first.c_str());
 
-    glLinkProgram(mProgramShader);
+    bool cacheable = binaryCacheSupported();
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+    if (cacheable)
+        glProgramParameteri(variant.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(variant.program);
 
     GLint status;
-    glGetProgramiv(mProgramShader, GL_LINK_STATUS, &status);
+    glGetProgramiv(variant.program, GL_LINK_STATUS, &status);
 
     if (status != GL_TRUE) {
         char buffer[512];
-        glGetProgramInfoLog(mProgramShader, 512, nullptr, buffer);
+        glGetProgramInfoLog(variant.program, 512, nullptr, buffer);
         std::cerr << "Linker error: " << std::endl << buffer << std::endl;
-        mProgramShader = 0;
         throw std::runtime_error("Shader linking failed!");
     }
 
+    sStats.compiled++;
+    sStats.compileTime += millisecondsSince(start);
+
+    if (cacheable)
+        storeProgramBinary(key, variant);
+
     return true;
 }
 
+std::string GLShader::driverString() {
+    auto str = [](GLenum name) {
+        const char *s = (const char *) glGetString(name);
+        return std::string(s ? s : "");
+    };
+    return str(GL_VENDOR) + "|" + str(GL_RENDERER) + "|" + str(GL_VERSION);
+}
+
+bool GLShader::binaryCacheSupported() {
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+    static int supported = -1;
+    if (supported < 0) {
+        GLint major = 0, minor = 0, formats = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        bool api = major > 4 || (major == 4 && minor >= 1) || hasExtension("GL_ARB_get_program_binary");
+        if (api)
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        supported = api && formats > 0 ? 1 : 0;
+    }
+    return supported == 1 && !Settings::getInstance().SHADER_CACHE_DIR.empty();
+#else
+    return false;
+#endif
+}
+
+std::string GLShader::binaryCacheFile(uint64_t key) {
+    std::ostringstream oss;
+    oss << Settings::getInstance().SHADER_CACHE_DIR << "/" << std::hex << std::setw(16) << std::setfill('0') << key << ".glbin";
+    return oss.str();
+}
+
+bool GLShader::loadProgramBinary(uint64_t key, Variant &variant) {
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+    if (!binaryCacheSupported())
+        return false;
+
+    std::ifstream file(binaryCacheFile(key), std::ios::binary);
+    if (!file)
+        return false;
+
+    ProgramBinaryHeader header;
+    if (!file.read((char *) &header, sizeof(header)) ||
+        memcmp(header.magic, ProgramBinaryMagic, sizeof(ProgramBinaryMagic)) != 0 ||
+        header.version != ProgramBinaryVersion || header.key != key || header.length == 0)
+        return false;
+
+    std::vector<char> binary(header.length);
+    if (!file.read(binary.data(), header.length))
+        return false;
+
+    // The driver rejects binaries of other versions, fall back to compiling from source
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, (GLenum) header.format, binary.data(), (GLsizei) header.length);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        glDeleteProgram(program);
+        return false;
+    }
+
+    variant.program = program;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void GLShader::storeProgramBinary(uint64_t key, const Variant &variant) {
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+    GLint length = 0;
+    glGetProgramiv(variant.program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(variant.program, length, &length, &format, binary.data());
+    if (length <= 0)
+        return;
+
+    ProgramBinaryHeader header;
+    memcpy(header.magic, ProgramBinaryMagic, sizeof(ProgramBinaryMagic));
+    header.version = ProgramBinaryVersion;
+    header.key = key;
+    header.format = (uint32_t) format;
+    header.length = (uint32_t) length;
+
+    // A missing or read-only cache directory just disables caching
+    std::ofstream file(binaryCacheFile(key), std::ios::binary | std::ios::trunc);
+    if (file) {
+        file.write((const char *) &header, sizeof(header));
+        file.write(binary.data(), length);
+    }
+#endif
+}
+
+void GLShader::declareFeatures(const std::vector<std::string> &names) {
+    if (names.size() > 32)
+        throw std::runtime_error(mName + ": at most 32 shader features are supported");
+    mFeatureNames = names;
+}
+
 void GLShader::bind() {
+    if (mFeatures != mVariantFeatures)
+        selectVariant(mFeatures);
+
+    // Uniforms of the program in use are uploaded as they are set, nothing is left to do
+    if (sCurrentProgram == mProgramShader && mProgramShader != 0)
+        return;
+
     glUseProgram(mProgramShader);
     glBindVertexArray(mVertexArrayObject);
+    sCurrentProgram = mProgramShader;
+
+    // Upload uniform values which were set while another variant was active
+    if (mVariant) {
+        for (size_t i = 0; i < mUniforms.size(); ++i)
+            if (mVariant->synced[i] != mUniforms[i].serial)
+                uploadUniform(i, false);
+    }
+}
+
+void GLShader::unbind() {
+    glUseProgram(0);
+    sCurrentProgram = 0;
+}
+
+void GLShader::setUniformValue(const std::string &name, GLenum type, const void *data,
+                               size_t size, GLsizei count, bool warn) {
+    size_t index;
+    auto it = mUniformIndices.find(name);
+    if (it == mUniformIndices.end()) {
+        index = mUniforms.size();
+        mUniformIndices[name] = index;
+        mUniforms.push_back(UniformValue());
+        mUniforms.back().name = name;
+        for (auto &variant : mVariants) {
+            variant.second.locations.push_back(UNKNOWN_LOCATION);
+            variant.second.synced.push_back(0);
+        }
+    } else {
+        index = it->second;
+    }
+
+    UniformValue &value = mUniforms[index];
+    if (value.type == type && value.count == count && value.data.size() == size &&
+        std::memcmp(value.data.data(), data, size) == 0)
+        return;
+
+    value.type = type;
+    value.count = count;
+    value.serial = ++mSerial;
+    value.data.assign((const uint8_t *) data, (const uint8_t *) data + size);
+
+    // Values are applied lazily on the next bind if this program is not in use
+    if (mVariant && sCurrentProgram == mProgramShader && mProgramShader != 0)
+        uploadUniform(index, warn);
+}
+
+void GLShader::uploadUniform(size_t index, bool warn) {
+    UniformValue &value = mUniforms[index];
+    GLint &location = mVariant->locations[index];
+    mVariant->synced[index] = value.serial;
+
+    if (location == UNKNOWN_LOCATION) {
+        location = glGetUniformLocation(mProgramShader, value.name.c_str());
+
+        // Variants may legitimately optimize uniforms away, but not ones no variant declares
+        if (location == -1 && warn && !value.checked) {
+            value.checked = true;
+            if (mFeatureNames.empty() || !inSources(value.name.substr(0, value.name.find_first_of(".["))))
+                std::cerr << mName << ": warning: did not find uniform " << value.name << std::endl;
+        }
+    }
+
+    if (location == -1)
+        return;
+
+    const float *f = (const float *) value.data.data();
+    switch (value.type) {
+        case GL_FLOAT_MAT4: glUniformMatrix4fv(location, value.count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3: glUniformMatrix3fv(location, value.count, GL_FALSE, f); break;
+        case GL_FLOAT_VEC4: glUniform4fv(location, value.count, f); break;
+        case GL_FLOAT_VEC3: glUniform3fv(location, value.count, f); break;
+        case GL_FLOAT_VEC2: glUniform2fv(location, value.count, f); break;
+        case GL_FLOAT: glUniform1fv(location, value.count, f); break;
+        case GL_INT: glUniform1iv(location, value.count, (const GLint *) value.data.data()); break;
+    }
+}
+
+bool GLShader::inSources(const std::string &name) const {
+    auto word = [](char c) { return std::isalnum((unsigned char) c) || c == '_'; };
+    for (const std::string *source : { &mVertexSource, &mGeometrySource, &mFragmentSource }) {
+        for (size_t i = source->find(name); i != std::string::npos; i = source->find(name, i + 1)) {
+            size_t end = i + name.size();
+            if ((i == 0 || !word((*source)[i - 1])) && (end == source->size() || !word((*source)[end])))
+                return true;
+        }
+    }
+    return false;
 }
 
 GLint GLShader::attrib(const std::string &name, bool warn) const {
+    auto it = mAttribBindings.find(name);
+    if (it != mAttribBindings.end())
+        return it->second;
+
     GLint id = glGetAttribLocation(mProgramShader, name.c_str());
     if (id == -1 && warn)
         std::cerr << mName << ": warning: did not find attrib " << name << std::endl;
@@ -257,22 +563,23 @@ void GLShader::free() {
     if (mVertexArrayObject)
         glDeleteVertexArrays(1, &mVertexArrayObject);
 
-    if (mProgramShader) {
-        glDeleteProgram(mProgramShader);
-        mProgramShader = 0;
-    }
-    if (mVertexShader) {
-        glDeleteShader(mVertexShader);
-        mVertexShader = 0;
-    }
-    if (mFragmentShader) {
-        glDeleteShader(mFragmentShader);
-        mFragmentShader = 0;
-    }
-    if (mGeometryShader) {
-        glDeleteShader(mGeometryShader);
-        mGeometryShader = 0;
+    for (auto &it : mVariants) {
+        Variant &variant = it.second;
+        if (variant.program == sCurrentProgram)
+            sCurrentProgram = 0;
+        if (variant.program)
+            glDeleteProgram(variant.program);
+        if (variant.vertexShader)
+            glDeleteShader(variant.vertexShader);
+        if (variant.fragmentShader)
+            glDeleteShader(variant.fragmentShader);
+        if (variant.geometryShader)
+            glDeleteShader(variant.geometryShader);
     }
+
+    mVariants.clear();
+    mVariant = nullptr;
+    mProgramShader = mVertexShader = mFragmentShader = mGeometryShader = 0;
 }
 
 void GLFramebuffer::init(const Vector2i &size, int nSamples, bool nUseTexture = false) {
@@ -395,6 +702,130 @@ void GLFramebuffer::blit(int ox, int oy) {
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+void GLStreamBuffer::init(GLsizeiptr segmentSize) {
+	allocate(segmentSize);
+	mSegment = 0;
+	mHead = 0;
+	mFrameBytes = mLastFrameBytes = 0;
+}
+
+void GLStreamBuffer::allocate(GLsizeiptr segmentSize) {
+	free();
+
+	mSegmentSize = segmentSize;
+	GLsizeiptr total = mSegmentSize * Segments;
+
+	glGenBuffers(1, &mBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+
+#if defined(GL_MAP_PERSISTENT_BIT)
+	// Immutable storage which stays mapped for the whole lifetime of the buffer
+	if (hasExtension("GL_ARB_buffer_storage")) {
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_ARRAY_BUFFER, total, nullptr, flags);
+		mMapped = (uint8_t *) glMapBufferRange(GL_ARRAY_BUFFER, 0, total, flags);
+
+		// Immutable storage can not be respecified, start over with a fresh buffer
+		if (!mMapped) {
+			glDeleteBuffers(1, &mBuffer);
+			glGenBuffers(1, &mBuffer);
+			glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+		}
+	}
+#endif
+
+	if (!mMapped)
+		glBufferData(GL_ARRAY_BUFFER, total, nullptr, GL_STREAM_DRAW);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	mHead = 0;
+}
+
+void GLStreamBuffer::free() {
+	for (int i = 0; i < Segments; i++) {
+		if (mFences[i])
+			glDeleteSync(mFences[i]);
+		mFences[i] = 0;
+	}
+
+	if (mBuffer) {
+		if (mMapped) {
+			glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+		glDeleteBuffers(1, &mBuffer);
+	}
+
+	mBuffer = 0;
+	mMapped = nullptr;
+}
+
+void GLStreamBuffer::beginFrame() {
+	mSegment = (mSegment + 1) % Segments;
+	mHead = 0;
+	mFrameBytes = 0;
+
+	if (!mMapped) {
+		// Orphan the storage once the ring wraps around, the driver keeps the old one alive for pending draws
+		if (mSegment == 0) {
+			glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+			glBufferData(GL_ARRAY_BUFFER, mSegmentSize * Segments, nullptr, GL_STREAM_DRAW);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+		return;
+	}
+
+	// Wait until the GPU consumed the segment written three frames ago
+	GLsync &fence = mFences[mSegment];
+	if (fence) {
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		while (result == GL_TIMEOUT_EXPIRED)
+			result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		glDeleteSync(fence);
+		fence = 0;
+	}
+}
+
+void GLStreamBuffer::endFrame() {
+	if (mMapped) {
+		if (mFences[mSegment])
+			glDeleteSync(mFences[mSegment]);
+		mFences[mSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	mLastFrameBytes = mFrameBytes;
+}
+
+GLintptr GLStreamBuffer::write(const void *data, GLsizeiptr size, GLsizeiptr alignment) {
+	GLsizeiptr aligned = (mHead + alignment - 1) / alignment * alignment;
+
+	// Segment exhausted: grow the ring, draws issued so far keep the old buffer alive
+	if (aligned + size > mSegmentSize) {
+		std::cerr << "Stream buffer segment of " << mSegmentSize << " bytes exhausted, growing" << std::endl;
+		allocate(std::max(mSegmentSize * 2, size * 2));
+		aligned = 0;
+	}
+
+	GLintptr offset = mSegment * mSegmentSize + aligned;
+	if (mMapped) {
+		memcpy(mMapped + offset, data, size);
+	} else {
+		// The range has not been touched since the last orphaning, no need to synchronize
+		glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+		void *ptr = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (ptr) {
+			memcpy(ptr, data, size);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	mHead = aligned + size;
+	mFrameBytes += size;
+	return offset;
+}
+
 Eigen::Vector3f project(const Eigen::Vector3f &obj,
                         const Eigen::Matrix4f &model,
                         const Eigen::Matrix4f &proj,
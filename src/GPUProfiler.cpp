@@ -0,0 +1,365 @@
+#include "GPUProfiler.hpp"
+#include <iomanip>
+
+VR_NAMESPACE_BEGIN
+
+void GPUProfiler::init() {
+	for (int i = 0; i < Latency; i++) {
+		glGenQueries(2, mSlots[i].timestamps);
+		mSlots[i].pending = false;
+	}
+
+	mSeries.clear();
+	mPassIndices.clear();
+	mSeries.push_back(Series());
+	mSeries[0].name = "frame";
+	mCounters.clear();
+	mCounterSums.clear();
+	mLatencies.clear();
+
+	mFrame = 0;
+	mMeasured = 0;
+	mLatestPasses = 0.f;
+	mActive = -1;
+	mInFrame = false;
+	mReady = true;
+}
+
+void GPUProfiler::free() {
+	if (!mReady)
+		return;
+
+	for (int i = 0; i < Latency; i++) {
+		FrameSlot &slot = mSlots[i];
+		glDeleteQueries(2, slot.timestamps);
+		if (!slot.queries.empty())
+			glDeleteQueries((GLsizei) slot.queries.size(), slot.queries.data());
+		slot.queries.clear();
+		slot.passes.clear();
+		slot.pending = false;
+	}
+
+	mReady = false;
+}
+
+void GPUProfiler::beginFrame() {
+	if (!mReady)
+		return;
+
+	// The GPU had Latency frames time to finish this slot
+	int slot = int(mFrame % Latency);
+	if (mSlots[slot].pending)
+		collect(slot);
+
+	mSlots[slot].passes.clear();
+	mSlots[slot].pending = true;
+	glQueryCounter(mSlots[slot].timestamps[0], GL_TIMESTAMP);
+	mInFrame = true;
+}
+
+void GPUProfiler::endFrame() {
+	if (!mInFrame)
+		return;
+
+	// Counters are known on the CPU right away
+	for (size_t i = 0; i < mCounters.size(); i++) {
+		std::pair<double, double> &sum = mCounterSums[i];
+		if (sum.second > 0.0)
+			push(mCounters[i], float(100.0 * sum.first / sum.second));
+		sum = std::make_pair(0.0, 0.0);
+	}
+
+	end();
+	glQueryCounter(mSlots[mFrame % Latency].timestamps[1], GL_TIMESTAMP);
+	mInFrame = false;
+	mFrame++;
+}
+
+void GPUProfiler::flush() {
+	if (!mReady)
+		return;
+
+	// Oldest slot first
+	for (int i = 0; i < Latency; i++) {
+		int slot = int((mFrame + i) % Latency);
+		if (mSlots[slot].pending && !(mInFrame && slot == int(mFrame % Latency)))
+			collect(slot);
+	}
+}
+
+void GPUProfiler::reset() {
+	for (Series &series : mSeries) {
+		series.samples.clear();
+		series.head = 0;
+	}
+	for (Series &series : mCounters) {
+		series.samples.clear();
+		series.head = 0;
+	}
+	for (Series &series : mLatencies) {
+		series.samples.clear();
+		series.head = 0;
+	}
+}
+
+void GPUProfiler::count(const std::string &counter, double part, double total) {
+	if (!mInFrame)
+		return;
+
+	size_t i = 0;
+	while (i < mCounters.size() && mCounters[i].name != counter)
+		i++;
+	if (i == mCounters.size()) {
+		mCounters.push_back(Series());
+		mCounters.back().name = counter;
+		mCounterSums.push_back(std::make_pair(0.0, 0.0));
+	}
+
+	mCounterSums[i].first += part;
+	mCounterSums[i].second += total;
+}
+
+void GPUProfiler::latency(const std::string &name, float ms) {
+	if (!mReady)
+		return;
+
+	size_t i = 0;
+	while (i < mLatencies.size() && mLatencies[i].name != name)
+		i++;
+	if (i == mLatencies.size()) {
+		mLatencies.push_back(Series());
+		mLatencies.back().name = name;
+	}
+
+	push(mLatencies[i], ms);
+}
+
+void GPUProfiler::begin(const std::string &pass) {
+	if (!mInFrame)
+		return;
+
+	// Only one GL_TIME_ELAPSED query can be active at a time
+	end();
+
+	FrameSlot &slot = mSlots[mFrame % Latency];
+	if (slot.passes.size() == slot.queries.size()) {
+		GLuint query;
+		glGenQueries(1, &query);
+		slot.queries.push_back(query);
+	}
+
+	mActive = int(passIndex(pass));
+	glBeginQuery(GL_TIME_ELAPSED, slot.queries[slot.passes.size()]);
+	slot.passes.push_back(size_t(mActive));
+}
+
+void GPUProfiler::end() {
+	if (mActive < 0)
+		return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	mActive = -1;
+}
+
+size_t GPUProfiler::passIndex(const std::string &pass) {
+	auto it = mPassIndices.find(pass);
+	if (it != mPassIndices.end())
+		return it->second;
+
+	mSeries.push_back(Series());
+	mSeries.back().name = pass;
+	mPassIndices[pass] = mSeries.size() - 1;
+	return mSeries.size() - 1;
+}
+
+void GPUProfiler::push(Series &series, float sample) {
+	if (series.samples.size() < Window)
+		series.samples.push_back(sample);
+	else
+		series.samples[series.head % Window] = sample;
+	series.head++;
+}
+
+void GPUProfiler::collect(int index) {
+	FrameSlot &slot = mSlots[index];
+	slot.pending = false;
+
+	// Queries complete in order, never wait for a late frame but drop it
+	GLint available = 0;
+	glGetQueryObjectiv(slot.timestamps[1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available)
+		return;
+
+	GLuint64 begin = 0, end = 0;
+	glGetQueryObjectui64v(slot.timestamps[0], GL_QUERY_RESULT, &begin);
+	glGetQueryObjectui64v(slot.timestamps[1], GL_QUERY_RESULT, &end);
+	push(mSeries[0], float(double(end - begin) * 1e-6));
+
+	// Sum passes which were issued more than once (e.g. per eye)
+	std::vector<double> sums(mSeries.size(), -1.0);
+	for (size_t i = 0; i < slot.passes.size(); i++) {
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &elapsed);
+		double &sum = sums[slot.passes[i]];
+		sum = std::max(sum, 0.0) + double(elapsed) * 1e-6;
+	}
+
+	double total = 0.0;
+	for (size_t i = 1; i < sums.size(); i++) {
+		if (sums[i] >= 0.0) {
+			push(mSeries[i], float(sums[i]));
+			total += sums[i];
+		}
+	}
+	mLatestPasses = float(total);
+	mMeasured++;
+}
+
+GPUProfiler::Stats GPUProfiler::computeStats(const std::string &name, const std::vector<float> &samples, size_t head) {
+	Stats stats;
+	stats.name = name;
+	stats.samples = samples.size();
+	if (samples.empty())
+		return stats;
+
+	stats.last = samples[(head - 1) % Window];
+	stats.min = *std::min_element(samples.begin(), samples.end());
+
+	double sum = 0.0;
+	for (float s : samples)
+		sum += s;
+	stats.avg = float(sum / samples.size());
+
+	std::vector<float> sorted(samples);
+	size_t k = size_t(std::ceil(0.99 * sorted.size())) - 1;
+	std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+	stats.p99 = sorted[k];
+
+	return stats;
+}
+
+std::vector<GPUProfiler::Stats> GPUProfiler::stats() const {
+	std::vector<Stats> result;
+	for (const Series &series : mSeries)
+		result.push_back(computeStats(series.name, series.samples, series.head));
+	if (result.empty())
+		result.push_back(Stats());
+	return result;
+}
+
+std::vector<GPUProfiler::Stats> GPUProfiler::counters() const {
+	std::vector<Stats> result;
+	for (const Series &series : mCounters)
+		result.push_back(computeStats(series.name, series.samples, series.head));
+	return result;
+}
+
+std::vector<GPUProfiler::Stats> GPUProfiler::latencies() const {
+	std::vector<Stats> result;
+	for (const Series &series : mLatencies)
+		result.push_back(computeStats(series.name, series.samples, series.head));
+	return result;
+}
+
+void GPUProfiler::drawOverlay(int width, int height) const {
+	if (!mReady)
+		return;
+
+	static const float colors[][3] = {
+		{ 0.90f, 0.10f, 0.29f }, { 0.24f, 0.71f, 0.29f }, { 1.00f, 0.88f, 0.10f }, { 0.00f, 0.51f, 0.78f },
+		{ 0.96f, 0.51f, 0.19f }, { 0.57f, 0.12f, 0.71f }, { 0.27f, 0.94f, 0.94f }, { 0.94f, 0.20f, 0.90f }
+	};
+
+	// Full bar length equals the frame budget
+	float budget = 1000.f / (Settings::getInstance().USE_RIFT ? 75.f : 60.f);
+	int x = 10, y = 10, barHeight = 6, gap = 3, length = width * 2 / 5;
+
+	// Highest pass bar ends below the frame total, which has to fit into the viewport
+	int top = height - 10 - 2 * barHeight;
+	if (top < y)
+		return;
+
+	GLfloat clearColor[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+	GLboolean scissor = glIsEnabled(GL_SCISSOR_TEST);
+	glEnable(GL_SCISSOR_TEST);
+
+	auto bar = [&](int bx, int by, int w, int h, float r, float g, float b) {
+		glScissor(bx, by, std::max(w, 1), h);
+		glClearColor(r, g, b, 1.f);
+		glClear(GL_COLOR_BUFFER_BIT);
+	};
+
+	// Passes bottom up, the frame total on top, passes which do not fit below it are left out
+	std::vector<Stats> all = stats();
+	for (size_t i = all.size() - 1; i > 0 && y + barHeight <= top; i--) {
+		const float *c = colors[(i - 1) % 8];
+		bar(x, y, int(length * std::min(all[i].avg / budget, 1.f)), barHeight, c[0], c[1], c[2]);
+		y += barHeight + gap;
+	}
+
+	bool overBudget = all[0].p99 > budget;
+	bar(x, y, int(length * std::min(all[0].avg / budget, 1.f)), 2 * barHeight, 1.f, overBudget ? 0.f : 1.f, overBudget ? 0.f : 1.f);
+	y += 2 * barHeight;
+
+	// Budget marker
+	bar(x + length, 10, 1, y - 10, 1.f, 1.f, 1.f);
+
+	glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+	if (!scissor)
+		glDisable(GL_SCISSOR_TEST);
+}
+
+void GPUProfiler::dump(const std::string &prefix) const {
+	std::vector<Stats> all = stats();
+
+	std::ofstream csv(prefix + ".csv");
+	if (csv) {
+		csv << "pass,samples,last_ms,min_ms,avg_ms,p99_ms" << std::endl;
+		for (const Stats &s : all)
+			csv << s.name << "," << s.samples << "," << s.last << "," << s.min << "," << s.avg << "," << s.p99 << std::endl;
+	}
+
+	std::ofstream json(prefix + ".json");
+	if (json) {
+		json << "{\n  \"latency\": " << Latency << ",\n  \"window\": " << Window << ",\n  \"passes\": [\n";
+		for (size_t i = 0; i < all.size(); i++) {
+			const Stats &s = all[i];
+			json << "    { \"name\": \"" << s.name << "\", \"samples\": " << s.samples << ", \"last_ms\": " << s.last
+				<< ", \"min_ms\": " << s.min << ", \"avg_ms\": " << s.avg << ", \"p99_ms\": " << s.p99 << " }"
+				<< (i + 1 < all.size() ? "," : "") << "\n";
+		}
+		json << "  ],\n  \"counters\": [\n";
+		std::vector<Stats> percentages = counters();
+		for (size_t i = 0; i < percentages.size(); i++) {
+			const Stats &s = percentages[i];
+			json << "    { \"name\": \"" << s.name << "\", \"samples\": " << s.samples << ", \"last_pct\": " << s.last
+				<< ", \"min_pct\": " << s.min << ", \"avg_pct\": " << s.avg << ", \"p99_pct\": " << s.p99 << " }"
+				<< (i + 1 < percentages.size() ? "," : "") << "\n";
+		}
+		json << "  ],\n  \"latencies\": [\n";
+		std::vector<Stats> delays = latencies();
+		for (size_t i = 0; i < delays.size(); i++) {
+			const Stats &s = delays[i];
+			json << "    { \"name\": \"" << s.name << "\", \"samples\": " << s.samples << ", \"last_ms\": " << s.last
+				<< ", \"min_ms\": " << s.min << ", \"avg_ms\": " << s.avg << ", \"p99_ms\": " << s.p99 << " }"
+				<< (i + 1 < delays.size() ? "," : "") << "\n";
+		}
+		json << "  ]\n}" << std::endl;
+	}
+}
+
+std::string GPUProfiler::info() const {
+	std::ostringstream oss;
+	oss << std::fixed << std::setprecision(3) << "GPUProfiler[\n";
+	for (const Stats &s : stats())
+		oss << "  " << s.name << " = min " << s.min << " ms, avg " << s.avg << " ms, p99 " << s.p99 << " ms (" << s.samples << " frames)\n";
+	for (const Stats &s : counters())
+		oss << "  " << s.name << " = min " << s.min << " %, avg " << s.avg << " %, p99 " << s.p99 << " % (" << s.samples << " frames)\n";
+	for (const Stats &s : latencies())
+		oss << "  " << s.name << " = min " << s.min << " ms, avg " << s.avg << " ms, p99 " << s.p99 << " ms (" << s.samples << " frames, CPU)\n";
+	oss << "]";
+	return oss.str();
+}
+
+VR_NAMESPACE_END
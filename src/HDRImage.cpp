@@ -0,0 +1,346 @@
+#include "HDRImage.hpp"
+#include <cstring>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <sys/stat.h>
+
+#if defined(PLATFORM_WINDOWS)
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define VR_HDR_SSE2
+#endif
+
+VR_NAMESPACE_BEGIN
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile {
+public:
+	MappedFile(const std::string &file) : mData(nullptr), mSize(0) {
+#if defined(PLATFORM_WINDOWS)
+		mFile = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (mFile == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("Unable to open HDR file " + file);
+		LARGE_INTEGER size;
+		GetFileSizeEx(mFile, &size);
+		mSize = size_t(size.QuadPart);
+		mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mMapping)
+			mData = (const uint8_t *) MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+#else
+		mFile = open(file.c_str(), O_RDONLY);
+		if (mFile < 0)
+			throw std::runtime_error("Unable to open HDR file " + file);
+		struct stat st;
+		if (fstat(mFile, &st) == 0 && st.st_size > 0) {
+			mSize = size_t(st.st_size);
+			void *p = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFile, 0);
+			if (p != MAP_FAILED)
+				mData = (const uint8_t *) p;
+		}
+#endif
+		if (!mData) {
+			close();
+			throw std::runtime_error("Unable to map HDR file " + file);
+		}
+	}
+
+	~MappedFile() { close(); }
+
+	const uint8_t *data() const { return mData; }
+	size_t size() const { return mSize; }
+
+private:
+	MappedFile(MappedFile const&) = delete;
+	void operator=(MappedFile const&) = delete;
+
+	void close() {
+#if defined(PLATFORM_WINDOWS)
+		if (mData)
+			UnmapViewOfFile(mData);
+		if (mMapping)
+			CloseHandle(mMapping);
+		if (mFile != INVALID_HANDLE_VALUE)
+			CloseHandle(mFile);
+		mMapping = nullptr;
+		mFile = INVALID_HANDLE_VALUE;
+#else
+		if (mData)
+			munmap((void *) mData, mSize);
+		if (mFile >= 0)
+			::close(mFile);
+		mFile = -1;
+#endif
+		mData = nullptr;
+	}
+
+	const uint8_t *mData;
+	size_t mSize;
+#if defined(PLATFORM_WINDOWS)
+	HANDLE mFile, mMapping = nullptr;
+#else
+	int mFile;
+#endif
+};
+
+/// Scale of the mantissas for each exponent, v / 256 * 2^(e - 128)
+struct ExponentTable {
+	float scale[256];
+	ExponentTable() {
+		for (int e = 0; e < 256; e++)
+			scale[e] = std::ldexp(1.f, e - 136);
+	}
+};
+
+static const float *exponentTable() {
+	static const ExponentTable table;
+	return table.scale;
+}
+
+/// Whether a scanline starts with the header of the new run length encoding
+static bool isNewRLE(const uint8_t *src, const uint8_t *end, int width) {
+	return width >= 8 && width <= 0x7fff && end - src >= 4 && src[0] == 2 && src[1] == 2 &&
+		!(src[2] & 128) && ((src[2] << 8) | src[3]) == width;
+}
+
+HDRImage::HDRImage(const std::string &file) : mWidth(0), mHeight(0) {
+	MappedFile mapped(file);
+	const uint8_t *src = mapped.data(), *end = src + mapped.size();
+
+	// Header lines up to an empty line
+	auto readLine = [&src, end]() {
+		const uint8_t *start = src;
+		while (src < end && *src != '\n')
+			src++;
+		std::string line((const char *) start, src - start);
+		if (src < end)
+			src++;
+		return line;
+	};
+
+	std::string line = readLine();
+	if (line.compare(0, 10, "#?RADIANCE") != 0 && line.compare(0, 6, "#?RGBE") != 0)
+		throw std::runtime_error(file + " is not a Radiance HDR file");
+
+	while (src < end && !(line = readLine()).empty()) {
+		if (line.compare(0, 7, "FORMAT=") == 0 && line != "FORMAT=32-bit_rle_rgbe")
+			throw std::runtime_error(file + ": unsupported HDR format " + line.substr(7));
+	}
+
+	// Only the standard orientation is supported
+	line = readLine();
+	if (sscanf(line.c_str(), "-Y %d +X %d", &mHeight, &mWidth) != 2 || mWidth <= 0 || mHeight <= 0)
+		throw std::runtime_error(file + ": unsupported HDR resolution " + line);
+
+	mPixels.resize(size_t(mWidth) * mHeight * 3);
+
+	// Index pass, only walks the run codes to find the start of each scanline
+	std::vector<const uint8_t *> scanlines(mHeight);
+	const uint8_t *pos = src;
+	bool parallel = true;
+	for (int y = 0; y < mHeight && parallel; y++) {
+		if (!isNewRLE(pos, end, mWidth)) {
+			parallel = false;
+			break;
+		}
+
+		scanlines[y] = pos;
+		pos += 4;
+		for (int c = 0; c < 4 && parallel; c++) {
+			for (int x = 0; x < mWidth; ) {
+				if (pos >= end) {
+					parallel = false;
+					break;
+				}
+				int code = *pos++;
+				if (code > 128) {
+					x += code - 128;
+					pos++;
+				} else {
+					x += code;
+					pos += code;
+				}
+			}
+		}
+	}
+
+	// Flat or old-style encoded files can only be decoded front to back
+	if (!parallel) {
+		if (!decodeSequential(src, end))
+			throw std::runtime_error(file + ": truncated or corrupt HDR data");
+		return;
+	}
+
+	// Build the exponent table before the workers need it
+	exponentTable();
+
+	int threadCount = std::max(1, std::min<int>(int(std::thread::hardware_concurrency()), mHeight / 32));
+	std::atomic<bool> failed(false);
+	auto work = [&](int first, int last) {
+		std::vector<uint8_t> rgbe(size_t(mWidth) * 4);
+		for (int y = first; y < last; y++) {
+			if (!decodeScanline(scanlines[y], end, mWidth, rgbe.data())) {
+				failed = true;
+				return;
+			}
+			convert(rgbe.data(), mWidth, &mPixels[size_t(y) * mWidth * 3]);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(work, mHeight * i / threadCount, mHeight * (i + 1) / threadCount));
+	work(0, mHeight / threadCount);
+	for (auto &t : threads)
+		t.join();
+
+	if (failed)
+		throw std::runtime_error(file + ": corrupt HDR scanline");
+}
+
+bool HDRImage::decodeScanline(const uint8_t *src, const uint8_t *end, int width, uint8_t *rgbe) {
+	src += 4;
+
+	// Components are stored one after another, each run length encoded
+	for (int c = 0; c < 4; c++) {
+		for (int x = 0; x < width; ) {
+			if (src >= end)
+				return false;
+			int code = *src++;
+			if (code > 128) {
+				code -= 128;
+				if (x + code > width || src >= end)
+					return false;
+				uint8_t value = *src++;
+				while (code--)
+					rgbe[4 * x++ + c] = value;
+			} else {
+				if (code == 0 || x + code > width || end - src < code)
+					return false;
+				while (code--)
+					rgbe[4 * x++ + c] = *src++;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool HDRImage::decodeSequential(const uint8_t *src, const uint8_t *end) {
+	std::vector<uint8_t> rgbe(size_t(mWidth) * 4);
+
+	for (int y = 0; y < mHeight; y++) {
+		if (isNewRLE(src, end, mWidth)) {
+			if (!decodeScanline(src, end, mWidth, rgbe.data()))
+				return false;
+
+			// Skip the scanline which was just decoded
+			src += 4;
+			for (int c = 0; c < 4; c++)
+				for (int x = 0; x < mWidth; ) {
+					int code = *src++;
+					x += code > 128 ? code - 128 : code;
+					src += code > 128 ? 1 : code;
+				}
+		} else {
+			// Flat pixels, (1, 1, 1, n) repeats the previous pixel
+			int rshift = 0;
+			for (int x = 0; x < mWidth; ) {
+				if (end - src < 4)
+					return false;
+				if (src[0] == 1 && src[1] == 1 && src[2] == 1) {
+					if (x == 0)
+						return false;
+					for (int i = src[3] << rshift; i > 0 && x < mWidth; i--, x++)
+						memcpy(&rgbe[4 * x], &rgbe[4 * (x - 1)], 4);
+					rshift += 8;
+				} else {
+					memcpy(&rgbe[4 * x++], src, 4);
+					rshift = 0;
+				}
+				src += 4;
+			}
+		}
+
+		convert(rgbe.data(), mWidth, &mPixels[size_t(y) * mWidth * 3]);
+	}
+
+	return true;
+}
+
+void HDRImage::convert(const uint8_t *rgbe, int count, float *rgb) {
+	const float *scale = exponentTable();
+	int i = 0;
+
+#if defined(VR_HDR_SSE2)
+	// Four pixels per iteration. Every store writes one float too many which the next store
+	// overwrites, so the last pixel is always left to the scalar loop
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 4 < count; i += 4) {
+		__m128i px = _mm_loadu_si128((const __m128i *) (rgbe + 4 * i));
+		__m128i lo = _mm_unpacklo_epi8(px, zero), hi = _mm_unpackhi_epi8(px, zero);
+		__m128 p0 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+		__m128 p1 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+		__m128 p2 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+		__m128 p3 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+		_mm_storeu_ps(rgb + 3 * i, _mm_mul_ps(p0, _mm_set1_ps(scale[rgbe[4 * i + 3]])));
+		_mm_storeu_ps(rgb + 3 * i + 3, _mm_mul_ps(p1, _mm_set1_ps(scale[rgbe[4 * i + 7]])));
+		_mm_storeu_ps(rgb + 3 * i + 6, _mm_mul_ps(p2, _mm_set1_ps(scale[rgbe[4 * i + 11]])));
+		_mm_storeu_ps(rgb + 3 * i + 9, _mm_mul_ps(p3, _mm_set1_ps(scale[rgbe[4 * i + 15]])));
+	}
+#endif
+
+	for (; i < count; i++) {
+		float s = scale[rgbe[4 * i + 3]];
+		rgb[3 * i + 0] = rgbe[4 * i + 0] * s;
+		rgb[3 * i + 1] = rgbe[4 * i + 1] * s;
+		rgb[3 * i + 2] = rgbe[4 * i + 2] * s;
+	}
+}
+
+/**
+ * @brief Decoded images by file name, with the file size and modification time they were decoded from
+ */
+struct HDRCacheEntry {
+	long long size, modified;
+	std::shared_ptr<const HDRImage> image;
+};
+
+static std::mutex hdrCacheMutex;
+static std::map<std::string, HDRCacheEntry> hdrCache;
+
+std::shared_ptr<const HDRImage> HDRImage::load(const std::string &file) {
+	struct stat st;
+	if (stat(file.c_str(), &st) != 0)
+		throw std::runtime_error("HDR file " + file + " does not exist");
+
+	std::lock_guard<std::mutex> lock(hdrCacheMutex);
+	auto it = hdrCache.find(file);
+	if (it != hdrCache.end() && it->second.size == (long long) st.st_size && it->second.modified == (long long) st.st_mtime)
+		return it->second.image;
+
+	HDRCacheEntry entry;
+	entry.size = (long long) st.st_size;
+	entry.modified = (long long) st.st_mtime;
+	entry.image = std::make_shared<HDRImage>(file);
+	hdrCache[file] = entry;
+	return entry.image;
+}
+
+void HDRImage::clearCache() {
+	std::lock_guard<std::mutex> lock(hdrCacheMutex);
+	hdrCache.clear();
+}
+
+VR_NAMESPACE_END
@@ -0,0 +1,378 @@
+#include "HDRTexture.hpp"
+#include "Eigen/Geometry"
+#include <cstring>
+#include <cmath>
+#include <iomanip>
+#include <sys/stat.h>
+
+VR_NAMESPACE_BEGIN
+
+/// File header of a cached texture, followed by the six faces of every level
+struct HDRTextureHeader {
+	char magic[4];
+	uint32_t version;
+	int64_t sourceSize, sourceModified;
+	int32_t size, levels, format, samples;
+	float irradiance[SphericalHarmonics::Count * 3];
+};
+
+static const char HDRTextureMagic[4] = { 'V', 'R', 'T', 'X' };
+static const uint32_t HDRTextureVersion = 3;
+
+/// GGX samples per texel of the prefiltered levels
+static const int PrefilterSamples = 64;
+
+/// Face size of the last level, the irradiance covers anything blurrier
+static const int MinimumFaceSize = 8;
+
+/**
+ * @brief Float cube of one level, RGB triplets of the six faces one after another
+ */
+struct FloatCube {
+	int size;
+	std::vector<float> rgb;
+
+	FloatCube(int size) : size(size), rgb(size_t(6) * size * size * 3, 0.f) {}
+
+	float *texel(int face, int x, int y) { return &rgb[((size_t(face) * size + y) * size + x) * 3]; }
+	const float *texel(int face, int x, int y) const { return &rgb[((size_t(face) * size + y) * size + x) * 3]; }
+
+	/// Bilinear lookup of (s, t) in [-1, 1]^2 within a face, clamped at its edges
+	Vector3f sample(int face, float s, float t) const {
+		float fx = std::min(std::max((s + 1.f) * .5f * size - .5f, 0.f), float(size - 1));
+		float fy = std::min(std::max((t + 1.f) * .5f * size - .5f, 0.f), float(size - 1));
+		int x0 = int(fx), y0 = int(fy), x1 = std::min(x0 + 1, size - 1), y1 = std::min(y0 + 1, size - 1);
+		float ax = fx - x0, ay = fy - y0;
+		Vector3f c00(texel(face, x0, y0)), c10(texel(face, x1, y0)), c01(texel(face, x0, y1)), c11(texel(face, x1, y1));
+		return (c00 * (1.f - ax) + c10 * ax) * (1.f - ay) + (c01 * (1.f - ax) + c11 * ax) * ay;
+	}
+};
+
+/// Face and position (s, t) in [-1, 1]^2 of a direction, inverse of HDRTexture::faceDirection
+static void cubeCoordinates(const Vector3f &d, int &face, float &s, float &t) {
+	float ax = std::abs(d.x()), ay = std::abs(d.y()), az = std::abs(d.z());
+	if (ax >= ay && ax >= az) {
+		face = d.x() > 0.f ? 0 : 1;
+		s = (d.x() > 0.f ? -d.z() : d.z()) / ax;
+		t = -d.y() / ax;
+	} else if (ay >= az) {
+		face = d.y() > 0.f ? 2 : 3;
+		s = d.x() / ay;
+		t = (d.y() > 0.f ? d.z() : -d.z()) / ay;
+	} else {
+		face = d.z() > 0.f ? 4 : 5;
+		s = (d.z() > 0.f ? d.x() : -d.x()) / az;
+		t = -d.y() / az;
+	}
+}
+
+/// Bilinear lookup in the latitude-longitude image, u = atan2(-z, x) / 2pi and v = acos(y) / pi as on the environment sphere
+static Vector3f sampleLatLong(const HDRImage &image, const Vector3f &d) {
+	const int width = image.width(), height = image.height();
+	float u = std::atan2(-d.z(), d.x()) / float(2.0 * M_PI);
+	if (u < 0.f)
+		u += 1.f;
+	float v = std::acos(std::min(std::max(d.y(), -1.f), 1.f)) / float(M_PI);
+
+	float fx = u * width - .5f, fy = v * height - .5f;
+	int x0 = int(std::floor(fx)), y0 = int(std::floor(fy));
+	float ax = fx - x0, ay = fy - y0;
+	int x1 = (x0 + 1) % width;
+	x0 = (x0 + width) % width;
+	int y1 = std::min(y0 + 1, height - 1);
+	y0 = std::max(y0, 0);
+
+	auto texel = [&](int x, int y) { return Vector3f(image.data() + (size_t(y) * width + x) * 3); };
+	return (texel(x0, y0) * (1.f - ax) + texel(x1, y0) * ax) * (1.f - ay) + (texel(x0, y1) * (1.f - ax) + texel(x1, y1) * ax) * ay;
+}
+
+/**
+ * @brief GGX lobe around the normal for N = V = R, in tangent space with the normal along z
+ */
+struct PrefilterSample {
+	Vector3f direction;
+	float weight, lod;
+};
+
+/// Importance samples of a GGX lobe, the lod of each sample footprint in the source pyramid follows [Colbert and Krivanek 2007]
+static std::vector<PrefilterSample> prefilterSamples(float roughness, int sourceSize, int sourceLevels) {
+	float a2 = roughness * roughness * roughness * roughness;
+	float texelSolidAngle = float(4.0 * M_PI / (6.0 * sourceSize * sourceSize));
+	std::vector<PrefilterSample> samples;
+
+	for (uint32_t i = 0; i < uint32_t(PrefilterSamples); i++) {
+		// Hammersley point
+		uint32_t bits = i;
+		bits = (bits << 16u) | (bits >> 16u);
+		bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+		bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+		bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+		bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+		float u = float(i) / PrefilterSamples, v = float(bits) * 2.3283064365386963e-10f;
+
+		float phi = float(2.0 * M_PI) * u;
+		float cosTheta = std::sqrt((1.f - v) / (1.f + (a2 - 1.f) * v));
+		float sinTheta = std::sqrt(1.f - cosTheta * cosTheta);
+		Vector3f h(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+		Vector3f l = 2.f * cosTheta * h - Vector3f(0.f, 0.f, 1.f);
+		if (l.z() <= 0.f)
+			continue;
+
+		float d = (cosTheta * cosTheta * (a2 - 1.f) + 1.f);
+		float pdf = a2 / (float(M_PI) * d * d) / 4.f;
+		float sampleSolidAngle = 1.f / (PrefilterSamples * pdf);
+		float lod = std::max(.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.f, 0.f);
+
+		PrefilterSample sample;
+		sample.direction = l;
+		sample.weight = l.z();
+		sample.lod = std::min(lod, float(sourceLevels - 1));
+		samples.push_back(sample);
+	}
+
+	return samples;
+}
+
+HDRTexture::HDRTexture(const std::string &file) : mCached(false) {
+	struct stat st;
+	if (stat(file.c_str(), &st) != 0)
+		throw std::runtime_error("HDR file " + file + " does not exist");
+
+	// Power of two faces, such that every level halves the previous one
+	int size = MinimumFaceSize;
+	while (size * 2 <= Settings::getInstance().GI_CUBEMAP_SIZE)
+		size *= 2;
+
+	if (loadCache(file, (long long) st.st_size, (long long) st.st_mtime, size)) {
+		mCached = true;
+		return;
+	}
+
+	// Later loads read the packed cache file, the decoded floats (~15 MB) are released right away
+	convert(*HDRImage::load(file), size);
+	HDRImage::clearCache();
+	storeCache(file, (long long) st.st_size, (long long) st.st_mtime);
+}
+
+GLuint HDRTexture::upload() const {
+	GLuint textureID;
+	glGenTextures(1, &textureID);
+	glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levels() - 1);
+
+	// Filter across face edges, the blurry levels show seams otherwise
+	glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	for (int i = 0; i < levels(); i++) {
+		const Level &level = mLevels[i];
+		size_t faceTexels = size_t(level.size) * level.size;
+		for (int face = 0; face < 6; face++)
+			glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, GL_RGB9_E5, level.size, level.size, 0,
+				GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV, level.texels.data() + face * faceTexels);
+	}
+
+	return textureID;
+}
+
+size_t HDRTexture::bytes() const {
+	size_t bytes = 0;
+	for (auto &level : mLevels)
+		bytes += level.texels.size() * sizeof(uint32_t);
+	return bytes;
+}
+
+uint32_t HDRTexture::packRGB9E5(float r, float g, float b) {
+	// EXT_texture_shared_exponent: 9 bit mantissas, 5 bit exponent with a bias of 15
+	const float maxValue = 511.f / 512.f * 65536.f;
+
+	// NaNs fail the comparisons and become 0 as well
+	r = r > 0.f ? std::min(r, maxValue) : 0.f;
+	g = g > 0.f ? std::min(g, maxValue) : 0.f;
+	b = b > 0.f ? std::min(b, maxValue) : 0.f;
+
+	float maxChannel = std::max(r, std::max(g, b));
+	int exponent;
+	std::frexp(maxChannel, &exponent);
+	exponent = std::max(-16, exponent - 1) + 16;
+
+	// Rounding the largest channel up may overflow its mantissa
+	float scale = std::ldexp(1.f, 24 - exponent);
+	if (int(std::floor(maxChannel * scale + .5f)) == 512) {
+		exponent++;
+		scale *= .5f;
+	}
+
+	uint32_t rm = uint32_t(std::floor(r * scale + .5f));
+	uint32_t gm = uint32_t(std::floor(g * scale + .5f));
+	uint32_t bm = uint32_t(std::floor(b * scale + .5f));
+	return rm | (gm << 9) | (bm << 18) | (uint32_t(exponent) << 27);
+}
+
+Vector3f HDRTexture::unpackRGB9E5(uint32_t texel) {
+	float scale = std::ldexp(1.f, int(texel >> 27) - 24);
+	return Vector3f(float(texel & 511), float((texel >> 9) & 511), float((texel >> 18) & 511)) * scale;
+}
+
+Vector3f HDRTexture::faceDirection(int face, float s, float t) {
+	switch (face) {
+		case 0: return Vector3f(1.f, -t, -s);
+		case 1: return Vector3f(-1.f, -t, s);
+		case 2: return Vector3f(s, 1.f, t);
+		case 3: return Vector3f(s, -1.f, -t);
+		case 4: return Vector3f(s, -t, 1.f);
+		default: return Vector3f(-s, -t, -1.f);
+	}
+}
+
+void HDRTexture::convert(const HDRImage &image, int size) {
+	mIrradiance = SphericalHarmonics::irradiance(image);
+
+	// Level 0, 2x2 bilinear samples of the image per texel
+	std::vector<FloatCube> pyramid;
+	pyramid.push_back(FloatCube(size));
+	parallelFor(6 * size, [&](int row) {
+		int face = row / size, y = row % size;
+		for (int x = 0; x < size; x++) {
+			Vector3f sum(0.f, 0.f, 0.f);
+			for (int i = 0; i < 4; i++) {
+				float s = 2.f * (x + .25f + .5f * (i & 1)) / size - 1.f;
+				float t = 2.f * (y + .25f + .5f * (i >> 1)) / size - 1.f;
+				sum += sampleLatLong(image, faceDirection(face, s, t).normalized());
+			}
+			Vector3f::Map(pyramid.front().texel(face, x, y)) = sum * .25f;
+		}
+	});
+
+	// Box filtered source pyramid down to 1x1 for the filtered importance sampling
+	while (pyramid.back().size > 1) {
+		const FloatCube &src = pyramid.back();
+		FloatCube dst(src.size / 2);
+		for (int face = 0; face < 6; face++)
+			for (int y = 0; y < dst.size; y++)
+				for (int x = 0; x < dst.size; x++)
+					for (int c = 0; c < 3; c++)
+						dst.texel(face, x, y)[c] = .25f * (src.texel(face, 2 * x, 2 * y)[c] + src.texel(face, 2 * x + 1, 2 * y)[c] +
+							src.texel(face, 2 * x, 2 * y + 1)[c] + src.texel(face, 2 * x + 1, 2 * y + 1)[c]);
+		pyramid.push_back(std::move(dst));
+	}
+
+	int levelCount = 1;
+	while ((size >> levelCount) >= MinimumFaceSize)
+		levelCount++;
+
+	for (int level = 0; level < levelCount; level++) {
+		int levelSize = size >> level;
+		FloatCube filtered(levelSize);
+
+		if (level == 0) {
+			filtered = pyramid.front();
+		} else {
+			float roughness = float(level) / (levelCount - 1);
+			std::vector<PrefilterSample> samples = prefilterSamples(roughness, size, int(pyramid.size()));
+
+			parallelFor(6 * levelSize, [&](int row) {
+				int face = row / levelSize, y = row % levelSize;
+				for (int x = 0; x < levelSize; x++) {
+					Vector3f n = faceDirection(face, 2.f * (x + .5f) / levelSize - 1.f, 2.f * (y + .5f) / levelSize - 1.f).normalized();
+					Vector3f up = std::abs(n.z()) < .999f ? Vector3f(0.f, 0.f, 1.f) : Vector3f(1.f, 0.f, 0.f);
+					Vector3f tangent = up.cross(n).normalized(), bitangent = n.cross(tangent);
+
+					Vector3f sum(0.f, 0.f, 0.f);
+					float weight = 0.f;
+					for (auto &sample : samples) {
+						Vector3f l = tangent * sample.direction.x() + bitangent * sample.direction.y() + n * sample.direction.z();
+						int sampleFace;
+						float s, t;
+						cubeCoordinates(l, sampleFace, s, t);
+
+						int lod0 = int(sample.lod), lod1 = std::min(lod0 + 1, int(pyramid.size()) - 1);
+						float f = sample.lod - lod0;
+						Vector3f c = pyramid[lod0].sample(sampleFace, s, t) * (1.f - f) + pyramid[lod1].sample(sampleFace, s, t) * f;
+						sum += c * sample.weight;
+						weight += sample.weight;
+					}
+					Vector3f::Map(filtered.texel(face, x, y)) = sum / std::max(weight, 1e-6f);
+				}
+			});
+		}
+
+		Level packed;
+		packed.size = levelSize;
+		packed.texels.resize(size_t(6) * levelSize * levelSize);
+		for (size_t i = 0; i < packed.texels.size(); i++)
+			packed.texels[i] = packRGB9E5(filtered.rgb[3 * i], filtered.rgb[3 * i + 1], filtered.rgb[3 * i + 2]);
+		mLevels.push_back(std::move(packed));
+	}
+}
+
+std::string HDRTexture::cacheFile(const std::string &file) {
+	std::ostringstream oss;
+	oss << Settings::getInstance().TEXTURE_CACHE_DIR << "/" << std::hex << std::setw(16) << std::setfill('0') << fnv1a(file) << ".rgb9e5";
+	return oss.str();
+}
+
+bool HDRTexture::loadCache(const std::string &file, long long size, long long modified, int cubeSize) {
+	if (Settings::getInstance().TEXTURE_CACHE_DIR.empty())
+		return false;
+
+	std::ifstream is(cacheFile(file), std::ios::binary);
+	if (!is)
+		return false;
+
+	HDRTextureHeader header;
+	if (!is.read((char *) &header, sizeof(header)) ||
+		memcmp(header.magic, HDRTextureMagic, sizeof(HDRTextureMagic)) != 0 || header.version != HDRTextureVersion ||
+		header.sourceSize != size || header.sourceModified != modified || header.format != GL_RGB9_E5 ||
+		header.size != cubeSize || header.samples != PrefilterSamples || header.levels <= 0 || (cubeSize >> (header.levels - 1)) < 1)
+		return false;
+
+	for (int i = 0; i < SphericalHarmonics::Count; i++)
+		mIrradiance.data()[i] = Vector3f::Map(header.irradiance + 3 * i);
+
+	for (int i = 0; i < header.levels; i++) {
+		Level level;
+		level.size = cubeSize >> i;
+		level.texels.resize(size_t(6) * level.size * level.size);
+		if (!is.read((char *) level.texels.data(), level.texels.size() * sizeof(uint32_t))) {
+			mLevels.clear();
+			return false;
+		}
+		mLevels.push_back(std::move(level));
+	}
+
+	return true;
+}
+
+void HDRTexture::storeCache(const std::string &file, long long sourceSize, long long modified) const {
+	if (Settings::getInstance().TEXTURE_CACHE_DIR.empty())
+		return;
+
+	HDRTextureHeader header;
+	memcpy(header.magic, HDRTextureMagic, sizeof(HDRTextureMagic));
+	header.version = HDRTextureVersion;
+	header.sourceSize = sourceSize;
+	header.sourceModified = modified;
+	header.size = size();
+	header.levels = levels();
+	header.format = GL_RGB9_E5;
+	header.samples = PrefilterSamples;
+	for (int i = 0; i < SphericalHarmonics::Count; i++)
+		Vector3f::Map(header.irradiance + 3 * i) = mIrradiance.data()[i];
+
+	// A partially written file fails the size check on the next load
+	std::ofstream os(cacheFile(file), std::ios::binary | std::ios::trunc);
+	if (!os)
+		return;
+	os.write((const char *) &header, sizeof(header));
+	for (auto &level : mLevels)
+		os.write((const char *) level.texels.data(), level.texels.size() * sizeof(uint32_t));
+}
+
+VR_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include "SceneNode.hpp"
+#include "Eigen/Geometry"
+
+VR_NAMESPACE_BEGIN
+
+SceneNode::SceneNode()
+	: transMat(Matrix4f::Identity()), scaleMat(Matrix4f::Identity()), rotateMat(Matrix4f::Identity())
+	, worldMatrix(Matrix4f::Identity()), normalMatrix(Matrix3f::Identity()), dirty(true), parent(nullptr) {
+
+}
+
+SceneNode::SceneNode(const SceneNode &other)
+	: transMat(other.transMat), scaleMat(other.scaleMat), rotateMat(other.rotateMat)
+	, worldMatrix(Matrix4f::Identity()), normalMatrix(Matrix3f::Identity()), dirty(true), parent(nullptr) {
+
+}
+
+SceneNode &SceneNode::operator=(const SceneNode &other) {
+	transMat = other.transMat;
+	scaleMat = other.scaleMat;
+	rotateMat = other.rotateMat;
+	invalidate();
+	return *this;
+}
+
+SceneNode::~SceneNode() {
+	setParent(nullptr);
+	for (SceneNode *child : children) {
+		child->parent = nullptr;
+		child->invalidate();
+	}
+}
+
+void SceneNode::setParent(SceneNode *p) {
+	if (p == parent)
+		return;
+
+	if (parent != nullptr)
+		parent->children.erase(std::remove(parent->children.begin(), parent->children.end(), this), parent->children.end());
+
+	parent = p;
+	if (parent != nullptr)
+		parent->children.push_back(this);
+
+	invalidate();
+}
+
+void SceneNode::setTranslateMatrix(const Matrix4f &t) {
+	if (t == transMat)
+		return;
+
+	transMat = t;
+	invalidate();
+}
+
+void SceneNode::setScaleMatrix(const Matrix4f &s) {
+	if (s == scaleMat)
+		return;
+
+	scaleMat = s;
+	invalidate();
+}
+
+void SceneNode::setRotationMatrix(const Matrix4f &r) {
+	if (r == rotateMat)
+		return;
+
+	rotateMat = r;
+	invalidate();
+}
+
+void SceneNode::invalidate() {
+	// A valid node never has an invalid ancestor, so an invalid subtree is already marked
+	if (dirty)
+		return;
+
+	dirty = true;
+	for (SceneNode *child : children)
+		child->invalidate();
+}
+
+void SceneNode::update() {
+	if (dirty)
+		evaluate();
+
+	for (SceneNode *child : children)
+		child->update();
+}
+
+void SceneNode::evaluate() {
+	worldMatrix = parent != nullptr ? Matrix4f(parent->getWorldMatrix() * getLocalMatrix()) : getLocalMatrix();
+	normalMatrix = worldMatrix.topLeftCorner<3, 3>().inverse().transpose();
+	dirty = false;
+	worldChanged();
+}
+
+VR_NAMESPACE_END
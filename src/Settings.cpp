@@ -25,7 +25,6 @@ Settings::Settings () :
 	// MATERIAL
 	MATERIAL_COLOR				(0.8f, 0.8f, 0.8f),
 	MATERIAL_COLOR_ROTATION		(0.7843f, 0.72941f, 0.65098f),
-	ROTATION_ACTIVE				(false),
 	// LIGHTNING
 	LIGHT_INTENSITY				(0.9f, 0.9f, 0.9f),
 	LIGHT_AMBIENT				(0.005f),
@@ -34,14 +33,20 @@ Settings::Settings () :
 	MESH_DRAW					(true),
 	MESH_DIAGONAL				(0.60f),
 	MESH_DRAW_WIREFRAME			(false),
-	MESH_DISPLAY_BBOX			(false), 
 	MESH_DRAW_BBOX				(false),
+	// Reorder triangles and vertices for the vertex cache, against overdraw and for the vertex fetch
+	MESH_OPTIMIZE				(true),
+	// 16 byte vertices and 16 bit indices instead of 32 byte vertices and 32 bit indices
+	MESH_QUANTIZE				(true),
+	// Cull meshlets of 128 triangles against the view frustum and by their normal cones on the CPU
+	MESH_CULL					(true),
+	// Simplified levels of detail, chosen per eye such that the error stays below MESH_LOD_PIXEL_ERROR pixels
+	MESH_LOD_LEVELS				(5),
+	MESH_LOD_PIXEL_ERROR		(1.f),
+	MESH_LOD_HYSTERESIS			(0.25f),
 	SHOW_HANDS					(true),
-	SHOW_SPHERE					(false),
 	ENABLE_SPHERE				(true),
-	BBOX_ALPHA_BLEND			(0.f),
 	SHOW_SOCKEL					(true),
-	SOCKEL_ALPHA_BLEND			(1.f),
 
 	// LEAP, 1.f = 1 Unit = 1 millimeter
 	// PASSTHROUGH
@@ -51,7 +56,6 @@ Settings::Settings () :
 	LEAP_ALPHA_SCALE			(0.7f),
 	LEAP_CAMERA_SHIFT_X			(0.006f),
 	LEAP_CAMERA_SHIFT_Z			(-0.08f),
-	LEAP_USE_LISTENER			(false),
 
 	// GESTURES, 1.f = 1 Unit = 1 Second
 	GESTURES_SCALE_TIME			(0.6f), // Must be smaller than rotation time
@@ -63,13 +67,11 @@ Settings::Settings () :
 
 	// NETWORKING, 1 length unit = 1 millimeter, 1 size unit = 1 byte
 	NETWORK_ENABLED				(false),
-	NETWORK_LISTEN				(true),
 	NETWORK_MODE				(0),
 	NETWORK_PORT				(8888),
 	NETWORK_IP					("127.0.0.1"),
 	NETWORK_SEND_RATE			(50),
 	NETWORK_BUFFER_SIZE			(8192),
-	NETWORK_NEW_DATA			(false),
 
 	// ROTATION SPHERE SCALES
 	SHOW_DEBUG_SPHERES			(false),
@@ -78,16 +80,50 @@ Settings::Settings () :
 	SPHERE_MEDIUM_SCALE			(0.6f),
 	SPHERE_VISUAL_SCALE			(0.4f),
 	SPHERE_LARGE_SCALE			(0.9f),
-	SPHERE_ALPHA_BLEND			(0.f),
-	SPHERE_DISPLAY				(false),
-	SPHERE_ALPHA_BLEND_INTRO	(false),
-	SPHERE_VISUAL_HINT			(false),
 	SPHERE_VISUAL_HINT_COLOR	(0.6f, 0.f, 0.f),
 
 	// GLOBAL ILLUMINATION
 	GI_ENABLED					(true),
 	GI_FILE						("resources/hdr/loft.hdr"),
-	GI_DIFFUSE_FILE				("resources/hdr/loft_diffuse.hdr")
+	GI_CUBEMAP_SIZE				(256),
+	GI_SPECULAR_ROUGHNESS		(0.4f),
+
+	// STREAMING, 1 size unit = 1 byte per frame in flight
+	STREAM_BUFFER_SIZE			(256 * 1024),
+
+	// SIMULATION, Leap input, gestures, annotations and networking run on their own thread at this rate in Hz
+	SIMULATION_RATE				(120.f),
+
+	// DYNAMIC RESOLUTION, Rift eye buffers are allocated at MAX pixel density and rendered at a scale in [MIN, MAX] to hold 75 Hz
+	DYNAMIC_RESOLUTION			(true),
+	DYNAMIC_RESOLUTION_MIN		(0.5f),
+	DYNAMIC_RESOLUTION_MAX		(1.f),
+
+	// SHADERS, linked program binaries are cached here (empty = disabled)
+	SHADER_CACHE_DIR			("resources/cache"),
+
+	// TEXTURES, packed environment maps with their mip chains are cached here (empty = disabled)
+	TEXTURE_CACHE_DIR			("resources/cache"),
+
+	// MESHES, simplified index lists of the levels of detail are cached here (empty = disabled)
+	MESH_CACHE_DIR				("resources/cache"),
+
+	// PROFILER, GPU pass timings are written to <PROFILER_DUMP>.csv/.json on exit (empty = disabled)
+	PROFILER_OVERLAY			(false),
+	PROFILER_DUMP				("gpu_profile"),
+
+	// CPU trace in Chrome format, only recorded when built with VR_ENABLE_TRACE
+	TRACE_FILE					("trace.json"),
+
+	// BENCHMARK, offscreen rendering along a fixed rotation path
+	HEADLESS					(false),
+	BENCH_FRAMES				(500),
+	BENCH_OUTPUT				("bench.json"),
+	BENCH_PINS					(16),
+	BENCH_HANDS					(true),
+
+	// RUNTIME STATE
+	NETWORK_NEW_DATA			(false)
 {}
 
 VR_NAMESPACE_END
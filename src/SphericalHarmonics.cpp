@@ -0,0 +1,147 @@
+#include "SphericalHarmonics.hpp"
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define VR_SH_SSE2
+#endif
+
+VR_NAMESPACE_BEGIN
+
+/// Column weights 1, cos, sin, sin^2, cos sin, cos^2 of the azimuth, each repeated for the three channels of a pixel
+static const int ColumnWeights = 6;
+
+/**
+ * @brief Sums of a row of RGB triplets times each column weight, out[weight][channel]
+ */
+static void reduceRow(const float *row, const float *weights, size_t n, double out[ColumnWeights][3]) {
+	size_t i = 0;
+	float sums[ColumnWeights][3] = {};
+
+#if defined(VR_SH_SSE2)
+	// Four pixels (12 floats) per iteration, the lanes of the three accumulators of a weight
+	// cover the channels r g b r | g b r g | b r g b
+	__m128 acc[ColumnWeights][3];
+	for (int w = 0; w < ColumnWeights; w++)
+		acc[w][0] = acc[w][1] = acc[w][2] = _mm_setzero_ps();
+
+	for (; i + 12 <= n; i += 12) {
+		__m128 l0 = _mm_loadu_ps(row + i), l1 = _mm_loadu_ps(row + i + 4), l2 = _mm_loadu_ps(row + i + 8);
+		for (int w = 0; w < ColumnWeights; w++) {
+			const float *weight = weights + w * n + i;
+			acc[w][0] = _mm_add_ps(acc[w][0], _mm_mul_ps(l0, _mm_loadu_ps(weight)));
+			acc[w][1] = _mm_add_ps(acc[w][1], _mm_mul_ps(l1, _mm_loadu_ps(weight + 4)));
+			acc[w][2] = _mm_add_ps(acc[w][2], _mm_mul_ps(l2, _mm_loadu_ps(weight + 8)));
+		}
+	}
+
+	for (int w = 0; w < ColumnWeights; w++) {
+		float lanes[12];
+		_mm_storeu_ps(lanes, acc[w][0]);
+		_mm_storeu_ps(lanes + 4, acc[w][1]);
+		_mm_storeu_ps(lanes + 8, acc[w][2]);
+		for (int o = 0; o < 12; o++)
+			sums[w][o % 3] += lanes[o];
+	}
+#endif
+
+	for (; i < n; i++)
+		for (int w = 0; w < ColumnWeights; w++)
+			sums[w][i % 3] += row[i] * weights[w * n + i];
+
+	for (int w = 0; w < ColumnWeights; w++)
+		for (int c = 0; c < 3; c++)
+			out[w][c] = sums[w][c];
+}
+
+SphericalHarmonics::SphericalHarmonics() {
+	for (int k = 0; k < Count; k++)
+		mCoefficients[k].setZero();
+}
+
+SphericalHarmonics SphericalHarmonics::irradiance(const HDRImage &image) {
+	const int width = image.width(), height = image.height();
+	const size_t n = size_t(width) * 3;
+	const double pi = M_PI;
+
+	// Azimuth of the column centers, u = atan2(-z, x) / 2pi
+	std::vector<float> weights(ColumnWeights * n);
+	for (int x = 0; x < width; x++) {
+		double phi = 2.0 * pi * (x + .5) / width;
+		float c = float(std::cos(phi)), s = float(std::sin(phi));
+		float values[ColumnWeights] = { 1.f, c, s, s * s, c * s, c * c };
+		for (int w = 0; w < ColumnWeights; w++)
+			for (int ch = 0; ch < 3; ch++)
+				weights[w * n + 3 * x + ch] = values[w];
+	}
+
+	// Each worker integrates the polynomials of the 9 coefficients over a range of rows
+	auto work = [&](int first, int last, double result[Count][3]) {
+		for (int k = 0; k < Count; k++)
+			result[k][0] = result[k][1] = result[k][2] = 0.0;
+
+		for (int y = first; y < last; y++) {
+			double theta = pi * (y + .5) / height;
+			double cosTheta = std::cos(theta), sinTheta = std::sin(theta);
+			double solidAngle = sinTheta * (2.0 * pi / width) * (pi / height);
+
+			double s[ColumnWeights][3];
+			reduceRow(image.data() + size_t(y) * n, weights.data(), n, s);
+
+			// With x = sin(theta) cos(phi), y = cos(theta), z = -sin(theta) sin(phi)
+			for (int c = 0; c < 3; c++) {
+				double sum = s[0][c];
+				double sumX = sinTheta * s[1][c], sumZ = -sinTheta * s[2][c];
+				double sumZZ = sinTheta * sinTheta * s[3][c], sumXZ = -sinTheta * sinTheta * s[4][c];
+				double sumXX = sinTheta * sinTheta * s[5][c];
+
+				double p[Count] = {
+					sum, cosTheta * sum, sumZ, sumX, cosTheta * sumX, cosTheta * sumZ,
+					3.0 * sumZZ - sum, sumXZ, sumXX - cosTheta * cosTheta * sum
+				};
+				for (int k = 0; k < Count; k++)
+					result[k][c] += solidAngle * p[k];
+			}
+		}
+	};
+
+	int threadCount = std::max(1, std::min<int>(int(std::thread::hardware_concurrency()), height / 32));
+	std::vector<double> partial(size_t(threadCount) * Count * 3);
+	auto slice = [&](int i) { return (double (*)[3]) &partial[size_t(i) * Count * 3]; };
+
+	std::vector<std::thread> threads;
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(work, height * i / threadCount, height * (i + 1) / threadCount, slice(i)));
+	work(0, height / threadCount, slice(0));
+	for (auto &t : threads)
+		t.join();
+
+	// Squared basis normalization times the cosine lobe convolution A_l / pi (1, 2/3, 1/4)
+	const double scale[Count] = {
+		0.282095 * 0.282095,
+		0.488603 * 0.488603 * 2.0 / 3.0, 0.488603 * 0.488603 * 2.0 / 3.0, 0.488603 * 0.488603 * 2.0 / 3.0,
+		1.092548 * 1.092548 / 4.0, 1.092548 * 1.092548 / 4.0, 0.315392 * 0.315392 / 4.0,
+		1.092548 * 1.092548 / 4.0, 0.546274 * 0.546274 / 4.0
+	};
+
+	SphericalHarmonics sh;
+	for (int k = 0; k < Count; k++) {
+		for (int c = 0; c < 3; c++) {
+			double sum = 0.0;
+			for (int i = 0; i < threadCount; i++)
+				sum += slice(i)[k][c];
+			sh.mCoefficients[k][c] = float(scale[k] * sum);
+		}
+	}
+
+	return sh;
+}
+
+Vector3f SphericalHarmonics::evaluate(const Vector3f &n) const {
+	const Vector3f *c = mCoefficients;
+	return c[0] + c[1] * n.y() + c[2] * n.z() + c[3] * n.x() + c[4] * (n.x() * n.y()) + c[5] * (n.y() * n.z()) +
+		c[6] * (3.f * n.z() * n.z() - 1.f) + c[7] * (n.x() * n.z()) + c[8] * (n.x() * n.x() - n.y() * n.y());
+}
+
+VR_NAMESPACE_END
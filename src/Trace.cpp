@@ -0,0 +1,84 @@
+#include "Trace.hpp"
+#include <chrono>
+
+VR_NAMESPACE_BEGIN
+
+uint64_t Tracer::now() {
+	return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Tracer::ThreadBuffer &Tracer::threadBuffer() {
+	static VR_THREAD_LOCAL ThreadBuffer *buffer = nullptr;
+	if (buffer == nullptr) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mThreads.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+		buffer = mThreads.back().get();
+		buffer->id = uint32_t(mThreads.size());
+		buffer->name = "thread " + toString(buffer->id);
+		buffer->events.reset(new Slot[Capacity]);
+		buffer->head.store(0);
+	}
+	return *buffer;
+}
+
+void Tracer::record(const char *name, uint64_t begin, uint64_t end) {
+	ThreadBuffer &buffer = threadBuffer();
+	uint64_t head = buffer.head.load(std::memory_order_relaxed);
+	Slot &slot = buffer.events[head % Capacity];
+
+	// A reader which sees any of the new values also sees the previous head, see write()
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.name.store(name, std::memory_order_relaxed);
+	slot.begin.store(begin, std::memory_order_relaxed);
+	slot.end.store(end, std::memory_order_relaxed);
+	buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::setThreadName(const std::string &name) {
+	ThreadBuffer &buffer = threadBuffer();
+	std::lock_guard<std::mutex> lock(mMutex);
+	buffer.name = name;
+}
+
+bool Tracer::write(const std::string &file) const {
+	std::ofstream os(file);
+	if (!os)
+		return false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	bool first = true;
+	for (auto &thread : mThreads) {
+		os << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->id
+			<< ",\"args\":{\"name\":\"" << thread->name << "\"}}";
+		first = false;
+
+		// The owning thread keeps writing, copy the published events out first
+		uint64_t head = thread->head.load(std::memory_order_acquire);
+		uint64_t begin = head > Capacity ? head - Capacity : 0;
+		std::vector<Event> events;
+		events.reserve(size_t(head - begin));
+		for (uint64_t i = begin; i < head; i++) {
+			const Slot &slot = thread->events[i % Capacity];
+			Event e = { slot.name.load(std::memory_order_relaxed), slot.begin.load(std::memory_order_relaxed), slot.end.load(std::memory_order_relaxed) };
+			events.push_back(e);
+		}
+
+		// Drop the copies of slots it wrapped around to meanwhile, including the one it may be writing
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64_t newHead = thread->head.load(std::memory_order_acquire);
+		uint64_t valid = std::max(begin, newHead + 1 > Capacity ? newHead + 1 - Capacity : 0);
+		for (uint64_t i = valid; i < head; i++) {
+			const Event &e = events[size_t(i - begin)];
+			os << ",\n{\"name\":\"" << e.name << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->id
+				<< ",\"ts\":" << double(int64_t(e.begin - mStart)) * 1e-3 << ",\"dur\":" << double(e.end - e.begin) * 1e-3 << "}";
+		}
+	}
+
+	os << "\n]}" << std::endl;
+	return bool(os);
+}
+
+VR_NAMESPACE_END
@@ -1,4 +1,7 @@
 #include "Viewer.hpp"
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
 
 VR_NAMESPACE_BEGIN
 
@@ -12,7 +15,9 @@ Viewer *__cbref;
 Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 	: title(title), width(width), height(height), interval(1.f), lastPos(0, 0)
 	, scaleMatrix(Matrix4f::Identity()), rotationMatrix(Matrix4f::Identity()), translateMatrix(Matrix4f::Identity())
-	, hmd(nullptr), uploadAnnotation(false), loadAnnotationsFlag(false), sphereRadius(0.f), sequenceNr(0), netSocket(nullptr) {
+	, hmd(nullptr), uploadAnnotation(false), loadAnnotationsFlag(false), sphereRadius(0.f), sequenceNr(0), netSocket(nullptr)
+	, annotationsVersion(0), annotationsChanged(false), renderedAnnotations(0), lastSendTime(0), viewMatrix(Matrix4f::Identity())
+	, handsTransform(Matrix4f::Identity()), simulationStep(0), simulating(false), simulationFailed(false) {
 
 	// Append networking mode in title
 	if (Settings::getInstance().NETWORK_ENABLED) {
@@ -45,7 +50,11 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	if (Settings::getInstance().USE_RIFT || fullscreen) {
+	// Offscreen rendering only
+	if (Settings::getInstance().HEADLESS)
+		glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+	if ((Settings::getInstance().USE_RIFT || fullscreen) && !Settings::getInstance().HEADLESS) {
 		GLFWmonitor *monitor = glfwGetPrimaryMonitor();
 		const GLFWvidmode *mode = glfwGetVideoMode(monitor);
 		window = glfwCreateWindow(mode->width, mode->height, this->title.c_str(), monitor, nullptr);
@@ -188,9 +197,8 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 
 			// Place object to defauls
 			case GLFW_KEY_C: {
-				 __cbref->getTranslateMatrix() = Matrix4f::Identity();
-				 __cbref->getScaleMatrix() = Matrix4f::Identity();
-				 __cbref->getTranslateMatrix() = Matrix4f::Identity();
+				if (action == GLFW_PRESS)
+					__cbref->input.resets++;
 				break;
 			}
 
@@ -224,6 +232,22 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 				break;
 			}
 
+			// Export the CPU trace
+			case GLFW_KEY_T: {
+				if (action == GLFW_PRESS)
+					__cbref->writeTrace = true;
+
+				break;
+			}
+
+			// Show/hide the GPU profiler bars
+			case GLFW_KEY_F: {
+				if (action == GLFW_PRESS)
+					Settings::getInstance().PROFILER_OVERLAY = !Settings::getInstance().PROFILER_OVERLAY;
+
+				break;
+			}
+
 			// Enable/disable sockel
 			case GLFW_KEY_E: {
 				static bool disable = false;
@@ -257,42 +281,19 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 			Vector3f unprojectedPos = unproject(pos, VM, __cbref->getRenderer()->getProjectionMatrix(), viewPortSize);
 			Vector3f worldPos = (__cbref->getMesh()->getModelMatrix() * Vector4f(unprojectedPos.x(), unprojectedPos.y(), unprojectedPos.z(), 1.f)).head(3);
 
-			// Add/Delete an annotation
-			if (!__cbref->deletePinIfHit(worldPos)) {
-				KDTree kdtree = __cbref->getMesh()->getKDTree();
-
-				// Perform search
-				KDTree::SearchResult result[2];
-				size_t resultCount = kdtree.nnSearch(unprojectedPos, 1, result);
-
-				// If there is a hit upload a pin
-				if (resultCount == 1) {
-
-					// We take the first hit
-					GenericKDTreeNode<Point3f, Point3f> kdtreeNode = kdtree[result[0].index];
-
-					// Notify the viewer
-					__cbref->uploadAnnotation = true;
-					__cbref->annotationTarget = kdtreeNode.getPosition();
-					__cbref->annotationNormal = kdtreeNode.getData();
-				}
-			}
+			// Add/Delete an annotation on the simulation thread
+			__cbref->input.picks++;
+			__cbref->input.pickPosition = unprojectedPos;
+			__cbref->input.pickWorldPosition = worldPos;
 		} else if (button == GLFW_MOUSE_BUTTON_LEFT) {
 			__cbref->arcball.button(__cbref->lastPos, action == GLFW_PRESS);
 		}
-
-		// Need to send a new packet
-		Settings::getInstance().NETWORK_NEW_DATA = true;
 	});
 
 	/* Mouse movement callback */
 	glfwSetCursorPosCallback(window, [] (GLFWwindow *window, double x, double y) {
 		__cbref->lastPos = Vector2i(int(x), int(y));
 		__cbref->arcball.motion(__cbref->lastPos);
-
-		// Need to send a new packet
-		if (__cbref->arcball.active())
-			Settings::getInstance().NETWORK_NEW_DATA = true;
 	});
 
 	/* Mouse wheel callback */
@@ -300,17 +301,11 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 		if (Settings::getInstance().NETWORK_ENABLED && Settings::getInstance().NETWORK_MODE == NETWORK_MODES::CLIENT)
 			return;
 
-		float scaleFactor = 0.05f;
-#if defined(PLATFORM_WINDOWS)
-		scaleFactor = 0.45f;
-#endif
+		// Scaled on the simulation thread
 		if (y >= 0)
-			__cbref->scaleMatrix = scale(__cbref->scaleMatrix, 1.f + scaleFactor);
+			__cbref->input.scrollUp++;
 		else
-			__cbref->scaleMatrix = scale(__cbref->scaleMatrix, 1.f - scaleFactor);
-
-		// Need to send a new packet
-		Settings::getInstance().NETWORK_NEW_DATA = true;
+			__cbref->input.scrollDown++;
 	});
 
 	/* Window size callback */
@@ -329,9 +324,11 @@ Viewer::Viewer(const std::string &title, int width, int height, bool fullscreen)
 	// Leap hands
 	hands[0] = std::make_shared<SkeletonHand>(true); // Right
 	hands[1] = std::make_shared<SkeletonHand>(false); // Left
+	renderHands[0] = std::make_shared<SkeletonHand>(true);
+	renderHands[1] = std::make_shared<SkeletonHand>(false);
 
-	// Enable HMD mode and pass through
-	bool leapReady = false;
+	// Enable HMD mode and pass through, a headless benchmark runs without a Leap service
+	bool leapReady = Settings::getInstance().HEADLESS;
 	while (!leapReady) {
 		leapController.setPolicy(Leap::Controller::POLICY_BACKGROUND_FRAMES);
 		leapController.setPolicy(Leap::Controller::POLICY_IMAGES);
@@ -373,7 +370,9 @@ void Viewer::calcAndAppendFPS () {
 		//cout << fps << endl;
 
 		// Append to window title
-		std::string newTitle = title + " | FPS: " + toString(int(fps)) + " @ " + toString(width) + "x" + toString(height);
+		std::string newTitle = title + " | FPS: " + toString(int(fps)) + " @ " + toString(width) + "x" + toString(height)
+			+ " | GPU: " + toString(GPUProfiler::getInstance().frameStats().avg) + " ms"
+			+ " | Streamed: " + toString(GLStreamBuffer::getInstance().bytesStreamed()) + " B/frame";
 		glfwSetWindowTitle(window, newTitle.c_str());
 		
 		// Reset the FPS frame counter and set the initial time to be now
@@ -434,7 +433,7 @@ void Viewer::attachLeap (std::unique_ptr<LeapListener> &l) {
 	leapListener->setHands(hands[0], hands[1]);
 }
 
-void Viewer::display(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r) {
+void Viewer::setUp(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r) {
 	renderer = std::move(r);
 	mesh = m;
 
@@ -450,98 +449,358 @@ void Viewer::display(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r) {
 	renderer->setController(leapController);
 	renderer->setHmd(hmd); 
 
+	// Index order of scanner output is close to random, reorder it for the GPU caches
+	if (Settings::getInstance().MESH_OPTIMIZE)
+		mesh->optimize();
+
 	// Place object in world for immersion
 	placeObjectAndBuildKDTree(mesh);
 
+	// Simplified levels, annotations keep snapping to the full resolution kd-tree
+	mesh->buildLODs();
+	mesh->setQuantized(Settings::getInstance().MESH_QUANTIZE);
+	mesh->setMeshletCulling(Settings::getInstance().MESH_CULL);
+
 	// Renderer pre processing
-	gestureHandler->setMesh(mesh);
 	renderer->setMesh(mesh);
-	renderer->setHands(hands[0], hands[1]);
+	renderer->setHands(renderHands[0], renderHands[1]);
 	renderer->setWindow(window);
 	renderer->updateFBSize(FBWidth, FBHeight);
+
+	// Ring buffer for all per-frame dynamic geometry
+	GLStreamBuffer::getInstance().init(Settings::getInstance().STREAM_BUFFER_SIZE);
+	GPUProfiler::getInstance().init();
 	renderer->preProcess();
 
+	// Gestures and annotations work on a stand-in of the mesh
+	model.attach(*mesh);
+	gestureHandler->setModel(&model);
+
 	// Share the HMD
 	leapListener->setHmd(hmd);
-	leapListener->setMesh(mesh);
+	leapListener->setModel(&model);
 	leapListener->setGestureHandler(gestureHandler);
-	if (Settings::getInstance().LEAP_USE_LISTENER)
-		leapController.addListener(*leapListener);
 
 	// Load annotations if desired 
 	if (loadAnnotationsFlag)
 		loadAnnotationsOnLoop(); 
 
+	// Drawn until the simulation thread published its first step
+	publish(glfwGetTime());
+
 	// Print some info
 	std::cout << info() << std::endl;
+}
 
-	// Last send time in milliseconds
-	long lastTime = glfwGetTime() * 1000;
+void Viewer::display(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r) {
+	setUp(m, r);
+
+	// Input, gestures, annotations and networking from here on run on their own thread
+	SimulationScope simulationScope(*this);
 
 	// Render loop
+	VR_TRACE_THREAD("render");
 	glfwSwapInterval(1);
 	while (!glfwWindowShouldClose(window)) {
-
-		// Poll for events to process
-		glfwPollEvents();
-
-		// Swap framebuffer, only if the rift is not attached
-		if (renderer->getClassType() != EHMDRenderer)
-			glfwSwapBuffers(window);
-
-		// Update arcball
-		if ((Settings::getInstance().NETWORK_ENABLED && !Settings::getInstance().USE_RIFT && Settings::getInstance().NETWORK_MODE == NETWORK_MODES::SERVER) ||
-			(!Settings::getInstance().NETWORK_ENABLED && !Settings::getInstance().USE_RIFT && !Settings::getInstance().USE_LEAP)) {
-			rotationMatrix = arcball.matrix(renderer->getViewMatrix());
-		}
+		VR_TRACE_SCOPE("frame");
 
 		// Bounding sphere
 		renderer->setSphereCenter(sphereCenter);
 		renderer->setSphereRadius(sphereRadius);
 
+		// Wait for the next stream buffer segment to be released by the GPU
+		{
+			VR_TRACE_SCOPE("stream wait");
+			GLStreamBuffer::getInstance().beginFrame();
+			GPUProfiler::getInstance().beginFrame();
+		}
+
+		// Sample all input as late as possible before drawing: after the waits and from one head pose
+		double inputTime;
+		bool useArcball = (Settings::getInstance().NETWORK_ENABLED && !Settings::getInstance().USE_RIFT && Settings::getInstance().NETWORK_MODE == NETWORK_MODES::SERVER) ||
+			(!Settings::getInstance().NETWORK_ENABLED && !Settings::getInstance().USE_RIFT && !Settings::getInstance().USE_LEAP);
+		{
+			VR_TRACE_SCOPE("sample input");
+			inputTime = renderer->beginFrame();
+
+			// Poll for events to process
+			{
+				VR_TRACE_SCOPE("poll events");
+				glfwPollEvents();
+			}
+
+			// Update arcball, drawn right away instead of after a simulation step
+			if (useArcball) {
+				VR_TRACE_SCOPE("arcball");
+				input.arcballRotation = arcball.matrix(renderer->getViewMatrix());
+			}
+
+			// Hand the window input to the simulation thread
+			input.arcball = useArcball;
+			input.viewMatrix = renderer->getViewMatrix();
+			inputs.write() = input;
+			inputs.publish();
+
+			// Newest simulation step, the last one is drawn again if there is none
+			checkSimulation();
+			bool stepped = snapshots.update();
+			if (stepped)
+				applySnapshot(snapshots.read());
+
+			// Hands follow the head pose of this frame, on the Rift also between simulation steps
+			const ovrPosef *headPose = renderer->getHeadPose();
+			if (stepped || (headPose && Settings::getInstance().USE_LEAP))
+				placeHands(snapshots.read(), headPose);
+		}
+		const FrameSnapshot &snapshot = snapshots.read();
+
 		// Update state
-		renderer->update(scaleMatrix, rotationMatrix, translateMatrix);
+		{
+			VR_TRACE_SCOPE("update");
+			Matrix4f scale = snapshot.scaleMatrix, translate = snapshot.translateMatrix;
+			Matrix4f rotation = useArcball ? input.arcballRotation : snapshot.rotationMatrix;
+			renderer->update(scale, rotation, translate);
+		}
 
 		// Clear buffers
-		renderer->clear(background);
+		{
+			VR_TRACE_SCOPE("clear");
+			renderer->clear(background);
+		}
 
 		// Draw using attached renderer
-		renderer->draw();
+		{
+			VR_TRACE_SCOPE("draw");
+			renderer->draw();
 
-		// Get a new leap frame if no listener is used
-		if (!Settings::getInstance().LEAP_USE_LISTENER) {
-			frame = leapListener->pollFrame(leapController);
-			renderer->setFrame(frame);
+			// Profiler bars, the Rift renderer draws them into the eye buffers
+			if (Settings::getInstance().PROFILER_OVERLAY && renderer->getClassType() != EHMDRenderer)
+				GPUProfiler::getInstance().drawOverlay(FBWidth, FBHeight);
+
+			GPUProfiler::getInstance().endFrame();
+			GLStreamBuffer::getInstance().endFrame();
 		}
-		
+
+		// Swap framebuffer or end the distortion frame of the Rift, the input is as old as the time between sampling and presenting
+		{
+			VR_TRACE_SCOPE("swap");
+			renderer->present();
+			GPUProfiler::getInstance().latency("input to present", float(1000.0 * (renderer->now() - inputTime)));
+			GPUProfiler::getInstance().latency("hands to present", float(1000.0 * (glfwGetTime() - snapshot.inputTime)));
+		}
+
 		// Calc fps
 		if (appFPS)
 			calcAndAppendFPS();
-		
-		// Add annotation
-		if (uploadAnnotation) {
-			addAnnotation(annotationTarget, annotationNormal);
-			uploadAnnotation = false;
-		}
 
-		// Networking
-		if (Settings::getInstance().NETWORK_ENABLED && (long(glfwGetTime() * 1000) - lastTime) >= Settings::getInstance().NETWORK_SEND_RATE) {
-			processNetworking();
-			lastTime = long(glfwGetTime() * 1000);
+		// Trace export requested by key press
+		if (writeTrace) {
+			VR_TRACE_WRITE(Settings::getInstance().TRACE_FILE);
+			writeTrace = false;
 		}
 	}
+
+	// Stop the simulation before the state it works on goes away
+	stopSimulation();
+	checkSimulation();
 	
 	// Renderer cleapup
 	renderer->cleanUp();
+	GLStreamBuffer::getInstance().free();
+
+	// Shader variants are compiled on first use, most of them during the first frames
+	std::cout << "Shaders: " << GLShader::compileStats().toString() << std::endl;
+
+	// GPU timings
+	std::cout << GPUProfiler::getInstance().info() << std::endl;
+	if (!Settings::getInstance().PROFILER_DUMP.empty())
+		GPUProfiler::getInstance().dump(Settings::getInstance().PROFILER_DUMP);
+	GPUProfiler::getInstance().free();
+
+	// CPU timings
+	VR_TRACE_WRITE(Settings::getInstance().TRACE_FILE);
+}
+
+/// Quoted JSON string, file names may contain backslashes and quotes
+static std::string jsonString(const std::string &s) {
+	std::ostringstream oss;
+	oss << '"';
+	for (char c : s) {
+		if (c == '"' || c == '\\')
+			oss << '\\' << c;
+		else if ((unsigned char) c < 0x20)
+			oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+		else
+			oss << c;
+	}
+	oss << '"';
+	return oss.str();
+}
+
+/// JSON array of profiler statistics, one object per line
+static void writeStats(std::ostream &json, const std::vector<GPUProfiler::Stats> &stats) {
+	json << "[\n";
+	for (size_t i = 0; i < stats.size(); i++) {
+		const GPUProfiler::Stats &s = stats[i];
+		json << "    { \"name\": " << jsonString(s.name) << ", \"samples\": " << s.samples << ", \"min\": " << s.min
+			<< ", \"avg\": " << s.avg << ", \"p99\": " << s.p99 << " }" << (i + 1 < stats.size() ? "," : "") << "\n";
+	}
+	json << "  ]";
+}
+
+void Viewer::benchmark(std::shared_ptr<Mesh> &m, std::unique_ptr<Renderer> &r, int frames, const std::string &output) {
+	// Same pins and colors on every run
+	srand(0);
+	setUp(m, r);
+
+	// Render into an offscreen target of the window size
+	GLFramebuffer target;
+	target.init(Vector2i(width, height), 1, false);
+	renderer->updateFBSize(width, height);
+
+	// Synthetic annotations on evenly spaced vertices
+	int pins = std::min<int>(Settings::getInstance().BENCH_PINS, mesh->getVertexCount());
+	for (int i = 0; i < pins; i++) {
+		int index = int((int64_t(mesh->getVertexCount()) * i) / pins);
+		Vector3f pos = mesh->getVertexPositions().col(index), n = mesh->getVertexNormals().col(index);
+		addAnnotation(pos, n);
+	}
+
+	// Upload the pins
+	publish(glfwGetTime());
+	if (snapshots.update())
+		applySnapshot(snapshots.read());
+
+	// Hands are only drawn if the Leap is in use
+	bool synthHands = Settings::getInstance().BENCH_HANDS;
+	Settings::getInstance().USE_LEAP = synthHands;
+
+	// The simulation runs as in display(), the rotation along the path is its arcball input and sent to clients
+	SimulationScope simulationScope(*this);
+
+	const int warmup = 10;
+	std::vector<double> times;
+	times.reserve(frames);
+
+	// Presenting must not wait for the vertical blank
+	glfwSwapInterval(0);
+
+	target.bind();
+	glViewport(0, 0, width, height);
+	for (int i = -warmup; i < frames; i++) {
+		// One full turn around the up axis with a slight wobble
+		float t = 2.f * float(M_PI) * float(i) / float(frames);
+		Matrix4f rotation = Matrix4f::Identity();
+		rotation.block<3, 3>(0, 0) = (Eigen::AngleAxisf(t, Vector3f::UnitY()) * Eigen::AngleAxisf(0.25f * std::sin(t), Vector3f::UnitX())).toRotationMatrix();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		GLStreamBuffer::getInstance().beginFrame();
+		GPUProfiler::getInstance().beginFrame();
+
+		// Input is sampled at the same point of the frame as in display()
+		double inputTime = renderer->beginFrame();
+		input.arcball = true;
+		input.arcballRotation = rotation;
+		input.viewMatrix = renderer->getViewMatrix();
+		inputs.write() = input;
+		inputs.publish();
+		checkSimulation();
+		if (snapshots.update())
+			applySnapshot(snapshots.read());
+		const FrameSnapshot &snapshot = snapshots.read();
+
+		if (synthHands) {
+			Vector3f offset(0.6f * sphereRadius + 0.05f * std::sin(3.f * t), 0.f, 0.2f * sphereRadius);
+			renderHands[0]->pose(sphereCenter + offset, 0.2f);
+			renderHands[1]->pose(sphereCenter + Vector3f(-offset.x(), offset.y(), offset.z()), 0.2f);
+		}
+
+		Matrix4f scale = snapshot.scaleMatrix, translate = snapshot.translateMatrix;
+		renderer->update(scale, rotation, translate);
+		renderer->clear(background);
+		renderer->draw();
+		GPUProfiler::getInstance().endFrame();
+		GLStreamBuffer::getInstance().endFrame();
+
+		// Swaps the hidden window, the offscreen target is unaffected
+		renderer->present();
+		GPUProfiler::getInstance().latency("input to present", float(1000.0 * (renderer->now() - inputTime)));
+		GPUProfiler::getInstance().latency("hands to present", float(1000.0 * (glfwGetTime() - snapshot.inputTime)));
+		glFinish();
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		if (i >= 0) {
+			times.push_back(ms);
+		} else if (i == -1) {
+			GPUProfiler::getInstance().flush();
+			GPUProfiler::getInstance().reset();
+		}
+	}
+	GPUProfiler::getInstance().flush();
+	target.release();
+
+	stopSimulation();
+	checkSimulation();
+
+	// CPU frame time statistics, including the wait for the GPU
+	std::vector<double> sorted(times);
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted](double p) {
+		return sorted.empty() ? 0.0 : sorted[size_t(p * (sorted.size() - 1) + 0.5)];
+	};
+	double sum = 0.0;
+	for (double t : times)
+		sum += t;
+
+	// All variants the frames used, compiled on first bind
+	const GLShader::CompileStats &shaders = GLShader::compileStats();
+
+	const char *glRenderer = (const char *) glGetString(GL_RENDERER);
+	std::ostringstream json;
+	json << "{\n"
+		<< "  \"model\": " << jsonString(mesh->getName()) << ",\n"
+		<< "  \"vertices\": " << mesh->getVertexCount() << ",\n"
+		<< "  \"triangles\": " << mesh->getTriangleCount() << ",\n"
+		<< "  \"acmr\": { \"loaded\": " << mesh->getACMR(false) << ", \"optimized\": " << mesh->getACMR() << " },\n"
+		<< "  \"gpuBytes\": " << mesh->getGPUBytes() << ",\n"
+		<< "  \"gl_renderer\": " << jsonString(glRenderer ? glRenderer : "") << ",\n"
+		<< "  \"resolution\": [" << width << ", " << height << "],\n"
+		<< "  \"frames\": " << times.size() << ",\n"
+		<< "  \"pins\": " << pins << ",\n"
+		<< "  \"hands\": " << (synthHands ? "true" : "false") << ",\n"
+		<< "  \"shaders\": { \"compiled\": " << shaders.compiled << ", \"compile_ms\": " << shaders.compileTime
+		<< ", \"cached\": " << shaders.cached << ", \"cache_ms\": " << shaders.cacheTime << " },\n"
+		<< "  \"frame_ms\": { \"min\": " << percentile(0.0) << ", \"avg\": " << (times.empty() ? 0.0 : sum / times.size())
+		<< ", \"p50\": " << percentile(0.5) << ", \"p99\": " << percentile(0.99) << ", \"max\": " << percentile(1.0) << " },\n"
+		<< "  \"gpu_ms\": ";
+	writeStats(json, GPUProfiler::getInstance().stats());
+	json << ",\n  \"counters_pct\": ";
+	writeStats(json, GPUProfiler::getInstance().counters());
+	json << ",\n  \"latency_ms\": ";
+	writeStats(json, GPUProfiler::getInstance().latencies());
+	json << "\n}\n";
+
+	std::cout << json.str();
+	std::ofstream os(output);
+	if (!os)
+		throw std::runtime_error("Could not write benchmark results to " + output);
+	os << json.str();
+
+	// Release everything as after the render loop
+	target.free();
+	renderer->cleanUp();
+	GLStreamBuffer::getInstance().free();
+	GPUProfiler::getInstance().free();
 }
 
 void Viewer::processNetworking () {
+	VR_TRACE_SCOPE("Viewer::processNetworking");
 	if (Settings::getInstance().NETWORK_MODE == NETWORK_MODES::SERVER && Settings::getInstance().NETWORK_NEW_DATA)  {
 		netSocket->send(serializeTransformationState(), Settings::getInstance().NETWORK_IP, Settings::getInstance().NETWORK_PORT);
 
 		// Increase sequence nr
 		sequenceNr = (sequenceNr + 1) % std::numeric_limits<long>::max();
-	} else if (Settings::getInstance().NETWORK_LISTEN) {
+	} else if (netSocket->isListening()) {
 		netSocket->receive();
 	}
 
@@ -575,10 +834,11 @@ void Viewer::processNetworking () {
 				content = content.substr(0, content.find_last_of('}'));
 				std::vector<Pin> toDelete = getAnnotationsFromString(content);
 				for (auto &pDelete : toDelete) {
-					for (auto iter = pinList.begin(); iter != pinList.end(); iter++) {
+					for (auto iter = annotations.begin(); iter != annotations.end(); iter++) {
 						if (**iter == pDelete) {
-							(*iter)->releaseBuffers();
-							pinList.erase(iter);
+							// The render thread releases its copy with the next snapshot
+							annotations.erase(iter);
+							annotationsChanged = true;
 							break;
 						}
 					}
@@ -588,19 +848,241 @@ void Viewer::processNetworking () {
 	}
 }
 
+void Viewer::simulate() {
+	VR_TRACE_THREAD("simulation");
+	lastSendTime = long(glfwGetTime() * 1000);
+	const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::duration<double>(1.0 / std::max(1.f, Settings::getInstance().SIMULATION_RATE)));
+
+	try {
+		auto next = std::chrono::steady_clock::now();
+		while (simulating) {
+			step();
+
+			// Fixed rate, steps which took too long are not caught up
+			next += period;
+			auto now = std::chrono::steady_clock::now();
+			if (next < now)
+				next = now;
+			else
+				std::this_thread::sleep_until(next);
+		}
+	} catch (...) {
+		// Handed to the render thread, e.g. a socket error, instead of terminating
+		simulationError = std::current_exception();
+		simulationFailed = true;
+	}
+}
+
+void Viewer::startSimulation() {
+	simulationFailed = false;
+	simulationError = nullptr;
+	simulating = true;
+	simulation = std::thread(&Viewer::simulate, this);
+}
+
+void Viewer::stopSimulation() {
+	simulating = false;
+	if (simulation.joinable())
+		simulation.join();
+}
+
+void Viewer::checkSimulation() {
+	if (simulationFailed) {
+		simulationFailed = false;
+		std::rethrow_exception(simulationError);
+	}
+}
+
+void Viewer::step() {
+	VR_TRACE_SCOPE("simulation step");
+
+	// Window input of the newest render frame
+	if (inputs.update())
+		applyInput(inputs.read());
+
+	// Gestures and hit tests see the model as published last
+	model.setScaleMatrix(scaleMatrix);
+	model.setRotationMatrix(rotationMatrix);
+	model.setTranslateMatrix(translateMatrix);
+	model.update();
+
+	// Leap frame, transformed with the head pose at polling time. Gestures are recognized while polling
+	double inputTime = glfwGetTime();
+	{
+		VR_TRACE_SCOPE("leap poll");
+		ovrPosef headPose = {};
+		if (hmd)
+			headPose = ovrHmd_GetTrackingState(hmd, ovr_GetTimeInSeconds()).HeadPose.ThePose;
+		handsTransform = leapListener->getTransformationMatrix(headPose);
+		frame = leapListener->pollFrame(leapController, handsTransform);
+	}
+
+	// Add annotation
+	if (uploadAnnotation) {
+		VR_TRACE_SCOPE("annotation upload");
+		addAnnotation(annotationTarget, annotationNormal);
+		uploadAnnotation = false;
+	}
+
+	// Networking
+	if (Settings::getInstance().NETWORK_ENABLED && (long(glfwGetTime() * 1000) - lastSendTime) >= Settings::getInstance().NETWORK_SEND_RATE) {
+		VR_TRACE_SCOPE("networking");
+		processNetworking();
+		lastSendTime = long(glfwGetTime() * 1000);
+	}
+
+	publish(inputTime);
+}
+
+void Viewer::applyInput(const InputState &in) {
+	viewMatrix = in.viewMatrix;
+	if (in.arcball && in.arcballRotation != rotationMatrix) {
+		rotationMatrix = in.arcballRotation;
+		Settings::getInstance().NETWORK_NEW_DATA = true;
+	}
+
+	// Mouse wheel
+	float scaleFactor = 0.05f;
+#if defined(PLATFORM_WINDOWS)
+	scaleFactor = 0.45f;
+#endif
+	for (unsigned int i = lastInput.scrollUp; i != in.scrollUp; i++)
+		scaleMatrix = scale(scaleMatrix, 1.f + scaleFactor);
+	for (unsigned int i = lastInput.scrollDown; i != in.scrollDown; i++)
+		scaleMatrix = scale(scaleMatrix, 1.f - scaleFactor);
+	if (in.scrollUp != lastInput.scrollUp || in.scrollDown != lastInput.scrollDown)
+		Settings::getInstance().NETWORK_NEW_DATA = true;
+
+	// Place object to defaults
+	if (in.resets != lastInput.resets) {
+		translateMatrix = Matrix4f::Identity();
+		scaleMatrix = Matrix4f::Identity();
+		Settings::getInstance().NETWORK_NEW_DATA = true;
+	}
+
+	// Add/Delete an annotation
+	if (in.picks != lastInput.picks)
+		pick(in.pickPosition, in.pickWorldPosition);
+
+	lastInput = in;
+}
+
+void Viewer::pick(const Vector3f &position, Vector3f worldPosition) {
+	if (deletePinIfHit(worldPosition))
+		return;
+
+	// Perform search
+	const KDTree &kdtree = model.getKDTree();
+	KDTree::SearchResult result[2];
+	size_t resultCount = kdtree.nnSearch(position, 1, result);
+
+	// If there is a hit add a pin at the first one
+	if (resultCount == 1) {
+		const GenericKDTreeNode<Point3f, Point3f> &kdtreeNode = kdtree[result[0].index];
+		Vector3f target = kdtreeNode.getPosition(), normal = kdtreeNode.getData();
+		addAnnotation(target, normal);
+	}
+}
+
+void Viewer::publish(double inputTime) {
+	FrameSnapshot &snapshot = snapshots.write();
+	snapshot.step = ++simulationStep;
+	snapshot.inputTime = inputTime;
+	snapshot.scaleMatrix = scaleMatrix;
+	snapshot.rotationMatrix = rotationMatrix;
+	snapshot.translateMatrix = translateMatrix;
+	snapshot.hands[0] = *hands[0];
+	snapshot.hands[1] = *hands[1];
+	snapshot.handsTransform = handsTransform;
+	snapshot.frame = frame;
+	snapshot.gestures = gestureHandler->getFeedback();
+
+	// The list is immutable once published, it is only copied after a change
+	if (annotationsChanged || !publishedAnnotations) {
+		std::shared_ptr<std::vector<Annotation>> list = std::make_shared<std::vector<Annotation>>();
+		for (auto &pin : annotations) {
+			Annotation annotation = { pin->getPosition(), pin->getNormal(), pin->getColor() };
+			list->push_back(annotation);
+		}
+		publishedAnnotations = list;
+		annotationsVersion++;
+		annotationsChanged = false;
+	}
+	snapshot.annotations = publishedAnnotations;
+	snapshot.annotationsVersion = annotationsVersion;
+
+	snapshots.publish();
+}
+
+void Viewer::applySnapshot(const FrameSnapshot &snapshot) {
+	VR_TRACE_SCOPE("apply snapshot");
+
+	// Passthrough images and gesture feedback
+	Leap::Frame f = snapshot.frame;
+	renderer->setFrame(f);
+	renderer->setGestures(snapshot.gestures);
+
+	// Release deleted pins and upload added ones
+	if (snapshot.annotationsVersion != renderedAnnotations) {
+		VR_TRACE_SCOPE("annotation upload");
+		const std::vector<Annotation> &list = *snapshot.annotations;
+		auto published = [&list](const std::shared_ptr<Pin> &pin) {
+			return std::any_of(list.begin(), list.end(), [&pin](const Annotation &a) { return vector3fAlmostEqual(a.position, pin->getPosition()); });
+		};
+		auto uploaded = [this](const Annotation &a) {
+			return std::any_of(pinList.begin(), pinList.end(), [&a](const std::shared_ptr<Pin> &pin) { return vector3fAlmostEqual(a.position, pin->getPosition()); });
+		};
+
+		// The destructor of a pin releases its buffers
+		pinList.erase(std::remove_if(pinList.begin(), pinList.end(), [&published](const std::shared_ptr<Pin> &pin) { return !published(pin); }), pinList.end());
+
+		Matrix3f nm = mesh->getNormalMatrix();
+		for (const Annotation &a : list) {
+			if (uploaded(a))
+				continue;
+
+			std::shared_ptr<Pin> pin = std::make_shared<Pin>(a.position, a.normal, nm);
+			pin->setColor(a.color);
+			pin->setParent(mesh.get());
+			pinList.push_back(pin);
+			renderer->uploadAnnotation(pin, pinList);
+		}
+
+		renderedAnnotations = snapshot.annotationsVersion;
+	}
+}
+
+void Viewer::placeHands(const FrameSnapshot &snapshot, const ovrPosef *headPose) {
+	VR_TRACE_SCOPE("place hands");
+
+	// The simulation placed the hands with its own, older head pose. Both transforms share the Leap mount and scale, the correction is rigid
+	Matrix4f correction = Matrix4f::Identity();
+	if (headPose)
+		correction = leapListener->getTransformationMatrix(*headPose) * snapshot.handsTransform.inverse();
+
+	for (int i = 0; i < 2; i++) {
+		HandState &state = *renderHands[i];
+		state = snapshot.hands[i];
+		if (headPose)
+			state.transform(correction);
+		renderHands[i]->place();
+	}
+}
+
 bool Viewer::deletePinIfHit(Vector3f &position) {
 	bool found = false;
-	for (auto iter = pinList.begin(); iter != pinList.end(); iter++) {
+	for (auto iter = annotations.begin(); iter != annotations.end(); iter++) {
 		BoundingBox3f bbox = (*iter)->getBoundingBox();
 		if (bbox.contains(position)) {
 
 			// Copy pin and inform the client
-			Pin copy((*iter)->getPosition(), (*iter)->getNormal(), mesh->getNormalMatrix());
+			Pin copy((*iter)->getPosition(), (*iter)->getNormal(), model.getNormalMatrix());
 			pinListDelete.push_back(copy);
 
-			// Clear graphics memory and delete it safely
-			(*iter)->releaseBuffers();
-			pinList.erase(iter);
+			// The render thread releases its copy with the next snapshot
+			annotations.erase(iter);
+			annotationsChanged = true;
 			found = true;
 
 			// Need to send a new packet
@@ -613,7 +1095,7 @@ bool Viewer::deletePinIfHit(Vector3f &position) {
 }
 
 std::string Viewer::serializeTransformationState () {
-	Matrix4f vm = renderer->getViewMatrix();
+	Matrix4f vm = viewMatrix;
 
 	// Matrices are stored row major
 	std::string state;
@@ -693,7 +1175,7 @@ std::vector<Pin> Viewer::getAnnotationsFromString(std::string &s) {
 					break;
 			}
 
-			Matrix3f nm = mesh->getNormalMatrix();
+			Matrix3f nm = model.getNormalMatrix();
 			Pin pin(position, normal, nm);
 			pin.setColor(color);
 			list.push_back(pin);
@@ -721,13 +1203,15 @@ void Viewer::addAnnotation(const Vector3f &pos, const Vector3f &n, const Vector3
 	if (mesh == nullptr)
 		throw std::runtime_error("No mesh to add annotations");
 
-	Matrix3f nm = mesh->getNormalMatrix();
+	Matrix3f nm = model.getNormalMatrix();
 	std::shared_ptr<Pin> pin = std::make_shared<Pin>(pos, n, nm);
 	pin->setColor(c);
+	pin->setParent(&model);
 
-	if (!pinListContains(pinList, *pin)) {
-		pinList.push_back(pin);
-		renderer->uploadAnnotation(pin, pinList);
+	// Uploaded by the render thread with the next snapshot
+	if (!pinListContains(annotations, *pin)) {
+		annotations.push_back(pin);
+		annotationsChanged = true;
 
 		// Need to send a new packet
 		Settings::getInstance().NETWORK_NEW_DATA = true;
@@ -740,6 +1224,7 @@ void Viewer::addAnnotation(const Vector3f &pos, const Vector3f &n, const Vector3
 }
 
 void Viewer::loadAnnotationsOnLoop() {
+	VR_TRACE_SCOPE("Viewer::loadAnnotationsOnLoop");
 	if (!fileExists(annotationsLoadPath))
 		throw std::runtime_error("File "+annotationsLoadPath+" does not exists!");
 
@@ -788,6 +1273,7 @@ std::string Viewer::info () {
 		"  Size = "+toString(width) + " x " + toString(height)+",\n"
 		"  FBSize = "+toString(FBWidth) + " x " + toString(FBHeight)+",\n"
 		"  Renderer = "+indent((renderer ? renderer->info() : "null"))+",\n"
+		"  Shaders = "+GLShader::compileStats().toString()+" before the first frame,\n"
 		"  Mesh = "+indent((mesh ? mesh->toString() : "null"))+"\n"
 		"]\n";
 }
@@ -829,9 +1315,7 @@ std::unique_ptr<Renderer> &Viewer::getRenderer () {
 }
 
 Viewer::~Viewer () {
-	// Remove leap listeners if any
-	if (Settings::getInstance().LEAP_USE_LISTENER)
-		leapController.removeListener(*leapListener);
+	stopSimulation();
 
 	glfwDestroyWindow(window);
 	glfwTerminate();
@@ -1,4 +1,6 @@
 #include "common.hpp"
+#include <atomic>
+#include <thread>
 
 VR_NAMESPACE_BEGIN
 
@@ -135,6 +137,39 @@ bool fileExists(const std::string &name) {
 	}
 }
 
+uint64_t fnv1a(const std::string &str, uint64_t hash) {
+	for (unsigned char c : str) {
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+uint64_t fnv1a(const void *data, size_t size, uint64_t hash) {
+	const unsigned char *bytes = (const unsigned char *) data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+void parallelFor(int count, const std::function<void(int)> &body) {
+	std::atomic<int> next(0);
+	auto work = [&]() {
+		for (int i = next++; i < count; i = next++)
+			body(i);
+	};
+
+	int threadCount = std::max(1, std::min<int>(int(std::thread::hardware_concurrency()), count));
+	std::vector<std::thread> threads;
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(work));
+	work();
+	for (auto &t : threads)
+		t.join();
+}
+
 Matrix4f stringToMatrix4f (std::string &s) {
 	std::istringstream ss(s);
 	float value;
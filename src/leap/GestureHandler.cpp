@@ -5,7 +5,7 @@ using namespace Leap;
 VR_NAMESPACE_BEGIN
 
 GestureHandler::GestureHandler()
-	 : viewer(nullptr) {
+	 : viewer(nullptr), model(nullptr) {
 
 }
 
@@ -23,7 +23,7 @@ void GestureHandler::pinch (GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 		case GESTURE_STATES::UPDATE: {
 			//Settings::getInstance().MATERIAL_COLOR = Vector3f(0.f, 0.8f, 0.f);
 			// Convert world coordinates to local coordinates
-			Matrix4f worldToLocal = mesh->getModelMatrix().inverse();
+			Matrix4f worldToLocal = model->getModelMatrix().inverse();
 			Vector3f localTipPosition = (worldToLocal * Vector4f(avgPinchPos.x(), avgPinchPos.y(), avgPinchPos.z(), 1.f)).head(3);
 			
 			// Check if we hit any existing pin. If yes, remove it
@@ -32,7 +32,7 @@ void GestureHandler::pinch (GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 
 			// Use the kdtree to search for the nearest point to the tip position to place a pin
 			if (!found) {
-				KDTree kdtree = mesh->getKDTree();
+				const KDTree &kdtree = model->getKDTree();
 
 				// Perform search
 				KDTree::SearchResult results[2];
@@ -41,10 +41,10 @@ void GestureHandler::pinch (GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 				// If there is a hit upload a pin
 				if (resultCount == 1) {
 
-					GenericKDTreeNode<Point3f, Point3f> kdtreeNode = kdtree[results[0].index];
+					const GenericKDTreeNode<Point3f, Point3f> &kdtreeNode = kdtree[results[0].index];
 
 					Vector3f p = kdtreeNode.getPosition();
-					Vector3f worldPos = (mesh->getModelMatrix() * Vector4f(p.x(), p.y(), p.z(), 1.f)).head(3);
+					Vector3f worldPos = (model->getModelMatrix() * Vector4f(p.x(), p.y(), p.z(), 1.f)).head(3);
 
 					// Only if close enouth to surface
 					if ((worldPos - avgPinchPos).norm() <= Settings::getInstance().ANNOTATION_SEACH_RADIUS) {
@@ -78,19 +78,18 @@ void GestureHandler::rotate(GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 	static Vector3f center(0.f, 0.f, 0.f);
 	static float radius = 0.f;
 	static float lastPitch = 0.f;
-	float diameter = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm();
+	float diameter = (model->getBoundingBox().min - model->getBoundingBox().max).norm();
 
 	switch (state) {
 		case GESTURE_STATES::START: {
 			// Settings::getInstance().MATERIAL_COLOR = Vector3f(0.8f, 0.f, 0.f);
-			Settings::getInstance().SPHERE_ALPHA_BLEND_INTRO = true;
-			Settings::getInstance().SHOW_SPHERE = true;
-			center = mesh->getBoundingBox().getCenter();
+			feedback.sphereIntro = true;
+			center = model->getBoundingBox().getCenter();
 			radius = diameter * Settings::getInstance().SPHERE_MEDIUM_SCALE;
 			lastPos = projectOnSphere(midPoint, center, radius);
 			quat = Quaternionf::Identity();
 			lastPitch = hands[hand]->palm.pitch;
-			Settings::getInstance().ROTATION_ACTIVE = true;
+			feedback.rotating = true;
 			break;
 		}
 
@@ -102,17 +101,22 @@ void GestureHandler::rotate(GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 			Vector3f spherePoint = projectToSphere(midPoint, center, assistanceRadius);
 			float distance = (spherePoint - midPoint).norm();
 			float innerDistance = distance / clamp((Settings::getInstance().SPHERE_VISUAL_SCALE - Settings::getInstance().SPHERE_SMALL_SCALE) * 0.5f);
-			Settings::getInstance().MATERIAL_COLOR_ROTATION = Vector3f(innerDistance, 1.f - innerDistance, 0.f);
+			feedback.fingerColor = Vector3f(innerDistance, 1.f - innerDistance, 0.f);
 			
-			// Sphere blend
-			if (!Settings::getInstance().SPHERE_ALPHA_BLEND_INTRO) {
+			// Sphere blend, fades in first
+			if (feedback.sphereIntro) {
+				if (feedback.sphereAlpha < 0.3f)
+					feedback.sphereAlpha += GestureFeedback::fadeStep(0.02f);
+				else
+					feedback.sphereIntro = false;
+			} else {
 				if (!insideSphere(midPoint, center, diameter * Settings::getInstance().SPHERE_MEDIUM_SCALE)) {
 					float l = diameter * Settings::getInstance().SPHERE_LARGE_SCALE;
 					Vector3f largeSpherePoint = projectToSphere(midPoint, center, l);
 					float outerDistance = (largeSpherePoint - spherePoint).norm();
-					Settings::getInstance().SPHERE_ALPHA_BLEND = 0.3f - 0.3f * clamp(distance / outerDistance);
+					feedback.sphereAlpha = 0.3f - 0.3f * clamp(distance / outerDistance);
 				} else {
-					Settings::getInstance().SPHERE_ALPHA_BLEND = 0.3f;
+					feedback.sphereAlpha = 0.3f;
 				}
 			}
 			
@@ -148,16 +152,17 @@ void GestureHandler::rotate(GESTURE_STATES state, HANDS hand, std::shared_ptr<Sk
 
 			// Need to send a new packet
 			Settings::getInstance().NETWORK_NEW_DATA = true;
-			Settings::getInstance().ROTATION_ACTIVE = true;
+			feedback.rotating = true;
  			break;
 		}
 
 		case GESTURE_STATES::STOP:
 		case GESTURE_STATES::INVALID:
 		default: {
-			Settings::getInstance().MATERIAL_COLOR_ROTATION = Settings::getInstance().MATERIAL_COLOR;
-			Settings::getInstance().SHOW_SPHERE = false;
-			Settings::getInstance().ROTATION_ACTIVE = false;
+			// Fingers take the color of the hand, see PerspectiveRenderer::draw
+			feedback.fingerColor = Vector3f(1.f, 1.f, 1.f);
+			feedback.sphereIntro = false;
+			feedback.rotating = false;
 			// Settings::getInstance().MATERIAL_COLOR = Vector3f(0.8f, 0.8f, 0.8f);
 			break;
 		}
@@ -180,9 +185,9 @@ void GestureHandler::scale(GESTURE_STATES state, std::shared_ptr<SkeletonHand>(&
 	switch (state) {
 		case GESTURE_STATES::START: {
 			//Settings::getInstance().MATERIAL_COLOR = Vector3f(0.f, 0.8f, 0.f);
-			diagStart = (mesh->getBoundingBox().max - mesh->getBoundingBox().min).norm();
+			diagStart = (model->getBoundingBox().max - model->getBoundingBox().min).norm();
 			initialScale = viewer->getScaleMatrix();
-			Settings::getInstance().MESH_DRAW_BBOX = true;
+			feedback.scaling = true;
 		}
 
 		case GESTURE_STATES::UPDATE: {
@@ -190,7 +195,7 @@ void GestureHandler::scale(GESTURE_STATES state, std::shared_ptr<SkeletonHand>(&
 			//Settings::getInstance().MATERIAL_COLOR = Vector3f(0.f, 0.8f, 0.f);
 			if (dotProd <= dotProdThreshold) {
 				// We want that the bounding box fits our hands when scaling
-				BoundingBox3f bbox = mesh->getBoundingBox();
+				BoundingBox3f bbox = model->getBoundingBox();
 				float diag = (bbox.max - bbox.min).norm();
 				float factor = (distance / diag);
 
@@ -215,7 +220,7 @@ void GestureHandler::scale(GESTURE_STATES state, std::shared_ptr<SkeletonHand>(&
 		case GESTURE_STATES::INVALID:
 		default: {
 			// Settings::getInstance().MATERIAL_COLOR = Vector3f(0.8f, 0.8f, 0.8f);
-			Settings::getInstance().MESH_DRAW_BBOX = false;
+			feedback.scaling = false;
 			break;
 		}
 	}
@@ -266,8 +271,8 @@ void GestureHandler::setViewer (Viewer *v) {
 	viewer = v;
 }
 
-void GestureHandler::setMesh (std::shared_ptr<Mesh> &m) {
-	mesh = m;
+void GestureHandler::setModel (ModelNode *m) {
+	model = m;
 }
 
 VR_NAMESPACE_END
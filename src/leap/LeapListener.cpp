@@ -6,7 +6,7 @@ using namespace Leap;
 using namespace std;
 
 LeapListener::LeapListener(bool useRift)
-	: windowWidth(0.f), windowHeight(0.f), FBWidth(0.f), FBHeight(0.f), riftMounted(useRift), hmd(nullptr) {
+	: windowWidth(0.f), windowHeight(0.f), FBWidth(0.f), FBHeight(0.f), riftMounted(useRift), hmd(nullptr), model(nullptr) {
 
 	// A List of all gestures an their initial state, 0 = right hand, 1 = left hand
 	for (int i = 0; i < 2; i++) {
@@ -17,11 +17,8 @@ LeapListener::LeapListener(bool useRift)
 	gestureZoom = GESTURE_STATES::STOP;
 }
 
-Matrix4f LeapListener::getTransformationMatrix() {
+Matrix4f LeapListener::getTransformationMatrix(const ovrPosef &headPose) const {
 	if (Settings::getInstance().USE_RIFT) {
-		// Average of the left and right camera positions
-		ovrPosef headPose = ovrHmd_GetTrackingState(hmd, Settings::getInstance().FRAME_TIME).HeadPose.ThePose;
-
 		// Add camera offset to the head position
 		ovrVector3f cameraPose;
 		cameraPose.x = headPose.Position.x + Settings::getInstance().CAMERA_OFFSET.x();
@@ -64,7 +61,7 @@ Matrix4f LeapListener::getTransformationMatrix() {
 		return T;
 	} else {
 		float s = 0.001f;
-		static Matrix4f T;
+		Matrix4f T;
 
 		T << s, 0.f, 0.f, -Settings::getInstance().LEAP_NO_HMD_OFFSET.x(),
 			 0.f, s, 0.f, -Settings::getInstance().LEAP_NO_HMD_OFFSET.y(),
@@ -75,11 +72,11 @@ Matrix4f LeapListener::getTransformationMatrix() {
 	}
 }
 
-Leap::Frame LeapListener::pollFrame(const Leap::Controller &controller) {
+Leap::Frame LeapListener::pollFrame(const Leap::Controller &controller, const Matrix4f &worldTransform) {
+	VR_TRACE_SCOPE("LeapListener::pollFrame");
 	Leap::Frame frame = controller.frame(0);
 
 	// Get Rotation and translation matrix
-	const Matrix4f worldTransform = getTransformationMatrix();
 	const Matrix3f rotation = worldTransform.block<3, 3>(0, 0);
 	const Vector3f translation = worldTransform.block<3, 1>(0, 3);
 
@@ -125,10 +122,7 @@ Leap::Frame LeapListener::pollFrame(const Leap::Controller &controller) {
 			currentHand->palm.direction = palmDirection;
 			currentHand->palm.normal = palmNormal;
 			currentHand->palm.side = palmSide;
-
-			// Transform
-			currentHand->mesh.palm.translate(palm.x(), palm.y(), palm.z());
-			currentHand->mesh.palm.setRotationMatrix(rot);
+			currentHand->palm.rotation = rot;
 
 			// For all fingers
 			const FingerList fingers = hand.fingers();
@@ -142,25 +136,17 @@ Leap::Frame LeapListener::pollFrame(const Leap::Controller &controller) {
 				currentHand->finger[finger.type()].extended = finger.isExtended();
 				currentHand->finger[finger.type()].direction = direction;
 
-				// Transform
-				currentHand->mesh.finger[finger.type()].translate(tip.x(), tip.y(), tip.z());
-				currentHand->mesh.finger[finger.type()].setRotationMatrix(rot);
-
 				// Bones
 				for (int k = 0; k < currentHand->mesh.nrOfJoints; k++) {
 					// Joints
 					Leap::Bone bone = finger.bone(static_cast<Leap::Bone::Type>(k));
 					Vector3f jointPosition = rotation * bone.nextJoint().toVector3<Vector3f>() + translation;
 					currentHand->finger[finger.type()].jointPositions[k] = Vector3f(jointPosition.x(), jointPosition.y(), jointPosition.z());
-					currentHand->mesh.joints[i][k].translate(jointPosition.x(), jointPosition.y(), jointPosition.z());
-					currentHand->mesh.joints[i][k].setRotationMatrix(rot);
 
 					// Closing joint for metacarpal and proxicarpal
 					if (finger.type() == Finger::Type::TYPE_PINKY && k == 0) {
 						Vector3f handJointPos = rotation * bone.prevJoint().toVector3<Vector3f>() + translation;
 						currentHand->handJointPosition = handJointPos;
-						currentHand->mesh.handJoint.translate(handJointPos.x(), handJointPos.y(), handJointPos.z());
-						currentHand->mesh.handJoint.setRotationMatrix(rot);
 					}
 				}
 
@@ -211,11 +197,10 @@ Leap::Frame LeapListener::pollFrame(const Leap::Controller &controller) {
 	return frame;
 }
 
-void LeapListener::onFrame(const Controller &controller) {
-	pollFrame(controller);
-}
-
 void LeapListener::gesturesStateMachines() {
+	VR_TRACE_SCOPE("LeapListener::gesturesStateMachines");
+	GestureFeedback &feedback = gestureHandler->getFeedback();
+
 	/**
 	* Zoom state machine
 	*/
@@ -287,8 +272,8 @@ void LeapListener::gesturesStateMachines() {
 		float rotationGrabStrenth = 0.7f;
 
 		// Compute spheres
-		Vector3f sphereCenter = mesh->getBoundingBox().getCenter();
-		float diameter = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm();
+		Vector3f sphereCenter = model->getBoundingBox().getCenter();
+		float diameter = (model->getBoundingBox().min - model->getBoundingBox().max).norm();
 		float sphereRadius_Small = diameter * Settings::getInstance().SPHERE_SMALL_SCALE;
 		float sphereRadius_Pinch = diameter * Settings::getInstance().SPHERE_SPINCH_SCALE;
 		float sphereRadius_Medium = diameter * Settings::getInstance().SPHERE_MEDIUM_SCALE;
@@ -461,16 +446,16 @@ void LeapListener::gesturesStateMachines() {
 			if (glfwGetTime() - t0[i] >= 0.75f) {
 				hint[i] = true;
 				
-				if (Settings::getInstance().SPHERE_ALPHA_BLEND < 0.3f && increasing[i])
-					Settings::getInstance().SPHERE_ALPHA_BLEND += 0.04f;
+				if (feedback.sphereAlpha < 0.3f && increasing[i])
+					feedback.sphereAlpha += GestureFeedback::fadeStep(0.04f);
 				
-				if (Settings::getInstance().SPHERE_ALPHA_BLEND >= 0.3f && increasing[i])
+				if (feedback.sphereAlpha >= 0.3f && increasing[i])
 					increasing[i] = false;
 				
-				if (Settings::getInstance().SPHERE_ALPHA_BLEND > 0.f && !increasing[i])
-					Settings::getInstance().SPHERE_ALPHA_BLEND -= 0.04f;
+				if (feedback.sphereAlpha > 0.f && !increasing[i])
+					feedback.sphereAlpha -= GestureFeedback::fadeStep(0.04f);
 				
-				if (Settings::getInstance().SPHERE_ALPHA_BLEND <= 0.f && !increasing[i])
+				if (feedback.sphereAlpha <= 0.f && !increasing[i])
 					increasing[i] = true;
 
 			}
@@ -479,8 +464,12 @@ void LeapListener::gesturesStateMachines() {
 			t0[i] = glfwGetTime();
 		}
 
-		Settings::getInstance().SPHERE_VISUAL_HINT = hint[0] || hint[1];
+		feedback.sphereHint = hint[0] || hint[1];
 	}
+
+	// The sphere is hidden if it neither shows the rotation nor where to grab
+	if (!feedback.rotating && !feedback.sphereHint)
+		feedback.sphereAlpha = 0.f;
 }
 
 void LeapListener::stopRotationGesture(int hand) {
@@ -530,38 +519,6 @@ void LeapListener::stopPinchGensture(int hand) {
 	}
 }
 
-void LeapListener::onConnect(const Controller& controller) {
-	controller.enableGesture(Gesture::TYPE_CIRCLE);
-	controller.enableGesture(Gesture::TYPE_KEY_TAP);
-	controller.enableGesture(Gesture::TYPE_SCREEN_TAP);
-	controller.enableGesture(Gesture::TYPE_SWIPE);
-	Settings::getInstance().SHOW_HANDS = true;
-}
-
-void LeapListener::onDisconnect(const Controller &controller) {
-	Settings::getInstance().SHOW_HANDS = false;
-}
-
-void LeapListener::onServiceConnect(const Controller &controller) {
-	Settings::getInstance().SHOW_HANDS = true;
-}
-
-void LeapListener::onServiceDisconnect(const Controller &controller) {
-	Settings::getInstance().SHOW_HANDS = false;
-}
-
-void LeapListener::onInit(const Leap::Controller &controller) {
-
-}
-
-void LeapListener::onExit(const Leap::Controller &controller) {
-
-}
-
-void LeapListener::onDeviceChange (const Leap::Controller &controller) {
-
-}
-
 void LeapListener::setHands (std::shared_ptr<SkeletonHand> &l, std::shared_ptr<SkeletonHand> &r) {
 	skeletonHands[0] = rightHand = r;
 	skeletonHands[1] = leftHand = l;
@@ -578,8 +535,8 @@ void LeapListener::setGestureHandler (std::shared_ptr<GestureHandler> &s) {
 	gestureHandler = s;
 }
 
-void LeapListener::setMesh(std::shared_ptr<Mesh> &m) {
-	mesh = m;
+void LeapListener::setModel(ModelNode *m) {
+	model = m;
 }
 
 GESTURE_STATES LeapListener::leapToInternState (Leap::Gesture::State &s) {
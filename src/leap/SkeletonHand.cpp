@@ -2,10 +2,49 @@
 
 VR_NAMESPACE_BEGIN
 
-SkeletonHand::SkeletonHand (bool _isRight)
-	: isRight(_isRight), visible(false), id(-1), confidence(0.f), grabStrength(0.f), pinchStrength(0.0f) {
+HandState::HandState (bool _isRight)
+	: id(-1), isRight(_isRight), visible(false), confidence(0.f), pinchStrength(0.0f), grabStrength(0.f) {
 
 	palm.position = Vector3f(0.f, 0.f, 1000.f);
+	palm.rotation = Matrix4f::Identity();
+	for (int i = 0; i < 5; i++) {
+		finger[i].position = Vector3f(0.f, 0.f, 1000.f);
+		for (int j = 0; j < 3; j++)
+			finger[i].jointPositions[j] = Vector3f(0.f, 0.f, 1000.f);
+	}
+	handJointPosition = Vector3f(0.f, 0.f, 1000.f);
+}
+
+void HandState::transform (const Matrix4f &T) {
+	const Matrix3f R = T.block<3, 3>(0, 0);
+	const Vector3f t = T.block<3, 1>(0, 3);
+
+	palm.position = R * palm.position + t;
+	palm.direction = R * palm.direction;
+	palm.normal = R * palm.normal;
+	palm.side = R * palm.side;
+	palm.rotation.block<3, 3>(0, 0) = R * palm.rotation.block<3, 3>(0, 0) * R.transpose();
+
+	for (int i = 0; i < 5; i++) {
+		finger[i].position = R * finger[i].position + t;
+		finger[i].direction = R * finger[i].direction;
+		for (int j = 0; j < 3; j++)
+			finger[i].jointPositions[j] = R * finger[i].jointPositions[j] + t;
+	}
+	handJointPosition = R * handJointPosition + t;
+}
+
+SkeletonHand::SkeletonHand (bool _isRight)
+	: HandState(_isRight), rotating(false), fingerColor(Settings::getInstance().MATERIAL_COLOR_ROTATION) {
+
+	// All spheres are evaluated together in draw()
+	mesh.palm.setParent(&root);
+	mesh.handJoint.setParent(&root);
+	for (int i = 0; i < 5; i++) {
+		mesh.finger[i].setParent(&root);
+		for (int j = 0; j < mesh.nrOfJoints; j++)
+			mesh.joints[i][j].setParent(&root);
+	}
 
 	mesh.palm.scale(0.025f, 0.025f, 0.025f);
 	mesh.palm.translate(0.f, 0.f, 1000.f);
@@ -13,10 +52,8 @@ SkeletonHand::SkeletonHand (bool _isRight)
 	for (int i = 0; i < 5; i++) {
 		mesh.finger[i].scale(0.012f, 0.012f, 0.012f);
 		mesh.finger[i].translate(0.f, 0.f, 1000.f);
-		finger[i].position = Vector3f(0.f, 0.f, 1000.f);
 	}
 
-	handJointPosition = Vector3f(0.f, 0.f, 1000.f);
 	mesh.handJoint.scale(0.012f, 0.012f, 0.012f);
 	mesh.handJoint.translate(0.f, 0.f, 1000.f);
 
@@ -46,35 +83,44 @@ void SkeletonHand::upload (std::shared_ptr<GLShader> &s) {
 	for (int i = 0; i < 5; i++)
 		for (int j = 0; j < mesh.nrOfJoints; j++)
 			mesh.joints[i][j].upload(s);
+
+	// Lines stream their positions when drawn
+	for (int i = 0; i < 5; i++)
+		for (int j = 0; j < mesh.nrOfJoints; j++)
+			mesh.jointConnections[i][j].upload(s);
+
+	for (int i = 0; i < mesh.nrOfhandBones; i++)
+		mesh.handBones[i].upload(s);
 }
 
 void SkeletonHand::draw (const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
 	using namespace Leap;
 
+	// Recompute the world matrices of the spheres which moved since the last frame
+	root.update();
+
 	//mesh.palm.draw(viewMatrix, projectionMatrix);
 	mesh.handJoint.draw(viewMatrix, projectionMatrix);
 
-	Vector3f color = Settings::getInstance().MATERIAL_COLOR;
-	if (Settings::getInstance().ROTATION_ACTIVE)
-		shader->setUniform("enableGI", false);
-	shader->setUniform("materialColor", Settings::getInstance().MATERIAL_COLOR_ROTATION);
+	// Material of the hands, see PerspectiveRenderer::draw
+	Vector3f color(1.f, 1.f, 1.f);
+	if (rotating)
+		shader->setFeature(ENABLE_GI, false);
+	shader->setUniform("materialColor", fingerColor);
 	for (int i = 0; i < 5; i++)
 		mesh.finger[i].draw(viewMatrix, projectionMatrix);
 	shader->setUniform("materialColor", color);
-	if (Settings::getInstance().ROTATION_ACTIVE && !Settings::getInstance().LEAP_USE_PASSTHROUGH)
-		shader->setUniform("enableGI", true);
+	if (rotating && !Settings::getInstance().LEAP_USE_PASSTHROUGH)
+		shader->setFeature(ENABLE_GI, true);
 
 	for (int i = 0; i < 5; i++)
 		for (int j = 0; j < mesh.nrOfJoints; j++)
 			mesh.joints[i][j].draw(viewMatrix, projectionMatrix);
 	
 	shader->setUniform("materialColor", Vector3f(0.8f, 0.8f, 0.8f));
-	shader->setUniform("simpleColor", true);
+	shader->setFeature(SIMPLE_COLOR, true);
 
-	/**
-	 * This not efficient at all to do it that way - but since a line consists
-	 * only of two points its feasible.
-	 */
+	// Line positions are suballocated from the per-frame stream buffer
 	for (int i = 0; i < 5; i++) {
 		for (int j = 0; j < mesh.nrOfJoints; j++) {
 			if (j == mesh.nrOfJoints - 1)
@@ -82,7 +128,6 @@ void SkeletonHand::draw (const Matrix4f &viewMatrix, const Matrix4f &projectionM
 			else
 				mesh.jointConnections[i][j].update(finger[i].jointPositions[j], finger[i].jointPositions[j + 1]);
 
-			mesh.jointConnections[i][j].upload(shader);
 			mesh.jointConnections[i][j].draw(viewMatrix, projectionMatrix);
 		}
 	}
@@ -97,12 +142,58 @@ void SkeletonHand::draw (const Matrix4f &viewMatrix, const Matrix4f &projectionM
 
 	
 	for (int i = 0; i < mesh.nrOfhandBones; i++) {
-		mesh.handBones[i].upload(shader);
 		mesh.handBones[i].draw(viewMatrix, projectionMatrix);
 	}
 
 	shader->setUniform("materialColor", color);
-	shader->setUniform("simpleColor", false);
+	shader->setFeature(SIMPLE_COLOR, false);
+}
+
+void SkeletonHand::pose(const Vector3f &palmPosition, float spread) {
+	visible = true;
+	confidence = 1.f;
+	grabStrength = pinchStrength = 0.f;
+
+	palm.position = palmPosition;
+	palm.rotation = Matrix4f::Identity();
+
+	// Thumb on the inner side of the hand
+	float side = isRight ? -1.f : 1.f;
+	for (int i = 0; i < 5; i++) {
+		float angle = side * (i - 2) * spread;
+		Vector3f direction(std::sin(angle), std::cos(angle), 0.f);
+
+		for (int j = 0; j < mesh.nrOfJoints; j++)
+			finger[i].jointPositions[j] = palmPosition + direction * 0.025f * (j + 1);
+
+		finger[i].position = palmPosition + direction * 0.1f;
+		finger[i].direction = direction;
+		finger[i].extended = true;
+	}
+
+	handJointPosition = palmPosition - Vector3f(0.f, 0.03f, 0.f);
+	place();
+}
+
+void SkeletonHand::place() {
+	const Matrix4f &rot = palm.rotation;
+
+	mesh.palm.translate(palm.position.x(), palm.position.y(), palm.position.z());
+	mesh.palm.setRotationMatrix(rot);
+
+	for (int i = 0; i < 5; i++) {
+		mesh.finger[i].translate(finger[i].position.x(), finger[i].position.y(), finger[i].position.z());
+		mesh.finger[i].setRotationMatrix(rot);
+
+		for (int j = 0; j < mesh.nrOfJoints; j++) {
+			const Vector3f &joint = finger[i].jointPositions[j];
+			mesh.joints[i][j].translate(joint.x(), joint.y(), joint.z());
+			mesh.joints[i][j].setRotationMatrix(rot);
+		}
+	}
+
+	mesh.handJoint.translate(handJointPosition.x(), handJointPosition.y(), handJointPosition.z());
+	mesh.handJoint.setRotationMatrix(rot);
 }
 
 void SkeletonHand::translate(float x, float y, float z) {
@@ -11,27 +11,48 @@ using namespace VR_NS;
 
 void initShader(std::shared_ptr<GLShader> &shader);
 
+// Networking args starting at argv[first]: <client|server> <UDP-port> <ip-address>
+void parseNetworkArgs (int argc, char *argv[], int first) {
+	Settings::getInstance().NETWORK_ENABLED = false;
+	if (argc >= first + 2) {
+		Settings::getInstance().NETWORK_ENABLED = true;
+		Settings::getInstance().NETWORK_MODE = NETWORK_MODES::CLIENT;
+		Settings::getInstance().NETWORK_PORT = std::atoi(argv[first + 1]);
+		if (std::string(argv[first]) == "server" && argc > first + 2) {
+			Settings::getInstance().NETWORK_MODE = NETWORK_MODES::SERVER;
+			Settings::getInstance().NETWORK_IP = std::string(argv[first + 2]);
+		}
+	}
+}
+
 bool parseArgs (int argc, char *argv[]) {
 	if (argc < 2)
 		return false;
 
+	// Offscreen benchmark: bench <model.obj> [<frames>] [<output.json>] [<client|server> <UDP-port> <ip-address>]
+	if (std::string(argv[1]) == "bench") {
+		if (argc < 3)
+			return false;
+
+		Settings::getInstance().HEADLESS = true;
+		Settings::getInstance().USE_RIFT = Settings::getInstance().USE_LEAP = false;
+		Settings::getInstance().MODEL = std::string(argv[2]);
+		if (argc > 3)
+			Settings::getInstance().BENCH_FRAMES = std::max(1, std::atoi(argv[3]));
+		if (argc > 4)
+			Settings::getInstance().BENCH_OUTPUT = std::string(argv[4]);
+		parseNetworkArgs(argc, argv, 5);
+
+		return true;
+	}
+
 	Settings::getInstance().USE_RIFT = Settings::getInstance().USE_LEAP = (std::string(argv[1]) == "3d" ? true : false);
 	Settings::getInstance().MODEL = std::string(argv[2]);
 
 	if (argc > 3)
 		Settings::getInstance().ANNOTATIONS = std::string(argv[3]);
 
-	// Networking args
-	Settings::getInstance().NETWORK_ENABLED = false;
-	if (argc >= 6) {
-		Settings::getInstance().NETWORK_ENABLED = true;
-		Settings::getInstance().NETWORK_MODE = NETWORK_MODES::CLIENT;
-		Settings::getInstance().NETWORK_PORT = std::atoi(argv[5]);
-		if (std::string(argv[4]) == "server") {
-			Settings::getInstance().NETWORK_MODE = NETWORK_MODES::SERVER;
-			Settings::getInstance().NETWORK_IP = std::string(argv[6]);
-		}
-	}
+	parseNetworkArgs(argc, argv, 4);
 
 	return true;
 }
@@ -41,6 +62,7 @@ int main (int argc, char *argv[]) {
 	// Args
 	if (!parseArgs(argc, argv)) {
 		std::cout << "Usage: VRMeshViewer <3d|2d> <model.obj> [<none|annotations.txt>] [<client|server> <UDP-port> <ip-address>]" << std::endl;
+		std::cout << "       VRMeshViewer bench <model.obj> [<frames>] [<output.json>] [<client|server> <UDP-port> <ip-address>]" << std::endl;
 		return -1;
 	}
 
@@ -71,10 +93,6 @@ int main (int argc, char *argv[]) {
 //		Settings::getInstance().MODEL = "C:/Users/pnico/Downloads/Ajax_Jotero_com.obj";
 		std::shared_ptr<Mesh> mesh = std::make_shared<WavefrontOBJ>(Settings::getInstance().MODEL);
 
-		// Create Leap listener
-		std::unique_ptr<LeapListener> leap(new LeapListener(Settings::getInstance().USE_RIFT));
-		viewer.attachLeap(leap);
-
 		// Networking
 		std::unique_ptr<std::thread> netThread;
 		asio::io_service io_service;
@@ -107,11 +125,20 @@ int main (int argc, char *argv[]) {
 			viewer.attachSocket(socket);
 		}
 
-		// Load annotations, if any, and run
-		if (Settings::getInstance().ANNOTATIONS != "none")
-			viewer.loadAnnotations(Settings::getInstance().ANNOTATIONS);
+		// Create Leap listener, the benchmark polls it as well. Without a Leap service its frames have no hands
+		std::unique_ptr<LeapListener> leap(new LeapListener(Settings::getInstance().USE_RIFT));
+		viewer.attachLeap(leap);
 
-		viewer.display(mesh, renderer);
+		// Render a fixed number of frames offscreen
+		if (Settings::getInstance().HEADLESS) {
+			viewer.benchmark(mesh, renderer, Settings::getInstance().BENCH_FRAMES, Settings::getInstance().BENCH_OUTPUT);
+		} else {
+			// Load annotations, if any, and run
+			if (Settings::getInstance().ANNOTATIONS != "none")
+				viewer.loadAnnotations(Settings::getInstance().ANNOTATIONS);
+
+			viewer.display(mesh, renderer);
+		}
 		
 		// Stop networking and join to main thread
 		if (Settings::getInstance().NETWORK_ENABLED) {
@@ -130,6 +157,17 @@ int main (int argc, char *argv[]) {
 
 
 void initShader(std::shared_ptr<GLShader> &shader) {
+	// Feature bits as in SHADER_FEATURES, each variant is compiled on first use
+	shader->declareFeatures({ "SIMPLE_COLOR", "TEXTURE_ONLY", "ENABLE_GI", "SPECULAR", "USE_SPECULAR", "QUANTIZED", "WIREFRAME" });
+
+	// The geometry shader only computes the edge distances of the wireframe
+	shader->setGeometryFeatures(WIREFRAME);
+
+	// Same attribute locations in all variants
+	shader->bindAttribLocation("position", 0);
+	shader->bindAttribLocation("normal", 1);
+	shader->bindAttribLocation("tex", 2);
+
 	shader->init(
 		// Name
 		"std-shader",
@@ -138,39 +176,54 @@ void initShader(std::shared_ptr<GLShader> &shader) {
 		std::string("#version 330") + "\n" +
 
 		"uniform mat4 mvp;" + "\n" +
-		"uniform mat4 modelViewMatrix;" + "\n" +
-		"uniform mat3 normalMatrix;" + "\n" +
-		"uniform bool useSpecular = false;" + "\n" +
 
-		"in vec3 position;" + "\n" +
-		"in vec3 normal;" + "\n" +
 		"in vec2 tex;" + "\n" +
 
+		"#if defined(WIREFRAME)" + "\n" +
+		"// Outputs go to the geometry shader" + "\n" +
+		"#define vertexNormal geometryNormal" + "\n" +
+		"#define vertexPosition geometryPosition" + "\n" +
+		"#define uv geometryUV" + "\n" +
+		"#endif" + "\n" +
+
 		"out vec3 vertexNormal;" + "\n" +
 		"out vec3 vertexPosition;" + "\n" +
 		"out vec2 uv;" + "\n" +
-		"out vec2 uvGI;" + "\n" +
+
+		"#if defined(QUANTIZED)" + "\n" +
+		"uniform vec3 positionScale;" + "\n" +
+		"uniform vec3 positionOffset;" + "\n" +
+		"in vec3 position;" + "\n" +
+		"in vec2 normal;" + "\n" +
+
+		"// Normalized 16 bit steps in the bounding box" + "\n" +
+		"vec3 decodePosition () {" + "\n" +
+		"    return positionOffset + positionScale * (position * 65535.0);" + "\n" +
+		"}" + "\n" +
+
+		"// Octahedral normal" + "\n" +
+		"vec3 decodeNormal () {" + "\n" +
+		"    vec3 n = vec3(normal, 1.0 - abs(normal.x) - abs(normal.y));" + "\n" +
+		"    float t = max(-n.z, 0.0);" + "\n" +
+		"    n.x += n.x >= 0.0 ? -t : t;" + "\n" +
+		"    n.y += n.y >= 0.0 ? -t : t;" + "\n" +
+		"    return normalize(n);" + "\n" +
+		"}" + "\n" +
+		"#else" + "\n" +
+		"in vec3 position;" + "\n" +
+		"in vec3 normal;" + "\n" +
+
+		"vec3 decodePosition () { return position; }" + "\n" +
+		"vec3 decodeNormal () { return normal; }" + "\n" +
+		"#endif" + "\n" +
 
 		"void main () {" + "\n" +
 		"    // Pass" + "\n" +
 		"    uv = tex;" + "\n" +
-		"    vertexNormal = normal;" + "\n" +
-		"    vertexPosition = position;" + "\n" +
-
-		"    // GI" + "\n" +
-		"    vec3 e = normalize(vec3(modelViewMatrix * vec4(position, 1.0)));" + "\n" +
-		"    vec3 n = normalize(normalMatrix * normal);" + "\n" +
-
-		"    vec3 r;" + "\n" +
-		"    if (useSpecular)" + "\n" +
-		"		r = reflect(e, n);" + "\n" +
-		"    else" + "\n" +
-		"		r = n;" + "\n" +
+		"    vertexNormal = decodeNormal();" + "\n" +
+		"    vertexPosition = decodePosition();" + "\n" +
 
-		"    float m = 2.0 * sqrt(pow(r.x, 2.0) + pow(r.y, 2.0) + pow(r.z + 1.0, 2.0));" + "\n" +
-		"    uvGI = r.xy / m + .5;" + "\n" +
-
-		"    gl_Position = mvp * vec4(position, 1.0);" + "\n" +
+		"    gl_Position = mvp * vec4(vertexPosition, 1.0);" + "\n" +
 		"}" + "\n",
 
 		// Fragment shader
@@ -183,78 +236,145 @@ void initShader(std::shared_ptr<GLShader> &shader) {
 		"	 float ambientCoefficient;" + "\n" +
 		"};" + "\n" +
 
-		"uniform sampler2D env;" + "\n" +
-		"uniform sampler2D envDiffuse;" + "\n" +
+		"uniform samplerCube env;" + "\n" +
+		"uniform float envMaxLod;" + "\n" +
+		"uniform float roughness;" + "\n" +
+		"uniform vec3 irradiance[9];" + "\n" +
 		"uniform Light light;" + "\n" +
 		"uniform vec3 materialColor;" + "\n" +
 		"uniform mat4 modelMatrix;" + "\n" +
 		"uniform mat3 normalMatrix;" + "\n" +
 		"uniform float alpha;" + "\n" +
-		"uniform bool simpleColor = false;" + "\n" +
-		"uniform bool textureOnly = false;" + "\n" +
-		"uniform bool enableGI = false;" + "\n" +
-		"uniform bool specular = false;" + "\n" +
 		"uniform vec3 cameraPosition;" + "\n" +
 
 		"in vec3 vertexNormal;" + "\n" +
 		"in vec3 vertexPosition;" + "\n" +
 		"in vec2 uv;" + "\n" +
-		"in vec2 uvGI;" + "\n" +
+
+		"#if defined(WIREFRAME)" + "\n" +
+		"uniform vec3 wireframeColor;" + "\n" +
+		"uniform float wireframeWidth;" + "\n" +
+		"noperspective in vec3 edgeDistance;" + "\n" +
+		"#endif" + "\n" +
 
 		"out vec4 color;" + "\n" +
 
 		"void main () {" + "\n" +
-	
-		"    // Shading" + "\n" +
-		"    if (!simpleColor && !textureOnly) {" + "\n" +
-	
-		"        // Transform normal" + "\n" +
-		"        vec3 normal = normalize(normalMatrix * vertexNormal);" + "\n" +
-
-		"        // Position of fragment in world coodinates" + "\n" +
-		"        vec3 position = vec3(modelMatrix * vec4(vertexPosition, 1.0));" + "\n" +
-
-		"        // Calculate the vector from surface to the light" + "\n" +
-		"        vec3 surfaceToLight = light.position - position;" + "\n" +
-		"        vec3 surfaceToCamera = light.position - cameraPosition;" + "\n" +
-
-		"        // Calculate the cosine of the angle of incidence = brightness" + "\n" +
-		"        float brightness = dot(normal, surfaceToLight) / (length(surfaceToLight) * length(normal));" + "\n" +
-		"        brightness = clamp(brightness, 0.0, 1.0);" + "\n" +
-
-		"		 // Lightning" + "\n" +
-		"		 if (enableGI) {" + "\n" +
-		"			vec3 gi = (specular ? texture(env, uvGI).rgb : texture(envDiffuse, uvGI).rgb);" + "\n" +
-
-		"			// Ambient" + "\n" +
-		"			vec3 ambient = vec3(light.ambientCoefficient * materialColor * light.intensity);" + "\n" +
-
-		"			// Diffuse" + "\n" +
-		"			vec3 diffuse = vec3(gi * brightness * light.intensity);" + "\n" +
-
-		"			// Specular" + "\n" +
-		"			float specularCoefficient = 0.0;" + "\n" +
-		"			float materialShininess = 1.5;" + "\n" +
-		"			if (brightness > 0.0)" + "\n" +
-		"				specularCoefficient = pow(max(0.0, dot(surfaceToCamera, reflect(-surfaceToLight, normal))), materialShininess);" + "\n" +
-		
-		"			vec3 specularC = specularCoefficient * materialColor * light.intensity;" + "\n" +
-
-		"			float k = 0.2;" + "\n" +
-		"			float attenuation = 1.0 / (1.0 + k * pow(length(surfaceToLight), 2));" + "\n" +
-
-		"			color = vec4(ambient + attenuation * (diffuse + specularC), alpha);" + "\n" +
-
-		"		 } else {" + "\n" +
-		"			color = vec4(materialColor * brightness * light.intensity, alpha);" + "\n" +
-		"		 }" + "\n" +
-		"    } else if (textureOnly) {" + "\n" +
-		"        // No shading, only textures" + "\n" +
-		"        color = texture(env, uv.xy);" + "\n" +
-		"    } else {" + "\n" +
-		"        // Draw all in simple colors" + "\n" +
-		"        color = vec4(materialColor, alpha);" + "\n" +
+
+		"#if defined(TEXTURE_ONLY)" + "\n" +
+		"    // No shading, only textures" + "\n" +
+		"    color = vec4(textureLod(env, vertexPosition, 0.0).rgb, 1.0);" + "\n" +
+
+		"#elif defined(SIMPLE_COLOR)" + "\n" +
+		"    // Draw all in simple colors" + "\n" +
+		"    color = vec4(materialColor, alpha);" + "\n" +
+
+		"#else" + "\n" +
+		"    // Transform normal" + "\n" +
+		"    vec3 normal = normalize(normalMatrix * vertexNormal);" + "\n" +
+
+		"    // Position of fragment in world coodinates" + "\n" +
+		"    vec3 position = vec3(modelMatrix * vec4(vertexPosition, 1.0));" + "\n" +
+
+		"    // Calculate the vector from surface to the light" + "\n" +
+		"    vec3 surfaceToLight = light.position - position;" + "\n" +
+
+		"    // Calculate the cosine of the angle of incidence = brightness" + "\n" +
+		"    float brightness = dot(normal, surfaceToLight) / (length(surfaceToLight) * length(normal));" + "\n" +
+		"    brightness = clamp(brightness, 0.0, 1.0);" + "\n" +
+
+		"#if defined(ENABLE_GI)" + "\n" +
+		"    vec3 surfaceToCamera = light.position - cameraPosition;" + "\n" +
+
+		"#if defined(SPECULAR)" + "\n" +
+		"    // Prefiltered environment, the mip level selects the roughness" + "\n" +
+		"#if defined(USE_SPECULAR)" + "\n" +
+		"    vec3 r = reflect(normalize(position - cameraPosition), normal);" + "\n" +
+		"#else" + "\n" +
+		"    vec3 r = normal;" + "\n" +
+		"#endif" + "\n" +
+		"    vec3 gi = textureLod(env, r, roughness * envMaxLod).rgb;" + "\n" +
+		"#else" + "\n" +
+		"    // Irradiance from spherical harmonics, see SphericalHarmonics" + "\n" +
+		"    vec3 gi = irradiance[0] + irradiance[1] * normal.y + irradiance[2] * normal.z + irradiance[3] * normal.x" + "\n" +
+		"        + irradiance[4] * (normal.x * normal.y) + irradiance[5] * (normal.y * normal.z)" + "\n" +
+		"        + irradiance[6] * (3.0 * normal.z * normal.z - 1.0) + irradiance[7] * (normal.x * normal.z)" + "\n" +
+		"        + irradiance[8] * (normal.x * normal.x - normal.y * normal.y);" + "\n" +
+		"    gi = max(gi, vec3(0.0));" + "\n" +
+		"#endif" + "\n" +
+
+		"    // Ambient" + "\n" +
+		"    vec3 ambient = vec3(light.ambientCoefficient * materialColor * light.intensity);" + "\n" +
+
+		"    // Diffuse" + "\n" +
+		"    vec3 diffuse = vec3(gi * brightness * light.intensity);" + "\n" +
+
+		"    // Specular" + "\n" +
+		"    float specularCoefficient = 0.0;" + "\n" +
+		"    float materialShininess = 1.5;" + "\n" +
+		"    if (brightness > 0.0)" + "\n" +
+		"        specularCoefficient = pow(max(0.0, dot(surfaceToCamera, reflect(-surfaceToLight, normal))), materialShininess);" + "\n" +
+
+		"    vec3 specularC = specularCoefficient * materialColor * light.intensity;" + "\n" +
+
+		"    float k = 0.2;" + "\n" +
+		"    float attenuation = 1.0 / (1.0 + k * pow(length(surfaceToLight), 2));" + "\n" +
+
+		"    color = vec4(ambient + attenuation * (diffuse + specularC), alpha);" + "\n" +
+		"#else" + "\n" +
+		"    color = vec4(materialColor * brightness * light.intensity, alpha);" + "\n" +
+		"#endif" + "\n" +
+		"#endif" + "\n" +
+
+		"#if defined(WIREFRAME)" + "\n" +
+		"    // Distance to the closest edge in pixels, antialiased over one pixel" + "\n" +
+		"    float edge = min(edgeDistance.x, min(edgeDistance.y, edgeDistance.z));" + "\n" +
+		"    color.rgb = mix(wireframeColor, color.rgb, clamp(edge - 0.5 * wireframeWidth + 0.5, 0.0, 1.0));" + "\n" +
+		"#endif" + "\n" +
+		"}" + "\n",
+
+		// Geometry shader, only used by the WIREFRAME variants
+		std::string("#version 330") + "\n" +
+
+		"layout(triangles) in;" + "\n" +
+		"layout(triangle_strip, max_vertices = 3) out;" + "\n" +
+
+		"uniform vec2 viewportSize;" + "\n" +
+
+		"in vec3 geometryNormal[];" + "\n" +
+		"in vec3 geometryPosition[];" + "\n" +
+		"in vec2 geometryUV[];" + "\n" +
+
+		"out vec3 vertexNormal;" + "\n" +
+		"out vec3 vertexPosition;" + "\n" +
+		"out vec2 uv;" + "\n" +
+		"noperspective out vec3 edgeDistance;" + "\n" +
+
+		"void main () {" + "\n" +
+		"    // Corners in pixels" + "\n" +
+		"    vec2 p0 = 0.5 * viewportSize * gl_in[0].gl_Position.xy / gl_in[0].gl_Position.w;" + "\n" +
+		"    vec2 p1 = 0.5 * viewportSize * gl_in[1].gl_Position.xy / gl_in[1].gl_Position.w;" + "\n" +
+		"    vec2 p2 = 0.5 * viewportSize * gl_in[2].gl_Position.xy / gl_in[2].gl_Position.w;" + "\n" +
+
+		"    // Height of each corner over the opposite edge" + "\n" +
+		"    vec2 e1 = p2 - p0, e2 = p1 - p0;" + "\n" +
+		"    float area = abs(e1.x * e2.y - e1.y * e2.x);" + "\n" +
+		"    vec3 heights = area / max(vec3(length(p2 - p1), length(e1), length(e2)), vec3(1e-6));" + "\n" +
+
+		"    // Triangles crossing the eye plane have no screen space edges" + "\n" +
+		"    if (min(gl_in[0].gl_Position.w, min(gl_in[1].gl_Position.w, gl_in[2].gl_Position.w)) <= 0.0)" + "\n" +
+		"        heights = vec3(1e6);" + "\n" +
+
+		"    for (int i = 0; i < 3; i++) {" + "\n" +
+		"        gl_Position = gl_in[i].gl_Position;" + "\n" +
+		"        vertexNormal = geometryNormal[i];" + "\n" +
+		"        vertexPosition = geometryPosition[i];" + "\n" +
+		"        uv = geometryUV[i];" + "\n" +
+		"        edgeDistance = vec3(0.0);" + "\n" +
+		"        edgeDistance[i] = heights[i];" + "\n" +
+		"        EmitVertex();" + "\n" +
 		"    }" + "\n" +
+		"    EndPrimitive();" + "\n" +
 		"}" + "\n"
 	);
 }
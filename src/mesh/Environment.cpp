@@ -1,1937 +1,13 @@
 #include "mesh/Environment.hpp"
+#include "mesh/EnvironmentData.hpp"
 
 VR_NAMESPACE_BEGIN
 
 Environment::Environment(bool invertNormals) {
-	std::string obj(
-		std::string("v -4.37114e-06 -50 0") + "\n"
-		"v 4.37114e-06 50 0" + "\n"
-		"v 12.9409 -48.2963 0" + "\n"
-		"v 12.5 -48.2963 -3.34937" + "\n"
-		"v 11.2072 -48.2963 -6.4705" + "\n"
-		"v 9.15065 -48.2963 -9.15065" + "\n"
-		"v 6.4705 -48.2963 -11.2072" + "\n"
-		"v 3.34936 -48.2963 -12.5" + "\n"
-		"v -4.2222e-06 -48.2963 -12.941" + "\n"
-		"v -3.34937 -48.2963 -12.5" + "\n"
-		"v -6.4705 -48.2963 -11.2072" + "\n"
-		"v -9.15065 -48.2963 -9.15065" + "\n"
-		"v -11.2072 -48.2963 -6.4705" + "\n"
-		"v -12.5 -48.2963 -3.34937" + "\n"
-		"v -12.941 -48.2963 -1.58481e-15" + "\n"
-		"v -12.5 -48.2963 3.34937" + "\n"
-		"v -11.2072 -48.2963 6.4705" + "\n"
-		"v -9.15065 -48.2963 9.15065" + "\n"
-		"v -6.4705 -48.2963 11.2072" + "\n"
-		"v -3.34937 -48.2963 12.5" + "\n"
-		"v -4.2222e-06 -48.2963 12.941" + "\n"
-		"v 3.34936 -48.2963 12.5" + "\n"
-		"v 6.4705 -48.2963 11.2072" + "\n"
-		"v 9.15065 -48.2963 9.15065" + "\n"
-		"v 11.2072 -48.2963 6.4705" + "\n"
-		"v 12.5 -48.2963 3.34937" + "\n"
-		"v 25 -43.3013 0" + "\n"
-		"v 24.1481 -43.3013 -6.4705" + "\n"
-		"v 21.6506 -43.3013 -12.5" + "\n"
-		"v 17.6776 -43.3013 -17.6776" + "\n"
-		"v 12.5 -43.3013 -21.6507" + "\n"
-		"v 6.4705 -43.3013 -24.1482" + "\n"
-		"v -3.78552e-06 -43.3012 -25" + "\n"
-		"v -6.4705 -43.3012 -24.1482" + "\n"
-		"v -12.5 -43.3012 -21.6507" + "\n"
-		"v -17.6777 -43.3012 -17.6776" + "\n"
-		"v -21.6507 -43.3012 -12.5" + "\n"
-		"v -24.1482 -43.3012 -6.4705" + "\n"
-		"v -25 -43.3012 -3.06161e-15" + "\n"
-		"v -24.1482 -43.3012 6.4705" + "\n"
-		"v -21.6507 -43.3012 12.5" + "\n"
-		"v -17.6777 -43.3012 17.6776" + "\n"
-		"v -12.5 -43.3012 21.6507" + "\n"
-		"v -6.4705 -43.3012 24.1482" + "\n"
-		"v -3.78552e-06 -43.3012 25" + "\n"
-		"v 6.4705 -43.3013 24.1482" + "\n"
-		"v 12.5 -43.3013 21.6507" + "\n"
-		"v 17.6776 -43.3013 17.6776" + "\n"
-		"v 21.6506 -43.3013 12.5" + "\n"
-		"v 24.1481 -43.3013 6.4705" + "\n"
-		"v 35.3553 -35.3554 0" + "\n"
-		"v 34.1506 -35.3554 -9.15065" + "\n"
-		"v 30.6186 -35.3554 -17.6776" + "\n"
-		"v 25 -35.3554 -25" + "\n"
-		"v 17.6776 -35.3554 -30.6186" + "\n"
-		"v 9.15065 -35.3554 -34.1506" + "\n"
-		"v -3.09086e-06 -35.3553 -35.3554" + "\n"
-		"v -9.15065 -35.3553 -34.1506" + "\n"
-		"v -17.6777 -35.3553 -30.6186" + "\n"
-		"v -25 -35.3553 -25" + "\n"
-		"v -30.6186 -35.3553 -17.6776" + "\n"
-		"v -34.1507 -35.3553 -9.15065" + "\n"
-		"v -35.3554 -35.3553 -4.32978e-15" + "\n"
-		"v -34.1507 -35.3553 9.15065" + "\n"
-		"v -30.6186 -35.3553 17.6776" + "\n"
-		"v -25 -35.3553 25" + "\n"
-		"v -17.6777 -35.3553 30.6186" + "\n"
-		"v -9.15065 -35.3553 34.1506" + "\n"
-		"v -3.09086e-06 -35.3553 35.3554" + "\n"
-		"v 9.15065 -35.3554 34.1506" + "\n"
-		"v 17.6776 -35.3554 30.6186" + "\n"
-		"v 25 -35.3554 25" + "\n"
-		"v 30.6186 -35.3554 17.6776" + "\n"
-		"v 34.1506 -35.3554 9.15065" + "\n"
-		"v 43.3012 -25 0" + "\n"
-		"v 41.8258 -25 -11.2072" + "\n"
-		"v 37.5 -25 -21.6507" + "\n"
-		"v 30.6186 -25 -30.6186" + "\n"
-		"v 21.6506 -25 -37.5" + "\n"
-		"v 11.2072 -25 -41.8258" + "\n"
-		"v -2.18557e-06 -25 -43.3013" + "\n"
-		"v -11.2072 -25 -41.8258" + "\n"
-		"v -21.6507 -25 -37.5" + "\n"
-		"v -30.6186 -25 -30.6186" + "\n"
-		"v -37.5 -25 -21.6507" + "\n"
-		"v -41.8258 -25 -11.2072" + "\n"
-		"v -43.3013 -25 -5.3029e-15" + "\n"
-		"v -41.8258 -25 11.2072" + "\n"
-		"v -37.5 -25 21.6507" + "\n"
-		"v -30.6186 -25 30.6186" + "\n"
-		"v -21.6507 -25 37.5" + "\n"
-		"v -11.2072 -25 41.8258" + "\n"
-		"v -2.18557e-06 -25 43.3013" + "\n"
-		"v 11.2072 -25 41.8258" + "\n"
-		"v 21.6506 -25 37.5" + "\n"
-		"v 30.6186 -25 30.6186" + "\n"
-		"v 37.5 -25 21.6507" + "\n"
-		"v 41.8258 -25 11.2072" + "\n"
-		"v 48.2963 -12.941 0" + "\n"
-		"v 46.6506 -12.941 -12.5" + "\n"
-		"v 41.8258 -12.941 -24.1482" + "\n"
-		"v 34.1506 -12.941 -34.1506" + "\n"
-		"v 24.1481 -12.941 -41.8258" + "\n"
-		"v 12.5 -12.941 -46.6506" + "\n"
-		"v -1.13133e-06 -12.9409 -48.2963" + "\n"
-		"v -12.5 -12.9409 -46.6506" + "\n"
-		"v -24.1482 -12.9409 -41.8258" + "\n"
-		"v -34.1507 -12.9409 -34.1506" + "\n"
-		"v -41.8258 -12.9409 -24.1482" + "\n"
-		"v -46.6507 -12.9409 -12.5" + "\n"
-		"v -48.2963 -12.9409 -5.9146e-15" + "\n"
-		"v -46.6507 -12.9409 12.5" + "\n"
-		"v -41.8258 -12.9409 24.1482" + "\n"
-		"v -34.1507 -12.9409 34.1506" + "\n"
-		"v -24.1482 -12.9409 41.8258" + "\n"
-		"v -12.5 -12.9409 46.6506" + "\n"
-		"v -1.13133e-06 -12.9409 48.2963" + "\n"
-		"v 12.5 -12.941 46.6506" + "\n"
-		"v 24.1481 -12.941 41.8258" + "\n"
-		"v 34.1506 -12.941 34.1506" + "\n"
-		"v 41.8258 -12.941 24.1482" + "\n"
-		"v 46.6506 -12.941 12.5" + "\n"
-		"v 50 -4.37114e-06 0" + "\n"
-		"v 48.2963 -4.2222e-06 -12.941" + "\n"
-		"v 43.3012 -3.78552e-06 -25" + "\n"
-		"v 35.3553 -3.09086e-06 -35.3554" + "\n"
-		"v 25 -2.18557e-06 -43.3013" + "\n"
-		"v 12.9409 -1.13133e-06 -48.2963" + "\n"
-		"v 3.06161e-15 -2.67655e-22 -50" + "\n"
-		"v -12.9409 1.13133e-06 -48.2963" + "\n"
-		"v -25 2.18557e-06 -43.3013" + "\n"
-		"v -35.3553 3.09086e-06 -35.3554" + "\n"
-		"v -43.3012 3.78552e-06 -25" + "\n"
-		"v -48.2963 4.2222e-06 -12.941" + "\n"
-		"v -50 4.37114e-06 -6.12325e-15" + "\n"
-		"v -48.2963 4.2222e-06 12.941" + "\n"
-		"v -43.3012 3.78552e-06 25" + "\n"
-		"v -35.3553 3.09086e-06 35.3554" + "\n"
-		"v -25 2.18557e-06 43.3013" + "\n"
-		"v -12.9409 1.13133e-06 48.2963" + "\n"
-		"v -9.18485e-15 8.02965e-22 50" + "\n"
-		"v 12.9409 -1.13133e-06 48.2963" + "\n"
-		"v 25 -2.18557e-06 43.3013" + "\n"
-		"v 35.3553 -3.09086e-06 35.3554" + "\n"
-		"v 43.3012 -3.78552e-06 25" + "\n"
-		"v 48.2963 -4.2222e-06 12.941" + "\n"
-		"v 48.2963 12.9409 0" + "\n"
-		"v 46.6507 12.9409 -12.5" + "\n"
-		"v 41.8258 12.9409 -24.1482" + "\n"
-		"v 34.1507 12.9409 -34.1506" + "\n"
-		"v 24.1482 12.9409 -41.8258" + "\n"
-		"v 12.5 12.9409 -46.6506" + "\n"
-		"v 1.13133e-06 12.9409 -48.2963" + "\n"
-		"v -12.5 12.941 -46.6506" + "\n"
-		"v -24.1481 12.941 -41.8258" + "\n"
-		"v -34.1506 12.941 -34.1506" + "\n"
-		"v -41.8258 12.941 -24.1482" + "\n"
-		"v -46.6506 12.941 -12.5" + "\n"
-		"v -48.2963 12.941 -5.9146e-15" + "\n"
-		"v -46.6506 12.941 12.5" + "\n"
-		"v -41.8258 12.941 24.1482" + "\n"
-		"v -34.1506 12.941 34.1506" + "\n"
-		"v -24.1481 12.941 41.8258" + "\n"
-		"v -12.5 12.941 46.6506" + "\n"
-		"v 1.13133e-06 12.9409 48.2963" + "\n"
-		"v 12.5 12.9409 46.6506" + "\n"
-		"v 24.1482 12.9409 41.8258" + "\n"
-		"v 34.1507 12.9409 34.1506" + "\n"
-		"v 41.8258 12.9409 24.1482" + "\n"
-		"v 46.6507 12.9409 12.5" + "\n"
-		"v 43.3013 25 0" + "\n"
-		"v 41.8258 25 -11.2072" + "\n"
-		"v 37.5 25 -21.6507" + "\n"
-		"v 30.6186 25 -30.6186" + "\n"
-		"v 21.6507 25 -37.5" + "\n"
-		"v 11.2072 25 -41.8258" + "\n"
-		"v 2.18557e-06 25 -43.3013" + "\n"
-		"v -11.2072 25 -41.8258" + "\n"
-		"v -21.6506 25 -37.5" + "\n"
-		"v -30.6186 25 -30.6186" + "\n"
-		"v -37.5 25 -21.6507" + "\n"
-		"v -41.8258 25 -11.2072" + "\n"
-		"v -43.3012 25 -5.3029e-15" + "\n"
-		"v -41.8258 25 11.2072" + "\n"
-		"v -37.5 25 21.6507" + "\n"
-		"v -30.6186 25 30.6186" + "\n"
-		"v -21.6506 25 37.5" + "\n"
-		"v -11.2072 25 41.8258" + "\n"
-		"v 2.18557e-06 25 43.3013" + "\n"
-		"v 11.2072 25 41.8258" + "\n"
-		"v 21.6507 25 37.5" + "\n"
-		"v 30.6186 25 30.6186" + "\n"
-		"v 37.5 25 21.6507" + "\n"
-		"v 41.8258 25 11.2072" + "\n"
-		"v 35.3554 35.3553 0" + "\n"
-		"v 34.1507 35.3553 -9.15065" + "\n"
-		"v 30.6186 35.3553 -17.6776" + "\n"
-		"v 25 35.3553 -25" + "\n"
-		"v 17.6777 35.3553 -30.6186" + "\n"
-		"v 9.15065 35.3553 -34.1506" + "\n"
-		"v 3.09086e-06 35.3553 -35.3554" + "\n"
-		"v -9.15065 35.3554 -34.1506" + "\n"
-		"v -17.6776 35.3554 -30.6186" + "\n"
-		"v -25 35.3554 -25" + "\n"
-		"v -30.6186 35.3554 -17.6776" + "\n"
-		"v -34.1506 35.3554 -9.15065" + "\n"
-		"v -35.3553 35.3554 -4.32978e-15" + "\n"
-		"v -34.1506 35.3554 9.15065" + "\n"
-		"v -30.6186 35.3554 17.6776" + "\n"
-		"v -25 35.3554 25" + "\n"
-		"v -17.6776 35.3554 30.6186" + "\n"
-		"v -9.15065 35.3554 34.1506" + "\n"
-		"v 3.09086e-06 35.3553 35.3554" + "\n"
-		"v 9.15065 35.3553 34.1506" + "\n"
-		"v 17.6777 35.3553 30.6186" + "\n"
-		"v 25 35.3553 25" + "\n"
-		"v 30.6186 35.3553 17.6776" + "\n"
-		"v 34.1507 35.3553 9.15065" + "\n"
-		"v 25 43.3012 0" + "\n"
-		"v 24.1482 43.3012 -6.4705" + "\n"
-		"v 21.6507 43.3012 -12.5" + "\n"
-		"v 17.6777 43.3012 -17.6776" + "\n"
-		"v 12.5 43.3012 -21.6507" + "\n"
-		"v 6.4705 43.3012 -24.1482" + "\n"
-		"v 3.78552e-06 43.3012 -25" + "\n"
-		"v -6.4705 43.3013 -24.1482" + "\n"
-		"v -12.5 43.3013 -21.6507" + "\n"
-		"v -17.6776 43.3013 -17.6776" + "\n"
-		"v -21.6506 43.3013 -12.5" + "\n"
-		"v -24.1481 43.3013 -6.4705" + "\n"
-		"v -25 43.3013 -3.06161e-15" + "\n"
-		"v -24.1481 43.3013 6.4705" + "\n"
-		"v -21.6506 43.3013 12.5" + "\n"
-		"v -17.6776 43.3013 17.6776" + "\n"
-		"v -12.5 43.3013 21.6507" + "\n"
-		"v -6.4705 43.3013 24.1482" + "\n"
-		"v 3.78552e-06 43.3012 25" + "\n"
-		"v 6.4705 43.3012 24.1482" + "\n"
-		"v 12.5 43.3012 21.6507" + "\n"
-		"v 17.6777 43.3012 17.6776" + "\n"
-		"v 21.6507 43.3012 12.5" + "\n"
-		"v 24.1482 43.3012 6.4705" + "\n"
-		"v 12.941 48.2963 0" + "\n"
-		"v 12.5 48.2963 -3.34937" + "\n"
-		"v 11.2072 48.2963 -6.4705" + "\n"
-		"v 9.15065 48.2963 -9.15065" + "\n"
-		"v 6.4705 48.2963 -11.2072" + "\n"
-		"v 3.34937 48.2963 -12.5" + "\n"
-		"v 4.2222e-06 48.2963 -12.941" + "\n"
-		"v -3.34936 48.2963 -12.5" + "\n"
-		"v -6.4705 48.2963 -11.2072" + "\n"
-		"v -9.15065 48.2963 -9.15065" + "\n"
-		"v -11.2072 48.2963 -6.4705" + "\n"
-		"v -12.5 48.2963 -3.34937" + "\n"
-		"v -12.9409 48.2963 -1.58481e-15" + "\n"
-		"v -12.5 48.2963 3.34937" + "\n"
-		"v -11.2072 48.2963 6.4705" + "\n"
-		"v -9.15065 48.2963 9.15065" + "\n"
-		"v -6.4705 48.2963 11.2072" + "\n"
-		"v -3.34936 48.2963 12.5" + "\n"
-		"v 4.2222e-06 48.2963 12.941" + "\n"
-		"v 3.34937 48.2963 12.5" + "\n"
-		"v 6.4705 48.2963 11.2072" + "\n"
-		"v 9.15065 48.2963 9.15065" + "\n"
-		"v 11.2072 48.2963 6.4705" + "\n"
-		"v 12.5 48.2963 3.34937" + "\n"
-		"vt 0.04167 0.91667" + "\n"
-		"vt 0.04167 0.83333" + "\n"
-		"vt 0.00000 0.83333" + "\n"
-		"vt 0.00000 0.91667" + "\n"
-		"vt 0.08333 0.91667" + "\n"
-		"vt 0.08333 0.83333" + "\n"
-		"vt 0.04167 0.83333" + "\n"
-		"vt 0.04167 0.91667" + "\n"
-		"vt 0.12500 0.91667" + "\n"
-		"vt 0.12500 0.83333" + "\n"
-		"vt 0.08333 0.83333" + "\n"
-		"vt 0.08333 0.91667" + "\n"
-		"vt 0.16667 0.91667" + "\n"
-		"vt 0.16667 0.83333" + "\n"
-		"vt 0.12500 0.83333" + "\n"
-		"vt 0.12500 0.91667" + "\n"
-		"vt 0.20833 0.91667" + "\n"
-		"vt 0.20833 0.83333" + "\n"
-		"vt 0.16667 0.83333" + "\n"
-		"vt 0.16667 0.91667" + "\n"
-		"vt 0.25000 0.91667" + "\n"
-		"vt 0.25000 0.83333" + "\n"
-		"vt 0.20833 0.83333" + "\n"
-		"vt 0.20833 0.91667" + "\n"
-		"vt 0.29167 0.91667" + "\n"
-		"vt 0.29167 0.83333" + "\n"
-		"vt 0.25000 0.83333" + "\n"
-		"vt 0.25000 0.91667" + "\n"
-		"vt 0.33333 0.91667" + "\n"
-		"vt 0.33333 0.83333" + "\n"
-		"vt 0.29167 0.83333" + "\n"
-		"vt 0.29167 0.91667" + "\n"
-		"vt 0.37500 0.91667" + "\n"
-		"vt 0.37500 0.83333" + "\n"
-		"vt 0.33333 0.83333" + "\n"
-		"vt 0.33333 0.91667" + "\n"
-		"vt 0.41667 0.91667" + "\n"
-		"vt 0.41667 0.83333" + "\n"
-		"vt 0.37500 0.83333" + "\n"
-		"vt 0.37500 0.91667" + "\n"
-		"vt 0.45833 0.91667" + "\n"
-		"vt 0.45833 0.83333" + "\n"
-		"vt 0.41667 0.83333" + "\n"
-		"vt 0.41667 0.91667" + "\n"
-		"vt 0.50000 0.91667" + "\n"
-		"vt 0.50000 0.83333" + "\n"
-		"vt 0.45833 0.83333" + "\n"
-		"vt 0.45833 0.91667" + "\n"
-		"vt 0.54167 0.91667" + "\n"
-		"vt 0.54167 0.83333" + "\n"
-		"vt 0.50000 0.83333" + "\n"
-		"vt 0.50000 0.91667" + "\n"
-		"vt 0.58333 0.91667" + "\n"
-		"vt 0.58333 0.83333" + "\n"
-		"vt 0.54167 0.83333" + "\n"
-		"vt 0.54167 0.91667" + "\n"
-		"vt 0.62500 0.91667" + "\n"
-		"vt 0.62500 0.83333" + "\n"
-		"vt 0.58333 0.83333" + "\n"
-		"vt 0.58333 0.91667" + "\n"
-		"vt 0.66667 0.91667" + "\n"
-		"vt 0.66667 0.83333" + "\n"
-		"vt 0.62500 0.83333" + "\n"
-		"vt 0.62500 0.91667" + "\n"
-		"vt 0.70833 0.91667" + "\n"
-		"vt 0.70833 0.83333" + "\n"
-		"vt 0.66667 0.83333" + "\n"
-		"vt 0.66667 0.91667" + "\n"
-		"vt 0.75000 0.91667" + "\n"
-		"vt 0.75000 0.83333" + "\n"
-		"vt 0.70833 0.83333" + "\n"
-		"vt 0.70833 0.91667" + "\n"
-		"vt 0.79167 0.91667" + "\n"
-		"vt 0.79167 0.83333" + "\n"
-		"vt 0.75000 0.83333" + "\n"
-		"vt 0.75000 0.91667" + "\n"
-		"vt 0.83333 0.91667" + "\n"
-		"vt 0.83333 0.83333" + "\n"
-		"vt 0.79167 0.83333" + "\n"
-		"vt 0.79167 0.91667" + "\n"
-		"vt 0.87500 0.91667" + "\n"
-		"vt 0.87500 0.83333" + "\n"
-		"vt 0.83333 0.83333" + "\n"
-		"vt 0.83333 0.91667" + "\n"
-		"vt 0.91667 0.91667" + "\n"
-		"vt 0.91667 0.83333" + "\n"
-		"vt 0.87500 0.83333" + "\n"
-		"vt 0.87500 0.91667" + "\n"
-		"vt 0.95833 0.91667" + "\n"
-		"vt 0.95833 0.83333" + "\n"
-		"vt 0.91667 0.83333" + "\n"
-		"vt 0.91667 0.91667" + "\n"
-		"vt 1.00000 0.91667" + "\n"
-		"vt 1.00000 0.83333" + "\n"
-		"vt 0.95833 0.83333" + "\n"
-		"vt 0.95833 0.91667" + "\n"
-		"vt 0.04167 0.83333" + "\n"
-		"vt 0.04167 0.75000" + "\n"
-		"vt 0.00000 0.75000" + "\n"
-		"vt 0.00000 0.83333" + "\n"
-		"vt 0.08333 0.83333" + "\n"
-		"vt 0.08333 0.75000" + "\n"
-		"vt 0.04167 0.75000" + "\n"
-		"vt 0.04167 0.83333" + "\n"
-		"vt 0.12500 0.83333" + "\n"
-		"vt 0.12500 0.75000" + "\n"
-		"vt 0.08333 0.75000" + "\n"
-		"vt 0.08333 0.83333" + "\n"
-		"vt 0.16667 0.83333" + "\n"
-		"vt 0.16667 0.75000" + "\n"
-		"vt 0.12500 0.75000" + "\n"
-		"vt 0.12500 0.83333" + "\n"
-		"vt 0.20833 0.83333" + "\n"
-		"vt 0.20833 0.75000" + "\n"
-		"vt 0.16667 0.75000" + "\n"
-		"vt 0.16667 0.83333" + "\n"
-		"vt 0.25000 0.83333" + "\n"
-		"vt 0.25000 0.75000" + "\n"
-		"vt 0.20833 0.75000" + "\n"
-		"vt 0.20833 0.83333" + "\n"
-		"vt 0.29167 0.83333" + "\n"
-		"vt 0.29167 0.75000" + "\n"
-		"vt 0.25000 0.75000" + "\n"
-		"vt 0.25000 0.83333" + "\n"
-		"vt 0.33333 0.83333" + "\n"
-		"vt 0.33333 0.75000" + "\n"
-		"vt 0.29167 0.75000" + "\n"
-		"vt 0.29167 0.83333" + "\n"
-		"vt 0.37500 0.83333" + "\n"
-		"vt 0.37500 0.75000" + "\n"
-		"vt 0.33333 0.75000" + "\n"
-		"vt 0.33333 0.83333" + "\n"
-		"vt 0.41667 0.83333" + "\n"
-		"vt 0.41667 0.75000" + "\n"
-		"vt 0.37500 0.75000" + "\n"
-		"vt 0.37500 0.83333" + "\n"
-		"vt 0.45833 0.83333" + "\n"
-		"vt 0.45833 0.75000" + "\n"
-		"vt 0.41667 0.75000" + "\n"
-		"vt 0.41667 0.83333" + "\n"
-		"vt 0.50000 0.83333" + "\n"
-		"vt 0.50000 0.75000" + "\n"
-		"vt 0.45833 0.75000" + "\n"
-		"vt 0.45833 0.83333" + "\n"
-		"vt 0.54167 0.83333" + "\n"
-		"vt 0.54167 0.75000" + "\n"
-		"vt 0.50000 0.75000" + "\n"
-		"vt 0.50000 0.83333" + "\n"
-		"vt 0.58333 0.83333" + "\n"
-		"vt 0.58333 0.75000" + "\n"
-		"vt 0.54167 0.75000" + "\n"
-		"vt 0.54167 0.83333" + "\n"
-		"vt 0.62500 0.83333" + "\n"
-		"vt 0.62500 0.75000" + "\n"
-		"vt 0.58333 0.75000" + "\n"
-		"vt 0.58333 0.83333" + "\n"
-		"vt 0.66667 0.83333" + "\n"
-		"vt 0.66667 0.75000" + "\n"
-		"vt 0.62500 0.75000" + "\n"
-		"vt 0.62500 0.83333" + "\n"
-		"vt 0.70833 0.83333" + "\n"
-		"vt 0.70833 0.75000" + "\n"
-		"vt 0.66667 0.75000" + "\n"
-		"vt 0.66667 0.83333" + "\n"
-		"vt 0.75000 0.83333" + "\n"
-		"vt 0.75000 0.75000" + "\n"
-		"vt 0.70833 0.75000" + "\n"
-		"vt 0.70833 0.83333" + "\n"
-		"vt 0.79167 0.83333" + "\n"
-		"vt 0.79167 0.75000" + "\n"
-		"vt 0.75000 0.75000" + "\n"
-		"vt 0.75000 0.83333" + "\n"
-		"vt 0.83333 0.83333" + "\n"
-		"vt 0.83333 0.75000" + "\n"
-		"vt 0.79167 0.75000" + "\n"
-		"vt 0.79167 0.83333" + "\n"
-		"vt 0.87500 0.83333" + "\n"
-		"vt 0.87500 0.75000" + "\n"
-		"vt 0.83333 0.75000" + "\n"
-		"vt 0.83333 0.83333" + "\n"
-		"vt 0.91667 0.83333" + "\n"
-		"vt 0.91667 0.75000" + "\n"
-		"vt 0.87500 0.75000" + "\n"
-		"vt 0.87500 0.83333" + "\n"
-		"vt 0.95833 0.83333" + "\n"
-		"vt 0.95833 0.75000" + "\n"
-		"vt 0.91667 0.75000" + "\n"
-		"vt 0.91667 0.83333" + "\n"
-		"vt 1.00000 0.83333" + "\n"
-		"vt 1.00000 0.75000" + "\n"
-		"vt 0.95833 0.75000" + "\n"
-		"vt 0.95833 0.83333" + "\n"
-		"vt 0.04167 0.75000" + "\n"
-		"vt 0.04167 0.66667" + "\n"
-		"vt 0.00000 0.66667" + "\n"
-		"vt 0.00000 0.75000" + "\n"
-		"vt 0.08333 0.75000" + "\n"
-		"vt 0.08333 0.66667" + "\n"
-		"vt 0.04167 0.66667" + "\n"
-		"vt 0.04167 0.75000" + "\n"
-		"vt 0.12500 0.75000" + "\n"
-		"vt 0.12500 0.66667" + "\n"
-		"vt 0.08333 0.66667" + "\n"
-		"vt 0.08333 0.75000" + "\n"
-		"vt 0.16667 0.75000" + "\n"
-		"vt 0.16667 0.66667" + "\n"
-		"vt 0.12500 0.66667" + "\n"
-		"vt 0.12500 0.75000" + "\n"
-		"vt 0.20833 0.75000" + "\n"
-		"vt 0.20833 0.66667" + "\n"
-		"vt 0.16667 0.66667" + "\n"
-		"vt 0.16667 0.75000" + "\n"
-		"vt 0.25000 0.75000" + "\n"
-		"vt 0.25000 0.66667" + "\n"
-		"vt 0.20833 0.66667" + "\n"
-		"vt 0.20833 0.75000" + "\n"
-		"vt 0.29167 0.75000" + "\n"
-		"vt 0.29167 0.66667" + "\n"
-		"vt 0.25000 0.66667" + "\n"
-		"vt 0.25000 0.75000" + "\n"
-		"vt 0.33333 0.75000" + "\n"
-		"vt 0.33333 0.66667" + "\n"
-		"vt 0.29167 0.66667" + "\n"
-		"vt 0.29167 0.75000" + "\n"
-		"vt 0.37500 0.75000" + "\n"
-		"vt 0.37500 0.66667" + "\n"
-		"vt 0.33333 0.66667" + "\n"
-		"vt 0.33333 0.75000" + "\n"
-		"vt 0.41667 0.75000" + "\n"
-		"vt 0.41667 0.66667" + "\n"
-		"vt 0.37500 0.66667" + "\n"
-		"vt 0.37500 0.75000" + "\n"
-		"vt 0.45833 0.75000" + "\n"
-		"vt 0.45833 0.66667" + "\n"
-		"vt 0.41667 0.66667" + "\n"
-		"vt 0.41667 0.75000" + "\n"
-		"vt 0.50000 0.75000" + "\n"
-		"vt 0.50000 0.66667" + "\n"
-		"vt 0.45833 0.66667" + "\n"
-		"vt 0.45833 0.75000" + "\n"
-		"vt 0.54167 0.75000" + "\n"
-		"vt 0.54167 0.66667" + "\n"
-		"vt 0.50000 0.66667" + "\n"
-		"vt 0.50000 0.75000" + "\n"
-		"vt 0.58333 0.75000" + "\n"
-		"vt 0.58333 0.66667" + "\n"
-		"vt 0.54167 0.66667" + "\n"
-		"vt 0.54167 0.75000" + "\n"
-		"vt 0.62500 0.75000" + "\n"
-		"vt 0.62500 0.66667" + "\n"
-		"vt 0.58333 0.66667" + "\n"
-		"vt 0.58333 0.75000" + "\n"
-		"vt 0.66667 0.75000" + "\n"
-		"vt 0.66667 0.66667" + "\n"
-		"vt 0.62500 0.66667" + "\n"
-		"vt 0.62500 0.75000" + "\n"
-		"vt 0.70833 0.75000" + "\n"
-		"vt 0.70833 0.66667" + "\n"
-		"vt 0.66667 0.66667" + "\n"
-		"vt 0.66667 0.75000" + "\n"
-		"vt 0.75000 0.75000" + "\n"
-		"vt 0.75000 0.66667" + "\n"
-		"vt 0.70833 0.66667" + "\n"
-		"vt 0.70833 0.75000" + "\n"
-		"vt 0.79167 0.75000" + "\n"
-		"vt 0.79167 0.66667" + "\n"
-		"vt 0.75000 0.66667" + "\n"
-		"vt 0.75000 0.75000" + "\n"
-		"vt 0.83333 0.75000" + "\n"
-		"vt 0.83333 0.66667" + "\n"
-		"vt 0.79167 0.66667" + "\n"
-		"vt 0.79167 0.75000" + "\n"
-		"vt 0.87500 0.75000" + "\n"
-		"vt 0.87500 0.66667" + "\n"
-		"vt 0.83333 0.66667" + "\n"
-		"vt 0.83333 0.75000" + "\n"
-		"vt 0.91667 0.75000" + "\n"
-		"vt 0.91667 0.66667" + "\n"
-		"vt 0.87500 0.66667" + "\n"
-		"vt 0.87500 0.75000" + "\n"
-		"vt 0.95833 0.75000" + "\n"
-		"vt 0.95833 0.66667" + "\n"
-		"vt 0.91667 0.66667" + "\n"
-		"vt 0.91667 0.75000" + "\n"
-		"vt 1.00000 0.75000" + "\n"
-		"vt 1.00000 0.66667" + "\n"
-		"vt 0.95833 0.66667" + "\n"
-		"vt 0.95833 0.75000" + "\n"
-		"vt 0.04167 0.66667" + "\n"
-		"vt 0.04167 0.58333" + "\n"
-		"vt 0.00000 0.58333" + "\n"
-		"vt 0.00000 0.66667" + "\n"
-		"vt 0.08333 0.66667" + "\n"
-		"vt 0.08333 0.58333" + "\n"
-		"vt 0.04167 0.58333" + "\n"
-		"vt 0.04167 0.66667" + "\n"
-		"vt 0.12500 0.66667" + "\n"
-		"vt 0.12500 0.58333" + "\n"
-		"vt 0.08333 0.58333" + "\n"
-		"vt 0.08333 0.66667" + "\n"
-		"vt 0.16667 0.66667" + "\n"
-		"vt 0.16667 0.58333" + "\n"
-		"vt 0.12500 0.58333" + "\n"
-		"vt 0.12500 0.66667" + "\n"
-		"vt 0.20833 0.66667" + "\n"
-		"vt 0.20833 0.58333" + "\n"
-		"vt 0.16667 0.58333" + "\n"
-		"vt 0.16667 0.66667" + "\n"
-		"vt 0.25000 0.66667" + "\n"
-		"vt 0.25000 0.58333" + "\n"
-		"vt 0.20833 0.58333" + "\n"
-		"vt 0.20833 0.66667" + "\n"
-		"vt 0.29167 0.66667" + "\n"
-		"vt 0.29167 0.58333" + "\n"
-		"vt 0.25000 0.58333" + "\n"
-		"vt 0.25000 0.66667" + "\n"
-		"vt 0.33333 0.66667" + "\n"
-		"vt 0.33333 0.58333" + "\n"
-		"vt 0.29167 0.58333" + "\n"
-		"vt 0.29167 0.66667" + "\n"
-		"vt 0.37500 0.66667" + "\n"
-		"vt 0.37500 0.58333" + "\n"
-		"vt 0.33333 0.58333" + "\n"
-		"vt 0.33333 0.66667" + "\n"
-		"vt 0.41667 0.66667" + "\n"
-		"vt 0.41667 0.58333" + "\n"
-		"vt 0.37500 0.58333" + "\n"
-		"vt 0.37500 0.66667" + "\n"
-		"vt 0.45833 0.66667" + "\n"
-		"vt 0.45833 0.58333" + "\n"
-		"vt 0.41667 0.58333" + "\n"
-		"vt 0.41667 0.66667" + "\n"
-		"vt 0.50000 0.66667" + "\n"
-		"vt 0.50000 0.58333" + "\n"
-		"vt 0.45833 0.58333" + "\n"
-		"vt 0.45833 0.66667" + "\n"
-		"vt 0.54167 0.66667" + "\n"
-		"vt 0.54167 0.58333" + "\n"
-		"vt 0.50000 0.58333" + "\n"
-		"vt 0.50000 0.66667" + "\n"
-		"vt 0.58333 0.66667" + "\n"
-		"vt 0.58333 0.58333" + "\n"
-		"vt 0.54167 0.58333" + "\n"
-		"vt 0.54167 0.66667" + "\n"
-		"vt 0.62500 0.66667" + "\n"
-		"vt 0.62500 0.58333" + "\n"
-		"vt 0.58333 0.58333" + "\n"
-		"vt 0.58333 0.66667" + "\n"
-		"vt 0.66667 0.66667" + "\n"
-		"vt 0.66667 0.58333" + "\n"
-		"vt 0.62500 0.58333" + "\n"
-		"vt 0.62500 0.66667" + "\n"
-		"vt 0.70833 0.66667" + "\n"
-		"vt 0.70833 0.58333" + "\n"
-		"vt 0.66667 0.58333" + "\n"
-		"vt 0.66667 0.66667" + "\n"
-		"vt 0.75000 0.66667" + "\n"
-		"vt 0.75000 0.58333" + "\n"
-		"vt 0.70833 0.58333" + "\n"
-		"vt 0.70833 0.66667" + "\n"
-		"vt 0.79167 0.66667" + "\n"
-		"vt 0.79167 0.58333" + "\n"
-		"vt 0.75000 0.58333" + "\n"
-		"vt 0.75000 0.66667" + "\n"
-		"vt 0.83333 0.66667" + "\n"
-		"vt 0.83333 0.58333" + "\n"
-		"vt 0.79167 0.58333" + "\n"
-		"vt 0.79167 0.66667" + "\n"
-		"vt 0.87500 0.66667" + "\n"
-		"vt 0.87500 0.58333" + "\n"
-		"vt 0.83333 0.58333" + "\n"
-		"vt 0.83333 0.66667" + "\n"
-		"vt 0.91667 0.66667" + "\n"
-		"vt 0.91667 0.58333" + "\n"
-		"vt 0.87500 0.58333" + "\n"
-		"vt 0.87500 0.66667" + "\n"
-		"vt 0.95833 0.66667" + "\n"
-		"vt 0.95833 0.58333" + "\n"
-		"vt 0.91667 0.58333" + "\n"
-		"vt 0.91667 0.66667" + "\n"
-		"vt 1.00000 0.66667" + "\n"
-		"vt 1.00000 0.58333" + "\n"
-		"vt 0.95833 0.58333" + "\n"
-		"vt 0.95833 0.66667" + "\n"
-		"vt 0.04167 0.58333" + "\n"
-		"vt 0.04167 0.50000" + "\n"
-		"vt 0.00000 0.50000" + "\n"
-		"vt 0.00000 0.58333" + "\n"
-		"vt 0.08333 0.58333" + "\n"
-		"vt 0.08333 0.50000" + "\n"
-		"vt 0.04167 0.50000" + "\n"
-		"vt 0.04167 0.58333" + "\n"
-		"vt 0.12500 0.58333" + "\n"
-		"vt 0.12500 0.50000" + "\n"
-		"vt 0.08333 0.50000" + "\n"
-		"vt 0.08333 0.58333" + "\n"
-		"vt 0.16667 0.58333" + "\n"
-		"vt 0.16667 0.50000" + "\n"
-		"vt 0.12500 0.50000" + "\n"
-		"vt 0.12500 0.58333" + "\n"
-		"vt 0.20833 0.58333" + "\n"
-		"vt 0.20833 0.50000" + "\n"
-		"vt 0.16667 0.50000" + "\n"
-		"vt 0.16667 0.58333" + "\n"
-		"vt 0.25000 0.58333" + "\n"
-		"vt 0.25000 0.50000" + "\n"
-		"vt 0.20833 0.50000" + "\n"
-		"vt 0.20833 0.58333" + "\n"
-		"vt 0.29167 0.58333" + "\n"
-		"vt 0.29167 0.50000" + "\n"
-		"vt 0.25000 0.50000" + "\n"
-		"vt 0.25000 0.58333" + "\n"
-		"vt 0.33333 0.58333" + "\n"
-		"vt 0.33333 0.50000" + "\n"
-		"vt 0.29167 0.50000" + "\n"
-		"vt 0.29167 0.58333" + "\n"
-		"vt 0.37500 0.58333" + "\n"
-		"vt 0.37500 0.50000" + "\n"
-		"vt 0.33333 0.50000" + "\n"
-		"vt 0.33333 0.58333" + "\n"
-		"vt 0.41667 0.58333" + "\n"
-		"vt 0.41667 0.50000" + "\n"
-		"vt 0.37500 0.50000" + "\n"
-		"vt 0.37500 0.58333" + "\n"
-		"vt 0.45833 0.58333" + "\n"
-		"vt 0.45833 0.50000" + "\n"
-		"vt 0.41667 0.50000" + "\n"
-		"vt 0.41667 0.58333" + "\n"
-		"vt 0.50000 0.58333" + "\n"
-		"vt 0.50000 0.50000" + "\n"
-		"vt 0.45833 0.50000" + "\n"
-		"vt 0.45833 0.58333" + "\n"
-		"vt 0.54167 0.58333" + "\n"
-		"vt 0.54167 0.50000" + "\n"
-		"vt 0.50000 0.50000" + "\n"
-		"vt 0.50000 0.58333" + "\n"
-		"vt 0.58333 0.58333" + "\n"
-		"vt 0.58333 0.50000" + "\n"
-		"vt 0.54167 0.50000" + "\n"
-		"vt 0.54167 0.58333" + "\n"
-		"vt 0.62500 0.58333" + "\n"
-		"vt 0.62500 0.50000" + "\n"
-		"vt 0.58333 0.50000" + "\n"
-		"vt 0.58333 0.58333" + "\n"
-		"vt 0.66667 0.58333" + "\n"
-		"vt 0.66667 0.50000" + "\n"
-		"vt 0.62500 0.50000" + "\n"
-		"vt 0.62500 0.58333" + "\n"
-		"vt 0.70833 0.58333" + "\n"
-		"vt 0.70833 0.50000" + "\n"
-		"vt 0.66667 0.50000" + "\n"
-		"vt 0.66667 0.58333" + "\n"
-		"vt 0.75000 0.58333" + "\n"
-		"vt 0.75000 0.50000" + "\n"
-		"vt 0.70833 0.50000" + "\n"
-		"vt 0.70833 0.58333" + "\n"
-		"vt 0.79167 0.58333" + "\n"
-		"vt 0.79167 0.50000" + "\n"
-		"vt 0.75000 0.50000" + "\n"
-		"vt 0.75000 0.58333" + "\n"
-		"vt 0.83333 0.58333" + "\n"
-		"vt 0.83333 0.50000" + "\n"
-		"vt 0.79167 0.50000" + "\n"
-		"vt 0.79167 0.58333" + "\n"
-		"vt 0.87500 0.58333" + "\n"
-		"vt 0.87500 0.50000" + "\n"
-		"vt 0.83333 0.50000" + "\n"
-		"vt 0.83333 0.58333" + "\n"
-		"vt 0.91667 0.58333" + "\n"
-		"vt 0.91667 0.50000" + "\n"
-		"vt 0.87500 0.50000" + "\n"
-		"vt 0.87500 0.58333" + "\n"
-		"vt 0.95833 0.58333" + "\n"
-		"vt 0.95833 0.50000" + "\n"
-		"vt 0.91667 0.50000" + "\n"
-		"vt 0.91667 0.58333" + "\n"
-		"vt 1.00000 0.58333" + "\n"
-		"vt 1.00000 0.50000" + "\n"
-		"vt 0.95833 0.50000" + "\n"
-		"vt 0.95833 0.58333" + "\n"
-		"vt 0.04167 0.50000" + "\n"
-		"vt 0.04167 0.41667" + "\n"
-		"vt 0.00000 0.41667" + "\n"
-		"vt 0.00000 0.50000" + "\n"
-		"vt 0.08333 0.50000" + "\n"
-		"vt 0.08333 0.41667" + "\n"
-		"vt 0.04167 0.41667" + "\n"
-		"vt 0.04167 0.50000" + "\n"
-		"vt 0.12500 0.50000" + "\n"
-		"vt 0.12500 0.41667" + "\n"
-		"vt 0.08333 0.41667" + "\n"
-		"vt 0.08333 0.50000" + "\n"
-		"vt 0.16667 0.50000" + "\n"
-		"vt 0.16667 0.41667" + "\n"
-		"vt 0.12500 0.41667" + "\n"
-		"vt 0.12500 0.50000" + "\n"
-		"vt 0.20833 0.50000" + "\n"
-		"vt 0.20833 0.41667" + "\n"
-		"vt 0.16667 0.41667" + "\n"
-		"vt 0.16667 0.50000" + "\n"
-		"vt 0.25000 0.50000" + "\n"
-		"vt 0.25000 0.41667" + "\n"
-		"vt 0.20833 0.41667" + "\n"
-		"vt 0.20833 0.50000" + "\n"
-		"vt 0.29167 0.50000" + "\n"
-		"vt 0.29167 0.41667" + "\n"
-		"vt 0.25000 0.41667" + "\n"
-		"vt 0.25000 0.50000" + "\n"
-		"vt 0.33333 0.50000" + "\n"
-		"vt 0.33333 0.41667" + "\n"
-		"vt 0.29167 0.41667" + "\n"
-		"vt 0.29167 0.50000" + "\n"
-		"vt 0.37500 0.50000" + "\n"
-		"vt 0.37500 0.41667" + "\n"
-		"vt 0.33333 0.41667" + "\n"
-		"vt 0.33333 0.50000" + "\n"
-		"vt 0.41667 0.50000" + "\n"
-		"vt 0.41667 0.41667" + "\n"
-		"vt 0.37500 0.41667" + "\n"
-		"vt 0.37500 0.50000" + "\n"
-		"vt 0.45833 0.50000" + "\n"
-		"vt 0.45833 0.41667" + "\n"
-		"vt 0.41667 0.41667" + "\n"
-		"vt 0.41667 0.50000" + "\n"
-		"vt 0.50000 0.50000" + "\n"
-		"vt 0.50000 0.41667" + "\n"
-		"vt 0.45833 0.41667" + "\n"
-		"vt 0.45833 0.50000" + "\n"
-		"vt 0.54167 0.50000" + "\n"
-		"vt 0.54167 0.41667" + "\n"
-		"vt 0.50000 0.41667" + "\n"
-		"vt 0.50000 0.50000" + "\n"
-		"vt 0.58333 0.50000" + "\n"
-		"vt 0.58333 0.41667" + "\n"
-		"vt 0.54167 0.41667" + "\n"
-		"vt 0.54167 0.50000" + "\n"
-		"vt 0.62500 0.50000" + "\n"
-		"vt 0.62500 0.41667" + "\n"
-		"vt 0.58333 0.41667" + "\n"
-		"vt 0.58333 0.50000" + "\n"
-		"vt 0.66667 0.50000" + "\n"
-		"vt 0.66667 0.41667" + "\n"
-		"vt 0.62500 0.41667" + "\n"
-		"vt 0.62500 0.50000" + "\n"
-		"vt 0.70833 0.50000" + "\n"
-		"vt 0.70833 0.41667" + "\n"
-		"vt 0.66667 0.41667" + "\n"
-		"vt 0.66667 0.50000" + "\n"
-		"vt 0.75000 0.50000" + "\n"
-		"vt 0.75000 0.41667" + "\n"
-		"vt 0.70833 0.41667" + "\n"
-		"vt 0.70833 0.50000" + "\n"
-		"vt 0.79167 0.50000" + "\n"
-		"vt 0.79167 0.41667" + "\n"
-		"vt 0.75000 0.41667" + "\n"
-		"vt 0.75000 0.50000" + "\n"
-		"vt 0.83333 0.50000" + "\n"
-		"vt 0.83333 0.41667" + "\n"
-		"vt 0.79167 0.41667" + "\n"
-		"vt 0.79167 0.50000" + "\n"
-		"vt 0.87500 0.50000" + "\n"
-		"vt 0.87500 0.41667" + "\n"
-		"vt 0.83333 0.41667" + "\n"
-		"vt 0.83333 0.50000" + "\n"
-		"vt 0.91667 0.50000" + "\n"
-		"vt 0.91667 0.41667" + "\n"
-		"vt 0.87500 0.41667" + "\n"
-		"vt 0.87500 0.50000" + "\n"
-		"vt 0.95833 0.50000" + "\n"
-		"vt 0.95833 0.41667" + "\n"
-		"vt 0.91667 0.41667" + "\n"
-		"vt 0.91667 0.50000" + "\n"
-		"vt 1.00000 0.50000" + "\n"
-		"vt 1.00000 0.41667" + "\n"
-		"vt 0.95833 0.41667" + "\n"
-		"vt 0.95833 0.50000" + "\n"
-		"vt 0.04167 0.41667" + "\n"
-		"vt 0.04167 0.33333" + "\n"
-		"vt 0.00000 0.33333" + "\n"
-		"vt 0.00000 0.41667" + "\n"
-		"vt 0.08333 0.41667" + "\n"
-		"vt 0.08333 0.33333" + "\n"
-		"vt 0.04167 0.33333" + "\n"
-		"vt 0.04167 0.41667" + "\n"
-		"vt 0.12500 0.41667" + "\n"
-		"vt 0.12500 0.33333" + "\n"
-		"vt 0.08333 0.33333" + "\n"
-		"vt 0.08333 0.41667" + "\n"
-		"vt 0.16667 0.41667" + "\n"
-		"vt 0.16667 0.33333" + "\n"
-		"vt 0.12500 0.33333" + "\n"
-		"vt 0.12500 0.41667" + "\n"
-		"vt 0.20833 0.41667" + "\n"
-		"vt 0.20833 0.33333" + "\n"
-		"vt 0.16667 0.33333" + "\n"
-		"vt 0.16667 0.41667" + "\n"
-		"vt 0.25000 0.41667" + "\n"
-		"vt 0.25000 0.33333" + "\n"
-		"vt 0.20833 0.33333" + "\n"
-		"vt 0.20833 0.41667" + "\n"
-		"vt 0.29167 0.41667" + "\n"
-		"vt 0.29167 0.33333" + "\n"
-		"vt 0.25000 0.33333" + "\n"
-		"vt 0.25000 0.41667" + "\n"
-		"vt 0.33333 0.41667" + "\n"
-		"vt 0.33333 0.33333" + "\n"
-		"vt 0.29167 0.33333" + "\n"
-		"vt 0.29167 0.41667" + "\n"
-		"vt 0.37500 0.41667" + "\n"
-		"vt 0.37500 0.33333" + "\n"
-		"vt 0.33333 0.33333" + "\n"
-		"vt 0.33333 0.41667" + "\n"
-		"vt 0.41667 0.41667" + "\n"
-		"vt 0.41667 0.33333" + "\n"
-		"vt 0.37500 0.33333" + "\n"
-		"vt 0.37500 0.41667" + "\n"
-		"vt 0.45833 0.41667" + "\n"
-		"vt 0.45833 0.33333" + "\n"
-		"vt 0.41667 0.33333" + "\n"
-		"vt 0.41667 0.41667" + "\n"
-		"vt 0.50000 0.41667" + "\n"
-		"vt 0.50000 0.33333" + "\n"
-		"vt 0.45833 0.33333" + "\n"
-		"vt 0.45833 0.41667" + "\n"
-		"vt 0.54167 0.41667" + "\n"
-		"vt 0.54167 0.33333" + "\n"
-		"vt 0.50000 0.33333" + "\n"
-		"vt 0.50000 0.41667" + "\n"
-		"vt 0.58333 0.41667" + "\n"
-		"vt 0.58333 0.33333" + "\n"
-		"vt 0.54167 0.33333" + "\n"
-		"vt 0.54167 0.41667" + "\n"
-		"vt 0.62500 0.41667" + "\n"
-		"vt 0.62500 0.33333" + "\n"
-		"vt 0.58333 0.33333" + "\n"
-		"vt 0.58333 0.41667" + "\n"
-		"vt 0.66667 0.41667" + "\n"
-		"vt 0.66667 0.33333" + "\n"
-		"vt 0.62500 0.33333" + "\n"
-		"vt 0.62500 0.41667" + "\n"
-		"vt 0.70833 0.41667" + "\n"
-		"vt 0.70833 0.33333" + "\n"
-		"vt 0.66667 0.33333" + "\n"
-		"vt 0.66667 0.41667" + "\n"
-		"vt 0.75000 0.41667" + "\n"
-		"vt 0.75000 0.33333" + "\n"
-		"vt 0.70833 0.33333" + "\n"
-		"vt 0.70833 0.41667" + "\n"
-		"vt 0.79167 0.41667" + "\n"
-		"vt 0.79167 0.33333" + "\n"
-		"vt 0.75000 0.33333" + "\n"
-		"vt 0.75000 0.41667" + "\n"
-		"vt 0.83333 0.41667" + "\n"
-		"vt 0.83333 0.33333" + "\n"
-		"vt 0.79167 0.33333" + "\n"
-		"vt 0.79167 0.41667" + "\n"
-		"vt 0.87500 0.41667" + "\n"
-		"vt 0.87500 0.33333" + "\n"
-		"vt 0.83333 0.33333" + "\n"
-		"vt 0.83333 0.41667" + "\n"
-		"vt 0.91667 0.41667" + "\n"
-		"vt 0.91667 0.33333" + "\n"
-		"vt 0.87500 0.33333" + "\n"
-		"vt 0.87500 0.41667" + "\n"
-		"vt 0.95833 0.41667" + "\n"
-		"vt 0.95833 0.33333" + "\n"
-		"vt 0.91667 0.33333" + "\n"
-		"vt 0.91667 0.41667" + "\n"
-		"vt 1.00000 0.41667" + "\n"
-		"vt 1.00000 0.33333" + "\n"
-		"vt 0.95833 0.33333" + "\n"
-		"vt 0.95833 0.41667" + "\n"
-		"vt 0.04167 0.33333" + "\n"
-		"vt 0.04167 0.25000" + "\n"
-		"vt 0.00000 0.25000" + "\n"
-		"vt 0.00000 0.33333" + "\n"
-		"vt 0.08333 0.33333" + "\n"
-		"vt 0.08333 0.25000" + "\n"
-		"vt 0.04167 0.25000" + "\n"
-		"vt 0.04167 0.33333" + "\n"
-		"vt 0.12500 0.33333" + "\n"
-		"vt 0.12500 0.25000" + "\n"
-		"vt 0.08333 0.25000" + "\n"
-		"vt 0.08333 0.33333" + "\n"
-		"vt 0.16667 0.33333" + "\n"
-		"vt 0.16667 0.25000" + "\n"
-		"vt 0.12500 0.25000" + "\n"
-		"vt 0.12500 0.33333" + "\n"
-		"vt 0.20833 0.33333" + "\n"
-		"vt 0.20833 0.25000" + "\n"
-		"vt 0.16667 0.25000" + "\n"
-		"vt 0.16667 0.33333" + "\n"
-		"vt 0.25000 0.33333" + "\n"
-		"vt 0.25000 0.25000" + "\n"
-		"vt 0.20833 0.25000" + "\n"
-		"vt 0.20833 0.33333" + "\n"
-		"vt 0.29167 0.33333" + "\n"
-		"vt 0.29167 0.25000" + "\n"
-		"vt 0.25000 0.25000" + "\n"
-		"vt 0.25000 0.33333" + "\n"
-		"vt 0.33333 0.33333" + "\n"
-		"vt 0.33333 0.25000" + "\n"
-		"vt 0.29167 0.25000" + "\n"
-		"vt 0.29167 0.33333" + "\n"
-		"vt 0.37500 0.33333" + "\n"
-		"vt 0.37500 0.25000" + "\n"
-		"vt 0.33333 0.25000" + "\n"
-		"vt 0.33333 0.33333" + "\n"
-		"vt 0.41667 0.33333" + "\n"
-		"vt 0.41667 0.25000" + "\n"
-		"vt 0.37500 0.25000" + "\n"
-		"vt 0.37500 0.33333" + "\n"
-		"vt 0.45833 0.33333" + "\n"
-		"vt 0.45833 0.25000" + "\n"
-		"vt 0.41667 0.25000" + "\n"
-		"vt 0.41667 0.33333" + "\n"
-		"vt 0.50000 0.33333" + "\n"
-		"vt 0.50000 0.25000" + "\n"
-		"vt 0.45833 0.25000" + "\n"
-		"vt 0.45833 0.33333" + "\n"
-		"vt 0.54167 0.33333" + "\n"
-		"vt 0.54167 0.25000" + "\n"
-		"vt 0.50000 0.25000" + "\n"
-		"vt 0.50000 0.33333" + "\n"
-		"vt 0.58333 0.33333" + "\n"
-		"vt 0.58333 0.25000" + "\n"
-		"vt 0.54167 0.25000" + "\n"
-		"vt 0.54167 0.33333" + "\n"
-		"vt 0.62500 0.33333" + "\n"
-		"vt 0.62500 0.25000" + "\n"
-		"vt 0.58333 0.25000" + "\n"
-		"vt 0.58333 0.33333" + "\n"
-		"vt 0.66667 0.33333" + "\n"
-		"vt 0.66667 0.25000" + "\n"
-		"vt 0.62500 0.25000" + "\n"
-		"vt 0.62500 0.33333" + "\n"
-		"vt 0.70833 0.33333" + "\n"
-		"vt 0.70833 0.25000" + "\n"
-		"vt 0.66667 0.25000" + "\n"
-		"vt 0.66667 0.33333" + "\n"
-		"vt 0.75000 0.33333" + "\n"
-		"vt 0.75000 0.25000" + "\n"
-		"vt 0.70833 0.25000" + "\n"
-		"vt 0.70833 0.33333" + "\n"
-		"vt 0.79167 0.33333" + "\n"
-		"vt 0.79167 0.25000" + "\n"
-		"vt 0.75000 0.25000" + "\n"
-		"vt 0.75000 0.33333" + "\n"
-		"vt 0.83333 0.33333" + "\n"
-		"vt 0.83333 0.25000" + "\n"
-		"vt 0.79167 0.25000" + "\n"
-		"vt 0.79167 0.33333" + "\n"
-		"vt 0.87500 0.33333" + "\n"
-		"vt 0.87500 0.25000" + "\n"
-		"vt 0.83333 0.25000" + "\n"
-		"vt 0.83333 0.33333" + "\n"
-		"vt 0.91667 0.33333" + "\n"
-		"vt 0.91667 0.25000" + "\n"
-		"vt 0.87500 0.25000" + "\n"
-		"vt 0.87500 0.33333" + "\n"
-		"vt 0.95833 0.33333" + "\n"
-		"vt 0.95833 0.25000" + "\n"
-		"vt 0.91667 0.25000" + "\n"
-		"vt 0.91667 0.33333" + "\n"
-		"vt 1.00000 0.33333" + "\n"
-		"vt 1.00000 0.25000" + "\n"
-		"vt 0.95833 0.25000" + "\n"
-		"vt 0.95833 0.33333" + "\n"
-		"vt 0.04167 0.25000" + "\n"
-		"vt 0.04167 0.16667" + "\n"
-		"vt 0.00000 0.16667" + "\n"
-		"vt 0.00000 0.25000" + "\n"
-		"vt 0.08333 0.25000" + "\n"
-		"vt 0.08333 0.16667" + "\n"
-		"vt 0.04167 0.16667" + "\n"
-		"vt 0.04167 0.25000" + "\n"
-		"vt 0.12500 0.25000" + "\n"
-		"vt 0.12500 0.16667" + "\n"
-		"vt 0.08333 0.16667" + "\n"
-		"vt 0.08333 0.25000" + "\n"
-		"vt 0.16667 0.25000" + "\n"
-		"vt 0.16667 0.16667" + "\n"
-		"vt 0.12500 0.16667" + "\n"
-		"vt 0.12500 0.25000" + "\n"
-		"vt 0.20833 0.25000" + "\n"
-		"vt 0.20833 0.16667" + "\n"
-		"vt 0.16667 0.16667" + "\n"
-		"vt 0.16667 0.25000" + "\n"
-		"vt 0.25000 0.25000" + "\n"
-		"vt 0.25000 0.16667" + "\n"
-		"vt 0.20833 0.16667" + "\n"
-		"vt 0.20833 0.25000" + "\n"
-		"vt 0.29167 0.25000" + "\n"
-		"vt 0.29167 0.16667" + "\n"
-		"vt 0.25000 0.16667" + "\n"
-		"vt 0.25000 0.25000" + "\n"
-		"vt 0.33333 0.25000" + "\n"
-		"vt 0.33333 0.16667" + "\n"
-		"vt 0.29167 0.16667" + "\n"
-		"vt 0.29167 0.25000" + "\n"
-		"vt 0.37500 0.25000" + "\n"
-		"vt 0.37500 0.16667" + "\n"
-		"vt 0.33333 0.16667" + "\n"
-		"vt 0.33333 0.25000" + "\n"
-		"vt 0.41667 0.25000" + "\n"
-		"vt 0.41667 0.16667" + "\n"
-		"vt 0.37500 0.16667" + "\n"
-		"vt 0.37500 0.25000" + "\n"
-		"vt 0.45833 0.25000" + "\n"
-		"vt 0.45833 0.16667" + "\n"
-		"vt 0.41667 0.16667" + "\n"
-		"vt 0.41667 0.25000" + "\n"
-		"vt 0.50000 0.25000" + "\n"
-		"vt 0.50000 0.16667" + "\n"
-		"vt 0.45833 0.16667" + "\n"
-		"vt 0.45833 0.25000" + "\n"
-		"vt 0.54167 0.25000" + "\n"
-		"vt 0.54167 0.16667" + "\n"
-		"vt 0.50000 0.16667" + "\n"
-		"vt 0.50000 0.25000" + "\n"
-		"vt 0.58333 0.25000" + "\n"
-		"vt 0.58333 0.16667" + "\n"
-		"vt 0.54167 0.16667" + "\n"
-		"vt 0.54167 0.25000" + "\n"
-		"vt 0.62500 0.25000" + "\n"
-		"vt 0.62500 0.16667" + "\n"
-		"vt 0.58333 0.16667" + "\n"
-		"vt 0.58333 0.25000" + "\n"
-		"vt 0.66667 0.25000" + "\n"
-		"vt 0.66667 0.16667" + "\n"
-		"vt 0.62500 0.16667" + "\n"
-		"vt 0.62500 0.25000" + "\n"
-		"vt 0.70833 0.25000" + "\n"
-		"vt 0.70833 0.16667" + "\n"
-		"vt 0.66667 0.16667" + "\n"
-		"vt 0.66667 0.25000" + "\n"
-		"vt 0.75000 0.25000" + "\n"
-		"vt 0.75000 0.16667" + "\n"
-		"vt 0.70833 0.16667" + "\n"
-		"vt 0.70833 0.25000" + "\n"
-		"vt 0.79167 0.25000" + "\n"
-		"vt 0.79167 0.16667" + "\n"
-		"vt 0.75000 0.16667" + "\n"
-		"vt 0.75000 0.25000" + "\n"
-		"vt 0.83333 0.25000" + "\n"
-		"vt 0.83333 0.16667" + "\n"
-		"vt 0.79167 0.16667" + "\n"
-		"vt 0.79167 0.25000" + "\n"
-		"vt 0.87500 0.25000" + "\n"
-		"vt 0.87500 0.16667" + "\n"
-		"vt 0.83333 0.16667" + "\n"
-		"vt 0.83333 0.25000" + "\n"
-		"vt 0.91667 0.25000" + "\n"
-		"vt 0.91667 0.16667" + "\n"
-		"vt 0.87500 0.16667" + "\n"
-		"vt 0.87500 0.25000" + "\n"
-		"vt 0.95833 0.25000" + "\n"
-		"vt 0.95833 0.16667" + "\n"
-		"vt 0.91667 0.16667" + "\n"
-		"vt 0.91667 0.25000" + "\n"
-		"vt 1.00000 0.25000" + "\n"
-		"vt 1.00000 0.16667" + "\n"
-		"vt 0.95833 0.16667" + "\n"
-		"vt 0.95833 0.25000" + "\n"
-		"vt 0.04167 0.16667" + "\n"
-		"vt 0.04167 0.08333" + "\n"
-		"vt 0.00000 0.08333" + "\n"
-		"vt 0.00000 0.16667" + "\n"
-		"vt 0.08333 0.16667" + "\n"
-		"vt 0.08333 0.08333" + "\n"
-		"vt 0.04167 0.08333" + "\n"
-		"vt 0.04167 0.16667" + "\n"
-		"vt 0.12500 0.16667" + "\n"
-		"vt 0.12500 0.08333" + "\n"
-		"vt 0.08333 0.08333" + "\n"
-		"vt 0.08333 0.16667" + "\n"
-		"vt 0.16667 0.16667" + "\n"
-		"vt 0.16667 0.08333" + "\n"
-		"vt 0.12500 0.08333" + "\n"
-		"vt 0.12500 0.16667" + "\n"
-		"vt 0.20833 0.16667" + "\n"
-		"vt 0.20833 0.08333" + "\n"
-		"vt 0.16667 0.08333" + "\n"
-		"vt 0.16667 0.16667" + "\n"
-		"vt 0.25000 0.16667" + "\n"
-		"vt 0.25000 0.08333" + "\n"
-		"vt 0.20833 0.08333" + "\n"
-		"vt 0.20833 0.16667" + "\n"
-		"vt 0.29167 0.16667" + "\n"
-		"vt 0.29167 0.08333" + "\n"
-		"vt 0.25000 0.08333" + "\n"
-		"vt 0.25000 0.16667" + "\n"
-		"vt 0.33333 0.16667" + "\n"
-		"vt 0.33333 0.08333" + "\n"
-		"vt 0.29167 0.08333" + "\n"
-		"vt 0.29167 0.16667" + "\n"
-		"vt 0.37500 0.16667" + "\n"
-		"vt 0.37500 0.08333" + "\n"
-		"vt 0.33333 0.08333" + "\n"
-		"vt 0.33333 0.16667" + "\n"
-		"vt 0.41667 0.16667" + "\n"
-		"vt 0.41667 0.08333" + "\n"
-		"vt 0.37500 0.08333" + "\n"
-		"vt 0.37500 0.16667" + "\n"
-		"vt 0.45833 0.16667" + "\n"
-		"vt 0.45833 0.08333" + "\n"
-		"vt 0.41667 0.08333" + "\n"
-		"vt 0.41667 0.16667" + "\n"
-		"vt 0.50000 0.16667" + "\n"
-		"vt 0.50000 0.08333" + "\n"
-		"vt 0.45833 0.08333" + "\n"
-		"vt 0.45833 0.16667" + "\n"
-		"vt 0.54167 0.16667" + "\n"
-		"vt 0.54167 0.08333" + "\n"
-		"vt 0.50000 0.08333" + "\n"
-		"vt 0.50000 0.16667" + "\n"
-		"vt 0.58333 0.16667" + "\n"
-		"vt 0.58333 0.08333" + "\n"
-		"vt 0.54167 0.08333" + "\n"
-		"vt 0.54167 0.16667" + "\n"
-		"vt 0.62500 0.16667" + "\n"
-		"vt 0.62500 0.08333" + "\n"
-		"vt 0.58333 0.08333" + "\n"
-		"vt 0.58333 0.16667" + "\n"
-		"vt 0.66667 0.16667" + "\n"
-		"vt 0.66667 0.08333" + "\n"
-		"vt 0.62500 0.08333" + "\n"
-		"vt 0.62500 0.16667" + "\n"
-		"vt 0.70833 0.16667" + "\n"
-		"vt 0.70833 0.08333" + "\n"
-		"vt 0.66667 0.08333" + "\n"
-		"vt 0.66667 0.16667" + "\n"
-		"vt 0.75000 0.16667" + "\n"
-		"vt 0.75000 0.08333" + "\n"
-		"vt 0.70833 0.08333" + "\n"
-		"vt 0.70833 0.16667" + "\n"
-		"vt 0.79167 0.16667" + "\n"
-		"vt 0.79167 0.08333" + "\n"
-		"vt 0.75000 0.08333" + "\n"
-		"vt 0.75000 0.16667" + "\n"
-		"vt 0.83333 0.16667" + "\n"
-		"vt 0.83333 0.08333" + "\n"
-		"vt 0.79167 0.08333" + "\n"
-		"vt 0.79167 0.16667" + "\n"
-		"vt 0.87500 0.16667" + "\n"
-		"vt 0.87500 0.08333" + "\n"
-		"vt 0.83333 0.08333" + "\n"
-		"vt 0.83333 0.16667" + "\n"
-		"vt 0.91667 0.16667" + "\n"
-		"vt 0.91667 0.08333" + "\n"
-		"vt 0.87500 0.08333" + "\n"
-		"vt 0.87500 0.16667" + "\n"
-		"vt 0.95833 0.16667" + "\n"
-		"vt 0.95833 0.08333" + "\n"
-		"vt 0.91667 0.08333" + "\n"
-		"vt 0.91667 0.16667" + "\n"
-		"vt 1.00000 0.16667" + "\n"
-		"vt 1.00000 0.08333" + "\n"
-		"vt 0.95833 0.08333" + "\n"
-		"vt 0.95833 0.16667" + "\n"
-		"vt 0.04167 0.91667" + "\n"
-		"vt 0.00000 0.91667" + "\n"
-		"vt 0.00000 1.00000" + "\n"
-		"vt 0.00000 0.00000" + "\n"
-		"vt 0.00000 0.08333" + "\n"
-		"vt 0.04167 0.08333" + "\n"
-		"vt 0.08333 0.91667" + "\n"
-		"vt 0.04167 0.91667" + "\n"
-		"vt 0.04167 1.00000" + "\n"
-		"vt 0.04167 0.00000" + "\n"
-		"vt 0.04167 0.08333" + "\n"
-		"vt 0.08333 0.08333" + "\n"
-		"vt 0.12500 0.91667" + "\n"
-		"vt 0.08333 0.91667" + "\n"
-		"vt 0.08333 1.00000" + "\n"
-		"vt 0.08333 0.00000" + "\n"
-		"vt 0.08333 0.08333" + "\n"
-		"vt 0.12500 0.08333" + "\n"
-		"vt 0.16667 0.91667" + "\n"
-		"vt 0.12500 0.91667" + "\n"
-		"vt 0.12500 1.00000" + "\n"
-		"vt 0.12500 0.00000" + "\n"
-		"vt 0.12500 0.08333" + "\n"
-		"vt 0.16667 0.08333" + "\n"
-		"vt 0.20833 0.91667" + "\n"
-		"vt 0.16667 0.91667" + "\n"
-		"vt 0.16667 1.00000" + "\n"
-		"vt 0.16667 0.00000" + "\n"
-		"vt 0.16667 0.08333" + "\n"
-		"vt 0.20833 0.08333" + "\n"
-		"vt 0.25000 0.91667" + "\n"
-		"vt 0.20833 0.91667" + "\n"
-		"vt 0.20833 1.00000" + "\n"
-		"vt 0.20833 0.00000" + "\n"
-		"vt 0.20833 0.08333" + "\n"
-		"vt 0.25000 0.08333" + "\n"
-		"vt 0.29167 0.91667" + "\n"
-		"vt 0.25000 0.91667" + "\n"
-		"vt 0.25000 1.00000" + "\n"
-		"vt 0.25000 0.00000" + "\n"
-		"vt 0.25000 0.08333" + "\n"
-		"vt 0.29167 0.08333" + "\n"
-		"vt 0.33333 0.91667" + "\n"
-		"vt 0.29167 0.91667" + "\n"
-		"vt 0.29167 1.00000" + "\n"
-		"vt 0.29167 0.00000" + "\n"
-		"vt 0.29167 0.08333" + "\n"
-		"vt 0.33333 0.08333" + "\n"
-		"vt 0.37500 0.91667" + "\n"
-		"vt 0.33333 0.91667" + "\n"
-		"vt 0.33333 1.00000" + "\n"
-		"vt 0.33333 0.00000" + "\n"
-		"vt 0.33333 0.08333" + "\n"
-		"vt 0.37500 0.08333" + "\n"
-		"vt 0.41667 0.91667" + "\n"
-		"vt 0.37500 0.91667" + "\n"
-		"vt 0.37500 1.00000" + "\n"
-		"vt 0.37500 0.00000" + "\n"
-		"vt 0.37500 0.08333" + "\n"
-		"vt 0.41667 0.08333" + "\n"
-		"vt 0.45833 0.91667" + "\n"
-		"vt 0.41667 0.91667" + "\n"
-		"vt 0.41667 1.00000" + "\n"
-		"vt 0.41667 0.00000" + "\n"
-		"vt 0.41667 0.08333" + "\n"
-		"vt 0.45833 0.08333" + "\n"
-		"vt 0.50000 0.91667" + "\n"
-		"vt 0.45833 0.91667" + "\n"
-		"vt 0.45833 1.00000" + "\n"
-		"vt 0.45833 0.00000" + "\n"
-		"vt 0.45833 0.08333" + "\n"
-		"vt 0.50000 0.08333" + "\n"
-		"vt 0.54167 0.91667" + "\n"
-		"vt 0.50000 0.91667" + "\n"
-		"vt 0.50000 1.00000" + "\n"
-		"vt 0.50000 0.00000" + "\n"
-		"vt 0.50000 0.08333" + "\n"
-		"vt 0.54167 0.08333" + "\n"
-		"vt 0.58333 0.91667" + "\n"
-		"vt 0.54167 0.91667" + "\n"
-		"vt 0.54167 1.00000" + "\n"
-		"vt 0.54167 0.00000" + "\n"
-		"vt 0.54167 0.08333" + "\n"
-		"vt 0.58333 0.08333" + "\n"
-		"vt 0.62500 0.91667" + "\n"
-		"vt 0.58333 0.91667" + "\n"
-		"vt 0.58333 1.00000" + "\n"
-		"vt 0.58333 0.00000" + "\n"
-		"vt 0.58333 0.08333" + "\n"
-		"vt 0.62500 0.08333" + "\n"
-		"vt 0.66667 0.91667" + "\n"
-		"vt 0.62500 0.91667" + "\n"
-		"vt 0.62500 1.00000" + "\n"
-		"vt 0.62500 0.00000" + "\n"
-		"vt 0.62500 0.08333" + "\n"
-		"vt 0.66667 0.08333" + "\n"
-		"vt 0.70833 0.91667" + "\n"
-		"vt 0.66667 0.91667" + "\n"
-		"vt 0.66667 1.00000" + "\n"
-		"vt 0.66667 0.00000" + "\n"
-		"vt 0.66667 0.08333" + "\n"
-		"vt 0.70833 0.08333" + "\n"
-		"vt 0.75000 0.91667" + "\n"
-		"vt 0.70833 0.91667" + "\n"
-		"vt 0.70833 1.00000" + "\n"
-		"vt 0.70833 0.00000" + "\n"
-		"vt 0.70833 0.08333" + "\n"
-		"vt 0.75000 0.08333" + "\n"
-		"vt 0.79167 0.91667" + "\n"
-		"vt 0.75000 0.91667" + "\n"
-		"vt 0.75000 1.00000" + "\n"
-		"vt 0.75000 0.00000" + "\n"
-		"vt 0.75000 0.08333" + "\n"
-		"vt 0.79167 0.08333" + "\n"
-		"vt 0.83333 0.91667" + "\n"
-		"vt 0.79167 0.91667" + "\n"
-		"vt 0.79167 1.00000" + "\n"
-		"vt 0.79167 0.00000" + "\n"
-		"vt 0.79167 0.08333" + "\n"
-		"vt 0.83333 0.08333" + "\n"
-		"vt 0.87500 0.91667" + "\n"
-		"vt 0.83333 0.91667" + "\n"
-		"vt 0.83333 1.00000" + "\n"
-		"vt 0.83333 0.00000" + "\n"
-		"vt 0.83333 0.08333" + "\n"
-		"vt 0.87500 0.08333" + "\n"
-		"vt 0.91667 0.91667" + "\n"
-		"vt 0.87500 0.91667" + "\n"
-		"vt 0.87500 1.00000" + "\n"
-		"vt 0.87500 0.00000" + "\n"
-		"vt 0.87500 0.08333" + "\n"
-		"vt 0.91667 0.08333" + "\n"
-		"vt 0.95833 0.91667" + "\n"
-		"vt 0.91667 0.91667" + "\n"
-		"vt 0.91667 1.00000" + "\n"
-		"vt 0.91667 0.00000" + "\n"
-		"vt 0.91667 0.08333" + "\n"
-		"vt 0.95833 0.08333" + "\n"
-		"vt 1.00000 0.91667" + "\n"
-		"vt 0.95833 0.91667" + "\n"
-		"vt 0.95833 1.00000" + "\n"
-		"vt 0.95833 0.00000" + "\n"
-		"vt 0.95833 0.08333" + "\n"
-		"vt 1.00000 0.08333" + "\n"
-		"vn 0.24991 -0.96595 -0.0669696" + "\n"
-		"vn 0.482858 -0.866088 -0.129379" + "\n"
-		"vn 0.49989 -0.866089 0" + "\n"
-		"vn 0.258722 -0.965952 0" + "\n"
-		"vn 0.224066 -0.965952 -0.129346" + "\n"
-		"vn 0.432919 -0.866088 -0.249945" + "\n"
-		"vn 0.18294 -0.965953 -0.18294" + "\n"
-		"vn 0.353478 -0.866087 -0.353479" + "\n"
-		"vn 0.129346 -0.965952 -0.224066" + "\n"
-		"vn 0.249945 -0.866088 -0.432919" + "\n"
-		"vn 0.0669696 -0.96595 -0.24991" + "\n"
-		"vn 0.129379 -0.866088 -0.482858" + "\n"
-		"vn -8.44462e-08 -0.965952 -0.258723" + "\n"
-		"vn -7.57159e-08 -0.866089 -0.49989" + "\n"
-		"vn -0.0669697 -0.96595 -0.24991" + "\n"
-		"vn -0.129379 -0.866088 -0.482858" + "\n"
-		"vn -0.129346 -0.965952 -0.224066" + "\n"
-		"vn -0.249945 -0.866088 -0.432919" + "\n"
-		"vn -0.182941 -0.965953 -0.18294" + "\n"
-		"vn -0.353479 -0.866086 -0.353479" + "\n"
-		"vn -0.224066 -0.965952 -0.129346" + "\n"
-		"vn -0.432919 -0.866088 -0.249945" + "\n"
-		"vn -0.24991 -0.96595 -0.0669696" + "\n"
-		"vn -0.482858 -0.866088 -0.129379" + "\n"
-		"vn -0.258723 -0.965952 0" + "\n"
-		"vn -0.49989 -0.866089 0" + "\n"
-		"vn -0.24991 -0.96595 0.0669696" + "\n"
-		"vn -0.482858 -0.866088 0.129379" + "\n"
-		"vn -0.224066 -0.965952 0.129346" + "\n"
-		"vn -0.432919 -0.866088 0.249945" + "\n"
-		"vn -0.182941 -0.965953 0.18294" + "\n"
-		"vn -0.353479 -0.866086 0.353479" + "\n"
-		"vn -0.129346 -0.965952 0.224066" + "\n"
-		"vn -0.249945 -0.866088 0.432919" + "\n"
-		"vn -0.0669697 -0.96595 0.24991" + "\n"
-		"vn -0.129379 -0.866088 0.482858" + "\n"
-		"vn -8.44462e-08 -0.965952 0.258723" + "\n"
-		"vn -7.57159e-08 -0.866089 0.49989" + "\n"
-		"vn 0.0669696 -0.96595 0.24991" + "\n"
-		"vn 0.129379 -0.866088 0.482858" + "\n"
-		"vn 0.129346 -0.965952 0.224066" + "\n"
-		"vn 0.249945 -0.866088 0.432919" + "\n"
-		"vn 0.18294 -0.965953 0.18294" + "\n"
-		"vn 0.353478 -0.866087 0.353479" + "\n"
-		"vn 0.224066 -0.965952 0.129346" + "\n"
-		"vn 0.432919 -0.866088 0.249945" + "\n"
-		"vn 0.24991 -0.96595 0.0669696" + "\n"
-		"vn 0.482858 -0.866088 0.129379" + "\n"
-		"vn 0.682922 -0.707204 -0.182973" + "\n"
-		"vn 0.707013 -0.707201 0" + "\n"
-		"vn 0.612292 -0.7072 -0.353506" + "\n"
-		"vn 0.499925 -0.707213 -0.499925" + "\n"
-		"vn 0.353506 -0.7072 -0.612292" + "\n"
-		"vn 0.182973 -0.707204 -0.682922" + "\n"
-		"vn -6.18254e-08 -0.707201 -0.707013" + "\n"
-		"vn -0.182973 -0.707204 -0.682922" + "\n"
-		"vn -0.353506 -0.7072 -0.612292" + "\n"
-		"vn -0.499925 -0.707213 -0.499925" + "\n"
-		"vn -0.612292 -0.7072 -0.353506" + "\n"
-		"vn -0.682922 -0.707204 -0.182973" + "\n"
-		"vn -0.707013 -0.7072 0" + "\n"
-		"vn -0.682922 -0.707204 0.182973" + "\n"
-		"vn -0.612292 -0.7072 0.353506" + "\n"
-		"vn -0.499925 -0.707213 0.499925" + "\n"
-		"vn -0.353506 -0.7072 0.612292" + "\n"
-		"vn -0.182973 -0.707204 0.682922" + "\n"
-		"vn -6.18254e-08 -0.707201 0.707013" + "\n"
-		"vn 0.182973 -0.707204 0.682922" + "\n"
-		"vn 0.353506 -0.7072 0.612292" + "\n"
-		"vn 0.499925 -0.707213 0.499925" + "\n"
-		"vn 0.612292 -0.7072 0.353506" + "\n"
-		"vn 0.682922 -0.707204 0.182973" + "\n"
-		"vn 0.836457 -0.500105 -0.22413" + "\n"
-		"vn 0.865963 -0.500108 0" + "\n"
-		"vn 0.749952 -0.500103 -0.432977" + "\n"
-		"vn 0.612329 -0.500107 -0.612329" + "\n"
-		"vn 0.432977 -0.500103 -0.749952" + "\n"
-		"vn 0.22413 -0.500105 -0.836457" + "\n"
-		"vn -4.37209e-08 -0.500108 -0.865963" + "\n"
-		"vn -0.22413 -0.500105 -0.836457" + "\n"
-		"vn -0.432977 -0.500103 -0.749952" + "\n"
-		"vn -0.612329 -0.500107 -0.612329" + "\n"
-		"vn -0.749952 -0.500103 -0.432977" + "\n"
-		"vn -0.836457 -0.500105 -0.22413" + "\n"
-		"vn -0.865963 -0.500108 0" + "\n"
-		"vn -0.836457 -0.500105 0.22413" + "\n"
-		"vn -0.749952 -0.500103 0.432977" + "\n"
-		"vn -0.612329 -0.500107 0.612329" + "\n"
-		"vn -0.432977 -0.500103 0.749952" + "\n"
-		"vn -0.22413 -0.500105 0.836457" + "\n"
-		"vn -4.37209e-08 -0.500108 0.865963" + "\n"
-		"vn 0.22413 -0.500105 0.836457" + "\n"
-		"vn 0.432977 -0.500103 0.749952" + "\n"
-		"vn 0.612329 -0.500107 0.612329" + "\n"
-		"vn 0.749952 -0.500103 0.432977" + "\n"
-		"vn 0.836457 -0.500105 0.22413" + "\n"
-		"vn 0.933001 -0.258884 -0.249977" + "\n"
-		"vn 0.965911 -0.258876 0" + "\n"
-		"vn 0.8365 -0.258885 -0.482956" + "\n"
-		"vn 0.683 -0.258887 -0.683" + "\n"
-		"vn 0.482956 -0.258885 -0.8365" + "\n"
-		"vn 0.249977 -0.258884 -0.933001" + "\n"
-		"vn -2.26317e-08 -0.258876 -0.965911" + "\n"
-		"vn -0.249977 -0.258884 -0.933001" + "\n"
-		"vn -0.482956 -0.258885 -0.8365" + "\n"
-		"vn -0.683 -0.258887 -0.683" + "\n"
-		"vn -0.8365 -0.258885 -0.482956" + "\n"
-		"vn -0.933001 -0.258884 -0.249977" + "\n"
-		"vn -0.965911 -0.258876 0" + "\n"
-		"vn -0.933001 -0.258884 0.249977" + "\n"
-		"vn -0.8365 -0.258885 0.482956" + "\n"
-		"vn -0.683 -0.258887 0.683" + "\n"
-		"vn -0.482956 -0.258885 0.8365" + "\n"
-		"vn -0.249977 -0.258884 0.933001" + "\n"
-		"vn -2.26317e-08 -0.258876 0.965911" + "\n"
-		"vn 0.249977 -0.258884 0.933001" + "\n"
-		"vn 0.482956 -0.258885 0.8365" + "\n"
-		"vn 0.683 -0.258887 0.683" + "\n"
-		"vn 0.8365 -0.258885 0.482956" + "\n"
-		"vn 0.933001 -0.258884 0.249977" + "\n"
-		"vn 0.965926 -8.44439e-08 -0.258818" + "\n"
-		"vn 1 -8.74228e-08 0" + "\n"
-		"vn 0.866019 -7.57098e-08 -0.500011" + "\n"
-		"vn 0.707107 -6.18172e-08 -0.707107" + "\n"
-		"vn 0.500011 -4.37123e-08 -0.866019" + "\n"
-		"vn 0.258818 -2.26266e-08 -0.965926" + "\n"
-		"vn 0 0 -1" + "\n"
-		"vn -0.258818 2.26266e-08 -0.965926" + "\n"
-		"vn -0.500011 4.37123e-08 -0.866019" + "\n"
-		"vn -0.707107 6.18172e-08 -0.707107" + "\n"
-		"vn -0.866019 7.57098e-08 -0.500011" + "\n"
-		"vn -0.965926 8.44439e-08 -0.258818" + "\n"
-		"vn -1 8.74228e-08 0" + "\n"
-		"vn -0.965926 8.44439e-08 0.258818" + "\n"
-		"vn -0.866019 7.57098e-08 0.500011" + "\n"
-		"vn -0.707107 6.18172e-08 0.707107" + "\n"
-		"vn -0.500011 4.37123e-08 0.866019" + "\n"
-		"vn -0.258818 2.26266e-08 0.965926" + "\n"
-		"vn 0 0 1" + "\n"
-		"vn 0.258818 -2.26266e-08 0.965926" + "\n"
-		"vn 0.500011 -4.37123e-08 0.866019" + "\n"
-		"vn 0.707107 -6.18172e-08 0.707107" + "\n"
-		"vn 0.866019 -7.57098e-08 0.500011" + "\n"
-		"vn 0.965926 -8.44439e-08 0.258818" + "\n"
-		"vn 0.933001 0.258884 -0.249977" + "\n"
-		"vn 0.965911 0.258876 0" + "\n"
-		"vn 0.8365 0.258885 -0.482956" + "\n"
-		"vn 0.683 0.258887 -0.683" + "\n"
-		"vn 0.482943 0.258878 -0.83651" + "\n"
-		"vn 0.249977 0.258884 -0.933001" + "\n"
-		"vn 2.26317e-08 0.258876 -0.965911" + "\n"
-		"vn -0.249977 0.258884 -0.933001" + "\n"
-		"vn -0.482956 0.258885 -0.8365" + "\n"
-		"vn -0.683 0.258887 -0.683" + "\n"
-		"vn -0.8365 0.258885 -0.482956" + "\n"
-		"vn -0.933001 0.258884 -0.249977" + "\n"
-		"vn -0.965911 0.258876 0" + "\n"
-		"vn -0.933001 0.258884 0.249977" + "\n"
-		"vn -0.8365 0.258885 0.482956" + "\n"
-		"vn -0.683 0.258887 0.683" + "\n"
-		"vn -0.482943 0.258878 0.83651" + "\n"
-		"vn -0.249977 0.258884 0.933001" + "\n"
-		"vn 2.26317e-08 0.258876 0.965911" + "\n"
-		"vn 0.249977 0.258884 0.933001" + "\n"
-		"vn 0.482956 0.258885 0.8365" + "\n"
-		"vn 0.683 0.258887 0.683" + "\n"
-		"vn 0.8365 0.258885 0.482956" + "\n"
-		"vn 0.933001 0.258884 0.249977" + "\n"
-		"vn 0.836457 0.500105 -0.22413" + "\n"
-		"vn 0.865963 0.500108 0" + "\n"
-		"vn 0.749952 0.500103 -0.432977" + "\n"
-		"vn 0.612329 0.500107 -0.612329" + "\n"
-		"vn 0.432977 0.500103 -0.749952" + "\n"
-		"vn 0.22413 0.500105 -0.836457" + "\n"
-		"vn 4.37209e-08 0.500108 -0.865963" + "\n"
-		"vn -0.22413 0.500105 -0.836457" + "\n"
-		"vn -0.432977 0.500103 -0.749952" + "\n"
-		"vn -0.612329 0.500107 -0.612329" + "\n"
-		"vn -0.749952 0.500103 -0.432977" + "\n"
-		"vn -0.836457 0.500105 -0.22413" + "\n"
-		"vn -0.865963 0.500108 0" + "\n"
-		"vn -0.836457 0.500105 0.22413" + "\n"
-		"vn -0.749952 0.500103 0.432977" + "\n"
-		"vn -0.612329 0.500107 0.612329" + "\n"
-		"vn -0.432977 0.500103 0.749952" + "\n"
-		"vn -0.22413 0.500105 0.836457" + "\n"
-		"vn 4.37209e-08 0.500108 0.865963" + "\n"
-		"vn 0.22413 0.500105 0.836457" + "\n"
-		"vn 0.432977 0.500103 0.749952" + "\n"
-		"vn 0.612329 0.500107 0.612329" + "\n"
-		"vn 0.749952 0.500103 0.432977" + "\n"
-		"vn 0.836457 0.500105 0.22413" + "\n"
-		"vn 0.682922 0.707204 -0.182973" + "\n"
-		"vn 0.707013 0.7072 0" + "\n"
-		"vn 0.612292 0.7072 -0.353506" + "\n"
-		"vn 0.499925 0.707213 -0.499925" + "\n"
-		"vn 0.353506 0.7072 -0.612292" + "\n"
-		"vn 0.182973 0.707204 -0.682922" + "\n"
-		"vn 6.18254e-08 0.707201 -0.707013" + "\n"
-		"vn -0.182973 0.707204 -0.682922" + "\n"
-		"vn -0.353506 0.7072 -0.612292" + "\n"
-		"vn -0.499925 0.707213 -0.499925" + "\n"
-		"vn -0.612292 0.7072 -0.353506" + "\n"
-		"vn -0.682922 0.707204 -0.182973" + "\n"
-		"vn -0.707013 0.707201 0" + "\n"
-		"vn -0.682922 0.707204 0.182973" + "\n"
-		"vn -0.612292 0.7072 0.353506" + "\n"
-		"vn -0.499925 0.707213 0.499925" + "\n"
-		"vn -0.353506 0.7072 0.612292" + "\n"
-		"vn -0.182973 0.707204 0.682922" + "\n"
-		"vn 6.18254e-08 0.707201 0.707013" + "\n"
-		"vn 0.182973 0.707204 0.682922" + "\n"
-		"vn 0.353506 0.7072 0.612292" + "\n"
-		"vn 0.499925 0.707213 0.499925" + "\n"
-		"vn 0.612292 0.7072 0.353506" + "\n"
-		"vn 0.682922 0.707204 0.182973" + "\n"
-		"vn 0.482858 0.866088 -0.129379" + "\n"
-		"vn 0.49989 0.866089 0" + "\n"
-		"vn 0.432919 0.866088 -0.249945" + "\n"
-		"vn 0.353479 0.866086 -0.353479" + "\n"
-		"vn 0.249945 0.866088 -0.432919" + "\n"
-		"vn 0.129379 0.866088 -0.482858" + "\n"
-		"vn 7.57159e-08 0.866089 -0.49989" + "\n"
-		"vn -0.129379 0.866088 -0.482858" + "\n"
-		"vn -0.249945 0.866088 -0.432919" + "\n"
-		"vn -0.353478 0.866087 -0.353479" + "\n"
-		"vn -0.432919 0.866088 -0.249945" + "\n"
-		"vn -0.482858 0.866088 -0.129379" + "\n"
-		"vn -0.49989 0.866089 0" + "\n"
-		"vn -0.482858 0.866088 0.129379" + "\n"
-		"vn -0.432919 0.866088 0.249945" + "\n"
-		"vn -0.353478 0.866087 0.353479" + "\n"
-		"vn -0.249945 0.866088 0.432919" + "\n"
-		"vn -0.129379 0.866088 0.482858" + "\n"
-		"vn 7.57159e-08 0.866089 0.49989" + "\n"
-		"vn 0.129379 0.866088 0.482858" + "\n"
-		"vn 0.249945 0.866088 0.432919" + "\n"
-		"vn 0.353479 0.866086 0.353479" + "\n"
-		"vn 0.432919 0.866088 0.249945" + "\n"
-		"vn 0.482858 0.866088 0.129379" + "\n"
-		"vn 0.24991 0.96595 -0.0669696" + "\n"
-		"vn 0.258723 0.965952 0" + "\n"
-		"vn 0.224066 0.965952 -0.129346" + "\n"
-		"vn 0.182941 0.965953 -0.18294" + "\n"
-		"vn 0.129346 0.965952 -0.224066" + "\n"
-		"vn 0.0669697 0.96595 -0.24991" + "\n"
-		"vn 8.44462e-08 0.965952 -0.258723" + "\n"
-		"vn -0.0669696 0.96595 -0.24991" + "\n"
-		"vn -0.129346 0.965952 -0.224066" + "\n"
-		"vn -0.18294 0.965953 -0.18294" + "\n"
-		"vn -0.224066 0.965952 -0.129346" + "\n"
-		"vn -0.24991 0.96595 -0.0669696" + "\n"
-		"vn -0.258722 0.965952 0" + "\n"
-		"vn -0.24991 0.96595 0.0669696" + "\n"
-		"vn -0.224066 0.965952 0.129346" + "\n"
-		"vn -0.18294 0.965953 0.18294" + "\n"
-		"vn -0.129346 0.965952 0.224066" + "\n"
-		"vn -0.0669696 0.96595 0.24991" + "\n"
-		"vn 8.44462e-08 0.965952 0.258723" + "\n"
-		"vn 0.0669697 0.96595 0.24991" + "\n"
-		"vn 0.129346 0.965952 0.224066" + "\n"
-		"vn 0.182941 0.965953 0.18294" + "\n"
-		"vn 0.224066 0.965952 0.129346" + "\n"
-		"vn 0.24991 0.96595 0.0669696" + "\n"
-		"vn -8.74228e-08 -1 0" + "\n"
-		"vn 8.74228e-08 1 0" + "\n"
-		"f 4/1/1 28/2/2 27/3/3 3/4/4" + "\n"
-		"f 5/5/5 29/6/6 28/7/2 4/8/1" + "\n"
-		"f 6/9/7 30/10/8 29/11/6 5/12/5" + "\n"
-		"f 7/13/9 31/14/10 30/15/8 6/16/7" + "\n"
-		"f 8/17/11 32/18/12 31/19/10 7/20/9" + "\n"
-		"f 9/21/13 33/22/14 32/23/12 8/24/11" + "\n"
-		"f 10/25/15 34/26/16 33/27/14 9/28/13" + "\n"
-		"f 11/29/17 35/30/18 34/31/16 10/32/15" + "\n"
-		"f 12/33/19 36/34/20 35/35/18 11/36/17" + "\n"
-		"f 13/37/21 37/38/22 36/39/20 12/40/19" + "\n"
-		"f 14/41/23 38/42/24 37/43/22 13/44/21" + "\n"
-		"f 15/45/25 39/46/26 38/47/24 14/48/23" + "\n"
-		"f 16/49/27 40/50/28 39/51/26 15/52/25" + "\n"
-		"f 17/53/29 41/54/30 40/55/28 16/56/27" + "\n"
-		"f 18/57/31 42/58/32 41/59/30 17/60/29" + "\n"
-		"f 19/61/33 43/62/34 42/63/32 18/64/31" + "\n"
-		"f 20/65/35 44/66/36 43/67/34 19/68/33" + "\n"
-		"f 21/69/37 45/70/38 44/71/36 20/72/35" + "\n"
-		"f 22/73/39 46/74/40 45/75/38 21/76/37" + "\n"
-		"f 23/77/41 47/78/42 46/79/40 22/80/39" + "\n"
-		"f 24/81/43 48/82/44 47/83/42 23/84/41" + "\n"
-		"f 25/85/45 49/86/46 48/87/44 24/88/43" + "\n"
-		"f 26/89/47 50/90/48 49/91/46 25/92/45" + "\n"
-		"f 3/93/4 27/94/3 50/95/48 26/96/47" + "\n"
-		"f 28/97/2 52/98/49 51/99/50 27/100/3" + "\n"
-		"f 29/101/6 53/102/51 52/103/49 28/104/2" + "\n"
-		"f 30/105/8 54/106/52 53/107/51 29/108/6" + "\n"
-		"f 31/109/10 55/110/53 54/111/52 30/112/8" + "\n"
-		"f 32/113/12 56/114/54 55/115/53 31/116/10" + "\n"
-		"f 33/117/14 57/118/55 56/119/54 32/120/12" + "\n"
-		"f 34/121/16 58/122/56 57/123/55 33/124/14" + "\n"
-		"f 35/125/18 59/126/57 58/127/56 34/128/16" + "\n"
-		"f 36/129/20 60/130/58 59/131/57 35/132/18" + "\n"
-		"f 37/133/22 61/134/59 60/135/58 36/136/20" + "\n"
-		"f 38/137/24 62/138/60 61/139/59 37/140/22" + "\n"
-		"f 39/141/26 63/142/61 62/143/60 38/144/24" + "\n"
-		"f 40/145/28 64/146/62 63/147/61 39/148/26" + "\n"
-		"f 41/149/30 65/150/63 64/151/62 40/152/28" + "\n"
-		"f 42/153/32 66/154/64 65/155/63 41/156/30" + "\n"
-		"f 43/157/34 67/158/65 66/159/64 42/160/32" + "\n"
-		"f 44/161/36 68/162/66 67/163/65 43/164/34" + "\n"
-		"f 45/165/38 69/166/67 68/167/66 44/168/36" + "\n"
-		"f 46/169/40 70/170/68 69/171/67 45/172/38" + "\n"
-		"f 47/173/42 71/174/69 70/175/68 46/176/40" + "\n"
-		"f 48/177/44 72/178/70 71/179/69 47/180/42" + "\n"
-		"f 49/181/46 73/182/71 72/183/70 48/184/44" + "\n"
-		"f 50/185/48 74/186/72 73/187/71 49/188/46" + "\n"
-		"f 27/189/3 51/190/50 74/191/72 50/192/48" + "\n"
-		"f 52/193/49 76/194/73 75/195/74 51/196/50" + "\n"
-		"f 53/197/51 77/198/75 76/199/73 52/200/49" + "\n"
-		"f 54/201/52 78/202/76 77/203/75 53/204/51" + "\n"
-		"f 55/205/53 79/206/77 78/207/76 54/208/52" + "\n"
-		"f 56/209/54 80/210/78 79/211/77 55/212/53" + "\n"
-		"f 57/213/55 81/214/79 80/215/78 56/216/54" + "\n"
-		"f 58/217/56 82/218/80 81/219/79 57/220/55" + "\n"
-		"f 59/221/57 83/222/81 82/223/80 58/224/56" + "\n"
-		"f 60/225/58 84/226/82 83/227/81 59/228/57" + "\n"
-		"f 61/229/59 85/230/83 84/231/82 60/232/58" + "\n"
-		"f 62/233/60 86/234/84 85/235/83 61/236/59" + "\n"
-		"f 63/237/61 87/238/85 86/239/84 62/240/60" + "\n"
-		"f 64/241/62 88/242/86 87/243/85 63/244/61" + "\n"
-		"f 65/245/63 89/246/87 88/247/86 64/248/62" + "\n"
-		"f 66/249/64 90/250/88 89/251/87 65/252/63" + "\n"
-		"f 67/253/65 91/254/89 90/255/88 66/256/64" + "\n"
-		"f 68/257/66 92/258/90 91/259/89 67/260/65" + "\n"
-		"f 69/261/67 93/262/91 92/263/90 68/264/66" + "\n"
-		"f 70/265/68 94/266/92 93/267/91 69/268/67" + "\n"
-		"f 71/269/69 95/270/93 94/271/92 70/272/68" + "\n"
-		"f 72/273/70 96/274/94 95/275/93 71/276/69" + "\n"
-		"f 73/277/71 97/278/95 96/279/94 72/280/70" + "\n"
-		"f 74/281/72 98/282/96 97/283/95 73/284/71" + "\n"
-		"f 51/285/50 75/286/74 98/287/96 74/288/72" + "\n"
-		"f 76/289/73 100/290/97 99/291/98 75/292/74" + "\n"
-		"f 77/293/75 101/294/99 100/295/97 76/296/73" + "\n"
-		"f 78/297/76 102/298/100 101/299/99 77/300/75" + "\n"
-		"f 79/301/77 103/302/101 102/303/100 78/304/76" + "\n"
-		"f 80/305/78 104/306/102 103/307/101 79/308/77" + "\n"
-		"f 81/309/79 105/310/103 104/311/102 80/312/78" + "\n"
-		"f 82/313/80 106/314/104 105/315/103 81/316/79" + "\n"
-		"f 83/317/81 107/318/105 106/319/104 82/320/80" + "\n"
-		"f 84/321/82 108/322/106 107/323/105 83/324/81" + "\n"
-		"f 85/325/83 109/326/107 108/327/106 84/328/82" + "\n"
-		"f 86/329/84 110/330/108 109/331/107 85/332/83" + "\n"
-		"f 87/333/85 111/334/109 110/335/108 86/336/84" + "\n"
-		"f 88/337/86 112/338/110 111/339/109 87/340/85" + "\n"
-		"f 89/341/87 113/342/111 112/343/110 88/344/86" + "\n"
-		"f 90/345/88 114/346/112 113/347/111 89/348/87" + "\n"
-		"f 91/349/89 115/350/113 114/351/112 90/352/88" + "\n"
-		"f 92/353/90 116/354/114 115/355/113 91/356/89" + "\n"
-		"f 93/357/91 117/358/115 116/359/114 92/360/90" + "\n"
-		"f 94/361/92 118/362/116 117/363/115 93/364/91" + "\n"
-		"f 95/365/93 119/366/117 118/367/116 94/368/92" + "\n"
-		"f 96/369/94 120/370/118 119/371/117 95/372/93" + "\n"
-		"f 97/373/95 121/374/119 120/375/118 96/376/94" + "\n"
-		"f 98/377/96 122/378/120 121/379/119 97/380/95" + "\n"
-		"f 75/381/74 99/382/98 122/383/120 98/384/96" + "\n"
-		"f 100/385/97 124/386/121 123/387/122 99/388/98" + "\n"
-		"f 101/389/99 125/390/123 124/391/121 100/392/97" + "\n"
-		"f 102/393/100 126/394/124 125/395/123 101/396/99" + "\n"
-		"f 103/397/101 127/398/125 126/399/124 102/400/100" + "\n"
-		"f 104/401/102 128/402/126 127/403/125 103/404/101" + "\n"
-		"f 105/405/103 129/406/127 128/407/126 104/408/102" + "\n"
-		"f 106/409/104 130/410/128 129/411/127 105/412/103" + "\n"
-		"f 107/413/105 131/414/129 130/415/128 106/416/104" + "\n"
-		"f 108/417/106 132/418/130 131/419/129 107/420/105" + "\n"
-		"f 109/421/107 133/422/131 132/423/130 108/424/106" + "\n"
-		"f 110/425/108 134/426/132 133/427/131 109/428/107" + "\n"
-		"f 111/429/109 135/430/133 134/431/132 110/432/108" + "\n"
-		"f 112/433/110 136/434/134 135/435/133 111/436/109" + "\n"
-		"f 113/437/111 137/438/135 136/439/134 112/440/110" + "\n"
-		"f 114/441/112 138/442/136 137/443/135 113/444/111" + "\n"
-		"f 115/445/113 139/446/137 138/447/136 114/448/112" + "\n"
-		"f 116/449/114 140/450/138 139/451/137 115/452/113" + "\n"
-		"f 117/453/115 141/454/139 140/455/138 116/456/114" + "\n"
-		"f 118/457/116 142/458/140 141/459/139 117/460/115" + "\n"
-		"f 119/461/117 143/462/141 142/463/140 118/464/116" + "\n"
-		"f 120/465/118 144/466/142 143/467/141 119/468/117" + "\n"
-		"f 121/469/119 145/470/143 144/471/142 120/472/118" + "\n"
-		"f 122/473/120 146/474/144 145/475/143 121/476/119" + "\n"
-		"f 99/477/98 123/478/122 146/479/144 122/480/120" + "\n"
-		"f 124/481/121 148/482/145 147/483/146 123/484/122" + "\n"
-		"f 125/485/123 149/486/147 148/487/145 124/488/121" + "\n"
-		"f 126/489/124 150/490/148 149/491/147 125/492/123" + "\n"
-		"f 127/493/125 151/494/149 150/495/148 126/496/124" + "\n"
-		"f 128/497/126 152/498/150 151/499/149 127/500/125" + "\n"
-		"f 129/501/127 153/502/151 152/503/150 128/504/126" + "\n"
-		"f 130/505/128 154/506/152 153/507/151 129/508/127" + "\n"
-		"f 131/509/129 155/510/153 154/511/152 130/512/128" + "\n"
-		"f 132/513/130 156/514/154 155/515/153 131/516/129" + "\n"
-		"f 133/517/131 157/518/155 156/519/154 132/520/130" + "\n"
-		"f 134/521/132 158/522/156 157/523/155 133/524/131" + "\n"
-		"f 135/525/133 159/526/157 158/527/156 134/528/132" + "\n"
-		"f 136/529/134 160/530/158 159/531/157 135/532/133" + "\n"
-		"f 137/533/135 161/534/159 160/535/158 136/536/134" + "\n"
-		"f 138/537/136 162/538/160 161/539/159 137/540/135" + "\n"
-		"f 139/541/137 163/542/161 162/543/160 138/544/136" + "\n"
-		"f 140/545/138 164/546/162 163/547/161 139/548/137" + "\n"
-		"f 141/549/139 165/550/163 164/551/162 140/552/138" + "\n"
-		"f 142/553/140 166/554/164 165/555/163 141/556/139" + "\n"
-		"f 143/557/141 167/558/165 166/559/164 142/560/140" + "\n"
-		"f 144/561/142 168/562/166 167/563/165 143/564/141" + "\n"
-		"f 145/565/143 169/566/167 168/567/166 144/568/142" + "\n"
-		"f 146/569/144 170/570/168 169/571/167 145/572/143" + "\n"
-		"f 123/573/122 147/574/146 170/575/168 146/576/144" + "\n"
-		"f 148/577/145 172/578/169 171/579/170 147/580/146" + "\n"
-		"f 149/581/147 173/582/171 172/583/169 148/584/145" + "\n"
-		"f 150/585/148 174/586/172 173/587/171 149/588/147" + "\n"
-		"f 151/589/149 175/590/173 174/591/172 150/592/148" + "\n"
-		"f 152/593/150 176/594/174 175/595/173 151/596/149" + "\n"
-		"f 153/597/151 177/598/175 176/599/174 152/600/150" + "\n"
-		"f 154/601/152 178/602/176 177/603/175 153/604/151" + "\n"
-		"f 155/605/153 179/606/177 178/607/176 154/608/152" + "\n"
-		"f 156/609/154 180/610/178 179/611/177 155/612/153" + "\n"
-		"f 157/613/155 181/614/179 180/615/178 156/616/154" + "\n"
-		"f 158/617/156 182/618/180 181/619/179 157/620/155" + "\n"
-		"f 159/621/157 183/622/181 182/623/180 158/624/156" + "\n"
-		"f 160/625/158 184/626/182 183/627/181 159/628/157" + "\n"
-		"f 161/629/159 185/630/183 184/631/182 160/632/158" + "\n"
-		"f 162/633/160 186/634/184 185/635/183 161/636/159" + "\n"
-		"f 163/637/161 187/638/185 186/639/184 162/640/160" + "\n"
-		"f 164/641/162 188/642/186 187/643/185 163/644/161" + "\n"
-		"f 165/645/163 189/646/187 188/647/186 164/648/162" + "\n"
-		"f 166/649/164 190/650/188 189/651/187 165/652/163" + "\n"
-		"f 167/653/165 191/654/189 190/655/188 166/656/164" + "\n"
-		"f 168/657/166 192/658/190 191/659/189 167/660/165" + "\n"
-		"f 169/661/167 193/662/191 192/663/190 168/664/166" + "\n"
-		"f 170/665/168 194/666/192 193/667/191 169/668/167" + "\n"
-		"f 147/669/146 171/670/170 194/671/192 170/672/168" + "\n"
-		"f 172/673/169 196/674/193 195/675/194 171/676/170" + "\n"
-		"f 173/677/171 197/678/195 196/679/193 172/680/169" + "\n"
-		"f 174/681/172 198/682/196 197/683/195 173/684/171" + "\n"
-		"f 175/685/173 199/686/197 198/687/196 174/688/172" + "\n"
-		"f 176/689/174 200/690/198 199/691/197 175/692/173" + "\n"
-		"f 177/693/175 201/694/199 200/695/198 176/696/174" + "\n"
-		"f 178/697/176 202/698/200 201/699/199 177/700/175" + "\n"
-		"f 179/701/177 203/702/201 202/703/200 178/704/176" + "\n"
-		"f 180/705/178 204/706/202 203/707/201 179/708/177" + "\n"
-		"f 181/709/179 205/710/203 204/711/202 180/712/178" + "\n"
-		"f 182/713/180 206/714/204 205/715/203 181/716/179" + "\n"
-		"f 183/717/181 207/718/205 206/719/204 182/720/180" + "\n"
-		"f 184/721/182 208/722/206 207/723/205 183/724/181" + "\n"
-		"f 185/725/183 209/726/207 208/727/206 184/728/182" + "\n"
-		"f 186/729/184 210/730/208 209/731/207 185/732/183" + "\n"
-		"f 187/733/185 211/734/209 210/735/208 186/736/184" + "\n"
-		"f 188/737/186 212/738/210 211/739/209 187/740/185" + "\n"
-		"f 189/741/187 213/742/211 212/743/210 188/744/186" + "\n"
-		"f 190/745/188 214/746/212 213/747/211 189/748/187" + "\n"
-		"f 191/749/189 215/750/213 214/751/212 190/752/188" + "\n"
-		"f 192/753/190 216/754/214 215/755/213 191/756/189" + "\n"
-		"f 193/757/191 217/758/215 216/759/214 192/760/190" + "\n"
-		"f 194/761/192 218/762/216 217/763/215 193/764/191" + "\n"
-		"f 171/765/170 195/766/194 218/767/216 194/768/192" + "\n"
-		"f 196/769/193 220/770/217 219/771/218 195/772/194" + "\n"
-		"f 197/773/195 221/774/219 220/775/217 196/776/193" + "\n"
-		"f 198/777/196 222/778/220 221/779/219 197/780/195" + "\n"
-		"f 199/781/197 223/782/221 222/783/220 198/784/196" + "\n"
-		"f 200/785/198 224/786/222 223/787/221 199/788/197" + "\n"
-		"f 201/789/199 225/790/223 224/791/222 200/792/198" + "\n"
-		"f 202/793/200 226/794/224 225/795/223 201/796/199" + "\n"
-		"f 203/797/201 227/798/225 226/799/224 202/800/200" + "\n"
-		"f 204/801/202 228/802/226 227/803/225 203/804/201" + "\n"
-		"f 205/805/203 229/806/227 228/807/226 204/808/202" + "\n"
-		"f 206/809/204 230/810/228 229/811/227 205/812/203" + "\n"
-		"f 207/813/205 231/814/229 230/815/228 206/816/204" + "\n"
-		"f 208/817/206 232/818/230 231/819/229 207/820/205" + "\n"
-		"f 209/821/207 233/822/231 232/823/230 208/824/206" + "\n"
-		"f 210/825/208 234/826/232 233/827/231 209/828/207" + "\n"
-		"f 211/829/209 235/830/233 234/831/232 210/832/208" + "\n"
-		"f 212/833/210 236/834/234 235/835/233 211/836/209" + "\n"
-		"f 213/837/211 237/838/235 236/839/234 212/840/210" + "\n"
-		"f 214/841/212 238/842/236 237/843/235 213/844/211" + "\n"
-		"f 215/845/213 239/846/237 238/847/236 214/848/212" + "\n"
-		"f 216/849/214 240/850/238 239/851/237 215/852/213" + "\n"
-		"f 217/853/215 241/854/239 240/855/238 216/856/214" + "\n"
-		"f 218/857/216 242/858/240 241/859/239 217/860/215" + "\n"
-		"f 195/861/194 219/862/218 242/863/240 218/864/216" + "\n"
-		"f 220/865/217 244/866/241 243/867/242 219/868/218" + "\n"
-		"f 221/869/219 245/870/243 244/871/241 220/872/217" + "\n"
-		"f 222/873/220 246/874/244 245/875/243 221/876/219" + "\n"
-		"f 223/877/221 247/878/245 246/879/244 222/880/220" + "\n"
-		"f 224/881/222 248/882/246 247/883/245 223/884/221" + "\n"
-		"f 225/885/223 249/886/247 248/887/246 224/888/222" + "\n"
-		"f 226/889/224 250/890/248 249/891/247 225/892/223" + "\n"
-		"f 227/893/225 251/894/249 250/895/248 226/896/224" + "\n"
-		"f 228/897/226 252/898/250 251/899/249 227/900/225" + "\n"
-		"f 229/901/227 253/902/251 252/903/250 228/904/226" + "\n"
-		"f 230/905/228 254/906/252 253/907/251 229/908/227" + "\n"
-		"f 231/909/229 255/910/253 254/911/252 230/912/228" + "\n"
-		"f 232/913/230 256/914/254 255/915/253 231/916/229" + "\n"
-		"f 233/917/231 257/918/255 256/919/254 232/920/230" + "\n"
-		"f 234/921/232 258/922/256 257/923/255 233/924/231" + "\n"
-		"f 235/925/233 259/926/257 258/927/256 234/928/232" + "\n"
-		"f 236/929/234 260/930/258 259/931/257 235/932/233" + "\n"
-		"f 237/933/235 261/934/259 260/935/258 236/936/234" + "\n"
-		"f 238/937/236 262/938/260 261/939/259 237/940/235" + "\n"
-		"f 239/941/237 263/942/261 262/943/260 238/944/236" + "\n"
-		"f 240/945/238 264/946/262 263/947/261 239/948/237" + "\n"
-		"f 241/949/239 265/950/263 264/951/262 240/952/238" + "\n"
-		"f 242/953/240 266/954/264 265/955/263 241/956/239" + "\n"
-		"f 219/957/218 243/958/242 266/959/264 242/960/240" + "\n"
-		"f 4/961/1 3/962/4 1/963/265" + "\n"
-		"f 2/964/266 243/965/242 244/966/241" + "\n"
-		"f 5/967/5 4/968/1 1/969/265" + "\n"
-		"f 2/970/266 244/971/241 245/972/243" + "\n"
-		"f 6/973/7 5/974/5 1/975/265" + "\n"
-		"f 2/976/266 245/977/243 246/978/244" + "\n"
-		"f 7/979/9 6/980/7 1/981/265" + "\n"
-		"f 2/982/266 246/983/244 247/984/245" + "\n"
-		"f 8/985/11 7/986/9 1/987/265" + "\n"
-		"f 2/988/266 247/989/245 248/990/246" + "\n"
-		"f 9/991/13 8/992/11 1/993/265" + "\n"
-		"f 2/994/266 248/995/246 249/996/247" + "\n"
-		"f 10/997/15 9/998/13 1/999/265" + "\n"
-		"f 2/1000/266 249/1001/247 250/1002/248" + "\n"
-		"f 11/1003/17 10/1004/15 1/1005/265" + "\n"
-		"f 2/1006/266 250/1007/248 251/1008/249" + "\n"
-		"f 12/1009/19 11/1010/17 1/1011/265" + "\n"
-		"f 2/1012/266 251/1013/249 252/1014/250" + "\n"
-		"f 13/1015/21 12/1016/19 1/1017/265" + "\n"
-		"f 2/1018/266 252/1019/250 253/1020/251" + "\n"
-		"f 14/1021/23 13/1022/21 1/1023/265" + "\n"
-		"f 2/1024/266 253/1025/251 254/1026/252" + "\n"
-		"f 15/1027/25 14/1028/23 1/1029/265" + "\n"
-		"f 2/1030/266 254/1031/252 255/1032/253" + "\n"
-		"f 16/1033/27 15/1034/25 1/1035/265" + "\n"
-		"f 2/1036/266 255/1037/253 256/1038/254" + "\n"
-		"f 17/1039/29 16/1040/27 1/1041/265" + "\n"
-		"f 2/1042/266 256/1043/254 257/1044/255" + "\n"
-		"f 18/1045/31 17/1046/29 1/1047/265" + "\n"
-		"f 2/1048/266 257/1049/255 258/1050/256" + "\n"
-		"f 19/1051/33 18/1052/31 1/1053/265" + "\n"
-		"f 2/1054/266 258/1055/256 259/1056/257" + "\n"
-		"f 20/1057/35 19/1058/33 1/1059/265" + "\n"
-		"f 2/1060/266 259/1061/257 260/1062/258" + "\n"
-		"f 21/1063/37 20/1064/35 1/1065/265" + "\n"
-		"f 2/1066/266 260/1067/258 261/1068/259" + "\n"
-		"f 22/1069/39 21/1070/37 1/1071/265" + "\n"
-		"f 2/1072/266 261/1073/259 262/1074/260" + "\n"
-		"f 23/1075/41 22/1076/39 1/1077/265" + "\n"
-		"f 2/1078/266 262/1079/260 263/1080/261" + "\n"
-		"f 24/1081/43 23/1082/41 1/1083/265" + "\n"
-		"f 2/1084/266 263/1085/261 264/1086/262" + "\n"
-		"f 25/1087/45 24/1088/43 1/1089/265" + "\n"
-		"f 2/1090/266 264/1091/262 265/1092/263" + "\n"
-		"f 26/1093/47 25/1094/45 1/1095/265" + "\n"
-		"f 2/1096/266 265/1097/263 266/1098/264" + "\n"
-		"f 3/1099/4 26/1100/47 1/1101/265" + "\n"
-		"f 2/1102/266 266/1103/264 243/1104/242" 
-	);
-
-	std::istringstream is(obj);
-	loadFromString(is);
+	loadFromTables(EnvironmentData::VertexCount, EnvironmentData::TriangleCount, EnvironmentData::Positions,
+		EnvironmentData::Normals, EnvironmentData::TexCoords, EnvironmentData::Indices);
+	m_bbox = BoundingBox3f(Vector3f(EnvironmentData::BBoxMin[0], EnvironmentData::BBoxMin[1], EnvironmentData::BBoxMin[2]),
+		Vector3f(EnvironmentData::BBoxMax[0], EnvironmentData::BBoxMax[1], EnvironmentData::BBoxMax[2]));
 
 	if (invertNormals) {
 		for (uint32_t i = 0; i < m_N.cols(); i++) {
@@ -11,6 +11,7 @@ Line::Line(Vector3f a, Vector3f b) : Mesh() {
 	m_V.col(0) = a;
 	m_V.col(1) = b;
 	buffersAllocated = false;
+	positionLocation = 0;
 }
 
 void Line::update(Vector3f &a, Vector3f &b) {
@@ -21,35 +22,14 @@ void Line::update(Vector3f &a, Vector3f &b) {
 void Line::upload(std::shared_ptr<GLShader> &s) {
 	shader = s;
 
-	// VAO
-	if (!buffersAllocated)
-		glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
-
-	// Positions
-	if (!buffersAllocated)
-		glGenBuffers(1, &vbo[VERTEX_BUFFER]);
-	glBindBuffer(GL_ARRAY_BUFFER, vbo[VERTEX_BUFFER]);
-
-	if (!buffersAllocated) {
-		glBufferData(GL_ARRAY_BUFFER, 3 * m_V.cols() * sizeof(GLfloat), (const uint8_t *)m_V.data(), GL_STREAM_DRAW);
-	} else {
-		// Update data only
-		void* ptr = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-		if (ptr) {
-			memcpy(ptr, (const uint8_t *)m_V.data(), 3 * m_V.cols() * sizeof(GLfloat));
-			glUnmapBuffer(GL_ARRAY_BUFFER);
-		}
-	}
-
-	if (!buffersAllocated) {
-		GLuint pp = glGetAttribLocation(s->getId(), glPositionName.c_str());
-		glVertexAttribPointer(pp, 3, GL_FLOAT, GL_FALSE, 0, 0);
-		glEnableVertexAttribArray(pp);
-	}
+	// The positions are streamed every frame, only the VAO is persistent
+	if (buffersAllocated)
+		return;
 
-	// Reset state
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	positionLocation = s->attrib(glPositionName);
+	glEnableVertexAttribArray(positionLocation);
 	glBindVertexArray(0);
 
 	buffersAllocated = true;
@@ -60,8 +40,15 @@ void Line::draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
 	shader->bind();
 	shader->setUniform("mvp", mv);
 
+	// Suballocate the current positions from the per-frame stream buffer
+	GLStreamBuffer &stream = GLStreamBuffer::getInstance();
+	GLintptr offset = stream.write(m_V.data(), 3 * m_V.cols() * sizeof(GLfloat));
+
 	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, stream.getId());
+	glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, (const GLvoid *) offset);
 	glDrawArrays(GL_LINES, 0, 2);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	glBindVertexArray(0);
 }
 
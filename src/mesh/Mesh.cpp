@@ -1,11 +1,116 @@
 #include "mesh/Mesh.hpp"
+#include "mesh/MeshSimplifier.hpp"
+#include "mesh/MeshOptimizer.hpp"
+#include "GPUProfiler.hpp"
+#include <iomanip>
+#include <cstring>
+#include <cstddef>
+#include <limits>
+#include <sys/stat.h>
 
 VR_NAMESPACE_BEGIN
 
+/// Meshes are not simplified below this many triangles
+static const uint32_t MinimumLODTriangles = 2048;
+
+/**
+ * @brief Common header of the mesh cache files, ties the file to the source file and to the mesh it was built from
+ */
+struct MeshCacheHeader {
+	char magic[4];
+	uint32_t version;
+	long long sourceSize;
+	long long sourceModified;
+	uint32_t vertexCount;
+	uint32_t triangleCount;
+	uint64_t indexHash;
+
+	MeshCacheHeader() { memset(this, 0, sizeof(*this)); }
+
+	MeshCacheHeader(const char m[4], uint32_t v, long long size, long long modified, const Mesh &mesh) {
+		memcpy(magic, m, sizeof(magic));
+		version = v;
+		sourceSize = size;
+		sourceModified = modified;
+		vertexCount = mesh.getVertexCount();
+		triangleCount = mesh.getTriangleCount();
+		indexHash = fnv1a(mesh.getIndices().data(), mesh.getIndices().size() * sizeof(uint32_t));
+	}
+
+	bool operator==(const MeshCacheHeader &h) const {
+		return memcmp(magic, h.magic, sizeof(magic)) == 0 && version == h.version && sourceSize == h.sourceSize &&
+			sourceModified == h.sourceModified && vertexCount == h.vertexCount && triangleCount == h.triangleCount && indexHash == h.indexHash;
+	}
+};
+
+/// Header of a level of detail cache file, followed by the levels and their indices
+struct LODCacheHeader {
+	MeshCacheHeader mesh;
+	uint32_t maximumLevels;
+	uint32_t levels;
+	uint32_t indexCount;
+};
+
+static const char LODCacheMagic[4] = { 'V', 'R', 'L', 'D' };
+static const uint32_t LODCacheVersion = 2;
+
+/// The optimized cache file holds the vertex permutation and the reordered indices after the header
+static const char OptimizedCacheMagic[4] = { 'V', 'R', 'O', 'P' };
+static const uint32_t OptimizedCacheVersion = 2;
+
+/// Vertices per chunk of the quantized format, addressable with 16 bit indices
+static const size_t ChunkVertices = 65535;
+
+/// Triangles per meshlet, the unit of the CPU culling
+static const GLsizei MeshletTriangles = 128;
+
+/// Cone cutoff of meshlets too curved for backface culling, the cone test never passes
+static const float NoCone = 2.f;
+
+/**
+ * @brief Interleaved vertex of the quantized format, 16 bytes
+ */
+struct QuantizedVertex {
+	uint16_t position[4]; ///< Fixed point in the bounding box, the last one is padding
+	int16_t normal[2]; ///< Octahedral encoding, normalized
+	uint16_t uv[2]; ///< Half floats
+};
+
+/// Converts to a half float, rounds to nearest and saturates to the largest finite half
+static uint16_t toHalf(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+	float magnitude = std::min(std::abs(value), 65504.f);
+
+	// Values below the smallest normal half are flushed to zero
+	if (!(magnitude >= 6.103515625e-05f))
+		return sign;
+
+	memcpy(&bits, &magnitude, sizeof(bits));
+	bits += 0x00000FFF + ((bits >> 13) & 1);
+	return uint16_t(sign | (((bits >> 23) - 112) << 10) | ((bits >> 13) & 0x3FF));
+}
+
+/// Octahedral encoding of a direction as two snorm16 values [Cigolle et al. 2014]
+static void encodeOctahedral(const Vector3f &n, int16_t out[2]) {
+	float l1 = std::abs(n.x()) + std::abs(n.y()) + std::abs(n.z());
+	float x = l1 > 0.f ? n.x() / l1 : 0.f, y = l1 > 0.f ? n.y() / l1 : 0.f;
+	if (n.z() < 0.f) {
+		float fx = (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f);
+		float fy = (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f);
+		x = fx;
+		y = fy;
+	}
+	out[0] = int16_t(std::round(std::min(std::max(x, -1.f), 1.f) * 32767.f));
+	out[1] = int16_t(std::round(std::min(std::max(y, -1.f), 1.f) * 32767.f));
+}
+
 Mesh::Mesh()
 	: glPositionName("position"), glNormalName("normal"), glTexName("tex")
-	, transMat(Matrix4f::Identity()), scaleMat(Matrix4f::Identity()), rotateMat(Matrix4f::Identity())
-	, mmCache(Matrix4f::Identity()), mmChanged(false) {
+	, lodCenter(Vector3f::Zero()), lodRadius(0.f), lodView(0)
+	, acmrBefore(0.f), acmrAfter(0.f), quantized(false), quantizationScale(Vector3f::Ones()), quantizationOffset(Vector3f::Zero())
+	, gpuBytes(0), meshletCulling(false) {
 
 	// Initialize standard values
 	vbo[VERTEX_BUFFER] = 0;
@@ -13,6 +118,7 @@ Mesh::Mesh()
 	vbo[NORMAL_BUFFER] = 0;
 	vbo[INDEX_BUFFER] = 0;
 	vao = 0;
+	lodLevel[0] = lodLevel[1] = 0;
 }
 
 Mesh::~Mesh () {
@@ -32,42 +138,377 @@ void Mesh::releaseBuffers () {
 		glDeleteVertexArrays(1, &vao);
 }
 
-Matrix4f Mesh::getModelMatrix() {
-	if (mmChanged) {
-		mmCache = transMat * rotateMat * scaleMat;
-		mmChanged = false;
+void Mesh::loadFromTables(uint32_t vertexCount, uint32_t triangleCount, const float *positions,
+	const float *normals, const float *texCoords, const uint32_t *indices) {
+	m_V.resize(3, vertexCount);
+	memcpy(m_V.data(), positions, 3 * vertexCount * sizeof(float));
+
+	m_N.resize(3, vertexCount);
+	memcpy(m_N.data(), normals, 3 * vertexCount * sizeof(float));
+
+	if (texCoords) {
+		m_UV.resize(2, vertexCount);
+		memcpy(m_UV.data(), texCoords, 2 * vertexCount * sizeof(float));
+	}
+
+	m_F.resize(3, triangleCount);
+	memcpy(m_F.data(), indices, 3 * triangleCount * sizeof(uint32_t));
+}
+
+void Mesh::optimize() {
+	if (m_F.size() == 0)
+		return;
+
+	std::vector<uint32_t> indices(m_F.data(), m_F.data() + m_F.size()), order;
+	acmrBefore = MeshOptimizer::acmr(indices, getVertexCount());
+
+	struct stat st;
+	long long sourceSize = -1, modified = -1;
+	if (stat(m_name.c_str(), &st) == 0) {
+		sourceSize = (long long) st.st_size;
+		modified = (long long) st.st_mtime;
+	}
+
+	if (sourceSize < 0 || !loadOptimized(sourceSize, modified, indices, order)) {
+		MeshOptimizer::optimizeTriangles(m_V, indices);
+		order = MeshOptimizer::optimizeVertexFetch(indices, getVertexCount());
+		if (sourceSize >= 0)
+			storeOptimized(sourceSize, modified, indices, order);
+	}
+
+	// Permute the vertex attributes into first use order
+	auto permute = [&order](MatrixXf &m) {
+		if (m.cols() == 0)
+			return;
+		MatrixXf permuted(m.rows(), m.cols());
+		for (size_t i = 0; i < order.size(); i++)
+			permuted.col(i) = m.col(order[i]);
+		m.swap(permuted);
+	};
+	permute(m_V);
+	permute(m_N);
+	permute(m_UV);
+
+	memcpy(m_F.data(), indices.data(), indices.size() * sizeof(uint32_t));
+	acmrAfter = MeshOptimizer::acmr(indices, getVertexCount());
+}
+
+void Mesh::buildLODs() {
+	m_lods.clear();
+	m_lodIndices.clear();
+	lodLevel[0] = lodLevel[1] = 0;
+
+	LOD full = { 0, getTriangleCount(), 0.f };
+	m_lods.push_back(full);
+	if (m_V.cols() == 0)
+		return;
+
+	// The errors are stored relative to the bounding sphere, such that they survive a rescale of the vertices
+	Vector3f minimum = m_V.rowwise().minCoeff(), maximum = m_V.rowwise().maxCoeff();
+	lodCenter = .5f * (minimum + maximum);
+	lodRadius = std::max(.5f * (maximum - minimum).norm(), 1e-20f);
+
+	if (Settings::getInstance().MESH_LOD_LEVELS <= 1 || getTriangleCount() < 4 * MinimumLODTriangles)
+		return;
+
+	struct stat st;
+	long long sourceSize = -1, modified = -1;
+	if (stat(m_name.c_str(), &st) == 0) {
+		sourceSize = (long long) st.st_size;
+		modified = (long long) st.st_mtime;
+		if (loadLODs(sourceSize, modified))
+			return;
+	}
+
+	std::vector<uint32_t> indices(m_F.data(), m_F.data() + m_F.size());
+	float error = 0.f;
+	for (int level = 1; level < Settings::getInstance().MESH_LOD_LEVELS; level++) {
+		size_t target = indices.size() / 12;
+		if (target < MinimumLODTriangles)
+			break;
+
+		// Each level is simplified from the previous one, its error is bounded by the sum over all passes
+		float levelError;
+		std::vector<uint32_t> simplified = MeshSimplifier::simplify(m_V, indices, target, level, levelError);
+		if (simplified.size() * 10 > indices.size() * 9)
+			break;
+		error += levelError;
+
+		if (Settings::getInstance().MESH_OPTIMIZE)
+			MeshOptimizer::optimizeTriangles(m_V, simplified);
+
+		LOD lod = { uint32_t(m_F.size() + m_lodIndices.size()), uint32_t(simplified.size() / 3), error / lodRadius };
+		m_lods.push_back(lod);
+		m_lodIndices.insert(m_lodIndices.end(), simplified.begin(), simplified.end());
+		indices.swap(simplified);
 	}
 
-	return mmCache;
+	if (sourceSize >= 0)
+		storeLODs(sourceSize, modified);
 }
 
-Matrix3f Mesh::getNormalMatrix() {
-	// Calculate normal matrix for normal transformation
-	Matrix4f modelMatrix = getModelMatrix();
-	Matrix3f tmp = modelMatrix.topLeftCorner<3, 3>();
-	Matrix3f inv = tmp.inverse();
-	return inv.transpose();
+int Mesh::selectLOD(const Matrix4f &modelMatrix, const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
+	int &level = lodLevel[lodView];
+	if (m_lods.size() <= 1)
+		return level = 0;
+
+	// Projected bounding sphere radius in pixels, the error scales with it
+	Vector4f center = viewMatrix * modelMatrix * Vector4f(lodCenter.x(), lodCenter.y(), lodCenter.z(), 1.f);
+	Matrix3f linear = modelMatrix.topLeftCorner<3, 3>();
+	float radius = lodRadius * linear.colwise().norm().maxCoeff();
+	float depth = -center.z();
+	if (depth <= radius)
+		return level = 0;
+
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	float pixels = radius * projectionMatrix(1, 1) / depth * .5f * viewport[3];
+
+	const float threshold = Settings::getInstance().MESH_LOD_PIXEL_ERROR;
+	const float coarsen = threshold * (1.f - Settings::getInstance().MESH_LOD_HYSTERESIS);
+	level = std::min(level, int(m_lods.size()) - 1);
+	while (level > 0 && m_lods[level].error * pixels > threshold)
+		level--;
+	while (level + 1 < int(m_lods.size()) && m_lods[level + 1].error * pixels <= coarsen)
+		level++;
+
+	return level;
+}
+
+std::string Mesh::cacheFile(const std::string &extension) const {
+	std::ostringstream oss;
+	oss << Settings::getInstance().MESH_CACHE_DIR << "/" << std::hex << std::setw(16) << std::setfill('0') << fnv1a(m_name) << extension;
+	return oss.str();
+}
+
+bool Mesh::loadOptimized(long long sourceSize, long long modified, std::vector<uint32_t> &indices, std::vector<uint32_t> &order) const {
+	if (Settings::getInstance().MESH_CACHE_DIR.empty())
+		return false;
+
+	std::ifstream is(cacheFile(".opt"), std::ios::binary);
+	if (!is)
+		return false;
+
+	MeshCacheHeader header;
+	if (!is.read((char *) &header, sizeof(header)) ||
+		!(header == MeshCacheHeader(OptimizedCacheMagic, OptimizedCacheVersion, sourceSize, modified, *this)))
+		return false;
+
+	std::vector<uint32_t> cachedIndices(m_F.size()), cachedOrder(getVertexCount());
+	if (!is.read((char *) cachedOrder.data(), cachedOrder.size() * sizeof(uint32_t)) ||
+		!is.read((char *) cachedIndices.data(), cachedIndices.size() * sizeof(uint32_t)))
+		return false;
+
+	for (uint32_t i : cachedIndices)
+		if (i >= getVertexCount())
+			return false;
+	for (uint32_t i : cachedOrder)
+		if (i >= getVertexCount())
+			return false;
+
+	indices.swap(cachedIndices);
+	order.swap(cachedOrder);
+	return true;
+}
+
+void Mesh::storeOptimized(long long sourceSize, long long modified, const std::vector<uint32_t> &indices, const std::vector<uint32_t> &order) const {
+	if (Settings::getInstance().MESH_CACHE_DIR.empty())
+		return;
+
+	// Keyed by the loaded index order, a partially written file fails the read on the next load
+	MeshCacheHeader header(OptimizedCacheMagic, OptimizedCacheVersion, sourceSize, modified, *this);
+	std::ofstream os(cacheFile(".opt"), std::ios::binary | std::ios::trunc);
+	if (!os)
+		return;
+	os.write((const char *) &header, sizeof(header));
+	os.write((const char *) order.data(), order.size() * sizeof(uint32_t));
+	os.write((const char *) indices.data(), indices.size() * sizeof(uint32_t));
+}
+
+bool Mesh::loadLODs(long long sourceSize, long long modified) {
+	if (Settings::getInstance().MESH_CACHE_DIR.empty())
+		return false;
+
+	std::ifstream is(cacheFile(".lod"), std::ios::binary);
+	if (!is)
+		return false;
+
+	LODCacheHeader header;
+	if (!is.read((char *) &header, sizeof(header)) ||
+		!(header.mesh == MeshCacheHeader(LODCacheMagic, LODCacheVersion, sourceSize, modified, *this)) ||
+		(int) header.maximumLevels != Settings::getInstance().MESH_LOD_LEVELS || header.levels >= header.maximumLevels)
+		return false;
+
+	std::vector<LOD> lods(header.levels);
+	std::vector<uint32_t> indices(header.indexCount);
+	if (!is.read((char *) lods.data(), lods.size() * sizeof(LOD)) ||
+		!is.read((char *) indices.data(), indices.size() * sizeof(uint32_t)))
+		return false;
+
+	// Reject ranges or indices outside of the mesh
+	for (const LOD &lod : lods)
+		if (lod.offset < m_F.size() || lod.offset - m_F.size() + 3 * size_t(lod.count) > indices.size())
+			return false;
+	for (uint32_t i : indices)
+		if (i >= getVertexCount())
+			return false;
+
+	m_lods.insert(m_lods.end(), lods.begin(), lods.end());
+	m_lodIndices.swap(indices);
+	return true;
+}
+
+void Mesh::storeLODs(long long sourceSize, long long modified) const {
+	if (Settings::getInstance().MESH_CACHE_DIR.empty())
+		return;
+
+	// Keyed by the index order, such that toggling MESH_OPTIMIZE rebuilds the levels
+	LODCacheHeader header;
+	header.mesh = MeshCacheHeader(LODCacheMagic, LODCacheVersion, sourceSize, modified, *this);
+	header.maximumLevels = uint32_t(Settings::getInstance().MESH_LOD_LEVELS);
+	header.levels = uint32_t(m_lods.size() - 1);
+	header.indexCount = uint32_t(m_lodIndices.size());
+
+	// Level 0 is implicit, a partially written file fails the read on the next load
+	std::ofstream os(cacheFile(".lod"), std::ios::binary | std::ios::trunc);
+	if (!os)
+		return;
+	os.write((const char *) &header, sizeof(header));
+	os.write((const char *) (m_lods.data() + 1), header.levels * sizeof(LOD));
+	os.write((const char *) m_lodIndices.data(), m_lodIndices.size() * sizeof(uint32_t));
 }
 
 void Mesh::draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
-	Matrix4f mm = getModelMatrix();
+	const Matrix4f &mm = getModelMatrix();
 	Matrix4f mv = viewMatrix * mm;
 	Matrix4f mvp = projectionMatrix * mv;
 
-	// Transform bounding box (only two points)
-	m_bbox.transformAxisAligned(mm);
-
+	shader->setFeature(QUANTIZED, quantized);
 	shader->bind();
 	shader->setUniform("modelMatrix", mm);
-	shader->setUniform("modelViewMatrix", mv);
 	shader->setUniform("normalMatrix", getNormalMatrix());
 	shader->setUniform("mvp", mvp);
 
+	int level = m_lods.empty() ? 0 : selectLOD(mm, viewMatrix, projectionMatrix);
 	glBindVertexArray(vao);
-	glDrawElements(GL_TRIANGLES, getTriangleCount() * 3, GL_UNSIGNED_INT, NULL);
+
+	if (quantized) {
+		shader->setUniform("positionScale", quantizationScale);
+		shader->setUniform("positionOffset", quantizationOffset);
+	}
+
+	GLenum type = quantized ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	if (meshletCulling && !meshlets.empty()) {
+		// Cones only apply while back faces are culled, e.g. not for the inside of a sphere
+		GLint cullMode = GL_BACK;
+		glGetIntegerv(GL_CULL_FACE_MODE, &cullMode);
+		bool backfaces = glIsEnabled(GL_CULL_FACE) && cullMode == GL_BACK;
+
+		const DrawList &list = cullMeshlets(level, mv, mvp, backfaces);
+		if (!list.counts.empty())
+			glMultiDrawElementsBaseVertex(GL_TRIANGLES, list.counts.data(), type, list.offsets.data(),
+				GLsizei(list.counts.size()), const_cast<GLint *>(list.baseVertices.data()));
+
+		uint32_t triangles = levelTriangles(level);
+		GPUProfiler::getInstance().count("mesh culled", double(triangles - list.triangles), double(triangles));
+	} else {
+		for (uint32_t i = lodChunks[level]; i < lodChunks[level + 1]; i++)
+			glDrawElementsBaseVertex(GL_TRIANGLES, chunks[i].count, type, (const GLvoid *) chunks[i].offset, chunks[i].baseVertex);
+	}
+
+	shader->setFeature(QUANTIZED, false);
 	glBindVertexArray(0);
 }
 
+void Mesh::uploadQuantized() {
+	std::vector<uint32_t> vertices, local(getVertexCount(), 0xFFFFFFFFu);
+	std::vector<uint16_t> indices;
+
+	// Greedy chunks in draw order, a chunk is closed once the next triangle would exceed ChunkVertices
+	lodChunks.clear();
+	chunks.clear();
+	for (size_t l = 0; l < levelCount(); l++) {
+		const uint32_t *first = levelIndices(l);
+		size_t count = 3 * size_t(levelTriangles(l));
+		lodChunks.push_back(uint32_t(chunks.size()));
+
+		size_t base = vertices.size();
+		for (size_t i = 0; i < count; i += 3) {
+			int added = (local[first[i]] == 0xFFFFFFFFu) + (local[first[i + 1]] == 0xFFFFFFFFu) + (local[first[i + 2]] == 0xFFFFFFFFu);
+			bool full = vertices.size() - base + added > ChunkVertices;
+			if (i == 0 || full) {
+				if (full) {
+					for (size_t v = base; v < vertices.size(); v++)
+						local[vertices[v]] = 0xFFFFFFFFu;
+					base = vertices.size();
+				}
+				Chunk chunk = { indices.size() * sizeof(uint16_t), 0, GLint(base) };
+				chunks.push_back(chunk);
+			}
+
+			for (int k = 0; k < 3; k++) {
+				uint32_t &slot = local[first[i + k]];
+				if (slot == 0xFFFFFFFFu) {
+					slot = uint32_t(vertices.size() - base);
+					vertices.push_back(first[i + k]);
+				}
+				indices.push_back(uint16_t(slot));
+			}
+			chunks.back().count += 3;
+		}
+
+		for (size_t v = base; v < vertices.size(); v++)
+			local[vertices[v]] = 0xFFFFFFFFu;
+	}
+	lodChunks.push_back(uint32_t(chunks.size()));
+
+	// Fixed point positions relative to the bounding box
+	Vector3f minimum = m_V.rowwise().minCoeff(), maximum = m_V.rowwise().maxCoeff();
+	quantizationOffset = minimum;
+	quantizationScale = ((maximum - minimum) / 65535.f).cwiseMax(1e-20f);
+
+	std::vector<QuantizedVertex> packed(vertices.size());
+	for (size_t i = 0; i < vertices.size(); i++) {
+		QuantizedVertex &q = packed[i];
+		Vector3f p = (m_V.col(vertices[i]) - quantizationOffset).cwiseQuotient(quantizationScale);
+		for (int k = 0; k < 3; k++)
+			q.position[k] = uint16_t(std::min(std::max(std::round(p[k]), 0.f), 65535.f));
+		q.position[3] = 0;
+
+		if (m_N.cols() > 0)
+			encodeOctahedral(m_N.col(vertices[i]), q.normal);
+		else
+			q.normal[0] = q.normal[1] = 0;
+
+		q.uv[0] = m_UV.cols() > 0 ? toHalf(m_UV(0, vertices[i])) : 0;
+		q.uv[1] = m_UV.cols() > 0 ? toHalf(m_UV(1, vertices[i])) : 0;
+	}
+
+	glGenBuffers(1, &vbo[VERTEX_BUFFER]);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo[VERTEX_BUFFER]);
+	glBufferData(GL_ARRAY_BUFFER, packed.size() * sizeof(QuantizedVertex), packed.data(), GL_STATIC_DRAW);
+
+	GLuint pp = shader->attrib(glPositionName);
+	glVertexAttribPointer(pp, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(QuantizedVertex), (const GLvoid *) offsetof(QuantizedVertex, position));
+	glEnableVertexAttribArray(pp);
+
+	GLuint np = shader->attrib(glNormalName);
+	glVertexAttribPointer(np, 2, GL_SHORT, GL_TRUE, sizeof(QuantizedVertex), (const GLvoid *) offsetof(QuantizedVertex, normal));
+	glEnableVertexAttribArray(np);
+
+	if (m_UV.cols() > 0) {
+		GLuint uvp = shader->attrib(glTexName);
+		glVertexAttribPointer(uvp, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(QuantizedVertex), (const GLvoid *) offsetof(QuantizedVertex, uv));
+		glEnableVertexAttribArray(uvp);
+	}
+
+	glGenBuffers(1, &vbo[INDEX_BUFFER]);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo[INDEX_BUFFER]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t), indices.data(), GL_STATIC_DRAW);
+
+	gpuBytes = packed.size() * sizeof(QuantizedVertex) + indices.size() * sizeof(uint16_t);
+}
+
 
 void Mesh::upload(std::shared_ptr<GLShader> &s) {
 	shader = s;
@@ -77,11 +518,25 @@ void Mesh::upload(std::shared_ptr<GLShader> &s) {
 	glGenVertexArrays(1, &vao);
 	glBindVertexArray(vao);
 
+	if (quantized)
+		uploadQuantized();
+	else
+		uploadFloat();
+
+	if (meshletCulling)
+		buildMeshlets();
+
+	// Reset state
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+}
+
+void Mesh::uploadFloat() {
 	// Positions
 	glGenBuffers(1, &vbo[VERTEX_BUFFER]);
 	glBindBuffer(GL_ARRAY_BUFFER, vbo[VERTEX_BUFFER]);
 	glBufferData(GL_ARRAY_BUFFER, 3 * m_V.cols() * sizeof(GLfloat), (const uint8_t *)m_V.data(), GL_STATIC_DRAW);
-	GLuint pp = glGetAttribLocation(s->getId(), glPositionName.c_str());
+	GLuint pp = shader->attrib(glPositionName);
 	glVertexAttribPointer(pp, 3, GL_FLOAT, GL_FALSE, 0, 0);
 	glEnableVertexAttribArray(pp);
 	
@@ -91,7 +546,7 @@ void Mesh::upload(std::shared_ptr<GLShader> &s) {
 		glGenBuffers(1, &vbo[TEXCOORD_BUFFER]);
 		glBindBuffer(GL_ARRAY_BUFFER, vbo[TEXCOORD_BUFFER]);
 		glBufferData(GL_ARRAY_BUFFER, 2 * m_V.cols() * sizeof(GLfloat), (const uint8_t *)m_UV.data(), GL_STATIC_DRAW);
-		GLuint uvp = glGetAttribLocation(s->getId(), glTexName.c_str());
+		GLuint uvp = shader->attrib(glTexName);
 		glVertexAttribPointer(uvp, 2, GL_FLOAT, GL_FALSE, 0, 0);
 		glEnableVertexAttribArray(uvp);
 	}
@@ -101,7 +556,7 @@ void Mesh::upload(std::shared_ptr<GLShader> &s) {
 		glGenBuffers(1, &vbo[NORMAL_BUFFER]);
 		glBindBuffer(GL_ARRAY_BUFFER, vbo[NORMAL_BUFFER]);
 		glBufferData(GL_ARRAY_BUFFER, 3 * m_V.cols() * sizeof(GLfloat), (const uint8_t *)m_N.data(), GL_STATIC_DRAW);
-		GLuint np = glGetAttribLocation(s->getId(), glNormalName.c_str());
+		GLuint np = shader->attrib(glNormalName);
 		glVertexAttribPointer(np, 3, GL_FLOAT, GL_FALSE, 0, 0);
 		glEnableVertexAttribArray(np);
 	}
@@ -109,51 +564,185 @@ void Mesh::upload(std::shared_ptr<GLShader> &s) {
 	// Indices
 	glGenBuffers(1, &vbo[INDEX_BUFFER]);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo[INDEX_BUFFER]);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, 3 * m_F.cols() * sizeof(GLuint), (const uint8_t *)m_F.data(), GL_STATIC_DRAW);
-	
-	// Reset state
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
-}
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (m_F.size() + m_lodIndices.size()) * sizeof(GLuint), nullptr, GL_STATIC_DRAW);
+	glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, m_F.size() * sizeof(GLuint), (const uint8_t *)m_F.data());
+	if (!m_lodIndices.empty())
+		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, m_F.size() * sizeof(GLuint), m_lodIndices.size() * sizeof(GLuint), (const uint8_t *)m_lodIndices.data());
 
-void Mesh::setTranslateMatrix(Matrix4f &t) { 
-	transMat = t; 
-	mmChanged = true; 
+	gpuBytes = (3 + (m_N.cols() > 0 ? 3 : 0) + (m_UV.cols() > 0 ? 2 : 0)) * m_V.cols() * sizeof(GLfloat) +
+		(m_F.size() + m_lodIndices.size()) * sizeof(GLuint);
+
+	// One chunk per level, coarser levels are ranges behind the full mesh in the same index buffer
+	chunks.clear();
+	lodChunks.clear();
+	for (size_t l = 0; l < levelCount(); l++) {
+		Chunk chunk = { (l == 0 ? 0 : m_lods[l].offset) * sizeof(GLuint), GLsizei(3 * levelTriangles(l)), 0 };
+		lodChunks.push_back(uint32_t(chunks.size()));
+		chunks.push_back(chunk);
+	}
+	lodChunks.push_back(uint32_t(chunks.size()));
 }
 
-void Mesh::setScaleMatrix(Matrix4f &t) { 
-	scaleMat = t; 
-	mmChanged = true; 
+void Mesh::buildMeshlets() {
+	const size_t indexSize = quantized ? sizeof(uint16_t) : sizeof(GLuint);
+	meshlets.clear();
+	lodMeshlets.clear();
+	meshletBounds.clear();
+
+	auto faceNormal = [this](const uint32_t *f) -> Vector3f {
+		Vector3f p0 = m_V.col(f[0]), p1 = m_V.col(f[1]), p2 = m_V.col(f[2]);
+		return (p1 - p0).cross(p2 - p0);
+	};
+
+	// Meshlets are consecutive runs of the optimized order within a chunk, which are spatially coherent
+	for (size_t l = 0; l < levelCount(); l++) {
+		const uint32_t *indices = levelIndices(l);
+		lodMeshlets.push_back(uint32_t(meshlets.size()));
+
+		for (uint32_t c = lodChunks[l]; c < lodChunks[l + 1]; c++) {
+			for (GLsizei i = 0; i < chunks[c].count; i += 3 * MeshletTriangles) {
+				Chunk meshlet = { chunks[c].offset + i * indexSize, std::min<GLsizei>(3 * MeshletTriangles, chunks[c].count - i), chunks[c].baseVertex };
+				if (meshlets.size() % 4 == 0)
+					meshletBounds.push_back(MeshletBlock());
+				MeshletBlock &block = meshletBounds.back();
+				int lane = int(meshlets.size() % 4);
+				meshlets.push_back(meshlet);
+
+				// Bounding sphere around the center of the bounding box
+				const uint32_t *F = indices;
+				indices += meshlet.count;
+				Vector3f minimum = m_V.col(F[0]), maximum = minimum;
+				for (GLsizei k = 1; k < meshlet.count; k++) {
+					minimum = minimum.cwiseMin(m_V.col(F[k]));
+					maximum = maximum.cwiseMax(m_V.col(F[k]));
+				}
+				Vector3f center = .5f * (minimum + maximum);
+				float radius = 0.f;
+				for (GLsizei k = 0; k < meshlet.count; k++)
+					radius = std::max(radius, (m_V.col(F[k]) - center).norm());
+
+				// Normal cone, the axis is the mean face normal and the cutoff the sine of the widest angle to it
+				Vector3f axis(0.f, 0.f, 0.f);
+				for (GLsizei k = 0; k < meshlet.count; k += 3) {
+					Vector3f n = faceNormal(F + k);
+					if (n.squaredNorm() > 0.f)
+						axis += n.normalized();
+				}
+				float minimumDot = 1.f;
+				if (axis.squaredNorm() > 0.f) {
+					axis.normalize();
+					for (GLsizei k = 0; k < meshlet.count; k += 3) {
+						Vector3f n = faceNormal(F + k);
+						if (n.squaredNorm() > 0.f)
+							minimumDot = std::min(minimumDot, axis.dot(n.normalized()));
+					}
+				} else {
+					minimumDot = -1.f;
+				}
+
+				for (int d = 0; d < 3; d++) {
+					block.center[d][lane] = center[d];
+					block.axis[d][lane] = axis[d];
+				}
+				block.radius[lane] = radius;
+				block.cutoff[lane] = minimumDot > 0.1f ? std::sqrt(1.f - minimumDot * minimumDot) : NoCone;
+			}
+		}
+	}
+	lodMeshlets.push_back(uint32_t(meshlets.size()));
+
+	for (DrawList &list : drawLists)
+		list.level = -1;
 }
 
-void Mesh::setRotationMatrix(Matrix4f &t) { 
-	rotateMat = t; 
-	mmChanged = true; 
+const Mesh::DrawList &Mesh::cullMeshlets(int level, const Matrix4f &modelView, const Matrix4f &mvp, bool backfaces) {
+	DrawList &list = drawLists[lodView];
+	if (list.level == level && list.backfaces == backfaces && list.mvp == mvp)
+		return list;
+
+	// Frustum planes in object space [Gribb and Hartmann 2001], scaled to give distances
+	Vector4f planes[6];
+	for (int i = 0; i < 3; i++) {
+		planes[2 * i] = (mvp.row(3) + mvp.row(i)).transpose();
+		planes[2 * i + 1] = (mvp.row(3) - mvp.row(i)).transpose();
+	}
+	for (Vector4f &plane : planes)
+		plane /= plane.head<3>().norm();
+	Vector3f camera = modelView.inverse().col(3).head<3>();
+
+	const uint32_t first = lodMeshlets[level], last = lodMeshlets[level + 1];
+	list.visible.resize(last - first);
+
+	// Four meshlets at a time, a meshlet is visible if the minimum of all signed distances is positive.
+	// Serial, about 70 us for 2M triangles, in the range of starting worker threads on every draw
+	for (uint32_t b = first / 4; b < (last + 3) / 4; b++) {
+		const MeshletBlock &m = meshletBounds[b];
+		Eigen::Map<const Eigen::Array4f> cx(m.center[0]), cy(m.center[1]), cz(m.center[2]), radius(m.radius);
+		Eigen::Array4f inside = Eigen::Array4f::Constant(std::numeric_limits<float>::max());
+		for (const Vector4f &p : planes)
+			inside = inside.min(p.x() * cx + p.y() * cy + p.z() * cz + p.w() + radius);
+
+		// Backfacing if the direction to the camera lies outside the normal cone widened by the sphere
+		if (backfaces) {
+			Eigen::Map<const Eigen::Array4f> ax(m.axis[0]), ay(m.axis[1]), az(m.axis[2]), cutoff(m.cutoff);
+			Eigen::Array4f dx = cx - camera.x(), dy = cy - camera.y(), dz = cz - camera.z();
+			Eigen::Array4f distance = (dx * dx + dy * dy + dz * dz).sqrt();
+			inside = inside.min(cutoff * distance + radius - (dx * ax + dy * ay + dz * az));
+		}
+
+		for (uint32_t lane = 0; lane < 4; lane++) {
+			uint32_t i = 4 * b + lane;
+			if (i >= first && i < last)
+				list.visible[i - first] = inside[lane] > 0.f;
+		}
+	}
+
+	// Neighbouring survivors of the same chunk are merged into one draw
+	const size_t indexSize = quantized ? sizeof(uint16_t) : sizeof(GLuint);
+	list.counts.clear();
+	list.offsets.clear();
+	list.baseVertices.clear();
+	list.triangles = 0;
+	for (uint32_t i = first; i < last; i++) {
+		if (!list.visible[i - first])
+			continue;
+
+		const Chunk &m = meshlets[i];
+		list.triangles += uint32_t(m.count / 3);
+		if (!list.counts.empty() && list.baseVertices.back() == m.baseVertex &&
+			(size_t) list.offsets.back() + list.counts.back() * indexSize == m.offset) {
+			list.counts.back() += m.count;
+		} else {
+			list.counts.push_back(m.count);
+			list.offsets.push_back((const GLvoid *) m.offset);
+			list.baseVertices.push_back(m.baseVertex);
+		}
+	}
+
+	list.mvp = mvp;
+	list.level = level;
+	list.backfaces = backfaces;
+	return list;
 }
 
 void Mesh::translate (float x, float y, float z) {
-	transMat = VR_NS::translate(Matrix4f::Identity(), Vector3f(x, y, z));
-	mmChanged = true;
+	setTranslateMatrix(VR_NS::translate(Matrix4f::Identity(), Vector3f(x, y, z)));
 }
 
 void Mesh::scale (float s){
-	scaleMat = VR_NS::scale(scaleMat, s);
-	mmChanged = true;
+	setScaleMatrix(VR_NS::scale(scaleMat, s));
 }
 
 void Mesh::scale (float x, float y, float z){
-	scaleMat = VR_NS::scale(scaleMat, x, y, z);
-	mmChanged = true;
+	setScaleMatrix(VR_NS::scale(scaleMat, x, y, z));
 }
 
 void Mesh::scale(Matrix4f mat, float x, float y, float z){
-	scaleMat = VR_NS::scale(mat, x, y, z);
-	mmChanged = true;
+	setScaleMatrix(VR_NS::scale(mat, x, y, z));
 }
 
 void Mesh::rotate (float roll, float pitch, float yaw) {
 	rotate(roll, Vector3f::UnitX(), pitch, Vector3f::UnitY(), yaw, Vector3f::UnitZ());
-	mmChanged = true;
 }
 
 void Mesh::rotate (float roll, Vector3f vr, float pitch, Vector3f vp, float yaw, Vector3f vy) {
@@ -162,17 +751,17 @@ void Mesh::rotate (float roll, Vector3f vr, float pitch, Vector3f vp, float yaw,
 	Eigen::AngleAxisf pitchAngle(pitch, vp.normalized());
 
 	Quaternionf q = rollAngle * yawAngle * pitchAngle;
-	rotateMat = Matrix4f::Identity();
-	rotateMat.block<3, 3>(0, 0) = q.toRotationMatrix();
-	mmChanged = true;
+	Matrix4f rotation = Matrix4f::Identity();
+	rotation.block<3, 3>(0, 0) = q.toRotationMatrix();
+	setRotationMatrix(rotation);
 }
 
 void Mesh::rotate(float angle, Vector3f axis) {
 	Eigen::AngleAxisf r = Eigen::AngleAxisf(angle, axis.normalized());
 	Quaternionf q;
 	q = r;
-	rotateMat = Matrix4f::Identity();
-	rotateMat.block<3, 3>(0, 0) = q.toRotationMatrix();
-	mmChanged = true;
+	Matrix4f rotation = Matrix4f::Identity();
+	rotation.block<3, 3>(0, 0) = q.toRotationMatrix();
+	setRotationMatrix(rotation);
 }
 VR_NAMESPACE_END
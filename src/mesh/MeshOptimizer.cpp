@@ -0,0 +1,292 @@
+#include "mesh/MeshOptimizer.hpp"
+#include "Eigen/Geometry"
+#include <cmath>
+
+VR_NAMESPACE_BEGIN
+
+/// Triangles per chunk, chunks are optimized independently and in parallel
+static const size_t ChunkTriangles = 1 << 16;
+
+/// Clusters are only cut at a cache restart once they hold this many triangles
+static const size_t MinimumClusterTriangles = 128;
+
+/// Size of the LRU cache Forsyth's scores are computed for
+static const int ScoreCacheSize = 32;
+
+/// Spreads the lower 10 bits of x to every third bit
+static uint32_t expandBits(uint32_t x) {
+	x = (x | (x << 16)) & 0x030000FF;
+	x = (x | (x << 8)) & 0x0300F00F;
+	x = (x | (x << 4)) & 0x030C30C3;
+	x = (x | (x << 2)) & 0x09249249;
+	return x;
+}
+
+/**
+ * @brief Score tables of Forsyth's heuristic, by cache position and by the number of remaining triangles
+ */
+struct VertexScores {
+	float cache[ScoreCacheSize];
+	float valence[32];
+
+	VertexScores() {
+		for (int i = 0; i < ScoreCacheSize; i++)
+			cache[i] = i < 3 ? .75f : std::pow(1.f - float(i - 3) / (ScoreCacheSize - 3), 1.5f);
+		valence[0] = 0.f;
+		for (int i = 1; i < 32; i++)
+			valence[i] = 2.f / std::sqrt(float(i));
+	}
+
+	float score(int cachePosition, uint32_t remaining) const {
+		if (remaining == 0)
+			return -1.f;
+		return (cachePosition < 0 ? 0.f : cache[cachePosition]) + valence[std::min<uint32_t>(remaining, 31)];
+	}
+};
+
+static const VertexScores Scores;
+
+float MeshOptimizer::acmr(const std::vector<uint32_t> &indices, size_t vertexCount) {
+	if (indices.empty())
+		return 0.f;
+
+	// Entry time of each vertex, a vertex is cached while it entered within the last CacheSize misses
+	std::vector<size_t> entered(vertexCount, 0);
+	size_t misses = 0;
+	for (uint32_t i : indices) {
+		if (entered[i] == 0 || misses - entered[i] >= CacheSize) {
+			misses++;
+			entered[i] = misses;
+		}
+	}
+
+	return float(misses) / (indices.size() / 3);
+}
+
+void MeshOptimizer::optimizeVertexCache(std::vector<uint32_t> &indices) {
+	const size_t faceCount = indices.size() / 3;
+
+	// Compact local vertex numbering
+	std::vector<uint32_t> vertices(indices);
+	std::sort(vertices.begin(), vertices.end());
+	vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+	const size_t vertexCount = vertices.size();
+	std::vector<uint32_t> F(indices.size());
+	for (size_t i = 0; i < indices.size(); i++)
+		F[i] = uint32_t(std::lower_bound(vertices.begin(), vertices.end(), indices[i]) - vertices.begin());
+
+	// Remaining triangles of each vertex, emitted ones are swapped behind the remaining count
+	std::vector<uint32_t> remaining(vertexCount, 0), first(vertexCount + 1, 0), adjacency(F.size());
+	for (uint32_t v : F)
+		remaining[v]++;
+	for (size_t v = 0; v < vertexCount; v++)
+		first[v + 1] = first[v] + remaining[v];
+	std::vector<uint32_t> fill(first.begin(), first.end() - 1);
+	for (size_t c = 0; c < F.size(); c++)
+		adjacency[fill[F[c]]++] = uint32_t(c / 3);
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> vertexScore(vertexCount), faceScore(faceCount);
+	std::vector<uint8_t> emitted(faceCount, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+		vertexScore[v] = Scores.score(-1, remaining[v]);
+	for (size_t f = 0; f < faceCount; f++)
+		faceScore[f] = vertexScore[F[3 * f]] + vertexScore[F[3 * f + 1]] + vertexScore[F[3 * f + 2]];
+
+	std::vector<uint32_t> cache, nextCache;
+	cache.reserve(ScoreCacheSize + 3);
+	nextCache.reserve(ScoreCacheSize + 3);
+
+	size_t best = 0, scan = 0, written = 0;
+	float bestScore = faceScore[0];
+	for (size_t f = 1; f < faceCount; f++)
+		if (faceScore[f] > bestScore)
+			bestScore = faceScore[best = f];
+
+	while (written < faceCount) {
+		const uint32_t *t = &F[3 * best];
+		for (int k = 0; k < 3; k++)
+			indices[3 * written + k] = vertices[t[k]];
+		written++;
+		emitted[best] = 1;
+
+		// Remove the triangle from its vertices
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = t[k];
+			uint32_t *list = &adjacency[first[v]];
+			for (uint32_t i = 0; i < remaining[v]; i++) {
+				if (list[i] == best) {
+					std::swap(list[i], list[remaining[v] - 1]);
+					break;
+				}
+			}
+			remaining[v]--;
+		}
+
+		// Move the vertices of the triangle to the front of the cache
+		nextCache.assign(t, t + 3);
+		for (uint32_t v : cache)
+			if (v != t[0] && v != t[1] && v != t[2])
+				nextCache.push_back(v);
+		for (size_t i = ScoreCacheSize; i < nextCache.size(); i++) {
+			cachePosition[nextCache[i]] = -1;
+			vertexScore[nextCache[i]] = Scores.score(-1, remaining[nextCache[i]]);
+		}
+		if (nextCache.size() > ScoreCacheSize)
+			nextCache.resize(ScoreCacheSize);
+		cache.swap(nextCache);
+
+		// The next triangle is the best one touching the cache, only their scores changed
+		for (size_t i = 0; i < cache.size(); i++) {
+			cachePosition[cache[i]] = int(i);
+			vertexScore[cache[i]] = Scores.score(int(i), remaining[cache[i]]);
+		}
+		for (int k = 0; k < 3; k++)
+			if (cachePosition[t[k]] < 0)
+				vertexScore[t[k]] = Scores.score(-1, remaining[t[k]]);
+
+		bestScore = -1.f;
+		for (uint32_t v : cache) {
+			for (uint32_t i = 0; i < remaining[v]; i++) {
+				uint32_t f = adjacency[first[v] + i];
+				const uint32_t *u = &F[3 * f];
+				faceScore[f] = vertexScore[u[0]] + vertexScore[u[1]] + vertexScore[u[2]];
+				if (faceScore[f] > bestScore) {
+					bestScore = faceScore[f];
+					best = f;
+				}
+			}
+		}
+
+		// Otherwise restart at the next triangle in input order
+		if (bestScore < 0.f) {
+			while (scan < faceCount && emitted[scan])
+				scan++;
+			best = scan;
+		}
+	}
+}
+
+void MeshOptimizer::optimizeTriangles(const MatrixXf &positions, std::vector<uint32_t> &indices, bool overdraw) {
+	const size_t faceCount = indices.size() / 3;
+	if (faceCount == 0)
+		return;
+
+	// Sort the triangles along a Morton curve through the bounding box
+	Vector3f minimum = positions.rowwise().minCoeff(), maximum = positions.rowwise().maxCoeff();
+	Vector3f scale = (1023.f / (maximum - minimum).array().max(1e-20f)).matrix();
+	std::vector<std::pair<uint32_t, uint32_t>> order(faceCount);
+	for (size_t f = 0; f < faceCount; f++) {
+		Vector3f centroid = (positions.col(indices[3 * f]) + positions.col(indices[3 * f + 1]) + positions.col(indices[3 * f + 2])) / 3.f;
+		Vector3f cell = (centroid - minimum).cwiseProduct(scale);
+		uint32_t code = expandBits(uint32_t(cell.x())) << 2 | expandBits(uint32_t(cell.y())) << 1 | expandBits(uint32_t(cell.z()));
+		order[f] = std::make_pair(code, uint32_t(f));
+	}
+	std::sort(order.begin(), order.end());
+
+	int chunkCount = int((faceCount + ChunkTriangles - 1) / ChunkTriangles);
+	std::vector<std::vector<uint32_t>> chunks(chunkCount);
+	for (int i = 0; i < chunkCount; i++) {
+		size_t begin = i * ChunkTriangles, end = std::min(faceCount, begin + ChunkTriangles);
+		for (size_t f = begin; f < end; f++)
+			for (int k = 0; k < 3; k++)
+				chunks[i].push_back(indices[3 * order[f].second + k]);
+	}
+
+	/**
+	 * @brief Run of triangles between two cache restarts, with the sort key against overdraw
+	 */
+	struct Cluster {
+		int chunk;
+		uint32_t begin, end;
+		float key;
+	};
+	std::vector<std::vector<Cluster>> clusters(chunkCount);
+
+	// Vertex cache order per chunk, then clusters wherever a triangle misses with all of its vertices
+	Vector3f meshCenter = .5f * (minimum + maximum);
+	parallelFor(chunkCount, [&](int i) {
+		std::vector<uint32_t> &chunk = chunks[i];
+		optimizeVertexCache(chunk);
+		if (!overdraw)
+			return;
+
+		std::vector<uint32_t> fifo(CacheSize, 0xFFFFFFFFu);
+		size_t head = 0, begin = 0, count = chunk.size() / 3;
+		for (size_t f = 0; f <= count; f++) {
+			int misses = 0;
+			for (int k = 0; f < count && k < 3; k++) {
+				uint32_t v = chunk[3 * f + k];
+				if (std::find(fifo.begin(), fifo.end(), v) == fifo.end()) {
+					fifo[head] = v;
+					head = (head + 1) % CacheSize;
+					misses++;
+				}
+			}
+
+			if (f == count || (misses == 3 && f - begin >= MinimumClusterTriangles)) {
+				// Area weighted normal against the direction from the mesh center to the cluster
+				Vector3f normal(0.f, 0.f, 0.f), centroid(0.f, 0.f, 0.f);
+				float area = 0.f;
+				for (size_t g = begin; g < f; g++) {
+					Vector3f p0 = positions.col(chunk[3 * g]), p1 = positions.col(chunk[3 * g + 1]), p2 = positions.col(chunk[3 * g + 2]);
+					Vector3f n = (p1 - p0).cross(p2 - p0);
+					float a = n.norm();
+					normal += n;
+					centroid += a * (p0 + p1 + p2) / 3.f;
+					area += a;
+				}
+				centroid = area > 0.f ? Vector3f(centroid / area) : meshCenter;
+
+				Cluster cluster = { i, uint32_t(begin), uint32_t(f), (centroid - meshCenter).dot(normal.normalized()) };
+				clusters[i].push_back(cluster);
+				begin = f;
+			}
+		}
+	});
+
+	indices.clear();
+	if (!overdraw) {
+		for (auto &chunk : chunks)
+			indices.insert(indices.end(), chunk.begin(), chunk.end());
+		return;
+	}
+
+	// Clusters on the outside first, they occlude the ones facing inwards. Clusters stay within their chunk,
+	// which keeps the vertices of a chunk together for 16 bit indices, and the chunks are sorted by their mean key
+	auto byKey = [](const Cluster &a, const Cluster &b) { return a.key > b.key; };
+	std::vector<Cluster> chunkOrder;
+	for (int i = 0; i < chunkCount; i++) {
+		std::stable_sort(clusters[i].begin(), clusters[i].end(), byKey);
+		Cluster chunk = { i, 0, 0, 0.f };
+		for (const Cluster &c : clusters[i])
+			chunk.key += c.key * (c.end - c.begin) / float(chunks[i].size() / 3);
+		chunkOrder.push_back(chunk);
+	}
+	std::stable_sort(chunkOrder.begin(), chunkOrder.end(), byKey);
+
+	for (const Cluster &chunk : chunkOrder)
+		for (const Cluster &c : clusters[chunk.chunk])
+			indices.insert(indices.end(), chunks[c.chunk].begin() + 3 * c.begin, chunks[c.chunk].begin() + 3 * c.end);
+}
+
+std::vector<uint32_t> MeshOptimizer::optimizeVertexFetch(std::vector<uint32_t> &indices, size_t vertexCount) {
+	std::vector<uint32_t> remap(vertexCount, 0xFFFFFFFFu), order;
+	order.reserve(vertexCount);
+	for (uint32_t &i : indices) {
+		if (remap[i] == 0xFFFFFFFFu) {
+			remap[i] = uint32_t(order.size());
+			order.push_back(i);
+		}
+		i = remap[i];
+	}
+
+	for (size_t v = 0; v < vertexCount; v++)
+		if (remap[v] == 0xFFFFFFFFu)
+			order.push_back(uint32_t(v));
+
+	return order;
+}
+
+VR_NAMESPACE_END
@@ -0,0 +1,312 @@
+#include "mesh/MeshSimplifier.hpp"
+#include "Eigen/Geometry"
+#include <limits>
+#include <queue>
+#include <thread>
+
+VR_NAMESPACE_BEGIN
+
+/// Slabs are not worth their locked borders below this many triangles
+static const size_t MinimumSlabTriangles = 50000;
+
+/// Weight of the planes perpendicular to open borders, keeps the outline of scans with holes in place
+static const double BorderWeight = 10.0;
+
+/// Marks vertices without a queued collapse
+static const uint32_t NoTarget = 0xFFFFFFFFu;
+
+/// Smallest cosine between a face normal before and after a collapse
+static const float MinimumNormalCosine = 0.2f;
+
+/**
+ * @brief Sum of squared distances to a set of planes as a symmetric 4x4 matrix, together with the total plane weight
+ */
+struct Quadric {
+	double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2, weight;
+
+	Quadric() : a2(0), ab(0), ac(0), ad(0), b2(0), bc(0), bd(0), c2(0), cd(0), d2(0), weight(0) {}
+
+	/// Plane n.p + d = 0 with unit normal n
+	Quadric(const Vector3f &n, float d, double w) : weight(w) {
+		double a = n.x(), b = n.y(), c = n.z();
+		a2 = w * a * a; ab = w * a * b; ac = w * a * c; ad = w * a * d;
+		b2 = w * b * b; bc = w * b * c; bd = w * b * d;
+		c2 = w * c * c; cd = w * c * d;
+		d2 = w * double(d) * d;
+	}
+
+	Quadric &operator+=(const Quadric &q) {
+		a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+		b2 += q.b2; bc += q.bc; bd += q.bd;
+		c2 += q.c2; cd += q.cd; d2 += q.d2;
+		weight += q.weight;
+		return *this;
+	}
+
+	/// Weighted sum of squared distances of a point to the planes
+	double error(const Vector3f &p) const {
+		double x = p.x(), y = p.y(), z = p.z();
+		return a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z) + d2;
+	}
+};
+
+/**
+ * @brief Cheapest collapse of a vertex onto a neighbour, stale once the neighbourhood of the vertex changed
+ */
+struct Collapse {
+	float cost;
+	uint32_t from, to;
+	uint32_t version;
+
+	bool operator<(const Collapse &c) const { return cost > c.cost; }
+};
+
+float MeshSimplifier::simplifySlab(const MatrixXf &positions, const std::vector<uint8_t> &locked,
+	std::vector<uint32_t> &indices, size_t targetCount) {
+
+	// Compact local vertex numbering
+	std::vector<uint32_t> vertices(indices);
+	std::sort(vertices.begin(), vertices.end());
+	vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+	const size_t vertexCount = vertices.size(), faceCount = indices.size() / 3;
+	std::vector<uint32_t> F(indices.size());
+	for (size_t i = 0; i < indices.size(); i++)
+		F[i] = uint32_t(std::lower_bound(vertices.begin(), vertices.end(), indices[i]) - vertices.begin());
+
+	auto position = [&](uint32_t v) -> Vector3f { return positions.col(vertices[v]); };
+
+	// Corners of each vertex as singly linked lists, corner c is slot c % 3 of face c / 3
+	std::vector<int32_t> head(vertexCount, -1), next(F.size(), -1);
+	for (size_t c = 0; c < F.size(); c++) {
+		next[c] = head[F[c]];
+		head[F[c]] = int32_t(c);
+	}
+
+	// Area weighted face planes
+	std::vector<Quadric> quadrics(vertexCount);
+	for (size_t f = 0; f < faceCount; f++) {
+		Vector3f p0 = position(F[3 * f]), p1 = position(F[3 * f + 1]), p2 = position(F[3 * f + 2]);
+		Vector3f n = (p1 - p0).cross(p2 - p0);
+		float length = n.norm();
+		if (length <= 0.f)
+			continue;
+		n /= length;
+		Quadric q(n, -n.dot(p0), .5 * length);
+		for (int k = 0; k < 3; k++)
+			quadrics[F[3 * f + k]] += q;
+	}
+
+	// Edges used by a single face are borders, keep them in place with perpendicular planes
+	std::vector<std::pair<uint64_t, uint32_t>> edges;
+	edges.reserve(F.size());
+	for (size_t c = 0; c < F.size(); c++) {
+		uint32_t a = F[c], b = F[c - c % 3 + (c + 1) % 3];
+		edges.push_back(std::make_pair((uint64_t(std::min(a, b)) << 32) | std::max(a, b), uint32_t(c)));
+	}
+	std::sort(edges.begin(), edges.end());
+	for (size_t i = 0; i < edges.size(); ) {
+		size_t j = i + 1;
+		while (j < edges.size() && edges[j].first == edges[i].first)
+			j++;
+
+		if (j - i == 1) {
+			uint32_t c = edges[i].second, f = c / 3;
+			uint32_t a = F[c], b = F[c - c % 3 + (c + 1) % 3];
+			Vector3f pa = position(a), pb = position(b);
+			Vector3f faceNormal = (position(F[3 * f + 1]) - position(F[3 * f])).cross(position(F[3 * f + 2]) - position(F[3 * f]));
+			Vector3f n = (pb - pa).cross(faceNormal);
+			if (n.squaredNorm() > 0.f) {
+				n.normalize();
+				Quadric q(n, -n.dot(pa), BorderWeight * (pb - pa).squaredNorm());
+				quadrics[a] += q;
+				quadrics[b] += q;
+			}
+		}
+		i = j;
+	}
+
+	std::vector<uint8_t> removed(vertexCount, 0), deadFace(faceCount, 0);
+	std::vector<uint32_t> version(vertexCount, 0), target(vertexCount, NoTarget);
+
+	// One candidate per vertex, its cheapest collapse onto a neighbour, dead corners are unlinked on the way
+	std::priority_queue<Collapse> queue;
+	auto update = [&](uint32_t from) {
+		version[from]++;
+		target[from] = NoTarget;
+		if (!locked.empty() && locked[vertices[from]])
+			return;
+
+		const Quadric &qFrom = quadrics[from];
+		Collapse best = { std::numeric_limits<float>::infinity(), from, NoTarget, version[from] };
+		int32_t *link = &head[from];
+		while (*link != -1) {
+			int32_t c = *link;
+			uint32_t f = uint32_t(c) / 3;
+			if (deadFace[f]) {
+				*link = next[c];
+				continue;
+			}
+			for (int k = 1; k < 3; k++) {
+				uint32_t to = F[3 * f + (c + k) % 3];
+				const Quadric &qTo = quadrics[to];
+				Vector3f p = position(to);
+				double weight = qFrom.weight + qTo.weight;
+				float cost = weight > 0.0 ? float(std::max(qFrom.error(p) + qTo.error(p), 0.0) / weight) : 0.f;
+				if (cost < best.cost) {
+					best.cost = cost;
+					best.to = to;
+				}
+			}
+			link = &next[c];
+		}
+
+		if (best.to != NoTarget) {
+			target[from] = best.to;
+			queue.push(best);
+		}
+	};
+
+	for (uint32_t v = 0; v < vertexCount; v++)
+		update(v);
+
+	size_t liveFaces = faceCount;
+	float maxError = 0.f;
+	std::vector<uint32_t> neighbours;
+	while (liveFaces > targetCount && !queue.empty()) {
+		Collapse collapse = queue.top();
+		queue.pop();
+
+		uint32_t u = collapse.from, v = collapse.to;
+		if (removed[u] || removed[v] || version[u] != collapse.version)
+			continue;
+
+		// No remaining face of u may flip
+		bool flips = false;
+		Vector3f moved = position(v);
+		for (int32_t c = head[u]; c != -1 && !flips; c = next[c]) {
+			uint32_t f = uint32_t(c) / 3;
+			const uint32_t *t = &F[3 * f];
+			if (deadFace[f] || t[0] == v || t[1] == v || t[2] == v)
+				continue;
+
+			Vector3f p[3] = { position(t[0]), position(t[1]), position(t[2]) };
+			Vector3f before = (p[1] - p[0]).cross(p[2] - p[0]);
+			p[c % 3] = moved;
+			Vector3f after = (p[1] - p[0]).cross(p[2] - p[0]);
+			flips = after.dot(before) <= MinimumNormalCosine * after.norm() * before.norm();
+		}
+
+		// The vertex waits until one of its neighbours changes
+		if (flips) {
+			target[u] = NoTarget;
+			continue;
+		}
+
+		// Faces with both vertices degenerate, all other corners of u move to v
+		int32_t c = head[u];
+		while (c != -1) {
+			int32_t following = next[c];
+			uint32_t f = uint32_t(c) / 3;
+			if (!deadFace[f]) {
+				const uint32_t *t = &F[3 * f];
+				if (t[0] == v || t[1] == v || t[2] == v) {
+					deadFace[f] = 1;
+					liveFaces--;
+				} else {
+					F[c] = v;
+					next[c] = head[v];
+					head[v] = c;
+				}
+			}
+			c = following;
+		}
+		head[u] = -1;
+
+		quadrics[v] += quadrics[u];
+		removed[u] = 1;
+		maxError = std::max(maxError, std::sqrt(collapse.cost));
+
+		// Only neighbours which were about to collapse onto u or v, or waited for a change, need a new candidate
+		update(v);
+		neighbours.clear();
+		for (int32_t c = head[v]; c != -1; c = next[c])
+			for (int k = 1; k < 3; k++)
+				neighbours.push_back(F[c - c % 3 + (c + k) % 3]);
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+		for (uint32_t w : neighbours)
+			if (target[w] == u || target[w] == v || target[w] == NoTarget)
+				update(w);
+	}
+
+	indices.clear();
+	for (size_t f = 0; f < faceCount; f++)
+		if (!deadFace[f])
+			for (int k = 0; k < 3; k++)
+				indices.push_back(vertices[F[3 * f + k]]);
+
+	return maxError;
+}
+
+std::vector<uint32_t> MeshSimplifier::simplify(const MatrixXf &positions, const std::vector<uint32_t> &indices,
+	size_t targetCount, int pass, float &error) {
+
+	const size_t faceCount = indices.size() / 3;
+	int slabCount = int(std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), faceCount / MinimumSlabTriangles)));
+
+	if (slabCount == 1) {
+		std::vector<uint32_t> result(indices);
+		error = simplifySlab(positions, std::vector<uint8_t>(), result, targetCount);
+		return result;
+	}
+
+	// Slabs of equal width along the longest axis, by face centroid
+	Vector3f minimum = positions.col(indices[0]), maximum = minimum;
+	for (uint32_t i : indices) {
+		minimum = minimum.cwiseMin(positions.col(i));
+		maximum = maximum.cwiseMax(positions.col(i));
+	}
+	int axis;
+	(maximum - minimum).maxCoeff(&axis);
+	float width = std::max((maximum[axis] - minimum[axis]) / slabCount, 1e-20f);
+	float shift = (pass & 1) ? .5f : 0.f;
+
+	std::vector<std::vector<uint32_t>> slabs(slabCount);
+	std::vector<int32_t> owner(positions.cols(), -1);
+	std::vector<uint8_t> locked(positions.cols(), 0);
+	for (size_t f = 0; f < faceCount; f++) {
+		const uint32_t *t = &indices[3 * f];
+		float centroid = (positions(axis, t[0]) + positions(axis, t[1]) + positions(axis, t[2])) / 3.f;
+		int slab = std::min(std::max(int((centroid - minimum[axis]) / width + shift), 0), slabCount - 1);
+		for (int k = 0; k < 3; k++) {
+			if (owner[t[k]] == -1)
+				owner[t[k]] = slab;
+			else if (owner[t[k]] != slab)
+				locked[t[k]] = 1;
+			slabs[slab].push_back(t[k]);
+		}
+	}
+
+	std::vector<float> errors(slabCount, 0.f);
+	std::vector<std::thread> threads;
+	for (int i = 0; i < slabCount; i++) {
+		size_t target = slabs[i].size() / 3 * targetCount / faceCount;
+		threads.push_back(std::thread([&, i, target]() {
+			errors[i] = simplifySlab(positions, locked, slabs[i], target);
+		}));
+	}
+	for (auto &t : threads)
+		t.join();
+
+	std::vector<uint32_t> result;
+	error = 0.f;
+	for (int i = 0; i < slabCount; i++) {
+		result.insert(result.end(), slabs[i].begin(), slabs[i].end());
+		error = std::max(error, errors[i]);
+	}
+	return result;
+}
+
+VR_NAMESPACE_END
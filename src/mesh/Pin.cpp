@@ -1,36 +1,34 @@
 	#include "mesh/Pin.hpp"
+#include "mesh/PinData.hpp"
 
 VR_NAMESPACE_BEGIN
 
-void Pin::draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
-	Matrix4f mm = getModelMatrix();
+/// Size of the pin model relative to the mesh
+static const Matrix4f &pinScale() {
+	static Matrix4f localScale = VR_NS::scale(Matrix4f::Identity(), 0.0030f, 0.0030f, 0.0030f);
+	return localScale;
+}
 
-	// Update the model matrix of the pin
-	Matrix4f m = mm * localRotation;
-	Matrix4f mv = viewMatrix * m;
-	Matrix4f mvp = projectionMatrix * mv;
-	
-	// Transform bounding box (only two points)
-	m_bbox.transformAxisAligned(m);
+void Pin::draw(const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
+	// The model matrix of the pin includes the one of the mesh it is attached to
+	const Matrix4f &m = getModelMatrix();
+	Matrix4f mvp = projectionMatrix * viewMatrix * m;
 
-	Vector3f prevColor = Settings::getInstance().MATERIAL_COLOR;
+	// The pin color is the material of its render command
 	shader->bind();
-	shader->setUniform("materialColor", color);
 	shader->setUniform("modelMatrix", m);
-	shader->setUniform("modelViewMatrix", mv);
 	shader->setUniform("normalMatrix", getNormalMatrix());
 	shader->setUniform("mvp", mvp);
 
 	glBindVertexArray(vao);
 	glDrawElements(GL_TRIANGLES, getTriangleCount() * 3, GL_UNSIGNED_INT, NULL);
 	glBindVertexArray(0);
-	shader->setUniform("materialColor", prevColor);
 }
 
 void Pin::calculateLocalRotation(const Matrix3f &nm) {
 	// Make the pin stand perpendicular on the surface of the model
 	Vector4f homogeneousPosition(position.x(), position.y(), position.z(), 1.f);
-	Vector3f positionWorld = (getModelMatrix() * homogeneousPosition).head<3>();
+	Vector3f positionWorld = (SceneNode::getLocalMatrix() * VR_NS::translate(Matrix4f::Identity(), position) * pinScale() * homogeneousPosition).head<3>();
 
 	Vector3f direction = (m_bbox.getCenter() - positionWorld);
 	Vector3f axis = direction.cross(normal).normalized();
@@ -55,9 +53,8 @@ std::string Pin::serialize() {
 	return output;
 }
 
-Matrix4f Pin::getModelMatrix() {
-	static Matrix4f localScale = VR_NS::scale(Matrix4f::Identity(), 0.0030f, 0.0030f, 0.0030f);
-	return transMat * rotateMat * scaleMat * VR_NS::translate(Matrix4f::Identity(), position) * localScale;
+Matrix4f Pin::getLocalMatrix() const {
+	return SceneNode::getLocalMatrix() * VR_NS::translate(Matrix4f::Identity(), position) * pinScale() * localRotation;
 }
 
 const Vector3f& Pin::getPosition() const {
@@ -77,1155 +74,9 @@ void Pin::setColor(const Vector3f &c) {
 }
 
 Pin::Pin(const Vector3f &pos, const Vector3f &n, const Matrix3f &nm) : position(pos), normal(n), color(0.8f, 0.f, 0.f) {
-	std::string obj(
-		std::string("v 0.302049 1.73116 0") + "\n" +
-		"v 0 10.4099 0" + "\n" +
-		"v 0.297461 1.73116 0.0524503" + "\n" +
-		"v 0 -0.5 0" + "\n" +
-		"v 0.302049 10.4099 0" + "\n" +
-		"v 0.302049 10.4099 0" + "\n" +
-		"v 0.283834 1.73116 0.103307" + "\n" +
-		"v 0.261583 1.73116 0.151025" + "\n" +
-		"v 0.297461 10.4099 0.0524503" + "\n" +
-		"v 0.297461 10.4099 0.0524503" + "\n" +
-		"v 0.231383 1.73116 0.194154" + "\n" +
-		"v 0.194154 1.73116 0.231383" + "\n" +
-		"v 0.283834 10.4099 0.103307" + "\n" +
-		"v 0.283834 10.4099 0.103307" + "\n" +
-		"v 0.151025 1.73116 0.261583" + "\n" +
-		"v 0.103307 1.73116 0.283834" + "\n" +
-		"v 0.261583 10.4099 0.151025" + "\n" +
-		"v 0.261583 10.4099 0.151025" + "\n" +
-		"v 0.0524503 1.73116 0.297461" + "\n" +
-		"v 1.84952e-17 1.73116 0.302049" + "\n" +
-		"v 0.231383 10.4099 0.194154" + "\n" +
-		"v 0.231383 10.4099 0.194154" + "\n" +
-		"v -0.0524503 1.73116 0.297461" + "\n" +
-		"v -0.103307 1.73116 0.283834" + "\n" +
-		"v 0.194154 10.4099 0.231383" + "\n" +
-		"v 0.194154 10.4099 0.231383" + "\n" +
-		"v -0.151025 1.73116 0.261583" + "\n" +
-		"v -0.194154 1.73116 0.231383" + "\n" +
-		"v 0.151025 10.4099 0.261583" + "\n" +
-		"v 0.151025 10.4099 0.261583" + "\n" +
-		"v -0.231383 1.73116 0.194154" + "\n" +
-		"v -0.261583 1.73116 0.151025" + "\n" +
-		"v 0.103307 10.4099 0.283834" + "\n" +
-		"v 0.103307 10.4099 0.283834" + "\n" +
-		"v -0.283834 1.73116 0.103307" + "\n" +
-		"v -0.297461 1.73116 0.0524503" + "\n" +
-		"v 0.0524503 10.4099 0.297461" + "\n" +
-		"v 0.0524503 10.4099 0.297461" + "\n" +
-		"v -0.302049 1.73116 4.44089e-17" + "\n" +
-		"v -0.297461 1.73116 -0.0524503" + "\n" +
-		"v 1.84952e-17 10.4099 0.302049" + "\n" +
-		"v 1.84952e-17 10.4099 0.302049" + "\n" +
-		"v -0.283834 1.73116 -0.103307" + "\n" +
-		"v -0.261583 1.73116 -0.151025" + "\n" +
-		"v -0.0524503 10.4099 0.297461" + "\n" +
-		"v -0.0524503 10.4099 0.297461" + "\n" +
-		"v -0.231383 1.73116 -0.194154" + "\n" +
-		"v -0.194154 1.73116 -0.231383" + "\n" +
-		"v -0.103307 10.4099 0.283834" + "\n" +
-		"v -0.103307 10.4099 0.283834" + "\n" +
-		"v -0.151025 1.73116 -0.261583" + "\n" +
-		"v -0.103307 1.73116 -0.283834" + "\n" +
-		"v -0.151025 10.4099 0.261583" + "\n" +
-		"v -0.151025 10.4099 0.261583" + "\n" +
-		"v -0.0524503 1.73116 -0.297461" + "\n" +
-		"v -5.54856e-17 1.73116 -0.302049" + "\n" +
-		"v -0.194154 10.4099 0.231383" + "\n" +
-		"v -0.194154 10.4099 0.231383" + "\n" +
-		"v 0.0524503 1.73116 -0.297461" + "\n" +
-		"v 0.103307 1.73116 -0.283834" + "\n" +
-		"v -0.231383 10.4099 0.194154" + "\n" +
-		"v -0.231383 10.4099 0.194154" + "\n" +
-		"v 0.151025 1.73116 -0.261583" + "\n" +
-		"v 0.194154 1.73116 -0.231383" + "\n" +
-		"v -0.261583 10.4099 0.151025" + "\n" +
-		"v -0.261583 10.4099 0.151025" + "\n" +
-		"v 0.231383 1.73116 -0.194154" + "\n" +
-		"v 0.261583 1.73116 -0.151025" + "\n" +
-		"v -0.283834 10.4099 0.103307" + "\n" +
-		"v -0.283834 10.4099 0.103307" + "\n" +
-		"v 0.283834 1.73116 -0.103307" + "\n" +
-		"v 0.297461 1.73116 -0.0524503" + "\n" +
-		"v -0.297461 10.4099 0.0524503" + "\n" +
-		"v -0.297461 10.4099 0.0524503" + "\n" +
-		"v 0.302049 -0.5 0" + "\n" +
-		"v 0.297461 -0.5 0.0524503" + "\n" +
-		"v -0.302049 10.4099 4.44089e-17" + "\n" +
-		"v -0.302049 10.4099 4.44089e-17" + "\n" +
-		"v 0.283834 -0.5 0.103307" + "\n" +
-		"v 0.261583 -0.5 0.151025" + "\n" +
-		"v -0.297461 10.4099 -0.0524503" + "\n" +
-		"v -0.297461 10.4099 -0.0524503" + "\n" +
-		"v 0.231383 -0.5 0.194154" + "\n" +
-		"v 0.194154 -0.5 0.231383" + "\n" +
-		"v -0.283834 10.4099 -0.103307" + "\n" +
-		"v -0.283834 10.4099 -0.103307" + "\n" +
-		"v 0.151025 -0.5 0.261583" + "\n" +
-		"v 0.103307 -0.5 0.283834" + "\n" +
-		"v -0.261583 10.4099 -0.151025" + "\n" +
-		"v -0.261583 10.4099 -0.151025" + "\n" +
-		"v 0.0524503 -0.5 0.297461" + "\n" +
-		"v 1.84952e-17 -0.5 0.302049" + "\n" +
-		"v -0.231383 10.4099 -0.194154" + "\n" +
-		"v -0.231383 10.4099 -0.194154" + "\n" +
-		"v -0.0524503 -0.5 0.297461" + "\n" +
-		"v -0.103307 -0.5 0.283834" + "\n" +
-		"v -0.194154 10.4099 -0.231383" + "\n" +
-		"v -0.194154 10.4099 -0.231383" + "\n" +
-		"v -0.151025 -0.5 0.261583" + "\n" +
-		"v -0.194154 -0.5 0.231383" + "\n" +
-		"v -0.151025 10.4099 -0.261583" + "\n" +
-		"v -0.151025 10.4099 -0.261583" + "\n" +
-		"v -0.231383 -0.5 0.194154" + "\n" +
-		"v -0.261583 -0.5 0.151025" + "\n" +
-		"v -0.103307 10.4099 -0.283834" + "\n" +
-		"v -0.103307 10.4099 -0.283834" + "\n" +
-		"v -0.283834 -0.5 0.103307" + "\n" +
-		"v -0.297461 -0.5 0.0524503" + "\n" +
-		"v -0.0524503 10.4099 -0.297461" + "\n" +
-		"v -0.0524503 10.4099 -0.297461" + "\n" +
-		"v -0.302049 -0.5 4.44089e-17" + "\n" +
-		"v -0.297461 -0.5 -0.0524503" + "\n" +
-		"v -5.54856e-17 10.4099 -0.302049" + "\n" +
-		"v -5.54856e-17 10.4099 -0.302049" + "\n" +
-		"v -0.283834 -0.5 -0.103307" + "\n" +
-		"v -0.261583 -0.5 -0.151025" + "\n" +
-		"v 0.0524503 10.4099 -0.297461" + "\n" +
-		"v 0.0524503 10.4099 -0.297461" + "\n" +
-		"v -0.231383 -0.5 -0.194154" + "\n" +
-		"v -0.194154 -0.5 -0.231383" + "\n" +
-		"v 0.103307 10.4099 -0.283834" + "\n" +
-		"v 0.103307 10.4099 -0.283834" + "\n" +
-		"v -0.151025 -0.5 -0.261583" + "\n" +
-		"v -0.103307 -0.5 -0.283834" + "\n" +
-		"v 0.151025 10.4099 -0.261583" + "\n" +
-		"v 0.151025 10.4099 -0.261583" + "\n" +
-		"v -0.0524503 -0.5 -0.297461" + "\n" +
-		"v -5.54856e-17 -0.5 -0.302049" + "\n" +
-		"v 0.194154 10.4099 -0.231383" + "\n" +
-		"v 0.194154 10.4099 -0.231383" + "\n" +
-		"v 0.0524503 -0.5 -0.297461" + "\n" +
-		"v 0.103307 -0.5 -0.283834" + "\n" +
-		"v 0.231383 10.4099 -0.194154" + "\n" +
-		"v 0.231383 10.4099 -0.194154" + "\n" +
-		"v 0.151025 -0.5 -0.261583" + "\n" +
-		"v 0.194154 -0.5 -0.231383" + "\n" +
-		"v 0.261583 10.4099 -0.151025" + "\n" +
-		"v 0.261583 10.4099 -0.151025" + "\n" +
-		"v 0.231383 -0.5 -0.194154" + "\n" +
-		"v 0.261583 -0.5 -0.151025" + "\n" +
-		"v 0.283834 10.4099 -0.103307" + "\n" +
-		"v 0.283834 10.4099 -0.103307" + "\n" +
-		"v 0.283834 -0.5 -0.103307" + "\n" +
-		"v 0.297461 -0.5 -0.0524503" + "\n" +
-		"v 0.297461 10.4099 -0.0524503" + "\n" +
-		"v 0.297461 10.4099 -0.0524503" + "\n" +
-		"vn 0 -1 0" + "\n" +
-		"vn 0 1 0" + "\n" +
-		"vn 0.866025 0 0.5" + "\n" +
-		"vn 0.766044 0 0.642788" + "\n" +
-		"vn 0.642788 0 0.766044" + "\n" +
-		"vn 0.5 0 0.866025" + "\n" +
-		"vn 0.34202 0 0.939693" + "\n" +
-		"vn 0.34202 0 0.939693" + "\n" +
-		"vn 0.173648 0 0.984808" + "\n" +
-		"vn 0 0 1" + "\n" +
-		"vn -0.173648 0 0.984808" + "\n" +
-		"vn -0.34202 0 0.939693" + "\n" +
-		"vn -0.5 0 0.866025" + "\n" +
-		"vn -0.642788 0 0.766044" + "\n" +
-		"vn -0.866025 0 0.5" + "\n" +
-		"vn -0.939693 0 0.34202" + "\n" +
-		"vn -0.939693 0 0.34202" + "\n" +
-		"vn -0.984808 0 0.173648" + "\n" +
-		"vn 1 0 0" + "\n" +
-		"vn 0.984808 0 0.173648" + "\n" +
-		"vn 0.984808 0 0.173648" + "\n" +
-		"vn 0.939693 0 0.34202" + "\n" +
-		"vn 0.939693 0 0.34202" + "\n" +
-		"vn -1 0 0" + "\n" +
-		"vn -0.984808 0 -0.173648" + "\n" +
-		"vn -0.984808 0 -0.173648" + "\n" +
-		"vn -0.984808 0 -0.173648" + "\n" +
-		"vn -0.939693 0 -0.34202" + "\n" +
-		"vn -0.939693 0 -0.34202" + "\n" +
-		"vn -0.866025 0 -0.5" + "\n" +
-		"vn 0.173648 0 0.984808" + "\n" +
-		"vn -0.766044 0 -0.642788" + "\n" +
-		"vn -0.173648 0 0.984808" + "\n" +
-		"vn -0.34202 0 0.939693" + "\n" +
-		"vn -0.642788 0 -0.766044" + "\n" +
-		"vn -0.5 0 -0.866025" + "\n" +
-		"vn -0.766044 0 0.642788" + "\n" +
-		"vn -0.766044 0 0.642788" + "\n" +
-		"vn -0.34202 0 -0.939693" + "\n" +
-		"vn -0.173648 0 -0.984808" + "\n" +
-		"vn -0.984808 0 0.173648" + "\n" +
-		"vn 0 0 -1" + "\n" +
-		"vn 0.173648 0 -0.984808" + "\n" +
-		"vn 0.173648 0 -0.984808" + "\n" +
-		"vn -0.34202 0 -0.939693" + "\n" +
-		"vn 0.34202 0 -0.939693" + "\n" +
-		"vn -0.173648 0 -0.984808" + "\n" +
-		"vn 0.34202 0 -0.939693" + "\n" +
-		"vn 0.5 0 -0.866025" + "\n" +
-		"vn 0.866025 0 -0.5" + "\n" +
-		"vn 0.939693 0 -0.34202" + "\n" +
-		"vn 0.939693 0 -0.34202" + "\n" +
-		"vn 0.642788 0 -0.766044" + "\n" +
-		"vn 0.766044 0 -0.642788" + "\n" +
-		"vn 0.766044 0 -0.642788" + "\n" +
-		"vn 0.984808 0 -0.173648" + "\n" +
-		"vn 0.984808 0 0.173648" + "\n" +
-		"vn 0.34202 0 0.939693" + "\n" +
-		"vn 0.173648 0 -0.984808" + "\n" +
-		"vn 0.984808 0 -0.173648" + "\n" +
-		"f 88//1 4//1 87//1" + "\n" +
-		"f 75//1 76//1 4//1" + "\n" +
-		"f 6//2 2//2 10//2" + "\n" +
-		"f 107//1 4//1 104//1" + "\n" +
-		"f 76//1 79//1 4//1" + "\n" +
-		"f 10//2 2//2 14//2" + "\n" +
-		"f 115//1 4//1 112//1" + "\n" +
-		"f 79//1 80//1 4//1" + "\n" +
-		"f 14//2 2//2 18//2" + "\n" +
-		"f 116//1 4//1 115//1" + "\n" +
-		"f 8//3 17//3 21//4 11//4" + "\n" +
-		"f 18//2 2//2 22//2" + "\n" +
-		"f 131//1 4//1 128//1" + "\n" +
-		"f 83//1 84//1 4//1" + "\n" +
-		"f 22//2 2//2 26//2" + "\n" +
-		"f 132//1 4//1 131//1" + "\n" +
-		"f 12//5 25//5 29//6 15//6" + "\n" +
-		"f 26//2 2//2 30//2" + "\n" +
-		"f 136//1 4//1 135//1" + "\n" +
-		"f 87//6 15//6 16//7 88//8" + "\n" +
-		"f 30//2 2//2 34//2" + "\n" +
-		"f 140//1 4//1 139//1" + "\n" +
-		"f 88//1 91//1 4//1" + "\n" +
-		"f 34//2 2//2 38//2" + "\n" +
-		"f 96//1 4//1 95//1" + "\n" +
-		"f 19//9 37//9 41//10 20//10" + "\n" +
-		"f 38//2 2//2 42//2" + "\n" +
-		"f 100//1 4//1 99//1" + "\n" +
-		"f 92//1 95//1 4//1" + "\n" +
-		"f 42//2 2//2 46//2" + "\n" +
-		"f 112//1 4//1 111//1" + "\n" +
-		"f 23//11 45//11 49//12 24//12" + "\n" +
-		"f 46//2 2//2 50//2" + "\n" +
-		"f 119//1 4//1 116//1" + "\n" +
-		"f 96//1 99//1 4//1" + "\n" +
-		"f 50//2 2//2 54//2" + "\n" +
-		"f 123//1 4//1 120//1" + "\n" +
-		"f 27//13 53//13 57//14 28//14" + "\n" +
-		"f 54//2 2//2 58//2" + "\n" +
-		"f 135//1 4//1 132//1" + "\n" +
-		"f 100//1 103//1 4//1" + "\n" +
-		"f 58//2 2//2 62//2" + "\n" +
-		"f 139//1 4//1 136//1" + "\n" +
-		"f 103//1 104//1 4//1" + "\n" +
-		"f 62//2 2//2 66//2" + "\n" +
-		"f 144//1 4//1 143//1" + "\n" +
-		"f 104//15 32//15 35//16 107//17" + "\n" +
-		"f 66//2 2//2 70//2" + "\n" +
-		"f 75//1 4//1 144//1" + "\n" +
-		"f 35//16 69//16 73//18 36//18" + "\n" +
-		"f 70//2 2//2 74//2" + "\n" +
-		"f 75//19 1//19 3//20 76//21" + "\n" +
-		"f 108//1 111//1 4//1" + "\n" +
-		"f 74//2 2//2 78//2" + "\n" +
-		"f 76//21 3//20 7//22 79//23" + "\n" +
-		"f 39//24 77//24 81//25 40//26" + "\n" +
-		"f 78//2 2//2 82//2" + "\n" +
-		"f 79//23 7//22 8//3 80//3" + "\n" +
-		"f 112//27 40//26 43//28 115//29" + "\n" +
-		"f 82//2 2//2 86//2" + "\n" +
-		"f 83//4 11//4 12//5 84//5" + "\n" +
-		"f 115//29 43//28 44//30 116//30" + "\n" +
-		"f 86//2 2//2 90//2" + "\n" +
-		"f 88//8 16//7 19//9 91//31" + "\n" +
-		"f 44//30 89//30 93//32 47//32" + "\n" +
-		"f 90//2 2//2 94//2" + "\n" +
-		"f 92//10 20//10 23//11 95//33" + "\n" +
-		"f 119//1 120//1 4//1" + "\n" +
-		"f 94//2 2//2 98//2" + "\n" +
-		"f 96//34 24//12 27//13 99//13" + "\n" +
-		"f 48//35 97//35 101//36 51//36" + "\n" +
-		"f 98//2 2//2 102//2" + "\n" +
-		"f 100//14 28//14 31//37 103//38" + "\n" +
-		"f 123//1 124//1 4//1" + "\n" +
-		"f 102//2 2//2 106//2" + "\n" +
-		"f 103//38 31//37 32//15 104//15" + "\n" +
-		"f 52//39 105//39 109//40 55//40" + "\n" +
-		"f 106//2 2//2 110//2" + "\n" +
-		"f 108//41 36//18 39//24 111//24" + "\n" +
-		"f 127//1 128//1 4//1" + "\n" +
-		"f 110//2 2//2 114//2" + "\n" +
-		"f 119//32 47//32 48//35 120//35" + "\n" +
-		"f 128//42 56//42 59//43 131//44" + "\n" +
-		"f 114//2 2//2 118//2" + "\n" +
-		"f 123//36 51//36 52//39 124//45" + "\n" +
-		"f 131//44 59//43 60//46 132//46" + "\n" +
-		"f 118//2 2//2 122//2" + "\n" +
-		"f 127//47 55//40 56//42 128//42" + "\n" +
-		"f 60//46 121//48 125//49 63//49" + "\n" +
-		"f 122//2 2//2 126//2" + "\n" +
-		"f 140//50 68//50 71//51 143//52" + "\n" +
-		"f 135//49 63//49 64//53 136//53" + "\n" +
-		"f 126//2 2//2 130//2" + "\n" +
-		"f 80//3 8//3 11//4 83//4" + "\n" +
-		"f 64//53 129//53 133//54 67//55" + "\n" +
-		"f 130//2 2//2 134//2" + "\n" +
-		"f 84//5 12//5 15//6 87//6" + "\n" +
-		"f 139//54 67//55 68//50 140//50" + "\n" +
-		"f 134//2 2//2 138//2" + "\n" +
-		"f 91//31 19//9 20//10 92//10" + "\n" +
-		"f 140//1 143//1 4//1" + "\n" +
-		"f 138//2 2//2 142//2" + "\n" +
-		"f 107//17 35//16 36//18 108//41" + "\n" +
-		"f 71//51 141//51 145//56 72//56" + "\n" +
-		"f 142//2 2//2 146//2" + "\n" +
-		"f 124//45 52//39 55//40 127//47" + "\n" +
-		"f 72//56 145//56 5//19 1//19" + "\n" +
-		"f 146//2 2//2 6//2" + "\n" +
-		"f 1//19 5//19 9//57 3//20" + "\n" +
-		"f 3//20 9//57 13//22 7//22" + "\n" +
-		"f 7//22 13//22 17//3 8//3" + "\n" +
-		"f 83//1 4//1 80//1" + "\n" +
-		"f 11//4 21//4 25//5 12//5" + "\n" +
-		"f 87//1 4//1 84//1" + "\n" +
-		"f 15//6 29//6 33//58 16//7" + "\n" +
-		"f 16//7 33//58 37//9 19//9" + "\n" +
-		"f 92//1 4//1 91//1" + "\n" +
-		"f 20//10 41//10 45//11 23//11" + "\n" +
-		"f 24//12 96//34 95//33 23//11" + "\n" +
-		"f 24//12 49//12 53//13 27//13" + "\n" +
-		"f 28//14 100//14 99//13 27//13" + "\n" +
-		"f 28//14 57//14 61//38 31//37" + "\n" +
-		"f 31//37 61//38 65//15 32//15" + "\n" +
-		"f 32//15 65//15 69//16 35//16" + "\n" +
-		"f 108//1 4//1 107//1" + "\n" +
-		"f 36//18 73//18 77//24 39//24" + "\n" +
-		"f 40//26 112//27 111//24 39//24" + "\n" +
-		"f 40//26 81//25 85//28 43//28" + "\n" +
-		"f 43//28 85//28 89//30 44//30" + "\n" +
-		"f 47//32 119//32 116//30 44//30" + "\n" +
-		"f 47//32 93//32 97//35 48//35" + "\n" +
-		"f 51//36 123//36 120//35 48//35" + "\n" +
-		"f 51//36 101//36 105//39 52//39" + "\n" +
-		"f 127//1 4//1 124//1" + "\n" +
-		"f 55//40 109//40 113//42 56//42" + "\n" +
-		"f 56//42 113//42 117//59 59//43" + "\n" +
-		"f 59//43 117//59 121//48 60//46" + "\n" +
-		"f 63//49 135//49 132//46 60//46" + "\n" +
-		"f 63//49 125//49 129//53 64//53" + "\n" +
-		"f 67//55 139//54 136//53 64//53" + "\n" +
-		"f 67//55 133//54 137//50 68//50" + "\n" +
-		"f 68//50 137//50 141//51 71//51" + "\n" +
-		"f 72//56 144//60 143//52 71//51" + "\n" +
-		"f 1//19 75//19 144//60 72//56" + "\n" +
-		"v 0 10.0003 0" + "\n" +
-		"v 0 20.0003 0" + "\n" +
-		"v 3.04 10.0003 0" + "\n" +
-		"v 3.04 10.0003 0" + "\n" +
-		"v 3.04 20.0003 0" + "\n" +
-		"v 3.04 20.0003 0" + "\n" +
-		"v 2.99382 10.0003 0.52789" + "\n" +
-		"v 2.99382 10.0003 0.52789" + "\n" +
-		"v 2.99382 20.0003 0.52789" + "\n" +
-		"v 2.99382 20.0003 0.52789" + "\n" +
-		"v 2.85667 10.0003 1.03974" + "\n" +
-		"v 2.85667 10.0003 1.03974" + "\n" +
-		"v 2.85667 20.0003 1.03974" + "\n" +
-		"v 2.85667 20.0003 1.03974" + "\n" +
-		"v 2.63272 10.0003 1.52" + "\n" +
-		"v 2.63272 10.0003 1.52" + "\n" +
-		"v 2.63272 20.0003 1.52" + "\n" +
-		"v 2.63272 20.0003 1.52" + "\n" +
-		"v 2.32878 10.0003 1.95407" + "\n" +
-		"v 2.32878 10.0003 1.95407" + "\n" +
-		"v 2.32878 20.0003 1.95407" + "\n" +
-		"v 2.32878 20.0003 1.95407" + "\n" +
-		"v 1.95407 10.0003 2.32878" + "\n" +
-		"v 1.95407 10.0003 2.32878" + "\n" +
-		"v 1.95407 20.0003 2.32878" + "\n" +
-		"v 1.95407 20.0003 2.32878" + "\n" +
-		"v 1.52 10.0003 2.63272" + "\n" +
-		"v 1.52 10.0003 2.63272" + "\n" +
-		"v 1.52 20.0003 2.63272" + "\n" +
-		"v 1.52 20.0003 2.63272" + "\n" +
-		"v 1.03974 10.0003 2.85667" + "\n" +
-		"v 1.03974 10.0003 2.85667" + "\n" +
-		"v 1.03974 20.0003 2.85667" + "\n" +
-		"v 1.03974 20.0003 2.85667" + "\n" +
-		"v 0.52789 10.0003 2.99382" + "\n" +
-		"v 0.52789 10.0003 2.99382" + "\n" +
-		"v 0.52789 20.0003 2.99382" + "\n" +
-		"v 0.52789 20.0003 2.99382" + "\n" +
-		"v 1.86146e-16 10.0003 3.04" + "\n" +
-		"v 1.86146e-16 10.0003 3.04" + "\n" +
-		"v 1.86146e-16 20.0003 3.04" + "\n" +
-		"v 1.86146e-16 20.0003 3.04" + "\n" +
-		"v -0.52789 10.0003 2.99382" + "\n" +
-		"v -0.52789 10.0003 2.99382" + "\n" +
-		"v -0.52789 20.0003 2.99382" + "\n" +
-		"v -0.52789 20.0003 2.99382" + "\n" +
-		"v -1.03974 10.0003 2.85667" + "\n" +
-		"v -1.03974 10.0003 2.85667" + "\n" +
-		"v -1.03974 20.0003 2.85667" + "\n" +
-		"v -1.03974 20.0003 2.85667" + "\n" +
-		"v -1.52 10.0003 2.63272" + "\n" +
-		"v -1.52 10.0003 2.63272" + "\n" +
-		"v -1.52 20.0003 2.63272" + "\n" +
-		"v -1.52 20.0003 2.63272" + "\n" +
-		"v -1.95407 10.0003 2.32878" + "\n" +
-		"v -1.95407 10.0003 2.32878" + "\n" +
-		"v -1.95407 20.0003 2.32878" + "\n" +
-		"v -1.95407 20.0003 2.32878" + "\n" +
-		"v -2.32878 10.0003 1.95407" + "\n" +
-		"v -2.32878 10.0003 1.95407" + "\n" +
-		"v -2.32878 20.0003 1.95407" + "\n" +
-		"v -2.32878 20.0003 1.95407" + "\n" +
-		"v -2.63272 10.0003 1.52" + "\n" +
-		"v -2.63272 10.0003 1.52" + "\n" +
-		"v -2.63272 20.0003 1.52" + "\n" +
-		"v -2.63272 20.0003 1.52" + "\n" +
-		"v -2.85667 10.0003 1.03974" + "\n" +
-		"v -2.85667 10.0003 1.03974" + "\n" +
-		"v -2.85667 20.0003 1.03974" + "\n" +
-		"v -2.85667 20.0003 1.03974" + "\n" +
-		"v -2.99382 10.0003 0.52789" + "\n" +
-		"v -2.99382 10.0003 0.52789" + "\n" +
-		"v -2.99382 20.0003 0.52789" + "\n" +
-		"v -2.99382 20.0003 0.52789" + "\n" +
-		"v -3.04 10.0003 3.55271e-16" + "\n" +
-		"v -3.04 10.0003 3.55271e-16" + "\n" +
-		"v -3.04 20.0003 3.55271e-16" + "\n" +
-		"v -3.04 20.0003 3.55271e-16" + "\n" +
-		"v -2.99382 10.0003 -0.52789" + "\n" +
-		"v -2.99382 10.0003 -0.52789" + "\n" +
-		"v -2.99382 20.0003 -0.52789" + "\n" +
-		"v -2.99382 20.0003 -0.52789" + "\n" +
-		"v -2.85667 10.0003 -1.03974" + "\n" +
-		"v -2.85667 10.0003 -1.03974" + "\n" +
-		"v -2.85667 20.0003 -1.03974" + "\n" +
-		"v -2.85667 20.0003 -1.03974" + "\n" +
-		"v -2.63272 10.0003 -1.52" + "\n" +
-		"v -2.63272 10.0003 -1.52" + "\n" +
-		"v -2.63272 20.0003 -1.52" + "\n" +
-		"v -2.63272 20.0003 -1.52" + "\n" +
-		"v -2.32878 10.0003 -1.95407" + "\n" +
-		"v -2.32878 10.0003 -1.95407" + "\n" +
-		"v -2.32878 20.0003 -1.95407" + "\n" +
-		"v -2.32878 20.0003 -1.95407" + "\n" +
-		"v -1.95407 10.0003 -2.32878" + "\n" +
-		"v -1.95407 10.0003 -2.32878" + "\n" +
-		"v -1.95407 20.0003 -2.32878" + "\n" +
-		"v -1.95407 20.0003 -2.32878" + "\n" +
-		"v -1.52 10.0003 -2.63272" + "\n" +
-		"v -1.52 10.0003 -2.63272" + "\n" +
-		"v -1.52 20.0003 -2.63272" + "\n" +
-		"v -1.52 20.0003 -2.63272" + "\n" +
-		"v -1.03974 10.0003 -2.85667" + "\n" +
-		"v -1.03974 10.0003 -2.85667" + "\n" +
-		"v -1.03974 20.0003 -2.85667" + "\n" +
-		"v -1.03974 20.0003 -2.85667" + "\n" +
-		"v -0.52789 10.0003 -2.99382" + "\n" +
-		"v -0.52789 10.0003 -2.99382" + "\n" +
-		"v -0.52789 20.0003 -2.99382" + "\n" +
-		"v -0.52789 20.0003 -2.99382" + "\n" +
-		"v -5.58439e-16 10.0003 -3.04" + "\n" +
-		"v -5.58439e-16 10.0003 -3.04" + "\n" +
-		"v -5.58439e-16 20.0003 -3.04" + "\n" +
-		"v -5.58439e-16 20.0003 -3.04" + "\n" +
-		"v 0.52789 10.0003 -2.99382" + "\n" +
-		"v 0.52789 10.0003 -2.99382" + "\n" +
-		"v 0.52789 20.0003 -2.99382" + "\n" +
-		"v 0.52789 20.0003 -2.99382" + "\n" +
-		"v 1.03974 10.0003 -2.85667" + "\n" +
-		"v 1.03974 10.0003 -2.85667" + "\n" +
-		"v 1.03974 20.0003 -2.85667" + "\n" +
-		"v 1.03974 20.0003 -2.85667" + "\n" +
-		"v 1.52 10.0003 -2.63272" + "\n" +
-		"v 1.52 10.0003 -2.63272" + "\n" +
-		"v 1.52 20.0003 -2.63272" + "\n" +
-		"v 1.52 20.0003 -2.63272" + "\n" +
-		"v 1.95407 10.0003 -2.32878" + "\n" +
-		"v 1.95407 10.0003 -2.32878" + "\n" +
-		"v 1.95407 20.0003 -2.32878" + "\n" +
-		"v 1.95407 20.0003 -2.32878" + "\n" +
-		"v 2.32878 10.0003 -1.95407" + "\n" +
-		"v 2.32878 10.0003 -1.95407" + "\n" +
-		"v 2.32878 20.0003 -1.95407" + "\n" +
-		"v 2.32878 20.0003 -1.95407" + "\n" +
-		"v 2.63272 10.0003 -1.52" + "\n" +
-		"v 2.63272 10.0003 -1.52" + "\n" +
-		"v 2.63272 20.0003 -1.52" + "\n" +
-		"v 2.63272 20.0003 -1.52" + "\n" +
-		"v 2.85667 10.0003 -1.03974" + "\n" +
-		"v 2.85667 10.0003 -1.03974" + "\n" +
-		"v 2.85667 20.0003 -1.03974" + "\n" +
-		"v 2.85667 20.0003 -1.03974" + "\n" +
-		"v 2.99382 10.0003 -0.52789" + "\n" +
-		"v 2.99382 10.0003 -0.52789" + "\n" +
-		"v 2.99382 20.0003 -0.52789" + "\n" +
-		"v 2.99382 20.0003 -0.52789" + "\n" +
-		"v -0.503707 20.0003 -2.85667" + "\n" +
-		"v -5.24761e-16 20.0003 -2.85667" + "\n" +
-		"v 0.503707 20.0003 -2.85667" + "\n" +
-		"v -0.52789 19.8396 -2.99382" + "\n" +
-		"v -5.58439e-16 19.8075 -3.04" + "\n" +
-		"v 0.52789 19.8396 -2.99382" + "\n" +
-		"v 3.04 18.9563 0" + "\n" +
-		"v 2.99382 18.9563 0.52789" + "\n" +
-		"v 2.85667 18.9563 1.03974" + "\n" +
-		"v 2.63272 18.9563 1.52" + "\n" +
-		"v 2.32878 18.9563 1.95407" + "\n" +
-		"v 1.95407 18.9563 2.32878" + "\n" +
-		"v 1.52 18.9563 2.63272" + "\n" +
-		"v 1.03974 18.9563 2.85667" + "\n" +
-		"v 0.52789 18.9563 2.99382" + "\n" +
-		"v 1.86146e-16 18.9563 3.04" + "\n" +
-		"v -0.52789 18.9563 2.99382" + "\n" +
-		"v -1.03974 18.9563 2.85667" + "\n" +
-		"v -1.52 18.9563 2.63272" + "\n" +
-		"v -1.95407 18.9563 2.32878" + "\n" +
-		"v -2.32878 18.9563 1.95407" + "\n" +
-		"v -2.63272 18.9563 1.52" + "\n" +
-		"v -2.85667 18.9563 1.03974" + "\n" +
-		"v -2.99382 18.9563 0.52789" + "\n" +
-		"v -3.04 18.9563 3.55271e-16" + "\n" +
-		"v -2.99382 18.9563 -0.52789" + "\n" +
-		"v -2.85667 18.9563 -1.03974" + "\n" +
-		"v -2.63272 18.9563 -1.52" + "\n" +
-		"v -2.32878 18.9563 -1.95407" + "\n" +
-		"v -1.95407 18.9563 -2.32878" + "\n" +
-		"v -1.52 18.9563 -2.63272" + "\n" +
-		"v -1.03974 18.9563 -2.85667" + "\n" +
-		"v -0.52789 18.9563 -2.99382" + "\n" +
-		"v -5.58439e-16 18.9563 -3.04" + "\n" +
-		"v 0.52789 18.9563 -2.99382" + "\n" +
-		"v 1.03974 18.9563 -2.85667" + "\n" +
-		"v 1.52 18.9563 -2.63272" + "\n" +
-		"v 1.95407 18.9563 -2.32878" + "\n" +
-		"v 2.32878 18.9563 -1.95407" + "\n" +
-		"v 2.63272 18.9563 -1.52" + "\n" +
-		"v 2.85667 18.9563 -1.03974" + "\n" +
-		"v 2.99382 18.9563 -0.52789" + "\n" +
-		"v 3.04 11.0443 0" + "\n" +
-		"v 2.99382 11.0443 0.52789" + "\n" +
-		"v 2.85667 11.0443 1.03974" + "\n" +
-		"v 2.63272 11.0443 1.52" + "\n" +
-		"v 2.32878 11.0443 1.95407" + "\n" +
-		"v 1.95407 11.0443 2.32878" + "\n" +
-		"v 1.52 11.0443 2.63272" + "\n" +
-		"v 1.03974 11.0443 2.85667" + "\n" +
-		"v 0.52789 11.0443 2.99382" + "\n" +
-		"v 1.86146e-16 11.0443 3.04" + "\n" +
-		"v -0.52789 11.0443 2.99382" + "\n" +
-		"v -1.03974 11.0443 2.85667" + "\n" +
-		"v -1.52 11.0443 2.63272" + "\n" +
-		"v -1.95407 11.0443 2.32878" + "\n" +
-		"v -2.32878 11.0443 1.95407" + "\n" +
-		"v -2.63272 11.0443 1.52" + "\n" +
-		"v -2.85667 11.0443 1.03974" + "\n" +
-		"v -2.99382 11.0443 0.52789" + "\n" +
-		"v -3.04 11.0443 3.55271e-16" + "\n" +
-		"v -2.99382 11.0443 -0.52789" + "\n" +
-		"v -2.85667 11.0443 -1.03974" + "\n" +
-		"v -2.63272 11.0443 -1.52" + "\n" +
-		"v -2.32878 11.0443 -1.95407" + "\n" +
-		"v -1.95407 11.0443 -2.32878" + "\n" +
-		"v -1.52 11.0443 -2.63272" + "\n" +
-		"v -1.03974 11.0443 -2.85667" + "\n" +
-		"v -0.52789 11.0443 -2.99382" + "\n" +
-		"v -5.58439e-16 11.0443 -3.04" + "\n" +
-		"v 0.52789 11.0443 -2.99382" + "\n" +
-		"v 1.03974 11.0443 -2.85667" + "\n" +
-		"v 1.52 11.0443 -2.63272" + "\n" +
-		"v 1.95407 11.0443 -2.32878" + "\n" +
-		"v 2.32878 11.0443 -1.95407" + "\n" +
-		"v 2.63272 11.0443 -1.52" + "\n" +
-		"v 2.85667 11.0443 -1.03974" + "\n" +
-		"v 2.99382 11.0443 -0.52789" + "\n" +
-		"v 0.722955 18.4338 0" + "\n" +
-		"v 0.711972 18.4338 0.12554" + "\n" +
-		"v 0.679356 18.4338 0.247265" + "\n" +
-		"v 0.626098 18.4338 0.361478" + "\n" +
-		"v 0.553816 18.4338 0.464707" + "\n" +
-		"v 0.464707 18.4338 0.553816" + "\n" +
-		"v 0.361478 18.4338 0.626098" + "\n" +
-		"v 0.247265 18.4338 0.679356" + "\n" +
-		"v 0.12554 18.4338 0.711972" + "\n" +
-		"v 4.42682e-17 18.4338 0.722955" + "\n" +
-		"v -0.12554 18.4338 0.711972" + "\n" +
-		"v -0.247265 18.4338 0.679356" + "\n" +
-		"v -0.361478 18.4338 0.626098" + "\n" +
-		"v -0.464707 18.4338 0.553816" + "\n" +
-		"v -0.553816 18.4338 0.464707" + "\n" +
-		"v -0.626098 18.4338 0.361478" + "\n" +
-		"v -0.679356 18.4338 0.247265" + "\n" +
-		"v -0.711972 18.4338 0.12554" + "\n" +
-		"v -0.722955 18.4338 0" + "\n" +
-		"v -0.711972 18.4338 -0.12554" + "\n" +
-		"v -0.679356 18.4338 -0.247265" + "\n" +
-		"v -0.626098 18.4338 -0.361478" + "\n" +
-		"v -0.553816 18.4338 -0.464707" + "\n" +
-		"v -0.464707 18.4338 -0.553816" + "\n" +
-		"v -0.361478 18.4338 -0.626098" + "\n" +
-		"v -0.247265 18.4338 -0.679356" + "\n" +
-		"v -0.12554 18.4338 -0.711972" + "\n" +
-		"v -1.32805e-16 18.4338 -0.722955" + "\n" +
-		"v 0.12554 18.4338 -0.711972" + "\n" +
-		"v 0.247265 18.4338 -0.679356" + "\n" +
-		"v 0.361478 18.4338 -0.626098" + "\n" +
-		"v 0.464707 18.4338 -0.553816" + "\n" +
-		"v 0.553816 18.4338 -0.464707" + "\n" +
-		"v 0.626098 18.4338 -0.361478" + "\n" +
-		"v 0.679356 18.4338 -0.247265" + "\n" +
-		"v 0.711972 18.4338 -0.12554" + "\n" +
-		"v 1.39604 11.5667 0" + "\n" +
-		"v 1.37483 11.5667 0.242419" + "\n" +
-		"v 1.31184 11.5667 0.477472" + "\n" +
-		"v 1.209 11.5667 0.698018" + "\n" +
-		"v 1.06943 11.5667 0.897355" + "\n" +
-		"v 0.897355 11.5667 1.06943" + "\n" +
-		"v 0.698018 11.5667 1.209" + "\n" +
-		"v 0.477472 11.5667 1.31184" + "\n" +
-		"v 0.242419 11.5667 1.37483" + "\n" +
-		"v 8.54826e-17 11.5667 1.39604" + "\n" +
-		"v -0.242419 11.5667 1.37483" + "\n" +
-		"v -0.477472 11.5667 1.31184" + "\n" +
-		"v -0.698018 11.5667 1.209" + "\n" +
-		"v -0.897355 11.5667 1.06943" + "\n" +
-		"v -1.06943 11.5667 0.897355" + "\n" +
-		"v -1.209 11.5667 0.698018" + "\n" +
-		"v -1.31184 11.5667 0.477472" + "\n" +
-		"v -1.37483 11.5667 0.242419" + "\n" +
-		"v -1.39604 11.5667 1.77636e-16" + "\n" +
-		"v -1.37483 11.5667 -0.242419" + "\n" +
-		"v -1.31184 11.5667 -0.477472" + "\n" +
-		"v -1.209 11.5667 -0.698018" + "\n" +
-		"v -1.06943 11.5667 -0.897355" + "\n" +
-		"v -0.897355 11.5667 -1.06943" + "\n" +
-		"v -0.698018 11.5667 -1.209" + "\n" +
-		"v -0.477472 11.5667 -1.31184" + "\n" +
-		"v -0.242419 11.5667 -1.37483" + "\n" +
-		"v -2.56448e-16 11.5667 -1.39604" + "\n" +
-		"v 0.242419 11.5667 -1.37483" + "\n" +
-		"v 0.477472 11.5667 -1.31184" + "\n" +
-		"v 0.698018 11.5667 -1.209" + "\n" +
-		"v 0.897355 11.5667 -1.06943" + "\n" +
-		"v 1.06943 11.5667 -0.897355" + "\n" +
-		"v 1.209 11.5667 -0.698018" + "\n" +
-		"v 1.31184 11.5667 -0.477472" + "\n" +
-		"v 1.37483 11.5667 -0.242419" + "\n" +
-		"vn 0 -1 0" + "\n" +
-		"vn 1 0 0" + "\n" +
-		"vn 0.806367 0.591416 0" + "\n" +
-		"vn 0.794116 0.591416 0.140024" + "\n" +
-		"vn 0.984808 0 0.173648" + "\n" +
-		"vn 0 1 0" + "\n" +
-		"vn 0.768253 -0.625649 0.135464" + "\n" +
-		"vn 0.939693 0 0.34202" + "\n" +
-		"vn 0.733058 -0.625649 0.266812" + "\n" +
-		"vn 0.757737 0.591416 0.275794" + "\n" +
-		"vn 0.698334 0.591416 0.403184" + "\n" +
-		"vn 0.866025 0 0.5" + "\n" +
-		"vn 0.67559 -0.625649 0.390052" + "\n" +
-		"vn 0.866025 0 0.5" + "\n" +
-		"vn 0.766044 0 0.642788" + "\n" +
-		"vn 0.597595 -0.625649 0.501442" + "\n" +
-		"vn 0.766044 0 0.642788" + "\n" +
-		"vn 0.617713 0.591416 0.518323" + "\n" +
-		"vn 0.518323 0.591416 0.617713" + "\n" +
-		"vn 0.642788 0 0.766044" + "\n" +
-		"vn 0.501442 -0.625649 0.597595" + "\n" +
-		"vn 0.642788 0 0.766044" + "\n" +
-		"vn 0.5 0 0.866025" + "\n" +
-		"vn 0.390052 -0.625649 0.67559" + "\n" +
-		"vn 0.5 0 0.866025" + "\n" +
-		"vn 0.403184 0.591416 0.698334" + "\n" +
-		"vn 0.275794 0.591416 0.757737" + "\n" +
-		"vn 0.34202 0 0.939693" + "\n" +
-		"vn 0.265617 0.62998 0.729776" + "\n" +
-		"vn 0.340389 0.0975477 0.935211" + "\n" +
-		"vn 0.17282 0.0975477 0.980111" + "\n" +
-		"vn 0.134857 0.62998 0.764813" + "\n" +
-		"vn 0.135464 -0.625649 0.768253" + "\n" +
-		"vn 0.173648 0 0.984808" + "\n" +
-		"vn 0 0 1" + "\n" +
-		"vn 0 -0.625649 0.780105" + "\n" +
-		"vn -1.67662e-08 0.591416 0.806367" + "\n" +
-		"vn -0.140024 0.591416 0.794116" + "\n" +
-		"vn -0.173648 0 0.984808" + "\n" +
-		"vn -0.135464 -0.625649 0.768253" + "\n" +
-		"vn -0.34202 0 0.939693" + "\n" +
-		"vn -0.266812 -0.625649 0.733058" + "\n" +
-		"vn -0.265617 0.62998 0.729776" + "\n" +
-		"vn -0.340389 0.0975477 0.935211" + "\n" +
-		"vn -0.497615 0.0975477 0.861895" + "\n" +
-		"vn -0.388306 0.62998 0.672565" + "\n" +
-		"vn -0.390052 -0.625649 0.67559" + "\n" +
-		"vn -0.5 0 0.866025" + "\n" +
-		"vn -0.642788 0 0.766044" + "\n" +
-		"vn -0.501442 -0.625649 0.597595" + "\n" +
-		"vn -0.141385 -0.97551 0.168497" + "\n" +
-		"vn -0.597595 -0.625649 0.501442" + "\n" +
-		"vn -0.168497 -0.97551 0.141385" + "\n" +
-		"vn -0.766044 0 0.642788" + "\n" +
-		"vn -0.866025 0 0.5" + "\n" +
-		"vn -0.67559 -0.625649 0.390052" + "\n" +
-		"vn -0.672565 0.62998 0.388306" + "\n" +
-		"vn -0.861895 0.0975477 0.497615" + "\n" +
-		"vn -0.935211 0.0975477 0.340389" + "\n" +
-		"vn -0.729776 0.62998 0.265617" + "\n" +
-		"vn -0.733058 -0.625649 0.266812" + "\n" +
-		"vn -0.939693 0 0.34202" + "\n" +
-		"vn -0.984808 0 0.173648" + "\n" +
-		"vn -0.768253 -0.625649 0.135464" + "\n" +
-		"vn -0.794116 0.591416 0.140024" + "\n" +
-		"vn -0.764813 0.62998 0.134857" + "\n" +
-		"vn -0.776611 0.62998 -1.34122e-08" + "\n" +
-		"vn -0.806367 0.591416 -1.44537e-08" + "\n" +
-		"vn -0.780105 -0.625649 -1.19484e-09" + "\n" +
-		"vn -1 0 0" + "\n" +
-		"vn -0.984808 0 -0.173648" + "\n" +
-		"vn -0.768253 -0.625649 -0.135464" + "\n" +
-		"vn -0.794116 0.591416 -0.140024" + "\n" +
-		"vn -0.764813 0.62998 -0.134857" + "\n" +
-		"vn -0.729776 0.62998 -0.265617" + "\n" +
-		"vn -0.757737 0.591416 -0.275794" + "\n" +
-		"vn -0.939693 0 -0.34202" + "\n" +
-		"vn -0.698334 0.591416 -0.403184" + "\n" +
-		"vn -0.866025 0 -0.5" + "\n" +
-		"vn -0.67559 -0.625649 -0.390052" + "\n" +
-		"vn -0.866025 0 -0.5" + "\n" +
-		"vn -0.766044 0 -0.642788" + "\n" +
-		"vn -0.597595 -0.625649 -0.501442" + "\n" +
-		"vn -0.617713 0.591416 -0.518323" + "\n" +
-		"vn -0.594919 0.62998 -0.499196" + "\n" +
-		"vn -0.499196 0.62998 -0.594919" + "\n" +
-		"vn -0.518323 0.591416 -0.617713" + "\n" +
-		"vn -0.501442 -0.625649 -0.597595" + "\n" +
-		"vn -0.642788 0 -0.766044" + "\n" +
-		"vn -0.5 0 -0.866025" + "\n" +
-		"vn -0.390052 -0.625649 -0.67559" + "\n" +
-		"vn -0.388306 0.62998 -0.672565" + "\n" +
-		"vn -0.497615 0.0975477 -0.861895" + "\n" +
-		"vn -0.340389 0.0975477 -0.935211" + "\n" +
-		"vn -0.265617 0.62998 -0.729776" + "\n" +
-		"vn -0.314482 0 -0.949263" + "\n" +
-		"vn -0.173648 0 -0.984808" + "\n" +
-		"vn -0.173648 0 -0.984808" + "\n" +
-		"vn -0.140024 0.591416 -0.794116" + "\n" +
-		"vn 1.67662e-08 0.591416 -0.806367" + "\n" +
-		"vn 0 0 -1" + "\n" +
-		"vn 0.140024 0.591416 -0.794116" + "\n" +
-		"vn 0.173648 0 -0.984808" + "\n" +
-		"vn 0.173648 0 -0.984808" + "\n" +
-		"vn 0.314482 0 -0.949263" + "\n" +
-		"vn 0.34202 0 -0.939693" + "\n" +
-		"vn 0.275794 0.591416 -0.757737" + "\n" +
-		"vn 0.403184 0.591416 -0.698334" + "\n" +
-		"vn 0.5 0 -0.866025" + "\n" +
-		"vn 0.518323 0.591416 -0.617713" + "\n" +
-		"vn 0.642788 0 -0.766044" + "\n" +
-		"vn 0.141385 -0.97551 -0.168497" + "\n" +
-		"vn 0.501442 -0.625649 -0.597595" + "\n" +
-		"vn 0.597595 -0.625649 -0.501442" + "\n" +
-		"vn 0.168497 -0.97551 -0.141385" + "\n" +
-		"vn 0.766044 0 -0.642788" + "\n" +
-		"vn 0.866025 0 -0.5" + "\n" +
-		"vn 0.67559 -0.625649 -0.390052" + "\n" +
-		"vn 0.939693 0 -0.34202" + "\n" +
-		"vn 0.733058 -0.625649 -0.266811" + "\n" +
-		"vn 0.757737 0.591416 -0.275794" + "\n" +
-		"vn 0.794116 0.591416 -0.140024" + "\n" +
-		"vn 0.984808 0 -0.173648" + "\n" +
-		"vn -0.34202 0 -0.939693" + "\n" +
-		"vn -0.275794 0.591416 -0.757737" + "\n" +
-		"vn 0.340389 0.0975477 -0.935211" + "\n" +
-		"vn 0.265617 0.62998 -0.729776" + "\n" +
-		"vn 0.134857 0.62998 -0.764813" + "\n" +
-		"vn 0.17282 0.0975477 -0.980111" + "\n" +
-		"vn 0.780105 -0.625649 5.9742e-10" + "\n" +
-		"vn 0.168497 -0.97551 0.141385" + "\n" +
-		"vn 0.190488 -0.97551 0.109978" + "\n" +
-		"vn 0.266812 -0.625649 0.733058" + "\n" +
-		"vn 0.140024 0.591416 0.794116" + "\n" +
-		"vn -0.275794 0.591416 0.757737" + "\n" +
-		"vn -0.518323 0.591416 0.617713" + "\n" +
-		"vn -0.642788 0 0.766044" + "\n" +
-		"vn -0.5 0 0.866025" + "\n" +
-		"vn -0.403184 0.591416 0.698334" + "\n" +
-		"vn -0.698334 0.591416 0.403184" + "\n" +
-		"vn -0.866025 0 0.5" + "\n" +
-		"vn -0.766044 0 0.642788" + "\n" +
-		"vn -0.617713 0.591416 0.518323" + "\n" +
-		"vn -0.216615 -0.97551 0.0381951" + "\n" +
-		"vn -0.206692 -0.97551 0.0752296" + "\n" +
-		"vn -0.216615 -0.97551 -0.038195" + "\n" +
-		"vn -0.219957 -0.97551 -9.31495e-10" + "\n" +
-		"vn -0.733058 -0.625649 -0.266812" + "\n" +
-		"vn -0.672565 0.62998 -0.388306" + "\n" +
-		"vn -0.403184 0.591416 -0.698334" + "\n" +
-		"vn -0.5 0 -0.866025" + "\n" +
-		"vn -0.642788 0 -0.766044" + "\n" +
-		"vn -0.266812 -0.625649 -0.733058" + "\n" +
-		"vn -0.135464 -0.625649 -0.768253" + "\n" +
-		"vn 0 -0.625649 -0.780105" + "\n" +
-		"vn 0.135464 -0.625649 -0.768253" + "\n" +
-		"vn 0.266812 -0.625649 -0.733058" + "\n" +
-		"vn 0.5 0 -0.866025" + "\n" +
-		"vn 0.390052 -0.625649 -0.67559" + "\n" +
-		"vn 0.642788 0 -0.766044" + "\n" +
-		"vn 0.698334 0.591416 -0.403184" + "\n" +
-		"vn 0.866025 0 -0.5" + "\n" +
-		"vn 0.766044 0 -0.642788" + "\n" +
-		"vn 0.617713 0.591416 -0.518323" + "\n" +
-		"vn 0.206692 -0.97551 -0.0752295" + "\n" +
-		"vn 0.190488 -0.97551 -0.109978" + "\n" +
-		"vn 0.768253 -0.625649 -0.135464" + "\n" +
-		"vn 0.776611 0.62998 1.11768e-09" + "\n" +
-		"vn 0.995231 0.0975477 0" + "\n" +
-		"vn 0.980111 0.0975477 0.17282" + "\n" +
-		"vn 0.764813 0.62998 0.134857" + "\n" +
-		"vn 0.206692 -0.97551 0.0752296" + "\n" +
-		"vn 0.141385 -0.97551 0.168497" + "\n" +
-		"vn 0.109978 -0.97551 0.190488" + "\n" +
-		"vn 0.0752296 -0.97551 0.206692" + "\n" +
-		"vn 0 -0.97551 0.219957" + "\n" +
-		"vn -0.038195 -0.97551 0.216615" + "\n" +
-		"vn -0.757737 0.591416 0.275794" + "\n" +
-		"vn -0.766044 0 -0.642788" + "\n" +
-		"vn -0.134857 0.62998 -0.764813" + "\n" +
-		"vn 1.56475e-08 0.62998 -0.776611" + "\n" +
-		"vn 0 -0.97551 -0.219957" + "\n" +
-		"vn 0.038195 -0.97551 -0.216615" + "\n" +
-		"vn 0.0752296 -0.97551 -0.206692" + "\n" +
-		"vn 0.109978 -0.97551 -0.190488" + "\n" +
-		"vn 0.729776 0.62998 -0.265617" + "\n" +
-		"vn 0.764813 0.62998 -0.134857" + "\n" +
-		"vn 0.980111 0.0975477 -0.17282" + "\n" +
-		"vn -0.0752296 -0.97551 -0.206692" + "\n" +
-		"vn -0.038195 -0.97551 -0.216615" + "\n" +
-		"vn 0.216615 -0.97551 0.038195" + "\n" +
-		"vn 0.499196 0.62998 0.594919" + "\n" +
-		"vn 0.639722 0.0975477 0.762391" + "\n" +
-		"vn 0.497615 0.0975477 0.861895" + "\n" +
-		"vn 0.388306 0.62998 0.672565" + "\n" +
-		"vn -3.12951e-08 0.62998 0.776611" + "\n" +
-		"vn -0.134857 0.62998 0.764813" + "\n" +
-		"vn -0.17282 0.0975477 0.980111" + "\n" +
-		"vn -0.109978 -0.97551 0.190488" + "\n" +
-		"vn -0.190488 -0.97551 0.109978" + "\n" +
-		"vn -0.141385 -0.97551 -0.168497" + "\n" +
-		"vn -0.109978 -0.97551 -0.190488" + "\n" +
-		"vn 0.594919 0.62998 -0.499196" + "\n" +
-		"vn 0.672565 0.62998 -0.388306" + "\n" +
-		"vn 0.038195 -0.97551 0.216615" + "\n" +
-		"vn -0.0752296 -0.97551 0.206692" + "\n" +
-		"vn -0.594919 0.62998 0.499196" + "\n" +
-		"vn -0.499196 0.62998 0.594919" + "\n" +
-		"vn -0.206692 -0.97551 -0.0752296" + "\n" +
-		"vn -0.168497 -0.97551 -0.141385" + "\n" +
-		"vn 0.762391 0.0975477 -0.639722" + "\n" +
-		"vn 0.499196 0.62998 -0.594919" + "\n" +
-		"vn 0.639722 0.0975477 -0.762391" + "\n" +
-		"vn 0.762391 0.0975477 0.639722" + "\n" +
-		"vn 0.594919 0.62998 0.499196" + "\n" +
-		"vn 0.672565 0.62998 0.388306" + "\n" +
-		"vn 0.861895 0.0975477 0.497615" + "\n" +
-		"vn -0.190488 -0.97551 -0.109978" + "\n" +
-		"vn 0.935211 0.0975477 -0.340389" + "\n" +
-		"vn 0.861895 0.0975477 -0.497615" + "\n" +
-		"vn 0.219957 -0.97551 0" + "\n" +
-		"vn 0.729776 0.62998 0.265617" + "\n" +
-		"vn -2.61757e-08 0.0975477 0.995231" + "\n" +
-		"vn 0.388306 0.62998 -0.672565" + "\n" +
-		"vn 0.497615 0.0975477 -0.861895" + "\n" +
-		"vn 0.216615 -0.97551 -0.038195" + "\n" +
-		"vn -0.639722 0.0975477 0.762391" + "\n" +
-		"vn -0.762391 0.0975477 0.639722" + "\n" +
-		"vn -0.639722 0.0975477 -0.762391" + "\n" +
-		"vn -0.980111 0.0975477 0.17282" + "\n" +
-		"vn -0.995231 0.0975477 0" + "\n" +
-		"vn -0.980111 0.0975477 -0.17282" + "\n" +
-		"vn -0.935211 0.0975477 -0.340389" + "\n" +
-		"vn -0.762391 0.0975477 -0.639722" + "\n" +
-		"vn -0.861895 0.0975477 -0.497615" + "\n" +
-		"vn -0.17282 0.0975477 -0.980111" + "\n" +
-		"vn 0 0.0975477 -0.995231" + "\n" +
-		"vn 0.935211 0.0975477 0.340389" + "\n" +
-		"f 147//61 149//61 153//61" + "\n" +
-		"f 150//62 335//63 336//64 154//65" + "\n" +
-		"f 152//66 148//66 156//66" + "\n" +
-		"f 147//61 153//61 157//61" + "\n" +
-		"f 300//67 155//65 159//68 301//69" + "\n" +
-		"f 156//66 148//66 160//66" + "\n" +
-		"f 147//61 157//61 161//61" + "\n" +
-		"f 158//68 337//70 338//71 162//72" + "\n" +
-		"f 160//66 148//66 164//66" + "\n" +
-		"f 147//61 161//61 165//61" + "\n" +
-		"f 302//73 163//74 167//75 303//76" + "\n" +
-		"f 164//66 148//66 168//66" + "\n" +
-		"f 147//61 165//61 169//61" + "\n" +
-		"f 166//77 339//78 340//79 170//80" + "\n" +
-		"f 168//66 148//66 172//66" + "\n" +
-		"f 147//61 169//61 173//61" + "\n" +
-		"f 304//81 171//82 175//83 305//84" + "\n" +
-		"f 172//66 148//66 176//66" + "\n" +
-		"f 147//61 173//61 177//61" + "\n" +
-		"f 174//85 341//86 342//87 178//88" + "\n" +
-		"f 176//66 148//66 180//66" + "\n" +
-		"f 147//61 177//61 181//61" + "\n" +
-		"f 414//89 378//90 379//91 415//92" + "\n" +
-		"f 180//66 148//66 184//66" + "\n" +
-		"f 147//61 181//61 185//61" + "\n" +
-		"f 307//93 183//94 187//95 308//96" + "\n" +
-		"f 184//66 148//66 188//66" + "\n" +
-		"f 147//61 185//61 189//61" + "\n" +
-		"f 186//95 344//97 345//98 190//99" + "\n" +
-		"f 188//66 148//66 192//66" + "\n" +
-		"f 147//61 189//61 193//61" + "\n" +
-		"f 309//100 191//99 195//101 310//102" + "\n" +
-		"f 192//66 148//66 196//66" + "\n" +
-		"f 147//61 193//61 197//61" + "\n" +
-		"f 418//103 382//104 383//105 419//106" + "\n" +
-		"f 196//66 148//66 200//66" + "\n" +
-		"f 147//61 197//61 201//61" + "\n" +
-		"f 311//107 199//108 203//109 312//110" + "\n" +
-		"f 200//66 148//66 204//66" + "\n" +
-		"f 147//61 201//61 205//61" + "\n" +
-		"f 384//111 312//110 313//112 385//113" + "\n" +
-		"f 204//66 148//66 208//66" + "\n" +
-		"f 147//61 205//61 209//61" + "\n" +
-		"f 313//112 207//114 211//115 314//116" + "\n" +
-		"f 208//66 148//66 212//66" + "\n" +
-		"f 147//61 209//61 213//61" + "\n" +
-		"f 422//117 386//118 387//119 423//120" + "\n" +
-		"f 212//66 148//66 216//66" + "\n" +
-		"f 147//61 213//61 217//61" + "\n" +
-		"f 315//121 215//122 219//123 316//124" + "\n" +
-		"f 216//66 148//66 220//66" + "\n" +
-		"f 147//61 217//61 221//61" + "\n" +
-		"f 352//125 424//126 425//127 353//128" + "\n" +
-		"f 220//66 148//66 224//66" + "\n" +
-		"f 147//61 221//61 225//61" + "\n" +
-		"f 317//129 223//130 227//131 318//132" + "\n" +
-		"f 224//66 148//66 228//66" + "\n" +
-		"f 147//61 225//61 229//61" + "\n" +
-		"f 354//133 426//134 427//135 355//136" + "\n" +
-		"f 228//66 148//66 232//66" + "\n" +
-		"f 147//61 229//61 233//61" + "\n" +
-		"f 230//137 355//136 356//138 234//139" + "\n" +
-		"f 232//66 148//66 236//66" + "\n" +
-		"f 147//61 233//61 237//61" + "\n" +
-		"f 320//140 235//141 239//142 321//143" + "\n" +
-		"f 236//66 148//66 240//66" + "\n" +
-		"f 147//61 237//61 241//61" + "\n" +
-		"f 357//144 429//145 430//146 358//147" + "\n" +
-		"f 240//66 148//66 244//66" + "\n" +
-		"f 147//61 241//61 245//61" + "\n" +
-		"f 322//148 243//149 247//150 323//151" + "\n" +
-		"f 244//66 148//66 248//66" + "\n" +
-		"f 147//61 245//61 249//61" + "\n" +
-		"f 431//152 395//153 396//154 432//155" + "\n" +
-		"f 248//66 148//66 252//66" + "\n" +
-		"f 147//61 249//61 253//61" + "\n" +
-		"f 251//156 255//157 296//157" + "\n" +
-		"f 252//66 293//66 256//66" + "\n" +
-		"f 147//61 253//61 257//61" + "\n" +
-		"f 254//158 361//159 362//160 258//161" + "\n" +
-		"f 293//66 148//66 294//66" + "\n" +
-		"f 147//61 257//61 261//61" + "\n" +
-		"f 258//161 362//160 363//162 262//163" + "\n" +
-		"f 294//66 148//66 295//66" + "\n" +
-		"f 147//61 261//61 265//61" + "\n" +
-		"f 298//164 263//163 267//165" + "\n" +
-		"f 264//66 295//66 268//66" + "\n" +
-		"f 147//61 265//61 269//61" + "\n" +
-		"f 266//166 364//167 365//168 270//169" + "\n" +
-		"f 268//66 148//66 272//66" + "\n" +
-		"f 147//61 269//61 273//61" + "\n" +
-		"f 270//169 365//168 366//170 274//171" + "\n" +
-		"f 272//66 148//66 276//66" + "\n" +
-		"f 147//61 273//61 277//61" + "\n" +
-		"f 402//172 330//173 331//174 403//175" + "\n" +
-		"f 276//66 148//66 280//66" + "\n" +
-		"f 147//61 277//61 281//61" + "\n" +
-		"f 331//174 279//176 283//177 332//178" + "\n" +
-		"f 280//66 148//66 284//66" + "\n" +
-		"f 147//61 281//61 285//61" + "\n" +
-		"f 332//178 283//177 287//179 333//180" + "\n" +
-		"f 284//66 148//66 288//66" + "\n" +
-		"f 147//61 285//61 289//61" + "\n" +
-		"f 286//179 369//181 370//182 290//183" + "\n" +
-		"f 288//66 148//66 292//66" + "\n" +
-		"f 147//61 289//61 149//61" + "\n" +
-		"f 290//183 370//182 335//63 150//62" + "\n" +
-		"f 292//66 148//66 152//66" + "\n" +
-		"f 361//159 254//158 250//184 360//185" + "\n" +
-		"f 252//66 148//66 293//66" + "\n" +
-		"f 296//157 255//157 259//161 297//161" + "\n" +
-		"f 294//66 260//66 256//66 293//66" + "\n" +
-		"f 297//161 259//161 263//163 298//164" + "\n" +
-		"f 295//66 264//66 260//66 294//66" + "\n" +
-		"f 400//186 436//187 435//188 399//189" + "\n" +
-		"f 295//66 148//66 268//66" + "\n" +
-		"f 299//190 151//62 155//65 300//67" + "\n" +
-		"f 337//70 158//68 154//65 336//64" + "\n" +
-		"f 301//69 159//68 163//74 302//73" + "\n" +
-		"f 303//76 375//191 374//192 302//73" + "\n" +
-		"f 303//76 167//75 171//82 304//81" + "\n" +
-		"f 341//86 174//85 170//80 340//79" + "\n" +
-		"f 305//84 175//83 179//88 306//193" + "\n" +
-		"f 306//193 179//88 183//94 307//93" + "\n" +
-		"f 344//97 186//95 182//94 343//194" + "\n" +
-		"f 308//96 187//95 191//99 309//100" + "\n" +
-		"f 346//195 194//101 190//99 345//98" + "\n" +
-		"f 310//102 195//101 199//108 311//107" + "\n" +
-		"f 348//196 202//197 198//198 347//199" + "\n" +
-		"f 312//110 203//109 207//114 313//112" + "\n" +
-		"f 350//200 210//201 206//202 349//203" + "\n" +
-		"f 314//116 211//115 215//122 315//121" + "\n" +
-		"f 316//124 388//204 387//205 315//121" + "\n" +
-		"f 316//124 219//123 223//130 317//129" + "\n" +
-		"f 318//132 390//206 389//207 317//129" + "\n" +
-		"f 318//132 227//131 231//137 319//208" + "\n" +
-		"f 319//208 231//137 235//141 320//140" + "\n" +
-		"f 429//145 357//144 356//138 428//209" + "\n" +
-		"f 321//143 239//142 243//149 322//148" + "\n" +
-		"f 359//210 246//211 242//212 358//147" + "\n" +
-		"f 323//151 247//150 251//156 324//213" + "\n" +
-		"f 325//214 296//157 297//161 326//215" + "\n" +
-		"f 326//215 297//161 298//164 327//216" + "\n" +
-		"f 328//217 267//165 271//218 329//219" + "\n" +
-		"f 329//219 271//218 275//220 330//173" + "\n" +
-		"f 330//173 275//220 279//176 331//174" + "\n" +
-		"f 368//221 282//222 278//223 367//224" + "\n" +
-		"f 333//180 405//225 404//226 332//178" + "\n" +
-		"f 333//180 287//179 291//183 334//227" + "\n" +
-		"f 334//227 291//183 151//62 299//190" + "\n" +
-		"f 324//213 251//156 296//157 325//214" + "\n" +
-		"f 327//216 298//164 267//165 328//217" + "\n" +
-		"f 407//228 371//229 372//230 408//231" + "\n" +
-		"f 373//232 301//69 302//73 374//192" + "\n" +
-		"f 375//191 303//76 304//81 376//233" + "\n" +
-		"f 377//234 305//84 306//193 378//235" + "\n" +
-		"f 343//194 182//94 178//88 342//87" + "\n" +
-		"f 380//236 308//96 309//100 381//237" + "\n" +
-		"f 347//199 198//198 194//101 346//195" + "\n" +
-		"f 349//203 206//202 202//197 348//196" + "\n" +
-		"f 351//238 214//122 210//201 350//200" + "\n" +
-		"f 353//128 222//130 218//123 352//125" + "\n" +
-		"f 355//136 230//137 226//131 354//133" + "\n" +
-		"f 355//136 427//135 428//209 356//138" + "\n" +
-		"f 358//147 242//212 238//239 357//144" + "\n" +
-		"f 360//185 250//184 246//211 359//210" + "\n" +
-		"f 361//159 433//240 434//241 362//160" + "\n" +
-		"f 398//242 326//215 327//216 399//243" + "\n" +
-		"f 400//244 328//217 329//219 401//245" + "\n" +
-		"f 401//245 329//219 330//173 402//172" + "\n" +
-		"f 367//224 278//223 274//171 366//170" + "\n" +
-		"f 369//181 441//246 442//247 370//182" + "\n" +
-		"f 442//247 406//248 371//229 407//228" + "\n" +
-		"f 396//249 324//213 325//214 397//250" + "\n" +
-		"f 364//167 266//166 262//163 363//162" + "\n" +
-		"f 372//251 300//67 301//69 373//232" + "\n" +
-		"f 339//78 166//77 162//72 338//71" + "\n" +
-		"f 412//252 376//253 377//254 413//255" + "\n" +
-		"f 343//194 415//92 416//256 344//97" + "\n" +
-		"f 417//257 381//258 382//104 418//103" + "\n" +
-		"f 383//259 311//107 312//110 384//111" + "\n" +
-		"f 385//113 313//112 314//116 386//260" + "\n" +
-		"f 352//125 218//123 214//122 351//238" + "\n" +
-		"f 354//133 226//131 222//130 353//128" + "\n" +
-		"f 357//144 238//239 234//139 356//138" + "\n" +
-		"f 394//261 322//148 323//151 395//262" + "\n" +
-		"f 367//224 439//263 440//264 368//221" + "\n" +
-		"f 369//181 286//179 282//222 368//221" + "\n" +
-		"f 378//235 306//193 307//93 379//265" + "\n" +
-		"f 382//266 310//102 311//107 383//259" + "\n" +
-		"f 421//267 349//203 348//196 420//268" + "\n" +
-		"f 386//260 314//116 315//121 387//205" + "\n" +
-		"f 388//204 316//124 317//129 389//207" + "\n" +
-		"f 390//206 318//132 319//208 391//269" + "\n" +
-		"f 393//270 321//143 322//148 394//261" + "\n" +
-		"f 395//262 323//151 324//213 396//249" + "\n" +
-		"f 403//271 439//263 438//272 402//273" + "\n" +
-		"f 399//243 327//216 328//217 400//244" + "\n" +
-		"f 375//274 411//275 410//276 374//277" + "\n" +
-		"f 424//126 352//125 351//238 423//120" + "\n" +
-		"f 426//134 354//133 353//128 425//127" + "\n" +
-		"f 392//278 320//140 321//143 393//270" + "\n" +
-		"f 405//279 441//246 440//264 404//280" + "\n" +
-		"f 371//281 299//190 300//67 372//251" + "\n" +
-		"f 410//276 338//71 337//70 409//282" + "\n" +
-		"f 376//253 412//252 411//275 375//274" + "\n" +
-		"f 414//89 342//87 341//86 413//255" + "\n" +
-		"f 381//258 417//257 416//256 380//283" + "\n" +
-		"f 391//269 319//208 320//140 392//278" + "\n" +
-		"f 397//250 325//214 326//215 398//242" + "\n" +
-		"f 435//188 363//162 362//160 434//241" + "\n" +
-		"f 437//284 365//168 364//167 436//187" + "\n" +
-		"f 402//273 438//272 437//284 401//285" + "\n" +
-		"f 405//225 333//180 334//227 406//286" + "\n" +
-		"f 406//286 334//227 299//190 371//281" + "\n" +
-		"f 433//240 361//159 360//185 432//155" + "\n" +
-		"f 409//282 337//70 336//64 408//231" + "\n" +
-		"f 376//233 304//81 305//84 377//234" + "\n" +
-		"f 379//265 307//93 308//96 380//236" + "\n" +
-		"f 381//237 309//100 310//102 382//266" + "\n" +
-		"f 384//287 420//268 419//106 383//105" + "\n" +
-		"f 386//118 422//117 421//267 385//288" + "\n" +
-		"f 395//153 431//152 430//146 394//289" + "\n" +
-		"f 403//175 331//174 332//178 404//226" + "\n" +
-		"f 415//92 343//194 342//87 414//89" + "\n" +
-		"f 419//106 347//199 346//195 418//103" + "\n" +
-		"f 423//120 351//238 350//200 422//117" + "\n" +
-		"f 424//126 388//290 389//291 425//127" + "\n" +
-		"f 426//134 390//292 391//293 427//135" + "\n" +
-		"f 429//145 393//294 394//289 430//146" + "\n" +
-		"f 432//155 360//185 359//210 431//152" + "\n" +
-		"f 436//187 364//167 363//162 435//188" + "\n" +
-		"f 428//209 392//295 393//294 429//145" + "\n" +
-		"f 408//231 336//64 335//63 407//228" + "\n" +
-		"f 427//135 391//293 392//295 428//209" + "\n" +
-		"f 433//240 397//296 398//297 434//241" + "\n" +
-		"f 441//246 405//279 406//248 442//247" + "\n" +
-		"f 407//228 335//63 370//182 442//247" + "\n" +
-		"f 413//255 341//86 340//79 412//252" + "\n" +
-		"f 415//92 379//91 380//283 416//256" + "\n" +
-		"f 418//103 346//195 345//98 417//257" + "\n" +
-		"f 439//263 403//271 404//280 440//264" + "\n" +
-		"f 420//268 384//287 385//288 421//267" + "\n" +
-		"f 439//263 367//224 366//170 438//272" + "\n" +
-		"f 411//275 339//78 338//71 410//276" + "\n" +
-		"f 423//120 387//119 388//290 424//126" + "\n" +
-		"f 425//127 389//291 390//292 426//134" + "\n" +
-		"f 441//246 369//181 368//221 440//264" + "\n" +
-		"f 409//282 373//298 374//277 410//276" + "\n" +
-		"f 412//252 340//79 339//78 411//275" + "\n" +
-		"f 413//255 377//254 378//90 414//89" + "\n" +
-		"f 417//257 345//98 344//97 416//256" + "\n" +
-		"f 434//241 398//297 399//189 435//188" + "\n" +
-		"f 436//187 400//186 401//285 437//284" + "\n" +
-		"f 438//272 366//170 365//168 437//284" + "\n" +
-		"f 432//155 396//154 397//296 433//240" + "\n" +
-		"f 408//231 372//230 373//298 409//282" + "\n" +
-		"f 420//268 348//196 347//199 419//106" + "\n" +
-		"f 422//117 350//200 349//203 421//267" + "\n" +
-		"f 431//152 359//210 358//147 430//146" + "\n"
-	);
-
-	std::istringstream is(obj);
-	loadFromString(is);
+	loadFromTables(PinData::VertexCount, PinData::TriangleCount, PinData::Positions, PinData::Normals, nullptr, PinData::Indices);
+	m_bbox = BoundingBox3f(Vector3f(PinData::BBoxMin[0], PinData::BBoxMin[1], PinData::BBoxMin[2]),
+		Vector3f(PinData::BBoxMax[0], PinData::BBoxMax[1], PinData::BBoxMax[2]));
 
 	calculateLocalRotation(nm);
 }
@@ -1,18 +1,75 @@
 #include "mesh/Sphere.hpp"
+#include <map>
+#include <mutex>
+#include <tuple>
 
 VR_NAMESPACE_BEGIN
 
+/**
+ * @brief Vertex data of one sphere tessellation and the buffers of its first upload
+ */
+struct Sphere::Geometry {
+	MatrixXf V, N, UV;
+	MatrixXu F;
+
+	std::shared_ptr<GLShader> shader; ///< Shader the vertex array was set up for, nullptr before the first upload
+	bool quantized = false; ///< Vertex format of the buffers
+	GLuint vao = 0;
+	GLuint vbo[4] = { 0, 0, 0, 0 };
+	std::vector<Chunk> chunks;
+	std::vector<uint32_t> lodChunks;
+	Vector3f quantizationScale = Vector3f::Ones();
+	Vector3f quantizationOffset = Vector3f::Zero();
+	size_t gpuBytes = 0;
+
+	~Geometry() {
+		for (GLuint buffer : vbo)
+			if (buffer)
+				glDeleteBuffers(1, &buffer);
+		if (vao)
+			glDeleteVertexArrays(1, &vao);
+	}
+};
+
 Sphere::Sphere() : Sphere(1.f, 16, 16) {
 
 }
 
-Sphere::Sphere(float radius, unsigned int rings, unsigned int sectors, bool invertNormals) : Mesh(), radius(radius) {
+Sphere::Sphere(float radius, unsigned int rings, unsigned int sectors, bool invertNormals)
+	: Mesh(), radius(radius), geometry(getGeometry(radius, rings, sectors, invertNormals)), sharedBuffers(false) {
+	m_V = geometry->V;
+	m_N = geometry->N;
+	m_UV = geometry->UV;
+	m_F = geometry->F;
+}
+
+Sphere::~Sphere() {
+	// The geometry releases shared buffers once its last sphere is gone
+	if (sharedBuffers) {
+		vao = 0;
+		vbo[VERTEX_BUFFER] = vbo[TEXCOORD_BUFFER] = vbo[NORMAL_BUFFER] = vbo[INDEX_BUFFER] = 0;
+	}
+}
+
+std::shared_ptr<Sphere::Geometry> Sphere::getGeometry(float radius, unsigned int rings, unsigned int sectors, bool invertNormals) {
+	static std::mutex mutex;
+	static std::map<std::tuple<float, unsigned int, unsigned int, bool>, std::weak_ptr<Geometry>> cache;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::weak_ptr<Geometry> &entry = cache[std::make_tuple(radius, rings, sectors, invertNormals)];
+	std::shared_ptr<Geometry> geometry = entry.lock();
+	if (geometry)
+		return geometry;
+
+	geometry = std::make_shared<Geometry>();
+	entry = geometry;
+
 	float const R = 1.f / (float) (rings - 1);
 	float const S = 1.f / (float) (sectors - 1);
 
-	m_V.resize(3, rings * sectors + sectors);
-	m_UV.resize(2, rings * sectors + sectors);
-	m_N.resize(3, rings * sectors + sectors);
+	geometry->V.resize(3, rings * sectors + sectors);
+	geometry->UV.resize(2, rings * sectors + sectors);
+	geometry->N.resize(3, rings * sectors + sectors);
 
 	unsigned int i = 0;
 	for (unsigned int r = 0; r < rings; r++) {
@@ -21,25 +78,65 @@ Sphere::Sphere(float radius, unsigned int rings, unsigned int sectors, bool inve
 			float x = cosf(2 * M_PI * s * S) * sinf(M_PI * r * R);
 			float z = sinf(2 * M_PI * s * S) * sinf(M_PI * r * R);
 
-			m_V.col(i) = Vector3f(x * radius, y * radius, z * radius);
+			geometry->V.col(i) = Vector3f(x * radius, y * radius, z * radius);
 			if (invertNormals)
-				m_N.col(i) = -Vector3f(x, y, z);
+				geometry->N.col(i) = -Vector3f(x, y, z);
 			else
-				m_N.col(i) = Vector3f(x, y, z);
+				geometry->N.col(i) = Vector3f(x, y, z);
 
-			m_UV.col(i) = getUV(m_V.col(i).normalized());
+			geometry->UV.col(i) = getUV(geometry->V.col(i).normalized());
 			i++;
 		}
 	}
 
 	i = -1;
-	m_F.resize(3, rings * sectors * 2);
+	geometry->F.resize(3, rings * sectors * 2);
 	for (unsigned int r = 0; r < rings - 1; r++) {
 		for (unsigned int s = 0; s < sectors - 1; s++) {
-			m_F.col(++i) = Vector3ui(r * sectors + (s + 1), r * sectors + s, (r + 1) * sectors + s);
-			m_F.col(++i) = Vector3ui(r * sectors + (s + 1), (r + 1) * sectors + s, (r + 1) * sectors + (s + 1));
+			geometry->F.col(++i) = Vector3ui(r * sectors + (s + 1), r * sectors + s, (r + 1) * sectors + s);
+			geometry->F.col(++i) = Vector3ui(r * sectors + (s + 1), (r + 1) * sectors + s, (r + 1) * sectors + (s + 1));
 		}
 	}
+
+	return geometry;
+}
+
+void Sphere::upload(std::shared_ptr<GLShader> &s) {
+	// Levels of detail and meshlets are built per instance, the vertex array binds the attributes of one shader
+	Geometry &g = *geometry;
+	if (!m_lods.empty() || meshletCulling || (g.shader && (g.shader != s || g.quantized != quantized))) {
+		// Forget the shared handles, the buffers uploaded now are our own and released with this sphere
+		if (sharedBuffers) {
+			vao = 0;
+			vbo[VERTEX_BUFFER] = vbo[TEXCOORD_BUFFER] = vbo[NORMAL_BUFFER] = vbo[INDEX_BUFFER] = 0;
+			sharedBuffers = false;
+		}
+		Mesh::upload(s);
+		return;
+	}
+
+	if (!g.shader) {
+		Mesh::upload(s);
+		g.shader = s;
+		g.quantized = quantized;
+		g.vao = vao;
+		std::copy(vbo, vbo + 4, g.vbo);
+		g.chunks = chunks;
+		g.lodChunks = lodChunks;
+		g.quantizationScale = quantizationScale;
+		g.quantizationOffset = quantizationOffset;
+		g.gpuBytes = gpuBytes;
+	} else {
+		shader = s;
+		vao = g.vao;
+		std::copy(g.vbo, g.vbo + 4, vbo);
+		chunks = g.chunks;
+		lodChunks = g.lodChunks;
+		quantizationScale = g.quantizationScale;
+		quantizationOffset = g.quantizationOffset;
+		gpuBytes = g.gpuBytes;
+	}
+	sharedBuffers = true;
 }
 
 Vector2f Sphere::getUV(const Vector3f &v) {
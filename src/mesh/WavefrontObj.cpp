@@ -124,6 +124,7 @@ void WavefrontOBJ::loadFromString(std::istream &is) {
 }
 
 WavefrontOBJ::WavefrontOBJ(const std::string &file) {
+	VR_TRACE_SCOPE("WavefrontOBJ::load");
 	m_name = file;
 	std::ifstream is(file);
     if (is.fail())
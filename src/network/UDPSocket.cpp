@@ -5,29 +5,30 @@ VR_NAMESPACE_BEGIN
 using asio::ip::udp;
 
 UDPSocket::UDPSocket (asio::io_service& io_service, short listen_port)
-	: socket(io_service, udp::endpoint(udp::v4(), listen_port)), current_length(0), bufferChanged(true) {
+	: socket(io_service, udp::endpoint(udp::v4(), listen_port)), data(Settings::getInstance().NETWORK_BUFFER_SIZE)
+	, bufferChanged(false), listening(true) {
 
-	max_length = Settings::getInstance().NETWORK_BUFFER_SIZE;
-	data = new char[max_length];
 }
 
 void UDPSocket::receive () {
-	Settings::getInstance().NETWORK_LISTEN = false;
-	socket.async_receive_from(asio::buffer(data, max_length), endpoint, [this] (std::error_code ec, std::size_t bytes_recvd) {
+	listening = false;
+	socket.async_receive_from(asio::buffer(data.data(), data.size()), sender, [this] (std::error_code ec, std::size_t bytes_recvd) {
 		if (!ec && bytes_recvd > 0) {
-			current_length = bytes_recvd;
+			std::lock_guard<std::mutex> lock(mutex);
+			received.assign(data.begin(), data.begin() + bytes_recvd);
 			bufferChanged = true;
 		}
 		
-		Settings::getInstance().NETWORK_LISTEN = true;
+		listening = true;
 	});
 }
 
 void UDPSocket::send (const std::string &msg, const std::string &ip_address, short port) {
-	std::size_t length = copyToBuffer(msg);
+	// The packet lives until the send completed
+	std::shared_ptr<std::string> packet = std::make_shared<std::string>(msg);
 
-	endpoint = udp::endpoint(asio::ip::address::from_string(ip_address), port);
-	socket.async_send_to(asio::buffer(data, length), endpoint, [this] (std::error_code ec, std::size_t bytes_sent) {
+	udp::endpoint endpoint(asio::ip::address::from_string(ip_address), port);
+	socket.async_send_to(asio::buffer(packet->data(), packet->size()), endpoint, [packet] (std::error_code ec, std::size_t bytes_sent) {
 		/*if (!ec && bytes_sent > 0) {
 			std::cout << "Sent: '" << bytes_sent << "'\n";
 		}*/
@@ -38,23 +39,14 @@ void UDPSocket::send (const std::string &msg, const std::string &ip_address, sho
 }
 
 bool UDPSocket::hasNewData () {
+	std::lock_guard<std::mutex> lock(mutex);
 	return bufferChanged;
 }
 
 std::string UDPSocket::getBufferContent () {
+	std::lock_guard<std::mutex> lock(mutex);
 	bufferChanged = false;
-	return std::string(data, data + current_length);
-}
-
-void UDPSocket::copyToBuffer (const std::string &content, std::size_t length) {
-	strncpy(data, content.c_str(), length);
-	data[length] = 0;
-}
-
-std::size_t UDPSocket::copyToBuffer (const std::string &content) {
-	std::size_t length = content.size() * sizeof(std::string::value_type);
-	copyToBuffer(content, length);
-	return length;
+	return received;
 }
 
 VR_NAMESPACE_END
@@ -0,0 +1,63 @@
+#include "renderer/DynamicResolution.hpp"
+
+VR_NAMESPACE_BEGIN
+
+/// Weight of a new sample in the smoothed frame time
+static const float Smoothing = 0.2f;
+
+/// Share of the budget the scale aims for
+static const float Target = 0.85f;
+
+/// Smoothed frame times below this share of the budget let the scale grow
+static const float Headroom = 0.75f;
+
+/// Largest change of the scale per step
+static const float MaxStep = 0.1f;
+
+/// Consecutive samples below the headroom before the scale grows
+static const int SettleFrames = 30;
+
+DynamicResolution::DynamicResolution(float budget, float minScale, float maxScale, int latency)
+	: budget(budget), minScale(minScale), maxScale(std::max(minScale, maxScale)), latency(latency) {
+	reset();
+}
+
+void DynamicResolution::reset() {
+	scale = maxScale;
+	filtered = 0.f;
+	cooldown = 0;
+	settled = 0;
+	changes = 0;
+}
+
+float DynamicResolution::update(float frameTime) {
+	// Samples issued before the last change do not tell anything about the current scale
+	if (cooldown > 0) {
+		cooldown--;
+		return scale;
+	}
+
+	filtered = filtered == 0.f ? frameTime : filtered + Smoothing * (frameTime - filtered);
+	settled = filtered < Headroom * budget ? settled + 1 : 0;
+
+	// GPU time grows roughly with the number of pixels, i.e. with the square of the scale
+	bool over = filtered > budget;
+	if (!over && settled < SettleFrames)
+		return scale;
+
+	float desired = scale * std::sqrt(Target * budget / std::max(filtered, 1e-3f));
+	float next = std::min(std::max(desired, std::max(minScale, scale - MaxStep)), std::min(maxScale, scale + MaxStep));
+	if (std::abs(next - scale) < 1e-3f)
+		return scale;
+
+	scale = next;
+	changes++;
+
+	// The smoothed time restarts from the first sample at the new scale
+	filtered = 0.f;
+	settled = 0;
+	cooldown = latency;
+	return scale;
+}
+
+VR_NAMESPACE_END
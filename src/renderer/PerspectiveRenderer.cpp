@@ -7,7 +7,8 @@ PerspectiveRenderer::PerspectiveRenderer (std::shared_ptr<GLShader> &shader, flo
 	, fH(tan(fov / 360 * M_PI) * zNear), fW(fH * aspectRatio), lightIntensity(Settings::getInstance().LIGHT_INTENSITY)
 	, materialColor(Settings::getInstance().MATERIAL_COLOR), headsUp(Settings::getInstance().CAMERA_HEADS_UP)
 	, lookAtPosition(Settings::getInstance().CAMERA_LOOK_AT)
-	, cameraPosition(Settings::getInstance().CAMERA_OFFSET), GISphere(true) {
+	, cameraPosition(Settings::getInstance().CAMERA_OFFSET), GISphere(true)
+	, bboxDisplay(false), bboxAlpha(0.f), pedestalAlpha(1.f) {
 
 	setProjectionMatrix(frustum(-fW, fW, -fH, fH, zNear, zFar));
 	setViewMatrix(lookAt(cameraPosition, lookAtPosition, headsUp));
@@ -54,266 +55,171 @@ void PerspectiveRenderer::preProcessGI() {
 	GISphere.scale(0.08f, 0.08f, 0.08f);
 	GISphere.upload(shader);
 
-	// Load environment HDR
-	HDRLoaderResult result, resultDiffuse;
-	HDRLoader::load(Settings::getInstance().GI_FILE.c_str(), result);
-	HDRLoader::load(Settings::getInstance().GI_DIFFUSE_FILE.c_str(), resultDiffuse);
-	environment = std::shared_ptr<float>(result.cols);
-	environmentDiffuse = std::shared_ptr<float>(resultDiffuse.cols);
-
-	// Texture uniforms
-	envTexture = GLFramebuffer::createTexture(result.width, result.height);
-	envDiffuseTexture = GLFramebuffer::createTexture(resultDiffuse.width, resultDiffuse.height);
-
-	// Upload env
-	glBindTexture(GL_TEXTURE_2D, envTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, result.width, result.height, 0, GL_RGB, GL_FLOAT, environment.get());
-
-	// Upload env Diffuse 
-	glBindTexture(GL_TEXTURE_2D, envDiffuseTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, resultDiffuse.width, resultDiffuse.height, 0, GL_RGB, GL_FLOAT, environmentDiffuse.get());
-
-	// Pass to shader
-	glBindVertexArray(GISphere.getVAO());
-	GLuint env = glGetUniformLocation(shader->getId(), "env");
-	GLuint envDiffuse = glGetUniformLocation(shader->getId(), "envDiffuse");
-	glUniform1i(env, /*GL_TEXTURE*/0);
-	glUniform1i(envDiffuse,/*GL_TEXTURE*/1);
-	glBindVertexArray(0);
+	// Load environment HDR as a prefiltered cubemap
+	VR_TRACE_SCOPE("HDRTexture::load");
+	HDRTexture environment(Settings::getInstance().GI_FILE);
+	envTexture = environment.upload();
+
+	// Pass to shader, diffuse lighting is evaluated from the irradiance coefficients
+	shader->setUniform("env", /*GL_TEXTURE*/0);
+	shader->setUniform("envMaxLod", float(environment.levels() - 1));
+	shader->setUniform("roughness", Settings::getInstance().GI_SPECULAR_ROUGHNESS);
+	shader->setUniform("irradiance", environment.irradiance().data(), SphericalHarmonics::Count);
 }
 
 void PerspectiveRenderer::update(Matrix4f &s, Matrix4f &r, Matrix4f &t) {
+	const Settings &settings = Settings::getInstance();
+
 	// Mesh model matrix
 	mesh->setScaleMatrix(s);
 	mesh->setRotationMatrix(r);
 	mesh->setTranslateMatrix(t);
 
-	// Update pins
-	if (pinList != nullptr && !pinList->empty()) {
-		for (auto &p : *pinList) {
-			p->setScaleMatrix(s);
-			p->setRotationMatrix(r);
-			p->setTranslateMatrix(t);
-		}
-	}
+	// World matrices of the mesh and its pins, only recomputed if a transform changed
+	mesh->update();
 
 	// Bounding sphere
-	if (Settings::getInstance().SHOW_SPHERE || Settings::getInstance().SPHERE_VISUAL_HINT) {
+	if (gestures.rotating || gestures.sphereHint) {
 		sphereCenter = mesh->getBoundingBox().getCenter();
-		sphereRadius = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * Settings::getInstance().SPHERE_VISUAL_SCALE;
+		sphereRadius = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * settings.SPHERE_VISUAL_SCALE;
 
 		sphere.translate(sphereCenter.x(), sphereCenter.y(), sphereCenter.z());
 		sphere.scale(Matrix4f::Identity(), sphereRadius, sphereRadius, sphereRadius);
 		sphere.setRotationMatrix(r);
 		
 		// Debug spheres
-		if (Settings::getInstance().SHOW_DEBUG_SPHERES) {
+		if (settings.SHOW_DEBUG_SPHERES) {
 			// Large sphere
-			sphereRadius_large = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * Settings::getInstance().SPHERE_LARGE_SCALE;
+			sphereRadius_large = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * settings.SPHERE_LARGE_SCALE;
 			sphere_large.translate(sphereCenter.x(), sphereCenter.y(), sphereCenter.z());
 			sphere_large.scale(Matrix4f::Identity(), sphereRadius_large, sphereRadius_large, sphereRadius_large);
 			sphere_large.setRotationMatrix(r);
 
 			// Small sphere
-			sphereRadius_small = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * Settings::getInstance().SPHERE_SMALL_SCALE;
+			sphereRadius_small = (mesh->getBoundingBox().min - mesh->getBoundingBox().max).norm() * settings.SPHERE_SMALL_SCALE;
 			sphere_small.translate(sphereCenter.x(), sphereCenter.y(), sphereCenter.z());
 			sphere_small.scale(Matrix4f::Identity(), sphereRadius_small, sphereRadius_small, sphereRadius_small);
 			sphere_small.setRotationMatrix(r);
 		}
-
-		// Sphere blend
-		if (Settings::getInstance().SHOW_SPHERE) {
-			if (Settings::getInstance().SPHERE_ALPHA_BLEND_INTRO && Settings::getInstance().SPHERE_ALPHA_BLEND < 0.3f)
-				Settings::getInstance().SPHERE_ALPHA_BLEND += 0.02f;
-			else
-				Settings::getInstance().SPHERE_ALPHA_BLEND_INTRO = false;
-		}
-
-		Settings::getInstance().SPHERE_DISPLAY = true;
-	} else {
-		Settings::getInstance().SPHERE_DISPLAY = false;
-		if (!Settings::getInstance().SPHERE_VISUAL_HINT)
-			Settings::getInstance().SPHERE_ALPHA_BLEND = 0.f;
 	}
 
 	// BBox blend
-	if (Settings::getInstance().MESH_DRAW_BBOX) {
-		if (Settings::getInstance().BBOX_ALPHA_BLEND < 0.8f)
-			Settings::getInstance().BBOX_ALPHA_BLEND += 0.04f;
+	if (settings.MESH_DRAW_BBOX || gestures.scaling) {
+		if (bboxAlpha < 0.8f)
+			bboxAlpha += 0.04f;
 
-		Settings::getInstance().MESH_DISPLAY_BBOX = true;
+		bboxDisplay = true;
 	} else {
-		if (Settings::getInstance().BBOX_ALPHA_BLEND > 0.f)
-			Settings::getInstance().BBOX_ALPHA_BLEND -= 0.04f;
+		if (bboxAlpha > 0.f)
+			bboxAlpha -= 0.04f;
 		else
-			Settings::getInstance().MESH_DISPLAY_BBOX = false;
+			bboxDisplay = false;
 	}
 
 	// Create virtual point light
 	Vector3f cp = cameraPosition;
-	if (Settings::getInstance().USE_RIFT)
+	if (settings.USE_RIFT)
 		cp += Vector3f(0.f, 0.2f, 0.5f);
 
 	shader->setUniform("light.position", cp);
 	shader->setUniform("cameraPosition", cameraPosition);
 
 	// Default no wireframe and bbox overlay
-	shader->setUniform("simpleColor", false);
+	shader->setFeature(SIMPLE_COLOR, false);
 }
 
 void PerspectiveRenderer::draw() {
-	shader->bind();
-
-	// OpengGL Settings
-	glEnable(GL_CULL_FACE);
-	glCullFace(GL_BACK);
+	typedef RenderQueue::State State;
+	typedef RenderQueue::Material Material;
+	const Settings &settings = Settings::getInstance();
+	const Matrix4f &view = getViewMatrix(), &projection = getProjectionMatrix();
+	uint32_t gi = settings.USE_RIFT && settings.GI_ENABLED ? ENABLE_GI : 0;
 
 	// Shader settings
-	Settings::getInstance().MATERIAL_COLOR = Vector3f(0.8f, 0.8f, 0.8f);
-	shader->setUniform("materialColor", Settings::getInstance().MATERIAL_COLOR);
-	shader->setUniform("alpha", 1.f);
-	shader->setUniform("enableGI", Settings::getInstance().USE_RIFT && Settings::getInstance().GI_ENABLED);
-	shader->setUniform("light.ambientCoefficient", 0.03f);
+	Vector3f color = settings.MATERIAL_COLOR;
+
+	// Draw the mesh, the wireframe overlay is part of the same pass
+	if (settings.MESH_DRAW) {
+		uint32_t features = gi | (mesh->isQuantized() ? QUANTIZED : 0);
+		if (settings.MESH_DRAW_WIREFRAME) {
+			GLint viewport[4];
+			glGetIntegerv(GL_VIEWPORT, viewport);
+			features |= WIREFRAME;
+			shader->setUniform("viewportSize", Vector2f(float(viewport[2]), float(viewport[3])));
+			shader->setUniform("wireframeColor", Vector3f(0.2f, 0.2f, 0.2f));
+			shader->setUniform("wireframeWidth", 1.f);
+		}
 
-	// Draw the mesh
-	if (Settings::getInstance().MESH_DRAW)
-		mesh->draw(getViewMatrix(), getProjectionMatrix());
+		queue.submit(RenderQueue::EOpaque, "mesh", State(features), Material(color), *mesh, view, projection);
+	}
 
 	// Draw global illumination sphere
-	if (Settings::getInstance().USE_RIFT && Settings::getInstance().GI_ENABLED) {
-		glCullFace(GL_FRONT);
-		shader->setUniform("textureOnly", true);
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, envTexture);
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, envDiffuseTexture);
-		GISphere.draw(getViewMatrix(), getProjectionMatrix());
-		shader->setUniform("textureOnly", false);
-		glCullFace(GL_BACK);
-	}
+	if (settings.USE_RIFT && settings.GI_ENABLED)
+		queue.submit(RenderQueue::EBackground, "gi sphere", State(TEXTURE_ONLY, GL_FRONT, GL_FILL, envTexture), Material(), GISphere, view, projection);
 
 	// Draw annotations
 	if (pinList != nullptr && !pinList->empty()) {
-		shader->setUniform("enableGI", false);
 		for (auto &p : *pinList)
-			p->draw(getViewMatrix(), getProjectionMatrix());
-		shader->setUniform("enableGI", true);
+			queue.submit(RenderQueue::EOpaque, "pins", State(), Material(p->getColor()), *p, view, projection);
 	}
 
 	// Bounding box
-	if (Settings::getInstance().MESH_DISPLAY_BBOX) {
-		glDisable(GL_CULL_FACE);
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		shader->setUniform("simpleColor", true);
-		shader->setUniform("materialColor", Vector3f(0.8980f, 0.f, 0.16862f));
-		shader->setUniform("alpha", clamp(Settings::getInstance().BBOX_ALPHA_BLEND));
-
+	if (bboxDisplay) {
 		bbox.update(mesh->getBoundingBox().min, mesh->getBoundingBox().max);
-		bbox.draw(getViewMatrix(), getProjectionMatrix());
-
-		shader->setUniform("materialColor", Settings::getInstance().MATERIAL_COLOR);
-		shader->setUniform("simpleColor", false);
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-		glEnable(GL_CULL_FACE);
+		queue.submit(RenderQueue::ETranslucent, "bbox", State(SIMPLE_COLOR, GL_NONE, GL_LINE),
+			Material(Vector3f(0.8980f, 0.f, 0.16862f), clamp(bboxAlpha)), bbox, view, projection);
 	}
 
 	// Rotation sphere
-	if ((Settings::getInstance().USE_LEAP && Settings::getInstance().SPHERE_DISPLAY && Settings::getInstance().ENABLE_SPHERE) || Settings::getInstance().SPHERE_VISUAL_HINT) {
-		glDisable(GL_CULL_FACE);
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		shader->setUniform("simpleColor", true);
-		shader->setUniform("materialColor", Vector3f(0.28627f, 0.26666f, 0.26274f));
-		if (Settings::getInstance().SPHERE_VISUAL_HINT)
-			shader->setUniform("materialColor", Settings::getInstance().SPHERE_VISUAL_HINT_COLOR);
+	if ((settings.USE_LEAP && gestures.rotating && settings.ENABLE_SPHERE) || gestures.sphereHint) {
+		State lines(SIMPLE_COLOR, GL_NONE, GL_LINE);
+		Vector3f sphereColor = gestures.sphereHint ? settings.SPHERE_VISUAL_HINT_COLOR : Vector3f(0.28627f, 0.26666f, 0.26274f);
 
 		// (Visual) Rotation sphere
-		shader->setUniform("alpha", clamp(Settings::getInstance().SPHERE_ALPHA_BLEND));
-		sphere.draw(getViewMatrix(), getProjectionMatrix());
-		
+		queue.submit(RenderQueue::ETranslucent, "rotation sphere", lines, Material(sphereColor, clamp(gestures.sphereAlpha)), sphere, view, projection);
+
 		// Debug spheres
-		if (Settings::getInstance().SHOW_DEBUG_SPHERES) {
-			// Large
-			shader->setUniform("alpha", 0.3f);
-			shader->setUniform("materialColor", Vector3f(0.4f, 0.4f, 0.4f));
-			sphere_large.draw(getViewMatrix(), getProjectionMatrix());
-
-			// Small
-			shader->setUniform("alpha", 0.3f);
-			shader->setUniform("materialColor", Vector3f(0.6f, 0.f, 0.f));
-			sphere_small.draw(getViewMatrix(), getProjectionMatrix());
+		if (settings.SHOW_DEBUG_SPHERES) {
+			queue.submit(RenderQueue::ETranslucent, "rotation sphere", lines, Material(Vector3f(0.4f, 0.4f, 0.4f), 0.3f), sphere_large, view, projection);
+			queue.submit(RenderQueue::ETranslucent, "rotation sphere", lines, Material(Vector3f(0.6f, 0.f, 0.f), 0.3f), sphere_small, view, projection);
 		}
-
-		shader->setUniform("simpleColor", false);
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-		glEnable(GL_CULL_FACE);
-	}
-
-	// Draw wireframe overlay
-	if (Settings::getInstance().MESH_DRAW_WIREFRAME) {
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		glEnable(GL_POLYGON_OFFSET_LINE);
-		glPolygonOffset(-1, -1);
-
-		shader->setUniform("simpleColor", true);
-		shader->setUniform("materialColor", Vector3f(0.2f, 0.2f, 0.2f));
-		shader->setUniform("alpha", 1.f);
-
-		mesh->draw(getViewMatrix(), getProjectionMatrix());
-
-		shader->setUniform("simpleColor", false);
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-		glDisable(GL_POLYGON_OFFSET_LINE);
 	}
 
 	// Draw hands
-	if (Settings::getInstance().USE_LEAP && Settings::getInstance().SHOW_HANDS) {
-		Settings::getInstance().MATERIAL_COLOR = Vector3f(1.f, 1.f, 1.f);
-		shader->setUniform("materialColor", Settings::getInstance().MATERIAL_COLOR);
-		float ambient = Settings::getInstance().LIGHT_AMBIENT;
-		glDisable(GL_CULL_FACE);
-		shader->setUniform("enableGI", false);
-		if (Settings::getInstance().GI_ENABLED && !Settings::getInstance().LEAP_USE_PASSTHROUGH) {
-			shader->setUniform("light.ambientCoefficient", 0.05f);
-			shader->setUniform("specular", true);
-			shader->setUniform("enableGI", true);
-		}
-
-		if (leftHand->visible) {
-			shader->setUniform("alpha", leftHand->confidence * Settings::getInstance().LEAP_ALPHA_SCALE);
-			if (Settings::getInstance().USE_RIFT && Settings::getInstance().LEAP_USE_PASSTHROUGH)
-				leftHand->draw(getLeapViewMatrix(), getProjectionMatrix());
-			else
-				leftHand->draw(getViewMatrix(), getProjectionMatrix());
+	if (settings.USE_LEAP && settings.SHOW_HANDS) {
+		color = Vector3f(1.f, 1.f, 1.f);
+		bool lit = settings.GI_ENABLED && !settings.LEAP_USE_PASSTHROUGH;
+		State state(lit ? SPECULAR | ENABLE_GI : 0, GL_NONE);
+		const Matrix4f *handView = settings.USE_RIFT && settings.LEAP_USE_PASSTHROUGH ? &getLeapViewMatrix() : &view;
+
+		for (auto &hand : { leftHand, rightHand }) {
+			if (!hand->visible)
+				continue;
+
+			hand->highlight(gestures.rotating, gestures.fingerColor);
+
+			Material material(color, hand->confidence * settings.LEAP_ALPHA_SCALE, lit ? 0.05f : 0.03f);
+			queue.submit(RenderQueue::ETranslucent, "hands", state, material, [hand, handView, &projection]() {
+				hand->draw(*handView, projection);
+			});
 		}
-
-		if (rightHand->visible) {
-			shader->setUniform("alpha", rightHand->confidence * Settings::getInstance().LEAP_ALPHA_SCALE);
-			if (Settings::getInstance().USE_RIFT && Settings::getInstance().LEAP_USE_PASSTHROUGH)
-				rightHand->draw(getLeapViewMatrix(), getProjectionMatrix());
-			else
-				rightHand->draw(getViewMatrix(), getProjectionMatrix());
-		}
-
-		shader->setUniform("light.ambientCoefficient", ambient);
-		shader->setUniform("specular", false);
-		glEnable(GL_CULL_FACE);
 	}
 
 	// Draw the anchor point
- 	if (Settings::getInstance().SHOW_SOCKEL && Settings::getInstance().USE_RIFT && Settings::getInstance().GI_ENABLED) {
-		glDisable(GL_CULL_FACE);
+ 	if (settings.SHOW_SOCKEL && settings.USE_RIFT && settings.GI_ENABLED) {
 		if ((pedestal.getBoundingBox().overlaps(mesh->getBoundingBox()) || 
 			rightHand->containsBBox(pedestal.getBoundingBox()) || 
-			leftHand->containsBBox(pedestal.getBoundingBox())) && Settings::getInstance().SOCKEL_ALPHA_BLEND > 0.f)
+			leftHand->containsBBox(pedestal.getBoundingBox())) && pedestalAlpha > 0.f)
 			
-			Settings::getInstance().SOCKEL_ALPHA_BLEND -= 0.02f;
-		else if (Settings::getInstance().SOCKEL_ALPHA_BLEND <= 1.f)
-			Settings::getInstance().SOCKEL_ALPHA_BLEND += 0.02f;
+			pedestalAlpha -= 0.02f;
+		else if (pedestalAlpha <= 1.f)
+			pedestalAlpha += 0.02f;
 
-		shader->setUniform("alpha", clamp(Settings::getInstance().SOCKEL_ALPHA_BLEND));
-		pedestal.draw(getViewMatrix(), getProjectionMatrix());
-		glEnable(GL_CULL_FACE);
+		queue.submit(RenderQueue::ETranslucent, "pedestal", State(gi, GL_NONE),
+			Material(color, clamp(pedestalAlpha)), pedestal, view, projection);
 	}
+
+	queue.execute(*shader);
 }
 
 void PerspectiveRenderer::cleanUp () {
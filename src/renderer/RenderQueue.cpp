@@ -0,0 +1,140 @@
+#include "renderer/RenderQueue.hpp"
+#include "GPUProfiler.hpp"
+#include <cstring>
+
+VR_NAMESPACE_BEGIN
+
+/// State items a command could change: culling, culled faces, polygon mode, texture, program and material
+static const int StateItems = 6;
+
+void RenderQueue::submit(Layer layer, const char *pass, const State &state, const Material &material, Mesh &mesh, const Matrix4f &viewMatrix, const Matrix4f &projectionMatrix) {
+	Command &command = push(layer, pass, state, material);
+	command.mesh = &mesh;
+	command.viewMatrix = &viewMatrix;
+	command.projectionMatrix = &projectionMatrix;
+}
+
+void RenderQueue::submit(Layer layer, const char *pass, const State &state, const Material &material, const std::function<void()> &draw) {
+	Command &command = push(layer, pass, state, material);
+	command.draw = draw;
+}
+
+RenderQueue::Command &RenderQueue::push(Layer layer, const char *pass, const State &state, const Material &material) {
+	Command command;
+	command.pass = pass;
+	command.state = state;
+	command.material = indexOf(materials, material);
+	command.mesh = nullptr;
+	command.viewMatrix = command.projectionMatrix = nullptr;
+
+	// Layer | features | culling | polygon mode | texture | material | submission order
+	uint64_t key = uint64_t(layer) << 62;
+	if (layer != ETranslucent) {
+		uint64_t cull = state.cullFace == GL_NONE ? 0 : state.cullFace == GL_BACK ? 1 : state.cullFace == GL_FRONT ? 2 : 3;
+		key |= uint64_t(state.features & 0xFFFF) << 46;
+		key |= cull << 44;
+		key |= uint64_t(state.polygonMode == GL_LINE) << 43;
+		key |= uint64_t(std::min<size_t>(indexOf(textures, state.cubeMap), 0x3F)) << 37;
+		key |= uint64_t(std::min<size_t>(command.material, 0x3FF)) << 27;
+	}
+	command.key = key | uint64_t(commands.size());
+
+	commands.push_back(command);
+	return commands.back();
+}
+
+void RenderQueue::execute(GLShader &shader) {
+	std::sort(commands.begin(), commands.end(), [](const Command &a, const Command &b) { return a.key < b.key; });
+
+	// Nothing is known about the state before the first command
+	int culling = -1;
+	GLenum cullFace = GL_NONE, polygonMode = GL_NONE;
+	GLuint cubeMap = 0;
+	uint32_t program = ~0u;
+	size_t material = materials.size();
+	uint32_t changes = 0;
+	const char *pass = nullptr;
+
+	for (const Command &command : commands) {
+		const State &state = command.state;
+
+		// Passes interleave after sorting, the profiler sums the times of repeated passes
+		if (pass == nullptr || std::strcmp(pass, command.pass) != 0) {
+			GPUProfiler::getInstance().begin(command.pass);
+			pass = command.pass;
+		}
+
+		int cull = state.cullFace != GL_NONE;
+		if (cull != culling) {
+			if (cull)
+				glEnable(GL_CULL_FACE);
+			else
+				glDisable(GL_CULL_FACE);
+			culling = cull;
+			changes++;
+		}
+		if (cull && state.cullFace != cullFace) {
+			glCullFace(state.cullFace);
+			cullFace = state.cullFace;
+			changes++;
+		}
+
+		if (state.polygonMode != polygonMode) {
+			glPolygonMode(GL_FRONT_AND_BACK, state.polygonMode);
+			polygonMode = state.polygonMode;
+			changes++;
+		}
+
+		if (state.cubeMap != 0 && state.cubeMap != cubeMap) {
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_CUBE_MAP, state.cubeMap);
+			cubeMap = state.cubeMap;
+			changes++;
+		}
+
+		// Draws may leave other features behind, the variant is only switched if these differ from the bound one
+		shader.setFeatures(state.features);
+		shader.bind();
+		if (state.features != program) {
+			program = state.features;
+			changes++;
+		}
+
+		if (command.material != material) {
+			const Material &m = materials[command.material];
+			shader.setUniform("materialColor", m.color);
+			shader.setUniform("alpha", m.alpha);
+			shader.setUniform("light.ambientCoefficient", m.ambient);
+			material = command.material;
+			changes++;
+		}
+
+		if (command.mesh) {
+			command.mesh->draw(*command.viewMatrix, *command.projectionMatrix);
+		} else {
+			command.draw();
+
+			// The callback may have changed the uniforms and the variant
+			material = materials.size();
+			program = ~0u;
+		}
+	}
+
+	GPUProfiler::getInstance().end();
+
+	if (culling != 1)
+		glEnable(GL_CULL_FACE);
+	if (cullFace != GL_BACK)
+		glCullFace(GL_BACK);
+	if (polygonMode != GL_FILL)
+		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	shader.setFeatures(0);
+
+	GPUProfiler::getInstance().count("state changes skipped", double(StateItems * commands.size() - changes), double(StateItems * commands.size()));
+
+	commands.clear();
+	materials.clear();
+	textures.clear();
+}
+
+VR_NAMESPACE_END
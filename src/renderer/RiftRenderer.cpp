@@ -3,8 +3,10 @@
 VR_NAMESPACE_BEGIN
 
 RiftRenderer::RiftRenderer(std::shared_ptr<GLShader> &shader, float fov, float width, float height, float zNear, float zFar)
-: leapShader(nullptr), leapVAO(0), leapV_VBO(0), leapUV_VBO(0), leapF_VBO(0)
-, PerspectiveRenderer(shader, fov, width, height, zNear, zFar) {
+: leapShader(nullptr), leapVAO(0), leapV_VBO(0), leapUV_VBO(0), leapF_VBO(0), leapPBOIndex(0), leapFrameId(-1)
+, PerspectiveRenderer(shader, fov, width, height, zNear, zFar)
+, resolution(1000.f / 75.f, Settings::getInstance().DYNAMIC_RESOLUTION_MIN, Settings::getInstance().DYNAMIC_RESOLUTION_MAX)
+, resolutionSamples(0), eyeRenderPose(), trackingState() {
 
 	// Leap passthrough shader
 	leapShader = std::make_shared<GLShader>();
@@ -55,14 +57,15 @@ void RiftRenderer::preProcess() {
 	if (hmd == nullptr)
 		throw new std::runtime_error("HMD not set! Can't do pre necessary processing for the Rift");
 
-	// Generate framebuffers for left and right eye
-	OVR::Sizei texLeft = ovrHmd_GetFovTextureSize(hmd, ovrEye_Left, hmd->DefaultEyeFov[ovrEye_Left], 1.0f);
-	frameBuffer[ovrEye_Left].init(Vector2i(texLeft.w, texLeft.h), 0, true);
-	frameBuffer[ovrEye_Left].release();
-
-	OVR::Sizei texRight = ovrHmd_GetFovTextureSize(hmd, ovrEye_Right, hmd->DefaultEyeFov[ovrEye_Right], 1.0f);
-	frameBuffer[ovrEye_Right].init(Vector2i(texRight.w, texRight.h), 0, true);
-	frameBuffer[ovrEye_Right].release();
+	// Generate framebuffers for left and right eye, at the highest resolution the viewports may grow to
+	float density = Settings::getInstance().DYNAMIC_RESOLUTION ? Settings::getInstance().DYNAMIC_RESOLUTION_MAX : 1.0f;
+	for (int eye = 0; eye < ovrEye_Count; eye++) {
+		OVR::Sizei native = ovrHmd_GetFovTextureSize(hmd, ovrEyeType(eye), hmd->DefaultEyeFov[eye], 1.0f);
+		OVR::Sizei tex = ovrHmd_GetFovTextureSize(hmd, ovrEyeType(eye), hmd->DefaultEyeFov[eye], density);
+		eyeSize[eye] = Vector2i(native.w, native.h);
+		frameBuffer[eye].init(Vector2i(tex.w, tex.h), 0, true);
+		frameBuffer[eye].release();
+	}
 
 	// Configure the Rift to use OpenGL
 	cfg.OGL.Header.API = ovrRenderAPI_OpenGL;
@@ -96,14 +99,13 @@ void RiftRenderer::preProcess() {
 	// Upload leap shader data
 	leapShader->bind();
 
-	// Leap image textures
-	// Left
-	leapRawTexture[0] = GLFramebuffer::createTexture(640, 240);
-	leapDistortionTexture[0] = GLFramebuffer::createTexture(64, 64, false);
-
-	// Right
-	leapRawTexture[1] = GLFramebuffer::createTexture(640, 240);
-	leapDistortionTexture[1] = GLFramebuffer::createTexture(64, 64, false);
+	// Leap image textures, raw images are streamed through two PBOs each
+	for (int i = 0; i < 2; i++) {
+		std::tie(leapRawTexture[i], leapPBO[i][0], leapPBO[i][1]) = GLFramebuffer::createPBOTexture(640, 240, sizeof(uint8_t), 1);
+		leapImageSize[i] = Vector2i(640, 240);
+		leapPBOFilled[i] = false;
+		leapDistortionTexture[i] = GLFramebuffer::createTexture(64, 64, false);
+	}
 
 	// Upload geometry
 	uploadBackgroundCube();
@@ -120,68 +122,104 @@ void RiftRenderer::update(Matrix4f &s, Matrix4f &r, Matrix4f &t) {
 
 	// Leap passthrough
 	if (Settings::getInstance().LEAP_USE_PASSTHROUGH && leapController.isConnected()) {
-		if (Settings::getInstance().LEAP_USE_LISTENER)
-			frame = leapController.frame();
-		
-		static int lastWidthRight = 0, lastHeightRight = 0;
-		static int lastWidthLeft = 0, lastHeightLeft = 0;
-
-		if (frame.isValid()) {
-			Leap::Image left = frame.images()[0], right = frame.images()[1];
-
-			// Single channel 8bit map = GL_RED
-			glBindTexture(GL_TEXTURE_2D, leapRawTexture[0]);
-			if (lastWidthLeft == left.width() && lastHeightLeft == left.height()) {
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, left.width(), left.height(), GL_RED, GL_UNSIGNED_BYTE, left.data());
-			}else {
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, left.width(), left.height(), 0, GL_RED, GL_UNSIGNED_BYTE, left.data());
-				lastWidthLeft = left.width();
-				lastHeightLeft = left.height();
-			}
-
-			// 2 * 32bit (= 2 * 8bytes) = GL_RG32F for distortion calibration map
-			glBindTexture(GL_TEXTURE_2D, leapDistortionTexture[0]);
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, left.distortionWidth() / 2, left.distortionHeight(), GL_RG, GL_FLOAT, left.distortion());
-
-			// Single channel 8bit map = GL_RED
-			glBindTexture(GL_TEXTURE_2D, leapRawTexture[1]);
-			if (lastWidthRight == right.width() && lastHeightRight == right.height()) {
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, right.width(), right.height(), GL_RED, GL_UNSIGNED_BYTE, right.data());
-			}
-			else {
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, right.width(), right.height(), 0, GL_RED, GL_UNSIGNED_BYTE, right.data());
-				lastWidthRight = right.width();
-				lastHeightRight = right.height();
-			}
-
-			// 2 * 32bit (= 2 * 8bytes) = GL_RG32F for distortion calibration map
-			glBindTexture(GL_TEXTURE_2D, leapDistortionTexture[1]);
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, right.distortionWidth() / 2, right.distortionHeight(), GL_RG, GL_FLOAT, right.distortion());
+		// Nothing to upload if the Leap did not deliver a new frame since the last one
+		if (frame.isValid() && frame.id() != leapFrameId) {
+			leapFrameId = frame.id();
+			uploadLeapImage(0, frame.images()[0]);
+			uploadLeapImage(1, frame.images()[1]);
+			leapPBOIndex = 1 - leapPBOIndex;
+
+			// Other texture uploads read from client memory again
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 		}
 	}
 }
 
+void RiftRenderer::uploadLeapImage(int camera, const Leap::Image &image) {
+	int width = image.width(), height = image.height();
+	GLsizeiptr bytes = GLsizeiptr(width) * height * image.bytesPerPixel();
+	GLuint *pbo = leapPBO[camera];
+
+	// Single channel 8bit map = GL_RED, reallocate texture and PBOs if the image format changed
+	glBindTexture(GL_TEXTURE_2D, leapRawTexture[camera]);
+	if (leapImageSize[camera] != Vector2i(width, height)) {
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+		for (int i = 0; i < 2; i++) {
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
+			glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+		}
+		leapImageSize[camera] = Vector2i(width, height);
+		leapPBOFilled[camera] = false;
+	}
+
+	// DMA the image written during the last frame into the texture, the call returns immediately
+	if (leapPBOFilled[camera]) {
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[1 - leapPBOIndex]);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RED, GL_UNSIGNED_BYTE, 0);
+	}
+
+	// Copy the current image into the other PBO, orphaning avoids waiting for a pending transfer
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[leapPBOIndex]);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+	void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (dst) {
+		memcpy(dst, image.data(), bytes);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	}
+	leapPBOFilled[camera] = dst != nullptr;
+
+	// 2 * 32bit (= 2 * 8bytes) = GL_RG32F for distortion calibration map, only changes with the calibration
+	size_t distortionSize = size_t(image.distortionWidth()) * image.distortionHeight();
+	std::vector<float> &distortion = leapDistortion[camera];
+	if (distortion.size() != distortionSize || memcmp(distortion.data(), image.distortion(), distortionSize * sizeof(float)) != 0) {
+		distortion.assign(image.distortion(), image.distortion() + distortionSize);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glBindTexture(GL_TEXTURE_2D, leapDistortionTexture[camera]);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image.distortionWidth() / 2, image.distortionHeight(), GL_RG, GL_FLOAT, distortion.data());
+	}
+}
+
 void RiftRenderer::clear(Vector3f background) {
 	frameBuffer[0].clear();
 	frameBuffer[1].clear();
 }
 
-void RiftRenderer::draw() {
+double RiftRenderer::beginFrame() {
 	// Begin distortion rendering
-	ovrFrameTiming frameTiming = ovrHmd_BeginFrame(hmd, 0);
-	Settings::getInstance().FRAME_TIME = frameTiming.ScanoutMidpointSeconds;
+	ovrHmd_BeginFrame(hmd, 0);
 
-	// Get eye poses, feeding in correct IPD offset
+	// Get eye poses, feeding in correct IPD offset. The tracking state is predicted for the same scanout time
+	double time = ovr_GetTimeInSeconds();
 	ovrVector3f viewOffset[2] = { eyeRenderDesc[0].HmdToEyeViewOffset, eyeRenderDesc[1].HmdToEyeViewOffset };
-	ovrPosef eyeRenderPose[2];
-	ovrHmd_GetEyePoses(hmd, 0, viewOffset, eyeRenderPose, NULL);
+	ovrHmd_GetEyePoses(hmd, 0, viewOffset, eyeRenderPose, &trackingState);
+
+	return time;
+}
+
+void RiftRenderer::draw() {
+	// Resolution scale from the GPU time of the newest measured frame, each sample is only used once
+	if (Settings::getInstance().DYNAMIC_RESOLUTION) {
+		float frameTime;
+		uint64_t samples = GPUProfiler::getInstance().latestPasses(frameTime);
+		if (samples != resolutionSamples) {
+			resolutionSamples = samples;
+			resolution.update(frameTime);
+		}
+	}
 
 	// Render for each eye
 	for (int eyeIndex = 0; eyeIndex < ovrEye_Count; eyeIndex++) {
 		ovrEyeType eye = hmd->EyeRenderOrder[eyeIndex];
 
-		// Bind framebuffer of current eye for off screen rendering
+		// Bind framebuffer of current eye for off screen rendering, the distortion pass samples the viewport only.
+		// The scale is a pixel density like the one the texture was sized with, rounding may differ by a pixel
 		frameBuffer[eye].bind();
+		Vector2i viewport = frameBuffer[eye].mSize;
+		if (Settings::getInstance().DYNAMIC_RESOLUTION)
+			viewport = resolution.viewport(eyeSize[eye]).cwiseMin(viewport);
+		glViewport(0, 0, viewport.x(), viewport.y());
+		eyeTexture[eye].OGL.Header.RenderViewport.Size = OVR::Sizei(viewport.x(), viewport.y());
 
 		// Use data from rift sensors
 		OVR::Matrix4f finalRollPitchYaw = rollPitchYaw * OVR::Matrix4f(eyeRenderPose[eye].Orientation);
@@ -214,15 +252,26 @@ void RiftRenderer::draw() {
 			setViewMatrixLeap(vl);
 
 			// Draw Leap distorted image
+			GPUProfiler::Scope profile("leap passthrough");
 			leapShader->bind();
 			leapShader->setUniform("mvp", getProjectionMatrix());
 			drawOnCube(eye);
 		}
-		// Draw the mesh for each eye
+		// Draw the mesh for each eye, both keep their own level of detail
+		mesh->setLODView(eye == ovrEye_Left ? 0 : 1);
 		PerspectiveRenderer::draw();
+		mesh->setLODView(0);
+
+		// Profiler bars on top, visible in the HMD
+		if (Settings::getInstance().PROFILER_OVERLAY)
+			GPUProfiler::getInstance().drawOverlay(viewport.x(), viewport.y());
 	}
 	
-	// End SDK distortion mode
+}
+
+void RiftRenderer::present() {
+	// End SDK distortion mode, the SDK binds its own programs
+	GLShader::unbind();
 	ovrHmd_EndFrame(hmd, eyeRenderPose, &eyeTexture[0].Texture);
 }
 
@@ -302,12 +351,15 @@ void RiftRenderer::drawOnCube(ovrEyeType eye) {
 void RiftRenderer::cleanUp() {
 	PerspectiveRenderer::cleanUp();
 
-	if (Settings::getInstance().LEAP_USE_PASSTHROUGH) {
-		glDeleteBuffers(1, &leapV_VBO);
-		glDeleteBuffers(1, &leapUV_VBO);
-		glDeleteBuffers(1, &leapF_VBO);
-		glDeleteVertexArrays(1, &leapVAO);
-	}
+	// Created in preProcess() regardless of the passthrough setting
+	glDeleteBuffers(1, &leapV_VBO);
+	glDeleteBuffers(1, &leapUV_VBO);
+	glDeleteBuffers(1, &leapF_VBO);
+	glDeleteVertexArrays(1, &leapVAO);
+	for (int i = 0; i < 2; i++)
+		glDeleteBuffers(2, leapPBO[i]);
+	glDeleteTextures(2, leapRawTexture);
+	glDeleteTextures(2, leapDistortionTexture);
 }
 
 VR_NAMESPACE_END
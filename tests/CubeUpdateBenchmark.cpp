@@ -0,0 +1,106 @@
+#include "mesh/Cube.hpp"
+#include <chrono>
+#include <sstream>
+
+using namespace VR_NS;
+
+/**
+ * Times Cube::update against the path it replaced, no OpenGL needed
+ *
+ * The old update formatted the eight corners into a string, parsed them
+ * back and rebuilt every vertex position, it is kept here as reference.
+ * Its upload into the stream buffer is left out. Both paths must place
+ * the corners of the cube at the same positions. The timings are only
+ * printed, they depend on the machine and its load.
+ */
+
+static int failures = 0;
+
+#define CHECK(condition, message) \
+	if (!(condition)) { \
+		std::cout << "FAILED: " << message << " (" << #condition << ")" << std::endl; \
+		failures++; \
+	}
+
+/// Corner of each vertex of the unit cube, in the order Cube builds its vertices
+static const int Corners[24] = { 4, 0, 3, 7, 2, 6, 7, 3, 1, 5, 6, 2, 0, 4, 5, 1, 4, 7, 6, 5, 0, 1, 2, 3 };
+
+static const int OldIterations = 20000;
+static const int NewIterations = 2000000;
+
+/**
+ * @brief CPU part of the former Cube::update
+ */
+struct OldCube {
+	MatrixXf m_V = MatrixXf(3, 24);
+	BoundingBox3f m_bbox;
+
+	void update(const Vector3f &min, const Vector3f &max) {
+		std::string v =
+		std::to_string(max.x()) + " " + std::to_string(min.y()) + " " + std::to_string(min.z()) + "\n" +
+		std::to_string(max.x()) + " " + std::to_string(min.y()) + " " + std::to_string(max.z()) + "\n" +
+		std::to_string(min.x()) + " " + std::to_string(min.y()) + " " + std::to_string(max.z()) + "\n" +
+		std::to_string(min.x()) + " " + std::to_string(min.y()) + " " + std::to_string(min.z()) + "\n" +
+		std::to_string(max.x()) + " " + std::to_string(max.y()) + " " + std::to_string(min.z()) + "\n" +
+		std::to_string(max.x()) + " " + std::to_string(max.y()) + " " + std::to_string(max.z()) + "\n" +
+		std::to_string(min.x()) + " " + std::to_string(max.y()) + " " + std::to_string(max.z()) + "\n" +
+		std::to_string(min.x()) + " " + std::to_string(max.y()) + " " + std::to_string(min.z()) + "\n";
+
+		std::istringstream is(v);
+		std::string line_str;
+		std::vector<Vector3f> newPos;
+		m_bbox.reset();
+		while (std::getline(is, line_str)) {
+			std::istringstream line(line_str);
+
+			Point3f p;
+			line >> p.x() >> p.y() >> p.z();
+			newPos.push_back(p);
+			m_bbox.expandBy(p);
+		}
+
+		for (uint32_t i = 0; i < m_V.cols(); ++i)
+			m_V.col(i) = newPos.at(Corners[i]);
+	}
+};
+
+/// Microseconds per call of update with a box which changes every call
+template <typename T> static double time(T &cube, int iterations) {
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++) {
+		float s = 1.f + float(i % 100) * 0.01f;
+		cube.update(Vector3f(-s, 0.f, -s), Vector3f(s, 2.f * s, s));
+	}
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / iterations;
+}
+
+int main() {
+	OldCube oldCube;
+	Cube cube;
+
+	double oldTime = time(oldCube, OldIterations);
+	double newTime = time(cube, NewIterations);
+	std::cout << "Old update: " << oldTime << " us, new update: " << newTime << " us" << std::endl;
+
+	// Same box on both, to_string keeps six decimals
+	Vector3f min(-0.25f, 0.5f, -1.5f), max(0.75f, 2.5f, 1.5f);
+	oldCube.update(min, max);
+	cube.update(min, max);
+	Matrix4f model = cube.getModelMatrix();
+	float error = 0.f;
+	for (int i = 0; i < 24; i++) {
+		Vector3f p = (model * cube.getVertexPositions().col(i).homogeneous()).head<3>();
+		error = std::max(error, (p - oldCube.m_V.col(i)).cwiseAbs().maxCoeff());
+	}
+	CHECK(error < 1e-5f, "corners differ from the old path");
+	CHECK(cube.getBoundingBox().min.isApprox(oldCube.m_bbox.min) && cube.getBoundingBox().max.isApprox(oldCube.m_bbox.max),
+		"bounding box differs from the old path");
+
+	if (failures > 0) {
+		std::cout << failures << " check(s) failed" << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed" << std::endl;
+	return 0;
+}
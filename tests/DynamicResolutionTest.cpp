@@ -0,0 +1,116 @@
+#include "renderer/DynamicResolution.hpp"
+#include <deque>
+
+using namespace VR_NS;
+
+/**
+ * Drives DynamicResolution with synthetic GPU times, no OpenGL needed
+ *
+ * The GPU time is proportional to the number of pixels, i.e. to the square
+ * of the scale, with a little noise. It is measured a few frames after the
+ * frame was issued, as with the timer queries of the GPUProfiler.
+ */
+
+static int failures = 0;
+
+#define CHECK(condition, message) \
+	if (!(condition)) { \
+		std::cout << "FAILED: " << message << " (" << #condition << ")" << std::endl; \
+		failures++; \
+	}
+
+/// Budget of the DK2 at 75 Hz in ms
+static const float Budget = 1000.f / 75.f;
+
+/// Samples in flight, as passed to the controller
+static const int Latency = 4;
+
+struct SyntheticGPU {
+	DynamicResolution controller;
+	std::deque<float> inFlight; ///< Scales of frames not measured yet
+	unsigned int seed = 1;
+
+	SyntheticGPU() : controller(Budget, 0.5f, 1.f, Latency) { }
+
+	/// Deterministic noise in [-5%, 5%]
+	float noise() {
+		seed = seed * 1664525u + 1013904223u;
+		return 0.05f * (float(seed >> 8) / float(1 << 24) * 2.f - 1.f);
+	}
+
+	/// Renders one frame with load ms at full scale and feeds the measurement of the oldest one
+	float frame(float load) {
+		inFlight.push_back(controller.getScale());
+		if (inFlight.size() <= size_t(Latency))
+			return controller.getScale();
+
+		float s = inFlight.front();
+		inFlight.pop_front();
+		return controller.update(load * s * s * (1.f + noise()));
+	}
+};
+
+struct Phase {
+	int overBudget = 0; ///< Frames measured over the budget
+	int lastOverBudget = -1; ///< Last frame measured over the budget
+	int ups = 0, downs = 0; ///< Scale changes by direction
+	float lowest = 1e9f, highest = -1e9f; ///< Range of the scale
+};
+
+static Phase run(SyntheticGPU &gpu, float load, int frames) {
+	Phase phase;
+	for (int i = 0; i < frames; i++) {
+		float before = gpu.controller.getScale();
+		float scale = gpu.frame(load);
+
+		if (load * before * before > Budget) {
+			phase.overBudget++;
+			phase.lastOverBudget = i;
+		}
+		if (scale > before)
+			phase.ups++;
+		if (scale < before)
+			phase.downs++;
+		phase.lowest = std::min(phase.lowest, scale);
+		phase.highest = std::max(phase.highest, scale);
+	}
+	return phase;
+}
+
+int main() {
+	SyntheticGPU gpu;
+
+	// Light load, full resolution throughout
+	Phase light = run(gpu, 0.6f * Budget, 300);
+	CHECK(light.ups == 0 && light.downs == 0, "scale changed under a light load");
+	CHECK(gpu.controller.getScale() == 1.f, "light load did not stay at full scale");
+
+	// Load doubles: the scale drops within a few frames and then holds still
+	Phase doubled = run(gpu, 1.2f * Budget, 600);
+	std::cout << "Doubled load: " << doubled.overBudget << " frames over budget, last at frame " << doubled.lastOverBudget
+		<< ", " << doubled.downs << " steps down, scale " << gpu.controller.getScale() << std::endl;
+	CHECK(doubled.lastOverBudget < 30, "did not settle below the budget within 30 frames");
+	CHECK(doubled.ups == 0, "scale oscillated under a constant load");
+	CHECK(doubled.lowest >= 0.5f && doubled.highest <= 1.f, "scale left its bounds");
+	CHECK(gpu.controller.getScale() < 1.f, "scale did not drop");
+
+	// Load halves again: the scale grows back to full resolution
+	Phase halved = run(gpu, 0.6f * Budget, 600);
+	std::cout << "Halved load: " << halved.ups << " steps up, scale " << gpu.controller.getScale() << std::endl;
+	CHECK(halved.downs == 0, "scale oscillated while recovering");
+	CHECK(halved.overBudget == 0, "recovery went over the budget");
+	CHECK(gpu.controller.getScale() == 1.f, "did not recover to full scale");
+
+	// Far too much load: the scale stops at its lower bound
+	Phase heavy = run(gpu, 10.f * Budget, 300);
+	CHECK(heavy.lowest >= 0.5f, "scale fell below the minimum");
+	CHECK(gpu.controller.getScale() == 0.5f, "scale did not reach the minimum");
+
+	std::cout << gpu.controller.info() << std::endl;
+	if (failures > 0) {
+		std::cout << failures << " check(s) failed" << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed" << std::endl;
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include "TripleBuffer.hpp"
+#include <thread>
+
+using namespace VR_NS;
+
+/**
+ * Stress test of TripleBuffer between a writer and a reader thread
+ *
+ * Every value fills a whole slot with its sequence number. The reader must
+ * only see complete values, in increasing order, and finally the last one.
+ * Build with VR_SANITIZE_THREAD to check for data races as well.
+ */
+
+static int failures = 0;
+
+#define CHECK(condition, message) \
+	if (!(condition)) { \
+		std::cout << "FAILED: " << message << " (" << #condition << ")" << std::endl; \
+		failures++; \
+	}
+
+/// Large enough that a torn copy would show up
+struct Value {
+	uint64_t sequence = 0;
+	uint64_t payload[64] = { };
+};
+
+static const uint64_t Values = 2000000;
+
+int main() {
+	TripleBuffer<Value> buffer;
+
+	std::thread writer([&buffer] {
+		for (uint64_t i = 1; i <= Values; i++) {
+			Value &value = buffer.write();
+			value.sequence = i;
+			for (uint64_t &p : value.payload)
+				p = i;
+			buffer.publish();
+
+			// Let the reader in between, values are still skipped
+			if (i % 16 == 0)
+				std::this_thread::yield();
+		}
+	});
+
+	uint64_t last = 0, updates = 0, torn = 0, reordered = 0;
+	while (last < Values) {
+		if (!buffer.update()) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		const Value &value = buffer.read();
+		for (uint64_t p : value.payload)
+			torn += p != value.sequence;
+		reordered += value.sequence <= last;
+		last = value.sequence;
+		updates++;
+	}
+	writer.join();
+
+	std::cout << "Read " << updates << " of " << Values << " published values" << std::endl;
+	CHECK(torn == 0, "read a partially written value");
+	CHECK(reordered == 0, "read an old or repeated value");
+	CHECK(last == Values, "did not read the last value");
+	CHECK(!buffer.update(), "update without a new value");
+
+	if (failures > 0) {
+		std::cout << failures << " check(s) failed" << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed" << std::endl;
+	return 0;
+}